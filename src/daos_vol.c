@@ -293,6 +293,9 @@ hbool_t H5_daos_bypass_duns_g = FALSE;
 /* Target chunk size for automatic chunking */
 uint64_t H5_daos_chunk_target_size_g = H5_DAOS_CHUNK_TARGET_SIZE_DEF;
 
+/* Maximum number of chunk I/O operations in flight */
+size_t H5_daos_chunk_io_max_in_flight_g = H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_DEF;
+
 /* Global scheduler - used for tasks that are not tied to any open file */
 tse_sched_t H5_daos_glob_sched_g;
 
@@ -337,6 +340,10 @@ const char H5_daos_vtype_g[]               = "Value Datatype";
 const char H5_daos_map_key_g[]             = "Map Record";
 const char H5_daos_blob_key_g[]            = "Blob";
 const char H5_daos_fillval_key_g[]         = "Fill Value";
+const char H5_daos_nkeys_key_g[]           = "Num Keys";
+const char H5_daos_bloom_info_key_g[]      = "Bloom Filter Info";
+const char H5_daos_bloom_key_g[]           = "Bloom Filter";
+const char H5_daos_packed_attr_key_g[]     = "Packed Attribute Layout";
 
 const daos_size_t H5_daos_int_md_key_size_g          = (daos_size_t)(sizeof(H5_daos_int_md_key_g) - 1);
 const daos_size_t H5_daos_root_grp_oid_key_size_g    = (daos_size_t)(sizeof(H5_daos_root_grp_oid_key_g) - 1);
@@ -356,6 +363,10 @@ const daos_size_t H5_daos_vtype_size_g               = (daos_size_t)(sizeof(H5_d
 const daos_size_t H5_daos_map_key_size_g             = (daos_size_t)(sizeof(H5_daos_map_key_g) - 1);
 const daos_size_t H5_daos_blob_key_size_g            = (daos_size_t)(sizeof(H5_daos_blob_key_g) - 1);
 const daos_size_t H5_daos_fillval_key_size_g         = (daos_size_t)(sizeof(H5_daos_fillval_key_g) - 1);
+const daos_size_t H5_daos_nkeys_key_size_g           = (daos_size_t)(sizeof(H5_daos_nkeys_key_g) - 1);
+const daos_size_t H5_daos_bloom_info_key_size_g      = (daos_size_t)(sizeof(H5_daos_bloom_info_key_g) - 1);
+const daos_size_t H5_daos_bloom_key_size_g           = (daos_size_t)(sizeof(H5_daos_bloom_key_g) - 1);
+const daos_size_t H5_daos_packed_attr_key_size_g     = (daos_size_t)(sizeof(H5_daos_packed_attr_key_g) - 1);
 
 
 /*-------------------------------------------------------------------------
@@ -683,245 +694,1666 @@ H5daos_get_object_class(hid_t plist_id, char *object_class, size_t size)
             object_class[0] = '\0';
     } /* end else */
 
-    /* Set return value */
-    ret_value = (ssize_t)len;
+    /* Set return value */
+    ret_value = (ssize_t)len;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_object_class() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_root_open_object_class
+ *
+ * Purpose:     Sets the object class to use for opening the root group on
+ *              the provided file access property list.  This should match
+ *              the object class used to create the root group via
+ *              H5daos_set_object_class().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_root_open_object_class(hid_t fapl_id, char *object_class)
+{
+    htri_t      is_fapl;
+    char        *copied_object_class = NULL;
+    htri_t      prop_exists;
+    herr_t      ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object class property");
+
+    /* Copy object class */
+    if(object_class)
+        if(NULL == (copied_object_class = strdup(object_class)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't copy object class string");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME, &copied_object_class) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set property");
+    } /* end if */
+    else
+        if(H5Pinsert2(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME, sizeof(char *),
+                &copied_object_class, NULL, NULL,
+                H5_daos_str_prop_delete, H5_daos_str_prop_copy,
+                H5_daos_str_prop_compare, H5_daos_str_prop_close) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_root_open_object_class() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_root_open_object_class
+ *
+ * Purpose:     Retrieves the object class for opening the root group from
+ *              the provided file access property list, as set by
+ *              H5daos_set_root_open_object_class().
+ *
+ *              If not NULL, object_class points to a user-allocated
+ *              output buffer, whose size is size.
+ *
+ * Return:      Success:        length of object class string (excluding
+ *                              null terminator)
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5daos_get_root_open_object_class(hid_t fapl_id, char *object_class, size_t size)
+{
+    htri_t      is_fapl;
+    char        *tmp_object_class = NULL;
+    htri_t      prop_exists;
+    size_t      len;
+    ssize_t     ret_value;
+
+    H5_daos_inc_api_cnt();
+
+    if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object class property");
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME, &tmp_object_class) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get object class");
+
+        /* Set output values */
+        if(tmp_object_class) {
+            len = strlen(tmp_object_class);
+            if(object_class && (size > 0)) {
+                strncpy(object_class, tmp_object_class, size);
+                if(len >= size)
+                    object_class[size - 1] = '\0';
+            } /* end if */
+        } /* end if */
+        else {
+            /* Simply return an empty string */
+            len = 0;
+            if(object_class && (size > 0))
+                object_class[0] = '\0';
+        } /* end else */
+    } /* end if */
+    else {
+        /* Simply return an empty string */
+        len = 0;
+        if(object_class && (size > 0))
+            object_class[0] = '\0';
+    } /* end else */
+
+    /* Set return value */
+    ret_value = (ssize_t)len;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_root_open_object_class() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_all_ind_metadata_ops
+ *
+ * Purpose:     Modifies the access property list to indicate that all
+ *              metadata I/O operations should be performed independently.
+ *              By default, metadata reads are independent and metadata
+ *              writes are collective.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_all_ind_metadata_ops(hid_t accpl_id, hbool_t is_independent)
+{
+    htri_t is_fapl;
+    htri_t is_lapl;
+    htri_t is_rapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(accpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_fapl = H5Pisa_class(accpl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if((is_lapl = H5Pisa_class(accpl_id, H5P_LINK_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if((is_rapl = H5Pisa_class(accpl_id, H5P_REFERENCE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_fapl && !is_lapl && !is_rapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an access property list");
+
+    /* Check if the independent metadata writes property already exists on the property list */
+    if((prop_exists = H5Pexist(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for independent metadata I/O property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME, &is_independent) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set independent metadata I/O property");
+    } /* end if */
+    else
+        if(H5Pinsert2(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME, sizeof(hbool_t),
+                &is_independent, NULL, NULL, NULL, NULL,
+                H5_daos_bool_prop_compare, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_all_ind_metadata_ops() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_all_ind_metadata_ops
+ *
+ * Purpose:     Retrieves the independent metadata I/O setting from the
+ *              access property list accpl_id.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_all_ind_metadata_ops(hid_t accpl_id, hbool_t *is_independent)
+{
+    htri_t is_fapl;
+    htri_t is_lapl;
+    htri_t is_rapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if((is_fapl = H5Pisa_class(accpl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if((is_lapl = H5Pisa_class(accpl_id, H5P_LINK_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if((is_rapl = H5Pisa_class(accpl_id, H5P_REFERENCE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_fapl && !is_lapl && !is_rapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an access property list");
+
+    /* Check if the independent metadata writes property exists on the property list */
+    if((prop_exists = H5Pexist(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for independent metadata I/O property");
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME, is_independent) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get independent metadata I/O property");
+    } /* end if */
+    else {
+        /* Simply return FALSE as not all metadata I/O
+         * operations are independent by default. */
+        *is_independent = FALSE;
+    } /* end else */
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_all_ind_metadata_ops() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_chunk_io_max_in_flight
+ *
+ * Purpose:     Modifies the dataset transfer property list to limit the
+ *              number of chunk I/O operations in flight at once for a
+ *              single dataset read or write.  When more chunks than this
+ *              are selected, operations on later chunks are started as
+ *              earlier ones complete.  0 means no limit.  Overrides the
+ *              H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT environment variable.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_chunk_io_max_in_flight(hid_t dxpl_id, size_t max_in_flight)
+{
+    htri_t is_dxpl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(dxpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_dxpl = H5Pisa_class(dxpl_id, H5P_DATASET_XFER)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_dxpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list");
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for chunk I/O window property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME, &max_in_flight) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk I/O window property");
+    } /* end if */
+    else
+        if(H5Pinsert2(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME, sizeof(size_t),
+                &max_in_flight, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_chunk_io_max_in_flight() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_chunk_io_max_in_flight
+ *
+ * Purpose:     Retrieves the maximum number of chunk I/O operations in
+ *              flight from the dataset transfer property list dxpl_id.
+ *              If it was not set on dxpl_id, returns the value that will
+ *              be used instead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_chunk_io_max_in_flight(hid_t dxpl_id, size_t *max_in_flight)
+{
+    htri_t is_dxpl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!max_in_flight)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "max_in_flight is NULL");
+
+    if(dxpl_id != H5P_DEFAULT) {
+        if((is_dxpl = H5Pisa_class(dxpl_id, H5P_DATASET_XFER)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_dxpl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list");
+
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for chunk I/O window property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME, max_in_flight) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk I/O window property");
+    } /* end if */
+    else
+        *max_in_flight = H5_daos_chunk_io_max_in_flight_g;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_chunk_io_max_in_flight() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_chunk_cache
+ *
+ * Purpose:     Modifies the dataset access property list to give datasets
+ *              opened or created with it a chunk cache of up to nbytes
+ *              bytes.  The cache holds whole chunks in memory so small
+ *              reads and writes do not each go to DAOS.  Writes are kept
+ *              in the cache and written to DAOS when the chunk is
+ *              evicted, when the dataset or its file is flushed, or when
+ *              the dataset is refreshed or closed.  The cache is only used for chunked datasets
+ *              without filters and with fixed size datatypes.  The cache
+ *              is local to each process.  0 (the default) disables the
+ *              cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_chunk_cache(hid_t dapl_id, size_t nbytes)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(dapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_dapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for chunk cache size property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME, &nbytes) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk cache size property");
+    } /* end if */
+    else
+        if(H5Pinsert2(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME, sizeof(size_t),
+                &nbytes, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_chunk_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_chunk_cache
+ *
+ * Purpose:     Retrieves the chunk cache size from the dataset access
+ *              property list dapl_id.  Returns 0 if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_chunk_cache(hid_t dapl_id, size_t *nbytes)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!nbytes)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nbytes is NULL");
+
+    if(H5_daos_get_chunk_cache_nbytes(dapl_id, nbytes) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache size");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_chunk_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_chunk_cache_nbytes
+ *
+ * Purpose:     Internal routine to retrieve the chunk cache size from the
+ *              dataset access property list dapl_id.  Sets *nbytes to 0
+ *              if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_get_chunk_cache_nbytes(hid_t dapl_id, size_t *nbytes)
+{
+    htri_t is_dapl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    assert(nbytes);
+
+    if(dapl_id != H5P_DEFAULT && dapl_id != H5P_DATASET_ACCESS_DEFAULT) {
+        if((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_dapl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for chunk cache size property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME, nbytes) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache size property");
+    } /* end if */
+    else
+        *nbytes = 0;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_chunk_cache_nbytes() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_tconv_nthreads
+ *
+ * Purpose:     Modifies the file access property list to give files
+ *              opened or created with it a pool of nthreads worker
+ *              threads for datatype conversion.  When reading a dataset
+ *              with a conversion the connector can perform without HDF5
+ *              (such as between native integer or floating point types
+ *              of different sizes), each chunk is converted and scattered
+ *              to the read buffer by a worker thread once its fetch
+ *              completes, while other fetches continue.  0 (the default)
+ *              disables the thread pool.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_tconv_nthreads(hid_t fapl_id, unsigned nthreads)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for type conversion thread count property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME, &nthreads) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set type conversion thread count property");
+    } /* end if */
+    else
+        if(H5Pinsert2(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME, sizeof(unsigned),
+                &nthreads, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_tconv_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_tconv_nthreads
+ *
+ * Purpose:     Retrieves the number of type conversion worker threads
+ *              from the file access property list fapl_id.  Returns 0 if
+ *              it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_tconv_nthreads(hid_t fapl_id, unsigned *nthreads)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!nthreads)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nthreads is NULL");
+
+    if(H5_daos_get_tconv_nthreads(fapl_id, nthreads) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get type conversion thread count");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_tconv_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_tconv_nthreads
+ *
+ * Purpose:     Internal routine to retrieve the number of type conversion
+ *              worker threads from the file access property list
+ *              fapl_id.  Sets *nthreads to 0 if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_get_tconv_nthreads(hid_t fapl_id, unsigned *nthreads)
+{
+    htri_t is_fapl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    assert(nthreads);
+
+    if(fapl_id != H5P_DEFAULT && fapl_id != H5P_FILE_ACCESS_DEFAULT) {
+        if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_fapl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for type conversion thread count property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME, nthreads) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get type conversion thread count property");
+    } /* end if */
+    else
+        *nthreads = 0;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_tconv_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_inline_vl
+ *
+ * Purpose:     Modifies the file access property list to store variable
+ *              length values (and other blobs) of at most 15 bytes in
+ *              their blob IDs in files opened or created with it, instead
+ *              of in separate blob records.  Such values are then written
+ *              and read with the dataset, attribute or map record that
+ *              refers to them, with no additional I/O.  Files written
+ *              this way can only be read by versions of the connector
+ *              that understand inline blob IDs.  Reading inline values
+ *              does not require this setting.  The default is FALSE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_inline_vl(hid_t fapl_id, hbool_t inline_vl)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_INLINE_VL_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for inline variable length property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(fapl_id, H5_DAOS_INLINE_VL_PROP_NAME, &inline_vl) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set inline variable length property");
+    } /* end if */
+    else
+        if(H5Pinsert2(fapl_id, H5_DAOS_INLINE_VL_PROP_NAME, sizeof(hbool_t),
+                &inline_vl, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_inline_vl() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_inline_vl
+ *
+ * Purpose:     Retrieves whether short variable length values are stored
+ *              inline from the file access property list fapl_id.
+ *              Returns FALSE if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_inline_vl(hid_t fapl_id, hbool_t *inline_vl)
+{
+    htri_t is_fapl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!inline_vl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "inline_vl is NULL");
+
+    if(fapl_id != H5P_DEFAULT && fapl_id != H5P_FILE_ACCESS_DEFAULT) {
+        if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_fapl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(fapl_id, H5_DAOS_INLINE_VL_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for inline variable length property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(fapl_id, H5_DAOS_INLINE_VL_PROP_NAME, inline_vl) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get inline variable length property");
+    } /* end if */
+    else
+        *inline_vl = FALSE;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_inline_vl() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_path_cache
+ *
+ * Purpose:     Modifies the file access property list to give files
+ *              opened or created with it a cache of up to nents resolved
+ *              group paths.  When a path is traversed, the group at the
+ *              longest cached prefix of the path is opened directly,
+ *              skipping the link lookups and opens of the groups before
+ *              it.  The cache is invalidated when a link is deleted or
+ *              moved through the file, but not when another process
+ *              changes the file, so if ttl is positive, entries older
+ *              than ttl seconds are not used.  This is mainly intended
+ *              for files opened read only while others may be writing.
+ *              If ttl is 0 entries do not expire.  An nents of 0 (the
+ *              default) disables the cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_path_cache(hid_t fapl_id, size_t nents, double ttl)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+    if(ttl < 0.0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "path cache entry lifetime must not be negative");
+
+    if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the properties already exist on the property list */
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_PATH_CACHE_NENTS_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for path cache size property");
+
+    /* Set the properties, or insert them if they do not exist.  The two
+     * properties are always set together. */
+    if(prop_exists) {
+        if(H5Pset(fapl_id, H5_DAOS_PATH_CACHE_NENTS_PROP_NAME, &nents) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set path cache size property");
+        if(H5Pset(fapl_id, H5_DAOS_PATH_CACHE_TTL_PROP_NAME, &ttl) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set path cache entry lifetime property");
+    } /* end if */
+    else {
+        if(H5Pinsert2(fapl_id, H5_DAOS_PATH_CACHE_NENTS_PROP_NAME, sizeof(size_t),
+                &nents, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+        if(H5Pinsert2(fapl_id, H5_DAOS_PATH_CACHE_TTL_PROP_NAME, sizeof(double),
+                &ttl, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+    } /* end else */
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_path_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_path_cache
+ *
+ * Purpose:     Retrieves the path cache settings from the file access
+ *              property list fapl_id.  Returns 0 for both if they were
+ *              not set.  Either of nents and ttl may be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_path_cache(hid_t fapl_id, size_t *nents, double *ttl)
+{
+    htri_t is_fapl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(fapl_id != H5P_DEFAULT && fapl_id != H5P_FILE_ACCESS_DEFAULT) {
+        if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_fapl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+        /* Check if the properties exist on the property list */
+        if((prop_exists = H5Pexist(fapl_id, H5_DAOS_PATH_CACHE_NENTS_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for path cache size property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the properties */
+        if(nents && H5Pget(fapl_id, H5_DAOS_PATH_CACHE_NENTS_PROP_NAME, nents) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get path cache size property");
+        if(ttl && H5Pget(fapl_id, H5_DAOS_PATH_CACHE_TTL_PROP_NAME, ttl) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get path cache entry lifetime property");
+    } /* end if */
+    else {
+        if(nents)
+            *nents = 0;
+        if(ttl)
+            *ttl = 0.0;
+    } /* end else */
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_path_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_object_cache
+ *
+ * Purpose:     Modifies the file access property list to give files
+ *              opened or created with it an object metadata cache.  The
+ *              internal metadata (datatype, dataspace and creation
+ *              properties) fetched when a dataset or group is opened is
+ *              kept, by OID, while the object is open and for the nclosed
+ *              most recently closed objects, and opening the object again
+ *              uses it instead of fetching it.  Changes made through the
+ *              file (such as H5Dset_extent) update the cache, but changes
+ *              made by other processes are not seen until the entry is
+ *              evicted.  An nclosed of 0 (the default) disables the cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_object_cache(hid_t fapl_id, size_t nclosed)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_OBJ_CACHE_NCLOSED_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object metadata cache size property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(fapl_id, H5_DAOS_OBJ_CACHE_NCLOSED_PROP_NAME, &nclosed) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object metadata cache size property");
+    } /* end if */
+    else if(H5Pinsert2(fapl_id, H5_DAOS_OBJ_CACHE_NCLOSED_PROP_NAME, sizeof(size_t),
+            &nclosed, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_object_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_object_cache
+ *
+ * Purpose:     Retrieves the number of closed objects kept in the object
+ *              metadata cache from the file access property list fapl_id.
+ *              Returns 0 if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_object_cache(hid_t fapl_id, size_t *nclosed)
+{
+    htri_t is_fapl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!nclosed)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nclosed is NULL");
+
+    if(fapl_id != H5P_DEFAULT && fapl_id != H5P_FILE_ACCESS_DEFAULT) {
+        if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_fapl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(fapl_id, H5_DAOS_OBJ_CACHE_NCLOSED_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object metadata cache size property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(fapl_id, H5_DAOS_OBJ_CACHE_NCLOSED_PROP_NAME, nclosed) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get object metadata cache size property");
+    } /* end if */
+    else
+        *nclosed = 0;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_object_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_map_key_count
+ *
+ * Purpose:     Modifies the map creation property list to make maps
+ *              created with it keep a persistent count of their keys.
+ *              Putting a new key increments the count and deleting a key
+ *              decrements it, so H5Mget_count() only needs to read the
+ *              count instead of iterating over every key.  Each put or
+ *              delete then checks whether the key exists, writes or
+ *              deletes it and updates the count in one DAOS transaction,
+ *              which costs extra round trips and is retried when it
+ *              conflicts with another update of the map, so the count is
+ *              exact with any number of writers.  Maps created without
+ *              this setting are counted by iteration.  The default is
+ *              FALSE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_map_key_count(hid_t mcpl_id, hbool_t track_key_count)
+{
+    htri_t is_mcpl;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(mcpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_mcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+
+    if(H5_daos_set_map_key_count_prop(mcpl_id, track_key_count) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map key count property");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_map_key_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_map_key_count
+ *
+ * Purpose:     Retrieves whether maps keep a persistent count of their
+ *              keys from the map creation property list mcpl_id.
+ *              Returns FALSE if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_map_key_count(hid_t mcpl_id, hbool_t *track_key_count)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!track_key_count)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "track_key_count is NULL");
+
+    if(H5_daos_get_map_key_count_prop(mcpl_id, track_key_count) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map key count property");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_map_key_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_set_map_key_count_prop
+ *
+ * Purpose:     Internal routine to set the map key count property on the
+ *              map creation property list mcpl_id.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_set_map_key_count_prop(hid_t mcpl_id, hbool_t track_key_count)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_KEY_COUNT_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for map key count property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(mcpl_id, H5_DAOS_MAP_KEY_COUNT_PROP_NAME, &track_key_count) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map key count property");
+    } /* end if */
+    else
+        if(H5Pinsert2(mcpl_id, H5_DAOS_MAP_KEY_COUNT_PROP_NAME, sizeof(hbool_t),
+                &track_key_count, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_set_map_key_count_prop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_map_key_count_prop
+ *
+ * Purpose:     Internal routine to retrieve the map key count property
+ *              from the map creation property list mcpl_id.  Sets
+ *              *track_key_count to FALSE if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_get_map_key_count_prop(hid_t mcpl_id, hbool_t *track_key_count)
+{
+    htri_t is_mcpl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    assert(track_key_count);
+
+    if(mcpl_id != H5P_DEFAULT && mcpl_id != H5P_MAP_CREATE_DEFAULT) {
+        if((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_mcpl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_KEY_COUNT_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for map key count property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(mcpl_id, H5_DAOS_MAP_KEY_COUNT_PROP_NAME, track_key_count) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map key count property");
+    } /* end if */
+    else
+        *track_key_count = FALSE;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_map_key_count_prop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_map_ordered_keys
+ *
+ * Purpose:     Modifies the map creation property list to make maps
+ *              created with it store their keys in order.  The key type
+ *              of such maps must be an unsigned 64 bit integer type.  The
+ *              keys are stored big endian in an object with lexically
+ *              ordered dkeys, so DAOS lists them in ascending order.
+ *              H5Miterate() then visits the keys in order (if the map's
+ *              object class has a single redundancy group), and
+ *              H5daos_map_iterate_range() can stop listing keys once it
+ *              is past the end of the range.  The map's key type is
+ *              reported as H5T_STD_U64BE.  The default is FALSE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_map_ordered_keys(hid_t mcpl_id, hbool_t ordered_keys)
+{
+    htri_t is_mcpl;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(mcpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_mcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+
+    if(H5_daos_set_map_ordered_keys_prop(mcpl_id, ordered_keys) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map ordered keys property");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_map_ordered_keys() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_map_ordered_keys
+ *
+ * Purpose:     Retrieves whether maps store their keys in order from the
+ *              map creation property list mcpl_id.  Returns FALSE if it
+ *              was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_map_ordered_keys(hid_t mcpl_id, hbool_t *ordered_keys)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!ordered_keys)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "ordered_keys is NULL");
+
+    if(H5_daos_get_map_ordered_keys_prop(mcpl_id, ordered_keys) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map ordered keys property");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_map_ordered_keys() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_set_map_ordered_keys_prop
+ *
+ * Purpose:     Internal routine to set the map ordered keys property on
+ *              the map creation property list mcpl_id.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_set_map_ordered_keys_prop(hid_t mcpl_id, hbool_t ordered_keys)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_ORDERED_KEYS_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for map ordered keys property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(mcpl_id, H5_DAOS_MAP_ORDERED_KEYS_PROP_NAME, &ordered_keys) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map ordered keys property");
+    } /* end if */
+    else
+        if(H5Pinsert2(mcpl_id, H5_DAOS_MAP_ORDERED_KEYS_PROP_NAME, sizeof(hbool_t),
+                &ordered_keys, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_set_map_ordered_keys_prop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_map_ordered_keys_prop
+ *
+ * Purpose:     Internal routine to retrieve the map ordered keys property
+ *              from the map creation property list mcpl_id.  Sets
+ *              *ordered_keys to FALSE if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_get_map_ordered_keys_prop(hid_t mcpl_id, hbool_t *ordered_keys)
+{
+    htri_t is_mcpl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    assert(ordered_keys);
+
+    if(mcpl_id != H5P_DEFAULT && mcpl_id != H5P_MAP_CREATE_DEFAULT) {
+        if((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_mcpl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_ORDERED_KEYS_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for map ordered keys property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(mcpl_id, H5_DAOS_MAP_ORDERED_KEYS_PROP_NAME, ordered_keys) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map ordered keys property");
+    } /* end if */
+    else
+        *ordered_keys = FALSE;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_map_ordered_keys_prop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_map_bloom_filter
+ *
+ * Purpose:     Modifies the map creation property list to give maps
+ *              created with it a bloom filter sized for expected_keys
+ *              keys.  The filter is stored with the map and loaded when
+ *              the map is opened, after which H5Mexists() can report
+ *              most keys that are not in the map without reading the
+ *              key.  Puts only update the handle's copy of the filter,
+ *              the bits are written back when the handle is closed or
+ *              H5daos_map_refresh_bloom_filter() is called.  Keys put
+ *              through other handles are therefore only found by
+ *              H5Mexists() once those handles wrote their bits back and
+ *              this handle was refreshed (or reopened).  Deleting a key
+ *              does not clear its bits, use
+ *              H5daos_map_rebuild_bloom_filter() to clear the bits of
+ *              deleted keys.
+ *              Passing 0 disables the filter, which is the default.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_map_bloom_filter(hid_t mcpl_id, hsize_t expected_keys)
+{
+    htri_t is_mcpl;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(mcpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_mcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+
+    if(H5_daos_set_map_bloom_filter_prop(mcpl_id, expected_keys) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map bloom filter property");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_map_bloom_filter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_map_bloom_filter
+ *
+ * Purpose:     Retrieves the number of keys maps' bloom filters are sized
+ *              for from the map creation property list mcpl_id.  Returns
+ *              0 if maps do not have a bloom filter.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_map_bloom_filter(hid_t mcpl_id, hsize_t *expected_keys)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!expected_keys)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "expected_keys is NULL");
+
+    if(H5_daos_get_map_bloom_filter_prop(mcpl_id, expected_keys) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map bloom filter property");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_map_bloom_filter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_set_map_bloom_filter_prop
+ *
+ * Purpose:     Internal routine to set the map bloom filter property on
+ *              the map creation property list mcpl_id.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_set_map_bloom_filter_prop(hid_t mcpl_id, hsize_t expected_keys)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_BLOOM_FILTER_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for map bloom filter property");
+
+    /* Set the property, or insert it if it does not exist */
+    if(prop_exists) {
+        if(H5Pset(mcpl_id, H5_DAOS_MAP_BLOOM_FILTER_PROP_NAME, &expected_keys) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map bloom filter property");
+    } /* end if */
+    else
+        if(H5Pinsert2(mcpl_id, H5_DAOS_MAP_BLOOM_FILTER_PROP_NAME, sizeof(hsize_t),
+                &expected_keys, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_set_map_bloom_filter_prop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_map_bloom_filter_prop
+ *
+ * Purpose:     Internal routine to retrieve the map bloom filter property
+ *              from the map creation property list mcpl_id.  Sets
+ *              *expected_keys to 0 if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_get_map_bloom_filter_prop(hid_t mcpl_id, hsize_t *expected_keys)
+{
+    htri_t is_mcpl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    assert(expected_keys);
+
+    if(mcpl_id != H5P_DEFAULT && mcpl_id != H5P_MAP_CREATE_DEFAULT) {
+        if((is_mcpl = H5Pisa_class(mcpl_id, H5P_MAP_CREATE)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_mcpl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a map creation property list");
+
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(mcpl_id, H5_DAOS_MAP_BLOOM_FILTER_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for map bloom filter property");
+    } /* end if */
+
+    if(prop_exists) {
+        /* Get the property */
+        if(H5Pget(mcpl_id, H5_DAOS_MAP_BLOOM_FILTER_PROP_NAME, expected_keys) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map bloom filter property");
+    } /* end if */
+    else
+        *expected_keys = 0;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_map_bloom_filter_prop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_sparse_crt_order_index
+ *
+ * Purpose:     Modifies the object creation property list to make
+ *              objects created with it keep sparse link and attribute
+ *              creation order indices.  Entries in a sparse index are
+ *              keyed by their permanent creation order value, and holes
+ *              left by deleted entries are counted in a small tree
+ *              stored with the index, so deleting a link or attribute
+ *              updates O(log n) keys instead of shifting every later
+ *              entry down, and lookups by index descend the tree in
+ *              O(log n).  The choice is recorded in the object's ID, so
+ *              it has no effect on the root group, whose ID is fixed.
+ *              Objects created without it (including all objects in
+ *              existing files) keep dense indices.  The default is
+ *              FALSE.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_sparse_crt_order_index(hid_t ocpl_id, hbool_t sparse)
+{
+    htri_t is_ocpl;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(ocpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_ocpl = H5Pisa_class(ocpl_id, H5P_OBJECT_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_ocpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an object creation property list");
+
+    if(H5_daos_set_sparse_crt_order_prop(ocpl_id, sparse) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set sparse creation order index property");
 
 done:
     D_FUNC_LEAVE_API;
-} /* end H5daos_get_object_class() */
+} /* end H5daos_set_sparse_crt_order_index() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5daos_set_root_open_object_class
+ * Function:    H5daos_get_sparse_crt_order_index
  *
- * Purpose:     Sets the object class to use for opening the root group on
- *              the provided file access property list.  This should match
- *              the object class used to create the root group via
- *              H5daos_set_object_class().
+ * Purpose:     Retrieves whether objects keep sparse creation order
+ *              indices from the object creation property list ocpl_id.
+ *              Returns FALSE if it was not set.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5daos_set_root_open_object_class(hid_t fapl_id, char *object_class)
+H5daos_get_sparse_crt_order_index(hid_t ocpl_id, hbool_t *sparse)
 {
-    htri_t      is_fapl;
-    char        *copied_object_class = NULL;
-    htri_t      prop_exists;
-    herr_t      ret_value = SUCCEED;
+    herr_t ret_value = SUCCEED;
 
     H5_daos_inc_api_cnt();
 
-    if(fapl_id == H5P_DEFAULT)
-        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+    if(!sparse)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "sparse is NULL");
 
-    if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if(!is_fapl)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if(H5_daos_get_sparse_crt_order_prop(ocpl_id, sparse) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get sparse creation order index property");
 
-    /* Check if the property already exists on the property list */
-    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME)) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object class property");
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_sparse_crt_order_index() */
 
-    /* Copy object class */
-    if(object_class)
-        if(NULL == (copied_object_class = strdup(object_class)))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't copy object class string");
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_set_sparse_crt_order_prop
+ *
+ * Purpose:     Internal routine to set the sparse creation order index
+ *              property on the object creation property list ocpl_id.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_set_sparse_crt_order_prop(hid_t ocpl_id, hbool_t sparse)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(ocpl_id, H5_DAOS_SPARSE_CRT_ORDER_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for sparse creation order index property");
 
     /* Set the property, or insert it if it does not exist */
     if(prop_exists) {
-        if(H5Pset(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME, &copied_object_class) < 0)
-            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set property");
+        if(H5Pset(ocpl_id, H5_DAOS_SPARSE_CRT_ORDER_PROP_NAME, &sparse) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set sparse creation order index property");
     } /* end if */
     else
-        if(H5Pinsert2(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME, sizeof(char *),
-                &copied_object_class, NULL, NULL,
-                H5_daos_str_prop_delete, H5_daos_str_prop_copy,
-                H5_daos_str_prop_compare, H5_daos_str_prop_close) < 0)
+        if(H5Pinsert2(ocpl_id, H5_DAOS_SPARSE_CRT_ORDER_PROP_NAME, sizeof(hbool_t),
+                &sparse, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
             D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
 done:
-    D_FUNC_LEAVE_API;
-} /* end H5daos_set_root_open_object_class() */
+    D_FUNC_LEAVE;
+} /* end H5_daos_set_sparse_crt_order_prop() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5daos_get_root_open_object_class
- *
- * Purpose:     Retrieves the object class for opening the root group from
- *              the provided file access property list, as set by
- *              H5daos_set_root_open_object_class().
+ * Function:    H5_daos_get_sparse_crt_order_prop
  *
- *              If not NULL, object_class points to a user-allocated
- *              output buffer, whose size is size.
+ * Purpose:     Internal routine to retrieve the sparse creation order
+ *              index property from the object creation property list
+ *              ocpl_id.  Sets *sparse to FALSE if it was not set.
  *
- * Return:      Success:        length of object class string (excluding
- *                              null terminator)
- *              Failure:        -1
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-ssize_t
-H5daos_get_root_open_object_class(hid_t fapl_id, char *object_class, size_t size)
+herr_t
+H5_daos_get_sparse_crt_order_prop(hid_t ocpl_id, hbool_t *sparse)
 {
-    htri_t      is_fapl;
-    char        *tmp_object_class = NULL;
-    htri_t      prop_exists;
-    size_t      len;
-    ssize_t     ret_value;
+    htri_t is_ocpl;
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
+    assert(sparse);
 
-    if((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if(!is_fapl)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+    if(ocpl_id != H5P_DEFAULT) {
+        if((is_ocpl = H5Pisa_class(ocpl_id, H5P_OBJECT_CREATE)) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+        if(!is_ocpl)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an object creation property list");
 
-    /* Check if the property already exists on the property list */
-    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME)) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object class property");
+        /* Check if the property exists on the property list */
+        if((prop_exists = H5Pexist(ocpl_id, H5_DAOS_SPARSE_CRT_ORDER_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for sparse creation order index property");
+    } /* end if */
 
     if(prop_exists) {
         /* Get the property */
-        if(H5Pget(fapl_id, H5_DAOS_ROOT_OPEN_OCLASS_NAME, &tmp_object_class) < 0)
-            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get object class");
-
-        /* Set output values */
-        if(tmp_object_class) {
-            len = strlen(tmp_object_class);
-            if(object_class && (size > 0)) {
-                strncpy(object_class, tmp_object_class, size);
-                if(len >= size)
-                    object_class[size - 1] = '\0';
-            } /* end if */
-        } /* end if */
-        else {
-            /* Simply return an empty string */
-            len = 0;
-            if(object_class && (size > 0))
-                object_class[0] = '\0';
-        } /* end else */
+        if(H5Pget(ocpl_id, H5_DAOS_SPARSE_CRT_ORDER_PROP_NAME, sparse) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get sparse creation order index property");
     } /* end if */
-    else {
-        /* Simply return an empty string */
-        len = 0;
-        if(object_class && (size > 0))
-            object_class[0] = '\0';
-    } /* end else */
-
-    /* Set return value */
-    ret_value = (ssize_t)len;
+    else
+        *sparse = FALSE;
 
 done:
-    D_FUNC_LEAVE_API;
-} /* end H5daos_get_root_open_object_class() */
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_sparse_crt_order_prop() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5daos_set_all_ind_metadata_ops
- *
- * Purpose:     Modifies the access property list to indicate that all
- *              metadata I/O operations should be performed independently.
- *              By default, metadata reads are independent and metadata
- *              writes are collective.
+ * Function:    H5daos_set_packed_attr_layout
+ *
+ * Purpose:     Modifies the attribute or file creation property list
+ *              plist_id to select the packed attribute metadata layout.
+ *              A packed attribute stores its datatype, dataspace, ACPL
+ *              and, if it is small, its raw data in a single akey, so
+ *              opening and reading it takes one fetch and creating it
+ *              takes one update.  When set on an ACPL it applies to the
+ *              attribute created with it.  When set on an FCPL it is
+ *              stored in the file and is the default for attributes
+ *              created through any handle for the file.
+ *              Attributes in either layout can always be opened.  The
+ *              default is FALSE.
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5daos_set_all_ind_metadata_ops(hid_t accpl_id, hbool_t is_independent)
+H5daos_set_packed_attr_layout(hid_t plist_id, hbool_t packed)
 {
-    htri_t is_fapl;
-    htri_t is_lapl;
-    htri_t is_rapl;
-    htri_t prop_exists;
+    htri_t is_acpl;
+    htri_t is_fcpl = FALSE;
     herr_t ret_value = SUCCEED;
 
     H5_daos_inc_api_cnt();
 
-    if(accpl_id == H5P_DEFAULT)
+    if(plist_id == H5P_DEFAULT)
         D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
 
-    if((is_fapl = H5Pisa_class(accpl_id, H5P_FILE_ACCESS)) < 0)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if((is_lapl = H5Pisa_class(accpl_id, H5P_LINK_ACCESS)) < 0)
+    if((is_acpl = H5Pisa_class(plist_id, H5P_ATTRIBUTE_CREATE)) < 0)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if((is_rapl = H5Pisa_class(accpl_id, H5P_REFERENCE_ACCESS)) < 0)
+    if(!is_acpl && (is_fcpl = H5Pisa_class(plist_id, H5P_FILE_CREATE)) < 0)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if(!is_fapl && !is_lapl && !is_rapl)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an access property list");
+    if(!is_acpl && !is_fcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an attribute or file creation property list");
+
+    if(H5_daos_set_packed_attr_layout_prop(plist_id, packed) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set packed attribute layout property");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_packed_attr_layout() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_packed_attr_layout
+ *
+ * Purpose:     Retrieves whether the packed attribute metadata layout is
+ *              selected on the attribute or file creation property list
+ *              plist_id.  Returns FALSE if it was not set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_packed_attr_layout(hid_t plist_id, hbool_t *packed)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!packed)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "packed is NULL");
+
+    *packed = FALSE;
+    if(H5_daos_get_packed_attr_layout_prop(plist_id, packed) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get packed attribute layout property");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_packed_attr_layout() */
 
-    /* Check if the independent metadata writes property already exists on the property list */
-    if((prop_exists = H5Pexist(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME)) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for independent metadata I/O property");
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_set_packed_attr_layout_prop
+ *
+ * Purpose:     Internal routine to set the packed attribute layout
+ *              property on the property list plist_id.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_set_packed_attr_layout_prop(hid_t plist_id, hbool_t packed)
+{
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    /* Check if the property already exists on the property list */
+    if((prop_exists = H5Pexist(plist_id, H5_DAOS_PACKED_ATTR_LAYOUT_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for packed attribute layout property");
 
     /* Set the property, or insert it if it does not exist */
     if(prop_exists) {
-        if(H5Pset(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME, &is_independent) < 0)
-            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set independent metadata I/O property");
+        if(H5Pset(plist_id, H5_DAOS_PACKED_ATTR_LAYOUT_PROP_NAME, &packed) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set packed attribute layout property");
     } /* end if */
     else
-        if(H5Pinsert2(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME, sizeof(hbool_t),
-                &is_independent, NULL, NULL, NULL, NULL,
-                H5_daos_bool_prop_compare, NULL) < 0)
+        if(H5Pinsert2(plist_id, H5_DAOS_PACKED_ATTR_LAYOUT_PROP_NAME, sizeof(hbool_t),
+                &packed, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
             D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
 
 done:
-    D_FUNC_LEAVE_API;
-} /* end H5daos_set_all_ind_metadata_ops() */
+    D_FUNC_LEAVE;
+} /* end H5_daos_set_packed_attr_layout_prop() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5daos_get_all_ind_metadata_ops
+ * Function:    H5_daos_get_packed_attr_layout_prop
  *
- * Purpose:     Retrieves the independent metadata I/O setting from the
- *              access property list accpl_id.
+ * Purpose:     Internal routine to retrieve the packed attribute layout
+ *              property from the property list plist_id.  Leaves
+ *              *packed unchanged if it was not set, so the caller can
+ *              pass in the default (e.g. the file's).
  *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5daos_get_all_ind_metadata_ops(hid_t accpl_id, hbool_t *is_independent)
+H5_daos_get_packed_attr_layout_prop(hid_t plist_id, hbool_t *packed)
 {
-    htri_t is_fapl;
-    htri_t is_lapl;
-    htri_t is_rapl;
-    htri_t prop_exists;
+    htri_t prop_exists = FALSE;
     herr_t ret_value = SUCCEED;
 
-    H5_daos_inc_api_cnt();
-
-    if((is_fapl = H5Pisa_class(accpl_id, H5P_FILE_ACCESS)) < 0)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if((is_lapl = H5Pisa_class(accpl_id, H5P_LINK_ACCESS)) < 0)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if((is_rapl = H5Pisa_class(accpl_id, H5P_REFERENCE_ACCESS)) < 0)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
-    if(!is_fapl && !is_lapl && !is_rapl)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an access property list");
+    assert(packed);
 
-    /* Check if the independent metadata writes property exists on the property list */
-    if((prop_exists = H5Pexist(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME)) < 0)
-        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for independent metadata I/O property");
+    /* Check if the property exists on the property list */
+    if(plist_id != H5P_DEFAULT)
+        if((prop_exists = H5Pexist(plist_id, H5_DAOS_PACKED_ATTR_LAYOUT_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for packed attribute layout property");
 
-    if(prop_exists) {
-        /* Get the property */
-        if(H5Pget(accpl_id, H5_DAOS_IND_MD_IO_PROP_NAME, is_independent) < 0)
-            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get independent metadata I/O property");
-    } /* end if */
-    else {
-        /* Simply return FALSE as not all metadata I/O
-         * operations are independent by default. */
-        *is_independent = FALSE;
-    } /* end else */
+    /* Get the property */
+    if(prop_exists)
+        if(H5Pget(plist_id, H5_DAOS_PACKED_ATTR_LAYOUT_PROP_NAME, packed) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get packed attribute layout property");
 
 done:
-    D_FUNC_LEAVE_API;
-} /* end H5daos_get_all_ind_metadata_ops() */
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_packed_attr_layout_prop() */
 
 
 /*-------------------------------------------------------------------------
@@ -1170,6 +2602,8 @@ H5_daos_init(hid_t H5VL_DAOS_UNUSED vipl_id)
     H5_daos_snap_id_t snap_id_default;
 #endif
     char *auto_chunk_str = NULL;
+    char *max_in_flight_str = NULL;
+    char *bufpool_size_str = NULL;
     int ret;
     herr_t ret_value = SUCCEED;            /* Return value */
 
@@ -1232,6 +2666,26 @@ H5_daos_init(hid_t H5VL_DAOS_UNUSED vipl_id)
         H5_daos_chunk_target_size_g = (uint64_t)chunk_target_size_ll;
     } /* end if */
 
+    /* Determine maximum number of chunk I/O operations in flight */
+    if(NULL != (max_in_flight_str = getenv("H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT"))) {
+        long long max_in_flight_ll;
+
+        errno = 0;
+        if((max_in_flight_ll = strtoll(max_in_flight_str, NULL, 10)) < 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "failed to parse maximum number of chunk I/O operations in flight from environment or invalid value (H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT)");
+        H5_daos_chunk_io_max_in_flight_g = (size_t)max_in_flight_ll;
+    } /* end if */
+
+    /* Determine maximum size of the type conversion buffer pool */
+    if(NULL != (bufpool_size_str = getenv("H5_DAOS_TCONV_BUF_POOL_SIZE"))) {
+        long long bufpool_size_ll;
+
+        errno = 0;
+        if((bufpool_size_ll = strtoll(bufpool_size_str, NULL, 10)) < 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "failed to parse type conversion buffer pool size from environment or invalid value (H5_DAOS_TCONV_BUF_POOL_SIZE)");
+        H5_daos_bufpool_set_max((size_t)bufpool_size_ll);
+    } /* end if */
+
     /* Initialize global scheduler */
     if(0 != (ret = tse_sched_init(&H5_daos_glob_sched_g, NULL, NULL)))
         D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create global task scheduler: %s", H5_daos_err_to_string(ret));
@@ -1244,6 +2698,10 @@ H5_daos_init(hid_t H5VL_DAOS_UNUSED vipl_id)
     if(H5_daos_fill_def_plist_cache() < 0)
         D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't populate HDF5 default property list cache");
 
+    /* Initialize filter class table */
+    if(H5_daos_filter_init() < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize filter pipeline");
+
     /* Initialized */
     H5_daos_initialized_g = TRUE;
 
@@ -1305,6 +2763,13 @@ H5_daos_term(void)
     /* Free default property list cache */
     DV_free((void *)H5_daos_plist_cache_g);
 
+    /* Free filter class table and close filter plugins */
+    if(H5_daos_filter_term() < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't terminate filter pipeline");
+
+    /* Free cached type conversion buffers */
+    H5_daos_bufpool_term();
+
     /* "Forget" connector id.  This should normally be called by the library
      * when it is closing the id, so no need to close it here. */
     H5_DAOS_g = H5I_INVALID_HID;
@@ -2716,11 +4181,42 @@ H5_daos_oid_encode(daos_obj_id_t *oid, uint64_t oidx, H5I_type_t obj_type,
         oid->hi = H5_DAOS_TYPE_MAP;
     } /* end else */
 
-    /* Set the object feature flags */
+    /* Set the object feature flags.  Maps with ordered keys use lexical
+     * dkeys so their (big endian) keys are listed in order. */
     if(H5I_GROUP == obj_type)
         object_feats = DAOS_OF_DKEY_LEXICAL | DAOS_OF_AKEY_LEXICAL;
     else
         object_feats = DAOS_OF_DKEY_HASHED | DAOS_OF_AKEY_LEXICAL;
+    if(H5I_MAP == obj_type && crt_plist_id != H5P_DEFAULT) {
+        hbool_t ordered_keys = FALSE;
+
+        if(H5_daos_get_map_ordered_keys_prop(crt_plist_id, &ordered_keys) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get map ordered keys property");
+        if(ordered_keys)
+            object_feats = DAOS_OF_DKEY_LEXICAL | DAOS_OF_AKEY_LEXICAL;
+    } /* end if */
+
+    /* Mark objects with sparse creation order indices.  The root group's oid
+     * is regenerated at file open without its creation property list, so it
+     * always uses dense indices. */
+    if(oidx >= H5_DAOS_OIDX_FIRST_USER && crt_plist_id != H5P_DEFAULT) {
+        hbool_t sparse_corder = FALSE;
+
+        if(H5_daos_get_sparse_crt_order_prop(crt_plist_id, &sparse_corder) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get sparse creation order index property");
+        if(sparse_corder)
+            oid->hi |= H5_DAOS_SPARSE_CORDER;
+    } /* end if */
+
+    /* Mark datasets that store filtered chunk records */
+    if(H5I_DATASET == obj_type && crt_plist_id != H5P_DEFAULT) {
+        htri_t filtered;
+
+        if((filtered = H5_daos_dset_dcpl_filtered_chunks(crt_plist_id)) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check dataset chunk format");
+        if(filtered)
+            oid->hi |= H5_DAOS_FILTERED_CHUNKS;
+    } /* end if */
 
     /* Check for object class set on crt_plist_id */
     /* Note we do not copy the oclass_str in the property callbacks (there is no
@@ -4096,7 +5592,13 @@ H5_daos_list_key_init(H5_daos_iter_data_t *iter_data, H5_daos_obj_t *target_obj,
     else
         assert(opc == DAOS_OPC_OBJ_LIST_DKEY);
     iter_udata->base_iter = base_iter;
-    memset(&iter_udata->anchor, 0, sizeof(iter_udata->anchor));
+
+    /* Start listing from the beginning unless the caller supplied an anchor
+     * (e.g. to list a single part of a split object) */
+    if(base_iter && iter_data->start_anchor)
+        iter_udata->anchor = *iter_data->start_anchor;
+    else
+        memset(&iter_udata->anchor, 0, sizeof(iter_udata->anchor));
 
     /* Copy iter_data if this is the base of iteration, otherwise point to
      * existing iter_data */
@@ -4832,6 +6334,10 @@ H5_daos_progress(H5_daos_req_t *req, uint64_t timeout)
             } /* end if */
         } /* end if */
 
+        /* Complete type conversion jobs finished by thread pools */
+        if(H5_daos_tpool_progress() < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress thread pool jobs");
+
         /* Progress DAOS */
         if((0 != (ret = daos_progress(&H5_daos_glob_sched_g,
                 timeout_rem > (1000000 * H5_DAOS_ASYNC_POLL_INTERVAL)
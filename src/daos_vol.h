@@ -39,6 +39,12 @@
 /* Task list */
 #include "util/daos_vol_task_list.h"
 
+/* Thread pool */
+#include "util/daos_vol_tpool.h"
+
+/* Buffer pool */
+#include "util/daos_vol_bufpool.h"
+
 /* For DAOS compatibility */
 typedef d_iov_t daos_iov_t;
 typedef d_sg_list_t daos_sg_list_t;
@@ -142,6 +148,26 @@ do { \
 /* Default target chunk size for automatic chunking */
 #define H5_DAOS_CHUNK_TARGET_SIZE_DEF ((uint64_t)(1024 * 1024))
 
+/* Default maximum number of chunk I/O operations in flight for a single
+ * dataset I/O call (0 means unlimited) */
+#define H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_DEF ((size_t)1024)
+
+/* Maximum number of keys in flight for a single multi-key map put or get
+ * call */
+#define H5_DAOS_MAP_MULTI_MAX_IN_FLIGHT ((size_t)1024)
+
+/* Default maximum number of bytes cached by the type conversion buffer
+ * pool */
+#define H5_DAOS_BUFPOOL_SIZE_DEF ((size_t)64 * 1024 * 1024)
+
+/* Maximum number of blob writes and bytes in a blob write batch before it is
+ * flushed */
+#define H5_DAOS_BLOB_BATCH_MAX_TASKS 256
+#define H5_DAOS_BLOB_BATCH_MAX_BYTES ((size_t)16 * 1024 * 1024)
+
+/* Maximum number of bytes of blobs prefetched for one type conversion */
+#define H5_DAOS_BLOB_PREFETCH_MAX_BYTES ((size_t)64 * 1024 * 1024)
+
 /* Initial allocation sizes */
 #define H5_DAOS_GH_BUF_SIZE 1024
 #define H5_DAOS_LINK_NAME_BUF_SIZE 2048
@@ -164,11 +190,24 @@ do { \
 /* Size of blob IDs */
 #define H5_DAOS_BLOB_ID_SIZE sizeof(uuid_t)
 
+/* Inline blobs.  A blob of at most H5_DAOS_BLOB_INLINE_MAX bytes may be
+ * stored in its blob ID instead of under a UUID.  The data fills the ID in
+ * order, skipping byte H5_DAOS_BLOB_INLINE_FLAG_POS which holds
+ * H5_DAOS_BLOB_INLINE_FLAG.  UUIDs always have their variant bits (10) in
+ * that byte, so can never be mistaken for inline blob IDs. */
+#define H5_DAOS_BLOB_INLINE_MAX (H5_DAOS_BLOB_ID_SIZE - 1)
+#define H5_DAOS_BLOB_INLINE_FLAG_POS 8
+#define H5_DAOS_BLOB_INLINE_FLAG 0xe0
+#define H5_DAOS_BLOB_IS_INLINE(blob_id) \
+    (((const uint8_t *)(blob_id))[H5_DAOS_BLOB_INLINE_FLAG_POS] == H5_DAOS_BLOB_INLINE_FLAG)
+
 /* Sizes of objects on storage */
 #define H5_DAOS_ENCODED_OID_SIZE       16
 #define H5_DAOS_ENCODED_CRT_ORDER_SIZE 8
 #define H5_DAOS_ENCODED_NUM_ATTRS_SIZE 8
 #define H5_DAOS_ENCODED_NUM_LINKS_SIZE 8
+#define H5_DAOS_ENCODED_NUM_KEYS_SIZE  8
+#define H5_DAOS_ENCODED_BLOOM_INFO_SIZE 24
 #define H5_DAOS_ENCODED_RC_SIZE        8
 
 /* Size of encoded OID */
@@ -187,6 +226,21 @@ do { \
 #define H5_DAOS_TYPE_DTYPE  0x0000000080000000ull
 #define H5_DAOS_TYPE_MAP    0x00000000c0000000ull
 
+/* Bit in oid.hi set for objects whose link and attribute creation order
+ * indices are keyed by permanent creation order value and may contain holes
+ * (see H5daos_set_sparse_crt_order_index()) */
+#define H5_DAOS_SPARSE_CORDER 0x0000000020000000ull
+#define H5_DAOS_OBJ_SPARSE_CORDER(obj) \
+    (((obj)->oid.hi & H5_DAOS_SPARSE_CORDER) != 0)
+
+/* Bit in oid.hi set for datasets whose chunks are stored as filtered chunk
+ * records.  Datasets created before filters were supported (or with
+ * H5daos_set_legacy_chunk_format()) ignore the filters in their DCPL and
+ * store chunks as arrays. */
+#define H5_DAOS_FILTERED_CHUNKS 0x0000000010000000ull
+#define H5_DAOS_DSET_FILTERED_CHUNKS(dset) \
+    (((dset)->obj.oid.hi & H5_DAOS_FILTERED_CHUNKS) != 0)
+
 /* Predefined object indices */
 #define H5_DAOS_OIDX_GMD    0ull
 #define H5_DAOS_OIDX_ROOT   1ull
@@ -252,6 +306,20 @@ do { \
    (p) += 8;                                 \
 }
 
+#define UINT32ENCODE(p, i) {              \
+   *(p) = (uint8_t)( (i)        & 0xff); (p)++; \
+   *(p) = (uint8_t)(((i) >>  8) & 0xff); (p)++; \
+   *(p) = (uint8_t)(((i) >> 16) & 0xff); (p)++; \
+   *(p) = (uint8_t)(((i) >> 24) & 0xff); (p)++; \
+}
+
+#define UINT32DECODE(p, i) {                      \
+   (i)  =  (uint32_t)(*(p) & 0xff);       (p)++; \
+   (i) |= ((uint32_t)(*(p) & 0xff) <<  8); (p)++; \
+   (i) |= ((uint32_t)(*(p) & 0xff) << 16); (p)++; \
+   (i) |= ((uint32_t)(*(p) & 0xff) << 24); (p)++; \
+}
+
 /* Decode a variable-sized buffer */
 /* (Assumes that the high bits of the integer will be zero) */
 #define DECODE_VAR(p, n, l) { \
@@ -287,6 +355,52 @@ do { \
 /* Property to specify independent metadata I/O */
 #define H5_DAOS_IND_MD_IO_PROP_NAME "h5daos_independent_md_writes"
 
+/* Property to specify the maximum number of chunk I/O operations in flight */
+#define H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME "h5daos_chunk_io_max_in_flight"
+
+/* Property to specify the size of a dataset's chunk cache */
+#define H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME "h5daos_chunk_cache_nbytes"
+
+/* Property to specify the number of type conversion worker threads for a file */
+#define H5_DAOS_TCONV_NTHREADS_PROP_NAME "h5daos_tconv_nthreads"
+
+/* Property to specify whether short variable length values are stored
+ * inline in their blob IDs */
+#define H5_DAOS_INLINE_VL_PROP_NAME "h5daos_inline_vl"
+
+/* Properties to specify the maximum number of entries in and the lifetime (in
+ * seconds) of entries in a file's path cache */
+#define H5_DAOS_PATH_CACHE_NENTS_PROP_NAME "h5daos_path_cache_nents"
+#define H5_DAOS_PATH_CACHE_TTL_PROP_NAME "h5daos_path_cache_ttl"
+
+/* Property to specify the number of closed objects kept in a file's object
+ * metadata cache */
+#define H5_DAOS_OBJ_CACHE_NCLOSED_PROP_NAME "h5daos_obj_cache_nclosed"
+
+/* Property to specify whether objects keep sparse (hole tolerant) link and
+ * attribute creation order indices */
+#define H5_DAOS_SPARSE_CRT_ORDER_PROP_NAME "h5daos_sparse_crt_order_index"
+
+/* Property to specify that a dataset ignores the filters in its DCPL and
+ * stores chunks as arrays, as datasets created before filters were supported
+ * do (testing only) */
+#define H5_DAOS_LEGACY_CHUNK_FORMAT_PROP_NAME "h5daos_legacy_chunk_format"
+
+/* Property to specify whether attributes are created with the packed
+ * (single akey) metadata layout */
+#define H5_DAOS_PACKED_ATTR_LAYOUT_PROP_NAME "h5daos_packed_attr_layout"
+
+/* Property to specify whether a map keeps a persistent count of its keys */
+#define H5_DAOS_MAP_KEY_COUNT_PROP_NAME "h5daos_map_key_count"
+
+/* Property to specify whether a map stores its (unsigned 64 bit integer) keys
+ * in order */
+#define H5_DAOS_MAP_ORDERED_KEYS_PROP_NAME "h5daos_map_ordered_keys"
+
+/* Property to specify the number of keys a map's bloom filter is sized for (0
+ * for no bloom filter) */
+#define H5_DAOS_MAP_BLOOM_FILTER_PROP_NAME "h5daos_map_bloom_filter"
+
 /* DSINC - There are serious problems in HDF5 when trying to call
  * H5Pregister2/H5Punregister on the H5P_FILE_ACCESS class.
  */
@@ -489,6 +603,7 @@ typedef struct H5_daos_obj_t {
     daos_obj_id_t oid;
     daos_handle_t obj_oh;
     H5_daos_ocpl_cache_t ocpl_cache;
+    struct H5_daos_omd_cache_ent_t *omd_cache_ent;
 } H5_daos_obj_t;
 
 /* The FAPL cache struct */
@@ -496,6 +611,11 @@ typedef struct H5_daos_fapl_cache_t {
     daos_oclass_id_t default_object_class;
     hbool_t is_collective_md_read;
     hbool_t is_collective_md_write;
+    unsigned tconv_nthreads;
+    hbool_t inline_vl;
+    size_t path_cache_nents;
+    double path_cache_ttl;
+    size_t obj_cache_nclosed;
 } H5_daos_fapl_cache_t;
 
 /* Structure for caching the default values
@@ -554,6 +674,96 @@ typedef struct H5_daos_enc_plist_cache_t {
     void  *acpl_buf;
 } H5_daos_enc_plist_cache_t;
 
+/* Result of the blob I/O in one flush of a blob batch.  status holds the
+ * first error.  It is shared by the batch's tasks and the flush that waits on
+ * them, rc counts those references. */
+typedef struct H5_daos_blob_batch_status_t {
+    int status;
+    size_t rc;
+} H5_daos_blob_batch_status_t;
+
+/* Batch of blob reads and writes issued asynchronously.  While nest is
+ * nonzero blob puts are added to the batch instead of waiting for each one.
+ * The tasks all depend on first_task, which is scheduled (and the batch
+ * waited on) when the batch is flushed.  The batch is reset before it is
+ * waited on, so blob I/O issued while waiting starts a new batch. */
+typedef struct H5_daos_blob_batch_t {
+    unsigned nest;
+    tse_task_t *first_task;
+    tse_task_t *tasks[H5_DAOS_BLOB_BATCH_MAX_TASKS];
+    size_t ntasks;
+    size_t nbytes;
+    H5_daos_blob_batch_status_t *status;
+} H5_daos_blob_batch_t;
+
+/* A blob read ahead of time by H5_daos_blob_prefetch */
+typedef struct H5_daos_blob_prefetch_ent_t {
+    uint8_t blob_id[H5_DAOS_BLOB_ID_SIZE];
+    size_t size;
+    uint8_t *data;
+} H5_daos_blob_prefetch_ent_t;
+
+/* Blobs prefetched for one type conversion, sorted by blob ID.  blob gets
+ * for these blobs are served from here.  buf holds all of their data. */
+typedef struct H5_daos_blob_prefetch_t {
+    H5_daos_blob_prefetch_ent_t *ents;
+    size_t nents;
+    uint8_t *buf;
+} H5_daos_blob_prefetch_t;
+
+/* An entry in a file's path cache.  Maps path, relative to the group with
+ * OID start_oid, to the OID of the group it resolves to.  Entries are both
+ * the key and the value in the cache's hash table. */
+typedef struct H5_daos_path_cache_ent_t {
+    daos_obj_id_t start_oid;
+    const char *path; /* Points into the same allocation as the entry */
+    size_t path_len;
+    daos_obj_id_t oid;
+    double insert_time;
+} H5_daos_path_cache_ent_t;
+
+/* A file's path cache, used by H5_daos_group_traverse to skip following links
+ * to and opening intermediate groups.  Disabled if the file's
+ * fapl_cache.path_cache_nents is 0.  The table is created on first insert.
+ * epoch is incremented each time the cache is invalidated, so traversals
+ * issued before an invalidation do not add entries after it. */
+typedef struct H5_daos_path_cache_t {
+    dv_hash_table_t *table;
+    uint64_t epoch;
+} H5_daos_path_cache_t;
+
+/* Maximum number of serialized metadata fields in an object metadata cache
+ * entry (datatype, dataspace, DCPL and fill value for datasets) */
+#define H5_DAOS_OMD_CACHE_MAX_FIELDS 4
+
+/* An entry in a file's object metadata cache.  Holds the serialized internal
+ * metadata fetched when the object with OID oid was opened, all fields stored
+ * contiguously in buf.  nopen is the number of open objects using the entry.
+ * Entries with nopen 0 are on the cache's LRU list of closed objects.  evicted
+ * is set for pinned entries removed from the table, which are freed when the
+ * last object using them is closed. */
+typedef struct H5_daos_omd_cache_ent_t {
+    daos_obj_id_t oid;
+    unsigned nopen;
+    hbool_t evicted;
+    unsigned nfields;
+    size_t field_len[H5_DAOS_OMD_CACHE_MAX_FIELDS];
+    uint8_t *buf;
+    struct H5_daos_omd_cache_ent_t *prev;
+    struct H5_daos_omd_cache_ent_t *next;
+} H5_daos_omd_cache_ent_t;
+
+/* A file's object metadata cache, used to skip the metadata fetch when a
+ * dataset or group is opened again.  Disabled if the file's
+ * fapl_cache.obj_cache_nclosed is 0.  The table maps OIDs to entries and is
+ * created on first insert.  head is the most recently closed object. */
+typedef struct H5_daos_omd_cache_t {
+    dv_hash_table_t *table;
+    size_t nclosed;
+    H5_daos_omd_cache_ent_t *head;
+    H5_daos_omd_cache_ent_t *tail;
+} H5_daos_omd_cache_t;
+
 /* The file struct */
 typedef struct H5_daos_file_t {
     H5_daos_item_t item; /* Must be first */
@@ -579,6 +789,14 @@ typedef struct H5_daos_file_t {
     uint64_t max_oidx_collective;
     hid_t vol_id;
     void *vol_info;
+    H5_daos_tpool_t *tconv_pool;
+    H5_daos_blob_batch_t blob_batch;
+    H5_daos_blob_prefetch_t blob_prefetch;
+    H5_daos_path_cache_t path_cache;
+    H5_daos_omd_cache_t omd_cache;
+    struct H5_daos_dset_t *cached_dsets; /* Open datasets with a chunk cache, written back on file flush */
+    hbool_t packed_attrs; /* Default attribute layout, from the FCPL (stored in the global metadata object) */
+    hbool_t attr_open_try_packed; /* Layout to try first when opening attributes */
 } H5_daos_file_t;
 
 /* The GCPL cache struct */
@@ -592,6 +810,7 @@ typedef struct H5_daos_group_t {
     hid_t gcpl_id;
     hid_t gapl_id;
     H5_daos_gcpl_cache_t gcpl_cache;
+    hbool_t link_only; /* Opened only to follow links during traversal, GCPL not read */
 } H5_daos_group_t;
 
 /* Different algorithms for handling fill values on dataset reads */
@@ -605,12 +824,28 @@ typedef enum {
     H5_DAOS_COPY_FILL
 } H5_daos_fill_method_t;
 
+/* A filter in a dataset's filter pipeline */
+typedef struct H5_daos_filter_t {
+    H5Z_filter_t id;                /* Filter ID */
+    unsigned flags;                 /* Filter flags (H5Z_FLAG_*) */
+    size_t cd_nelmts;               /* Number of filter parameters */
+    unsigned *cd_values;            /* Filter parameters */
+    const H5Z_class2_t *cls;        /* Filter class (NULL if not available) */
+} H5_daos_filter_t;
+
+/* A dataset's filter pipeline */
+typedef struct H5_daos_filter_pipeline_t {
+    size_t nfilters;
+    H5_daos_filter_t *filters;
+} H5_daos_filter_pipeline_t;
+
 /* The DCPL cache struct */
 typedef struct H5_daos_dcpl_cache_t {
     H5D_layout_t layout;
     hsize_t chunk_dims[H5S_MAX_RANK];
     H5D_fill_value_t fill_status;
     H5_daos_fill_method_t fill_method;
+    H5_daos_filter_pipeline_t *pipeline; /* NULL if the dataset is not filtered */
 } H5_daos_dcpl_cache_t;
 
 /* Information about a singular selected chunk during a dataset read/write */
@@ -623,6 +858,51 @@ typedef struct H5_daos_select_chunk_info_t {
                                             selection in the chunk in the file */
 } H5_daos_select_chunk_info_t;
 
+/* Lightweight description of a regular selection, used instead of per-chunk
+ * dataspaces when the file and memory selections are both regular and have
+ * the same shape.  The selection in each chunk is the file selection clipped
+ * to the chunk, and the memory selection is the file selection translated by
+ * (mem_start - file_start).  Adjacent blocks are merged, so stride is greater
+ * than block in every dimension with count greater than 1. */
+typedef struct H5_daos_chunk_sel_pattern_t {
+    int      ndims;                      /* Rank of the file and memory dataspaces */
+    hsize_t  file_dims[H5S_MAX_RANK];    /* Dimensions of the file dataspace */
+    hsize_t  mem_dims[H5S_MAX_RANK];     /* Dimensions of the memory dataspace */
+    hsize_t  file_start[H5S_MAX_RANK];   /* Start of the selection in the file */
+    hsize_t  mem_start[H5S_MAX_RANK];    /* Start of the selection in memory */
+    hsize_t  stride[H5S_MAX_RANK];       /* Stride of the selection */
+    hsize_t  count[H5S_MAX_RANK];        /* Number of blocks in the selection */
+    hsize_t  block[H5S_MAX_RANK];        /* Size of each block in the selection */
+} H5_daos_chunk_sel_pattern_t;
+
+/* An entry in a dataset's chunk cache.  buf holds the whole chunk in the file
+ * datatype.  If loaded is FALSE the chunk has not been read from DAOS and
+ * only the elements in the dirty ranges are valid.  The dirty ranges are
+ * sorted and do not overlap or touch. */
+typedef struct H5_daos_chunk_cache_ent_t {
+    uint8_t dkey_buf[1 + (sizeof(uint64_t) * H5S_MAX_RANK)]; /* Encoded chunk coordinates, the cache key */
+    size_t dkey_len;
+    uint8_t *buf;
+    hbool_t loaded;
+    daos_recx_t *dirty;
+    size_t ndirty;
+    size_t dirty_nalloc;
+    struct H5_daos_chunk_cache_ent_t *prev; /* More recently used entry */
+    struct H5_daos_chunk_cache_ent_t *next; /* Less recently used entry */
+} H5_daos_chunk_cache_ent_t;
+
+/* A dataset's chunk cache.  Disabled if nbytes_max is 0. */
+typedef struct H5_daos_chunk_cache_t {
+    size_t nbytes_max;
+    size_t nbytes;
+    size_t chunk_nbytes;
+    dv_hash_table_t *table;
+    H5_daos_chunk_cache_ent_t *head; /* Most recently used entry */
+    H5_daos_chunk_cache_ent_t *tail; /* Least recently used entry */
+    struct H5_daos_dset_t *file_prev; /* Previous dataset in the file's list of cached datasets */
+    struct H5_daos_dset_t *file_next; /* Next dataset in the file's list of cached datasets */
+} H5_daos_chunk_cache_t;
+
 /* The dataset struct */
 typedef struct H5_daos_dset_t {
     H5_daos_obj_t obj; /* Must be first */
@@ -640,9 +920,15 @@ typedef struct H5_daos_dset_t {
         H5_daos_select_chunk_info_t single_chunk_info;
         H5_daos_select_chunk_info_t *chunk_info;
         size_t chunk_info_nalloc;
+        H5_daos_chunk_sel_pattern_t sel_pattern;
         hid_t mem_sel_iter_id;
         hid_t file_sel_iter_id;
     } io_cache;
+    H5_daos_chunk_cache_t chunk_cache;
+    struct {
+        uint64_t nchunks;
+        uint64_t nbatches;
+    } io_stats;
 } H5_daos_dset_t;
 
 /* The datatype struct */
@@ -655,6 +941,19 @@ typedef struct H5_daos_dtype_t {
     hid_t tapl_id;
 } H5_daos_dtype_t;
 
+/* Client-side copy of a map's bloom filter.  nbits is 0 if the map has no
+ * bloom filter, bits is NULL until the filter is loaded.  gen is the
+ * generation of the stored filter that bits was last synchronized with.
+ * pending holds the bits of keys put through this handle that have not been
+ * written to the stored filter, it is NULL if there are none. */
+typedef struct H5_daos_map_bloom_t {
+    uint64_t nbits;
+    uint64_t nhashes;
+    uint64_t gen;
+    uint8_t *bits;
+    uint8_t *pending;
+} H5_daos_map_bloom_t;
+
 /* The map struct */
 typedef struct H5_daos_map_t {
     H5_daos_obj_t obj; /* Must be first */
@@ -666,6 +965,9 @@ typedef struct H5_daos_map_t {
     hid_t val_file_type_id;
     hid_t mcpl_id;
     hid_t mapl_id;
+    hbool_t track_key_count;
+    hbool_t ordered_keys;
+    H5_daos_map_bloom_t bloom;
 } H5_daos_map_t;
 
 /* The attribute struct */
@@ -678,6 +980,9 @@ typedef struct H5_daos_attr_t {
     hid_t file_type_id;
     hid_t space_id;
     hid_t acpl_id;
+    hbool_t packed; /* Whether the attribute uses the packed metadata layout */
+    uint8_t *packed_md; /* Packed metadata preceding inline raw data, NULL if raw data is in its own akey */
+    size_t packed_md_len;
 } H5_daos_attr_t;
 
 /* The link value struct */
@@ -698,6 +1003,29 @@ typedef enum {
     H5_DAOS_TCONV_REUSE_BKG      /* Use buffer as background buffer */
 } H5_daos_tconv_reuse_t;
 
+/* Maximum number of contiguous runs of members copied by a compound subset
+ * conversion kernel, and maximum size of its source type */
+#define H5_DAOS_TCONV_KERNEL_MAX_RUNS 16
+#define H5_DAOS_TCONV_KERNEL_MAX_ELEM_SIZE 4096
+
+/* Datatype conversion kernel.  func does not call into HDF5, so may be run on
+ * a worker thread, and converts nelmts elements in place in buf, which must
+ * be large enough to hold the larger of the source and destination types.
+ * The remaining fields are parameters used by some kernels.  func is NULL if
+ * there is no kernel for a conversion. */
+typedef struct H5_daos_tconv_kernel_t {
+    void (*func)(const struct H5_daos_tconv_kernel_t *kernel, void *buf,
+        size_t nelmts);
+    size_t src_size;
+    size_t dst_size;
+    size_t nruns;
+    struct {
+        size_t src_off;
+        size_t dst_off;
+        size_t len;
+    } runs[H5_DAOS_TCONV_KERNEL_MAX_RUNS];
+} H5_daos_tconv_kernel_t;
+
 /* Enum type for distinguishing between I/O reads and writes. */
 typedef enum H5_daos_io_type_t {
     IO_READ,
@@ -821,6 +1149,7 @@ typedef struct H5_daos_omd_fetch_ud_t {
     H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
     H5_daos_mpi_ibcast_ud_flex_t *bcast_udata;
     tse_task_t *fetch_metatask;
+    hbool_t omd_cache_hit;
     uint8_t flex_buf[];
 } H5_daos_omd_fetch_ud_t;
 
@@ -857,6 +1186,37 @@ typedef struct H5_daos_oid_encode_ud_t {
     const char *oclass_prop_name;
 } H5_daos_oid_encode_ud_t;
 
+/*
+ * Enum values for determining which creation order index
+ * (a group's links or an object's attributes) an operation
+ * on a sparse creation order index applies to.
+ */
+typedef enum {
+    H5_DAOS_CORDER_IDX_LINK,
+    H5_DAOS_CORDER_IDX_ATTR
+} H5_daos_corder_idx_type_t;
+
+/* Number of entries probed at once when walking a sparse creation order
+ * index */
+#define H5_DAOS_CORDER_WALK_BATCH 16
+
+/*
+ * A walk over a creation order index, used by H5_daos_corder_idx_lookup()
+ * to find the entry after the previous one looked up without descending a
+ * sparse index's hole count tree again.  Must be zeroed before the first
+ * lookup and only used for one index.
+ */
+typedef struct H5_daos_corder_walk_t {
+    hbool_t valid;
+    H5_iter_order_t iter_order;
+    uint64_t index;
+    uint64_t key;
+    uint64_t max_corder;
+    uint64_t batch_start;
+    unsigned batch_n;
+    daos_size_t batch_size[H5_DAOS_CORDER_WALK_BATCH];
+} H5_daos_corder_walk_t;
+
 /*
  * Enum values for determining the type of iteration
  * being done with a given H5_daos_iter_data_t.
@@ -903,6 +1263,9 @@ typedef struct H5_daos_iter_data_t {
     hbool_t           short_circuit_init;
     H5_daos_req_t    *req;
 
+    /* Anchor to start listing from (NULL to list from the beginning) */
+    daos_anchor_t    *start_anchor;
+
     H5_daos_iter_data_type_t iter_type;
     union {
         struct {
@@ -927,8 +1290,15 @@ typedef struct H5_daos_iter_data_t {
             union {
                 H5M_iterate_t map_iter_op;
                 H5_daos_map_iterate_async_t map_iter_op_async;
+                H5daos_map_iterate_kv_t map_iter_kv_op;
             } u;
             hid_t key_mem_type_id;
+            hid_t val_mem_type_id;  /* Only used if prefetch_vals is TRUE */
+            hbool_t prefetch_vals;  /* Whether to fetch values for each batch of keys and call map_iter_kv_op */
+            hbool_t key_range;      /* Whether to only visit keys in [key_lo, key_hi] (ordered maps only) */
+            hbool_t key_range_sorted; /* Whether keys are listed in order, so listing can stop past key_hi */
+            uint64_t key_lo;
+            uint64_t key_hi;
         } map_iter_data;
 
         struct {
@@ -1015,6 +1385,9 @@ extern H5VL_DAOS_PRIVATE hbool_t H5_daos_bypass_duns_g;
 /* Target chunk size for automatic chunking */
 extern H5VL_DAOS_PRIVATE uint64_t H5_daos_chunk_target_size_g;
 
+/* Maximum number of chunk I/O operations in flight */
+extern H5VL_DAOS_PRIVATE size_t H5_daos_chunk_io_max_in_flight_g;
+
 /* Global scheduler - used for tasks that are not tied to any open file */
 extern tse_sched_t H5_daos_glob_sched_g;
 
@@ -1069,6 +1442,10 @@ extern H5VL_DAOS_PRIVATE const char H5_daos_vtype_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_map_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_blob_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_fillval_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_nkeys_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_bloom_info_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_bloom_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_packed_attr_key_g[];
 
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_int_md_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_root_grp_oid_key_size_g;
@@ -1088,6 +1465,10 @@ extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_vtype_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_map_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_blob_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_fillval_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_nkeys_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_bloom_info_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_bloom_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_packed_attr_key_size_g;
 
 /**********************/
 /* Private Prototypes */
@@ -1126,6 +1507,28 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_free_async(void *buf,
 H5VL_DAOS_PRIVATE herr_t H5_daos_comm_info_dup(MPI_Comm comm, MPI_Info info,
         MPI_Comm *comm_new, MPI_Info *info_new);
 H5VL_DAOS_PRIVATE herr_t H5_daos_comm_info_free(MPI_Comm *comm, MPI_Info *info);
+H5VL_DAOS_PRIVATE herr_t H5_daos_get_chunk_cache_nbytes(hid_t dapl_id, size_t *nbytes);
+H5VL_DAOS_PRIVATE herr_t H5_daos_get_tconv_nthreads(hid_t fapl_id, unsigned *nthreads);
+H5VL_DAOS_PRIVATE herr_t H5_daos_set_map_key_count_prop(hid_t mcpl_id,
+    hbool_t track_key_count);
+H5VL_DAOS_PRIVATE herr_t H5_daos_get_map_key_count_prop(hid_t mcpl_id,
+    hbool_t *track_key_count);
+H5VL_DAOS_PRIVATE herr_t H5_daos_set_map_ordered_keys_prop(hid_t mcpl_id,
+    hbool_t ordered_keys);
+H5VL_DAOS_PRIVATE herr_t H5_daos_get_map_ordered_keys_prop(hid_t mcpl_id,
+    hbool_t *ordered_keys);
+H5VL_DAOS_PRIVATE herr_t H5_daos_set_map_bloom_filter_prop(hid_t mcpl_id,
+    hsize_t expected_keys);
+H5VL_DAOS_PRIVATE herr_t H5_daos_get_map_bloom_filter_prop(hid_t mcpl_id,
+    hsize_t *expected_keys);
+H5VL_DAOS_PRIVATE herr_t H5_daos_set_sparse_crt_order_prop(hid_t ocpl_id,
+    hbool_t sparse);
+H5VL_DAOS_PRIVATE herr_t H5_daos_get_sparse_crt_order_prop(hid_t ocpl_id,
+    hbool_t *sparse);
+H5VL_DAOS_PRIVATE herr_t H5_daos_set_packed_attr_layout_prop(hid_t plist_id,
+    hbool_t packed);
+H5VL_DAOS_PRIVATE herr_t H5_daos_get_packed_attr_layout_prop(hid_t plist_id,
+    hbool_t *packed);
 
 /* File callbacks */
 H5VL_DAOS_PRIVATE void *H5_daos_file_create(const char *name, unsigned flags, hid_t fcpl_id,
@@ -1184,12 +1587,14 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_link_iterate(H5_daos_group_t *target_grp, H5_da
     tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_get_name_by_idx(
     H5_daos_group_t *target_grp, H5_index_t index_type,
-    H5_iter_order_t iter_order, uint64_t idx, size_t *link_name_size,
+    H5_iter_order_t iter_order, uint64_t idx,
+    H5_daos_corder_walk_t *corder_walk, size_t *link_name_size,
     char *link_name_out, size_t link_name_out_size, H5_daos_req_t *req,
     tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_get_name_by_idx_alloc(
     H5_daos_group_t *target_grp, H5_index_t index_type,
-    H5_iter_order_t iter_order, uint64_t idx, const char **link_name,
+    H5_iter_order_t iter_order, uint64_t idx,
+    H5_daos_corder_walk_t *corder_walk, const char **link_name,
     size_t *link_name_size, char **link_name_buf, size_t *link_name_buf_size,
     H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_get_crt_order_by_name(H5_daos_group_t *target_grp, const char *link_name,
@@ -1213,7 +1618,7 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_group_close(void *_grp, hid_t dxpl_id, void **r
 /* Other group routines */
 H5VL_DAOS_PRIVATE H5_daos_obj_t *H5_daos_group_traverse(H5_daos_item_t *item,
     const char *path, hid_t lcpl_id, H5_daos_req_t *req, hbool_t collective,
-    char **path_buf, const char **obj_name, size_t *obj_name_len,
+    hbool_t final_link_only, char **path_buf, const char **obj_name, size_t *obj_name_len,
     tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE void *H5_daos_group_create_helper(H5_daos_file_t *file, hbool_t is_root,
     hid_t gcpl_id, hid_t gapl_id, H5_daos_group_t *parent_grp, const char *name, size_t name_len,
@@ -1234,6 +1639,7 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_group_refresh(H5_daos_group_t *grp,
 H5VL_DAOS_PRIVATE herr_t H5_daos_group_flush(H5_daos_group_t *grp,
     H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_group_close_real(H5_daos_group_t *grp);
+H5VL_DAOS_PRIVATE void H5_daos_path_cache_invalidate(H5_daos_file_t *file);
 
 /* Dataset callbacks */
 H5VL_DAOS_PRIVATE void *H5_daos_dataset_create(void *_item, const H5VL_loc_params_t *loc_params,
@@ -1271,6 +1677,13 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_write_int(H5_daos_dset_t *dset,
 H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_flush(H5_daos_dset_t *dset,
     H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_close_real(H5_daos_dset_t *dset);
+H5VL_DAOS_PRIVATE htri_t H5_daos_dset_dcpl_filtered_chunks(hid_t dcpl_id);
+H5VL_DAOS_PRIVATE herr_t H5_daos_sel_iter_to_recx_iov(hid_t sel_iter_id,
+    size_t type_size, void *buf, daos_recx_t **recxs, daos_iov_t **sg_iovs,
+    size_t *list_nused);
+H5VL_DAOS_PRIVATE htri_t H5_daos_sel_to_recx_iov_regular(hid_t space_id,
+    size_t type_size, void *buf, daos_recx_t **recxs, daos_iov_t **sg_iovs,
+    size_t *list_nused);
 
 /* Datatype callbacks */
 H5VL_DAOS_PRIVATE void *H5_daos_datatype_commit(void *obj, const H5VL_loc_params_t *loc_params,
@@ -1296,6 +1709,16 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_init(hid_t src_type_id, size_t *src_type_
     hid_t dst_type_id, size_t *dst_type_size, size_t num_elem,
     hbool_t clear_tconv_buf, hbool_t dst_file, void **tconv_buf, void **bkg_buf,
     H5_daos_tconv_reuse_t *reuse, hbool_t *fill_bkg);
+H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_get_kernel(hid_t src_type_id,
+    hid_t dst_type_id, H5_daos_tconv_kernel_t *kernel);
+H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_convert(hid_t src_type_id,
+    hid_t dst_type_id, size_t nelmts, void *buf, void *bkg, hid_t dxpl_id);
+H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_convert_to_file(H5_daos_file_t *file,
+    hid_t src_type_id, hid_t dst_type_id, size_t nelmts, void *buf, void *bkg,
+    hid_t dxpl_id);
+H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_convert_from_file(H5_daos_file_t *file,
+    hid_t src_type_id, hid_t dst_type_id, size_t nelmts, void *buf, void *bkg,
+    hid_t dxpl_id);
 H5VL_DAOS_PRIVATE herr_t H5_daos_datatype_refresh(H5_daos_dtype_t *dtype,
     hid_t dxpl_id, void **req);
 H5VL_DAOS_PRIVATE herr_t H5_daos_datatype_flush(H5_daos_dtype_t *dtype,
@@ -1335,6 +1758,19 @@ H5VL_DAOS_PRIVATE int H5_daos_obj_read_rc(H5_daos_obj_t **obj_p,
 H5VL_DAOS_PRIVATE int H5_daos_obj_write_rc(H5_daos_obj_t **obj_p,
     H5_daos_obj_t *obj, uint64_t *rc, int64_t adjust,
     H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE int H5_daos_omd_fetch_prep_cb(tse_task_t *task, void *args);
+H5VL_DAOS_PRIVATE int H5_daos_omd_cache_insert(H5_daos_obj_t *obj, unsigned nfields,
+    const uint8_t *bufs[], const size_t lens[]);
+H5VL_DAOS_PRIVATE void H5_daos_omd_cache_release(H5_daos_obj_t *obj);
+H5VL_DAOS_PRIVATE void H5_daos_omd_cache_evict(H5_daos_file_t *file, const daos_obj_id_t *oid);
+H5VL_DAOS_PRIVATE void H5_daos_omd_cache_free(H5_daos_file_t *file);
+H5VL_DAOS_PRIVATE herr_t H5_daos_corder_idx_lookup(H5_daos_obj_t *obj,
+    H5_daos_corder_idx_type_t idx_type, const hsize_t *count, H5_iter_order_t iter_order,
+    uint64_t index, H5_daos_corder_walk_t *walk, uint64_t *key_out, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE herr_t H5_daos_corder_idx_remove(H5_daos_obj_t *obj,
+    H5_daos_corder_idx_type_t idx_type, const uint64_t *corder, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
 
 /* Attribute callbacks */
 H5VL_DAOS_PRIVATE void *H5_daos_attribute_create(void *_obj, const H5VL_loc_params_t *loc_params,
@@ -1408,6 +1844,17 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_map_close_real(H5_daos_map_t *map);
 H5VL_DAOS_PRIVATE herr_t H5_daos_map_flush(H5_daos_map_t *map,
     H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 
+/* Filter pipeline routines */
+H5VL_DAOS_PRIVATE herr_t H5_daos_filter_init(void);
+H5VL_DAOS_PRIVATE herr_t H5_daos_filter_term(void);
+H5VL_DAOS_PRIVATE herr_t H5_daos_filter_pipeline_init(hid_t dcpl_id,
+    hid_t type_id, hid_t space_id, hbool_t set_local,
+    H5_daos_filter_pipeline_t **pipeline);
+H5VL_DAOS_PRIVATE void H5_daos_filter_pipeline_free(H5_daos_filter_pipeline_t *pipeline);
+H5VL_DAOS_PRIVATE herr_t H5_daos_filter_pipeline_apply(
+    const H5_daos_filter_pipeline_t *pipeline, hbool_t reverse,
+    uint32_t *filter_mask, size_t *nbytes, size_t *buf_size, void **buf);
+
 /* Blob callbacks */
 H5VL_DAOS_PRIVATE herr_t H5_daos_blob_put(void *_file, const void *buf,
     size_t size, void *blob_id, void *_ctx);
@@ -1415,6 +1862,11 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_blob_get(void *_file, const void *blob_id,
     void *buf, size_t size, void *_ctx);
 H5VL_DAOS_PRIVATE herr_t H5_daos_blob_specific(void *_file, void *blob_id,
     H5VL_blob_specific_t specific_type, va_list arguments);
+H5VL_DAOS_PRIVATE void H5_daos_blob_batch_begin(H5_daos_file_t *file);
+H5VL_DAOS_PRIVATE herr_t H5_daos_blob_batch_end(H5_daos_file_t *file);
+H5VL_DAOS_PRIVATE herr_t H5_daos_blob_prefetch(H5_daos_file_t *file,
+    hid_t file_type_id, size_t nelmts, const void *buf, hbool_t *prefetched);
+H5VL_DAOS_PRIVATE void H5_daos_blob_prefetch_release(H5_daos_file_t *file);
 
 /* Request callbacks */
 H5VL_DAOS_PRIVATE herr_t H5_daos_req_wait(void *req, uint64_t timeout,
@@ -22,9 +22,30 @@
 /* Local Macros */
 /****************/
 
+/* Attribute info buffer, used for fetching and broadcasting attribute
+ * metadata at open.  Contains the layout flags and the lengths of the
+ * encoded datatype, dataspace and ACPL, followed by the encoded metadata. */
+#define H5_DAOS_AINFO_HDR_SIZE (4 * H5_DAOS_ENCODED_UINT64_T_SIZE)
 #define H5_DAOS_AINFO_BCAST_BUF_SIZE (                             \
         H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE             \
-      + H5_DAOS_ACPL_BUF_SIZE + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE) \
+      + H5_DAOS_ACPL_BUF_SIZE + H5_DAOS_AINFO_HDR_SIZE)
+
+/* Packed attribute metadata layout (see H5daos_set_packed_attr_layout()).
+ * The record is a single value stored under the attribute's datatype ("T-")
+ * akey.  It starts with a 0 signature byte, which an encoded datatype never
+ * starts with, then a flags byte and the lengths of the encoded datatype,
+ * dataspace and ACPL, followed by the encoded datatype, dataspace and ACPL
+ * and, if H5_DAOS_ATTR_PACKED_RAW_INLINE is set, the raw data.  Raw data of
+ * packed attributes larger than H5_DAOS_ATTR_PACKED_RAW_MAX bytes is stored
+ * in the raw data ("V-") akey as for the original layout. */
+#define H5_DAOS_ATTR_PACKED_SIG 0
+#define H5_DAOS_ATTR_PACKED_RAW_INLINE 0x01
+#define H5_DAOS_ATTR_PACKED_HDR_SIZE (2 + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE)
+#define H5_DAOS_ATTR_PACKED_RAW_MAX 1024
+
+/* Flag set in the attribute info header's layout flags (but never stored in
+ * the file) when the attribute uses the packed layout */
+#define H5_DAOS_AINFO_PACKED 0x100
 
 /************************************/
 /* Local Type and Struct Definition */
@@ -37,6 +58,7 @@ typedef struct H5_daos_attr_create_ud_t {
     H5_daos_attr_t *attr;
     daos_key_t akeys[4];
     void *akeys_buf;
+    unsigned corder_iod;
     uint8_t nattr_new_buf[H5_DAOS_ENCODED_NUM_ATTRS_SIZE];
     uint8_t nattr_old_buf[H5_DAOS_ENCODED_NUM_ATTRS_SIZE + 1];
     uint8_t max_corder_old_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
@@ -44,12 +66,18 @@ typedef struct H5_daos_attr_create_ud_t {
     uint8_t flex_buf[];
 } H5_daos_attr_create_ud_t;
 
-/* Task user data for opening an attribute */
+/* Task user data for opening an attribute.  If bcast_udata is set the
+ * attribute info buffer is the broadcast buffer, otherwise it is ainfo_buf,
+ * which initially points to flex_buf. */
 typedef struct H5_daos_attr_open_ud_t {
     H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
     H5_daos_mpi_ibcast_ud_t *bcast_udata;
     tse_task_t *fetch_metatask;
     H5_daos_attr_t *attr;
+    uint8_t *ainfo_buf;
+    size_t ainfo_buf_len;
+    hbool_t packed; /* Whether the current fetch is for the packed layout */
+    hbool_t tried_other; /* Whether the other layout has already been tried */
     uint8_t flex_buf[];
 } H5_daos_attr_open_ud_t;
 
@@ -72,6 +100,8 @@ typedef struct H5_daos_attr_io_ud_t {
     hid_t mem_type_id;
     daos_key_t akey;
     void *akey_buf;
+    void *md_buf;
+    d_iov_t packed_iov[2];
     H5_daos_io_type_t io_type;
     union {
         void *rbuf;
@@ -109,8 +139,8 @@ typedef struct H5_daos_attr_exists_ud_t {
     H5_DAOS_ATTR_EXISTS_OUT_TYPE *exists;
     htri_t bcast_exists;
     daos_key_t dkey;
-    daos_key_t akeys[H5_DAOS_ATTR_NUM_AKEYS - 1];
-    daos_iod_t iod[H5_DAOS_ATTR_NUM_AKEYS - 1];
+    daos_key_t akeys[2];
+    daos_iod_t iod[2];
     unsigned nr;
     void *akeys_buf;
 } H5_daos_attr_exists_ud_t;
@@ -154,6 +184,7 @@ typedef struct H5_daos_attr_gnbi_alloc_ud_t {
     H5_index_t index_type;
     H5_iter_order_t iter_order;
     uint64_t idx;
+    H5_daos_corder_walk_t *corder_walk;
     const char **attr_name;
     size_t *attr_name_size;
     char **attr_name_buf;
@@ -170,6 +201,7 @@ typedef struct H5_daos_attr_get_name_by_idx_ud_t {
     H5_index_t index_type;
     H5_iter_order_t iter_order;
     uint64_t idx;
+    H5_daos_corder_walk_t *corder_walk;
     hsize_t obj_nattrs;
     char *attr_name_out;
     size_t attr_name_out_size;
@@ -180,6 +212,7 @@ typedef struct H5_daos_attr_get_name_by_idx_ud_t {
         } by_name_data;
         struct {
             H5_daos_md_rw_cb_ud_t md_rw_cb_ud;
+            uint64_t idx_key;
             uint8_t idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
         } by_crt_order_data;
     } u;
@@ -203,6 +236,9 @@ typedef struct H5_daos_attr_crt_idx_iter_ud_t {
 static herr_t H5_daos_attribute_get_akeys(const char *attr_name, daos_key_t *datatype_key,
     daos_key_t *dataspace_key, daos_key_t *acpl_key, daos_key_t *acorder_key,
     daos_key_t *raw_data_key, void **akey_buf_out);
+static herr_t H5_daos_attribute_encode_packed(H5_daos_file_t *file, hid_t type_id,
+    hid_t space_id, hid_t acpl_id, uint8_t flags, size_t raw_size,
+    uint8_t **buf_out, size_t *md_len_out);
 static int H5_daos_attribute_md_rw_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_attribute_create_helper_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_attribute_create_helper_comp_cb(tse_task_t *task, void *args);
@@ -215,8 +251,10 @@ static herr_t H5_daos_attribute_open_by_idx_helper(H5_daos_obj_t *target_obj,
     tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_attribute_open_bcast_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_attribute_open_recv_comp_cb(tse_task_t *task, void *args);
-static int H5_daos_attribute_open_end(H5_daos_attr_t *attr, uint8_t *p, uint64_t type_buf_len,
-    uint64_t space_buf_len, uint64_t acpl_buf_len);
+static int H5_daos_attribute_open_end(H5_daos_attr_t *attr, uint8_t *p, uint64_t flags,
+    uint64_t type_buf_len, uint64_t space_buf_len, uint64_t acpl_buf_len);
+static void H5_daos_ainfo_fetch_setup(H5_daos_attr_open_ud_t *udata, hbool_t exact);
+static herr_t H5_daos_attribute_io_setup(H5_daos_attr_io_ud_t *udata, hbool_t fetch);
 static int H5_daos_attr_io_int_task(tse_task_t *task);
 static int H5_daos_attr_io_int_end_task(tse_task_t *task);
 static herr_t H5_daos_attribute_read_int(H5_daos_attr_t *attr,
@@ -279,12 +317,14 @@ static herr_t H5_daos_attribute_rename(H5_daos_obj_t *attr_container_obj, const
 
 static int H5_daos_attr_gnbi_alloc_task(tse_task_t *task);
 static herr_t H5_daos_attribute_get_name_by_idx_alloc(H5_daos_obj_t *target_obj,
-    H5_index_t index_type, H5_iter_order_t iter_order, uint64_t idx, const char **attr_name,
-    size_t *attr_name_size, char **attr_name_buf, size_t *attr_name_buf_size, H5_daos_req_t *req,
+    H5_index_t index_type, H5_iter_order_t iter_order, uint64_t idx,
+    H5_daos_corder_walk_t *corder_walk, const char **attr_name, size_t *attr_name_size,
+    char **attr_name_buf, size_t *attr_name_buf_size, H5_daos_req_t *req,
     tse_task_t **first_task, tse_task_t **dep_task);
 static herr_t H5_daos_attribute_get_name_by_idx(H5_daos_obj_t *target_obj, H5_index_t index_type,
-    H5_iter_order_t iter_order, uint64_t idx, char *attr_name_out, size_t attr_name_out_size,
-    size_t *attr_name_size, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+    H5_iter_order_t iter_order, uint64_t idx, H5_daos_corder_walk_t *corder_walk,
+    char *attr_name_out, size_t attr_name_out_size, size_t *attr_name_size,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static herr_t H5_daos_attribute_get_name_by_name_order(H5_daos_attr_get_name_by_idx_ud_t *get_name_udata,
     H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static herr_t H5_daos_attribute_get_name_by_name_order_cb(hid_t loc_id, const char *attr_name,
@@ -387,6 +427,83 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_attribute_get_akeys() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_attribute_encode_packed
+ *
+ * Purpose:     Helper routine to encode the packed metadata record for an
+ *              attribute (see H5_DAOS_ATTR_PACKED_SIG).  Allocates a
+ *              buffer large enough for the record plus raw_size zeroed
+ *              bytes of raw data, which the caller is responsible for
+ *              freeing.  The length of the record, not including raw
+ *              data, is returned in md_len_out.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_attribute_encode_packed(H5_daos_file_t *file, hid_t type_id,
+    hid_t space_id, hid_t acpl_id, uint8_t flags, size_t raw_size,
+    uint8_t **buf_out, size_t *md_len_out)
+{
+    size_t type_size = 0;
+    size_t space_size = 0;
+    size_t acpl_size = 0;
+    size_t md_len;
+    uint8_t *buf = NULL;
+    uint8_t *p;
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+    assert(buf_out);
+    assert(md_len_out);
+
+    /* Determine serialized sizes */
+    if(H5Tencode(type_id, NULL, &type_size) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't determine serialized length of datatype");
+    if(H5Sencode2(space_id, NULL, &space_size, file->fapl_id) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't determine serialized length of dataspace");
+    if(acpl_id == H5P_ATTRIBUTE_CREATE_DEFAULT)
+        acpl_size = file->def_plist_cache.acpl_size;
+    else if(H5Pencode2(acpl_id, NULL, &acpl_size, file->fapl_id) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't determine serialized length of acpl");
+    md_len = H5_DAOS_ATTR_PACKED_HDR_SIZE + type_size + space_size + acpl_size;
+
+    /* Allocate buffer.  Raw data is initialized to zeros. */
+    if(NULL == (buf = (uint8_t *)DV_calloc(md_len + raw_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for packed attribute metadata");
+
+    /* Encode header */
+    p = buf;
+    *p++ = H5_DAOS_ATTR_PACKED_SIG;
+    *p++ = flags;
+    UINT64ENCODE(p, (uint64_t)type_size);
+    UINT64ENCODE(p, (uint64_t)space_size);
+    UINT64ENCODE(p, (uint64_t)acpl_size);
+
+    /* Encode datatype, dataspace and ACPL */
+    if(H5Tencode(type_id, p, &type_size) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, FAIL, "can't serialize datatype");
+    p += type_size;
+    if(H5Sencode2(space_id, p, &space_size, file->fapl_id) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, FAIL, "can't serialize dataspace");
+    p += space_size;
+    if(acpl_id == H5P_ATTRIBUTE_CREATE_DEFAULT)
+        memcpy(p, file->def_plist_cache.acpl_buf, acpl_size);
+    else if(H5Pencode2(acpl_id, p, &acpl_size, file->fapl_id) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, FAIL, "can't serialize acpl");
+
+    *buf_out = buf;
+    *md_len_out = md_len;
+    buf = NULL;
+
+done:
+    DV_free(buf);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_attribute_encode_packed() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_attribute_md_rw_prep_cb
@@ -619,6 +736,8 @@ H5_daos_attribute_create_helper(H5_daos_item_t *item, const H5VL_loc_params_t *l
     tse_task_t *update_task;
     H5_daos_req_t *int_int_req = NULL;
     hbool_t default_acpl = (acpl_id == H5P_ATTRIBUTE_CREATE_DEFAULT);
+    hbool_t packed;
+    size_t inline_raw_size = 0;
     int ret;
     void *ret_value = NULL;
 
@@ -692,58 +811,124 @@ H5_daos_attribute_create_helper(H5_daos_item_t *item, const H5VL_loc_params_t *l
     else
         D_GOTO_ERROR(H5E_ATTR, H5E_UNSUPPORTED, NULL, "unsupported attribute create location parameters type");
 
+    /* Finish setting up attribute struct */
+    if((attr->type_id = H5Tcopy(type_id)) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "failed to copy datatype");
+    if((attr->file_type_id = H5VLget_file_type(item->file, H5_DAOS_g, type_id)) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, NULL, "failed to get file datatype");
+    if(0 == (attr->file_type_size = H5Tget_size(attr->file_type_id)))
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't get file datatype size");
+    if((attr->space_id = H5Scopy(space_id)) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "failed to copy dataspace");
+    if(!default_acpl && (attr->acpl_id = H5Pcopy(acpl_id)) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "failed to copy ACPL");
+    if(H5Sselect_all(attr->space_id) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, NULL, "can't change selection");
+
+    /* Determine the attribute's layout.  A layout set on the ACPL overrides
+     * the file's default.  Packed attributes keep small raw data inline with
+     * their metadata. */
+    packed = item->file->packed_attrs;
+    if(!default_acpl && H5_daos_get_packed_attr_layout_prop(acpl_id, &packed) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't get packed attribute layout property");
+    attr->packed = packed;
+    if(packed) {
+        hssize_t npoints;
+
+        if((npoints = H5Sget_simple_extent_npoints(space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, NULL, "can't get number of elements in attribute's dataspace");
+        inline_raw_size = (size_t)npoints * attr->file_type_size;
+        if(inline_raw_size > H5_DAOS_ATTR_PACKED_RAW_MAX)
+            inline_raw_size = 0;
+    } /* end if */
+
     /* Create attribute and write metadata if this process should */
     if(!collective || (item->file->my_rank == 0)) {
         size_t type_size = 0;
         size_t space_size = 0;
         size_t acpl_size = 0;
+        size_t packed_size = 0;
         void *type_buf = NULL;
         void *space_buf = NULL;
         void *acpl_buf = NULL;
+        uint8_t *packed_buf = NULL;
         hbool_t may_track_acorder = !attr->parent ||
                 (attr->parent->item.open_req->status < 0 && !attr->parent->item.created)
                 || attr->parent->ocpl_cache.track_acorder;
 
-        /* Determine serialized datatype size */
-        if(H5Tencode(type_id, NULL, &type_size) < 0)
-            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "can't determine serialized length of datatype");
+        if(packed) {
+            size_t md_len;
 
-        /* Determine serialized dataspace size */
-        if(H5Sencode2(space_id, NULL, &space_size, item->file->fapl_id) < 0)
-            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "can't determine serialized length of dataspace");
+            /* Encode packed metadata record, followed by zeroed raw data if
+             * it is stored inline */
+            if(H5_daos_attribute_encode_packed(item->file, type_id, space_id, acpl_id,
+                    inline_raw_size ? H5_DAOS_ATTR_PACKED_RAW_INLINE : 0, inline_raw_size,
+                    &packed_buf, &md_len) < 0)
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, NULL, "can't encode packed attribute metadata");
+            packed_size = md_len + inline_raw_size;
 
-        /* Determine serialized ACPL size if not the default */
-        if(!default_acpl)
-            if(H5Pencode2(acpl_id, NULL, &acpl_size, item->file->fapl_id) < 0)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "can't determine serialized length of acpl");
-
-        /* Allocate argument struct */
-        if(NULL == (create_ud = (H5_daos_attr_create_ud_t *)DV_calloc(sizeof(H5_daos_attr_create_ud_t) + type_size + space_size + acpl_size)))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate buffer for update callback arguments");
-        create_ud->req = req;
-        create_ud->attr = attr;
-        create_ud->akeys_buf = NULL;
+            /* Allocate argument struct */
+            if(NULL == (create_ud = (H5_daos_attr_create_ud_t *)DV_calloc(sizeof(H5_daos_attr_create_ud_t)))) {
+                DV_free(packed_buf);
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate buffer for update callback arguments");
+            } /* end if */
 
-        /* Encode datatype */
-        type_buf = create_ud->flex_buf;
-        if(H5Tencode(type_id, type_buf, &type_size) < 0)
-            D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, NULL, "can't serialize datatype");
-
-        /* Encode dataspace */
-        space_buf = create_ud->flex_buf + type_size;
-        if(H5Sencode2(space_id, space_buf, &space_size, item->file->fapl_id) < 0)
-            D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, NULL, "can't serialize dataspace");
-
-        /* Encode ACPL if not the default */
-        if(!default_acpl) {
-            acpl_buf = create_ud->flex_buf + type_size + space_size;
-            if(H5Pencode2(acpl_id, acpl_buf, &acpl_size, item->file->fapl_id) < 0)
-                D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, NULL, "can't serialize acpl");
+            /* Give the record to the update's sgl now so it is freed on
+             * failure */
+            daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[0], packed_buf, (daos_size_t)packed_size);
+            create_ud->md_rw_cb_ud.free_sg_iov[0] = TRUE;
+
+            /* Keep a copy of the record to rewrite along with inline raw
+             * data */
+            if(inline_raw_size) {
+                if(NULL == (attr->packed_md = (uint8_t *)DV_malloc(md_len)))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate buffer for packed attribute metadata");
+                memcpy(attr->packed_md, packed_buf, md_len);
+                attr->packed_md_len = md_len;
+            } /* end if */
         } /* end if */
         else {
-            acpl_buf = item->file->def_plist_cache.acpl_buf;
-            acpl_size = item->file->def_plist_cache.acpl_size;
+            /* Determine serialized datatype size */
+            if(H5Tencode(type_id, NULL, &type_size) < 0)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "can't determine serialized length of datatype");
+
+            /* Determine serialized dataspace size */
+            if(H5Sencode2(space_id, NULL, &space_size, item->file->fapl_id) < 0)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "can't determine serialized length of dataspace");
+
+            /* Determine serialized ACPL size if not the default */
+            if(!default_acpl)
+                if(H5Pencode2(acpl_id, NULL, &acpl_size, item->file->fapl_id) < 0)
+                    D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "can't determine serialized length of acpl");
+
+            /* Allocate argument struct */
+            if(NULL == (create_ud = (H5_daos_attr_create_ud_t *)DV_calloc(sizeof(H5_daos_attr_create_ud_t) + type_size + space_size + acpl_size)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate buffer for update callback arguments");
+
+            /* Encode datatype */
+            type_buf = create_ud->flex_buf;
+            if(H5Tencode(type_id, type_buf, &type_size) < 0)
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, NULL, "can't serialize datatype");
+
+            /* Encode dataspace */
+            space_buf = create_ud->flex_buf + type_size;
+            if(H5Sencode2(space_id, space_buf, &space_size, item->file->fapl_id) < 0)
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, NULL, "can't serialize dataspace");
+
+            /* Encode ACPL if not the default */
+            if(!default_acpl) {
+                acpl_buf = create_ud->flex_buf + type_size + space_size;
+                if(H5Pencode2(acpl_id, acpl_buf, &acpl_size, item->file->fapl_id) < 0)
+                    D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, NULL, "can't serialize acpl");
+            } /* end if */
+            else {
+                acpl_buf = item->file->def_plist_cache.acpl_buf;
+                acpl_size = item->file->def_plist_cache.acpl_size;
+            } /* end else */
         } /* end else */
+        create_ud->req = req;
+        create_ud->attr = attr;
+        create_ud->akeys_buf = NULL;
 
         /* Set up operation to write datatype, dataspace and ACPL to attribute's parent object */
         /* obj field is not used */
@@ -763,59 +948,81 @@ H5_daos_attribute_create_helper(H5_daos_item_t *item, const H5VL_loc_params_t *l
                         NULL, &create_ud->akeys_buf) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't get akey strings");
 
-        /* Set up iod */
+        create_ud->md_rw_cb_ud.free_akeys = FALSE;
 
-        /* iod[0] contains the key for the datatype description */
-        daos_iov_set(&create_ud->md_rw_cb_ud.iod[0].iod_name,
-                (void *)create_ud->akeys[0].iov_buf, (daos_size_t)create_ud->akeys[0].iov_len);
-        create_ud->md_rw_cb_ud.iod[0].iod_nr = 1u;
-        create_ud->md_rw_cb_ud.iod[0].iod_size = (uint64_t)type_size;
-        create_ud->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
-        create_ud->md_rw_cb_ud.iod[0].iod_flags = DAOS_COND_AKEY_INSERT;
-
-        /* iod[1] contains the key for the dataspace description */
-        daos_iov_set(&create_ud->md_rw_cb_ud.iod[1].iod_name,
-                (void *)create_ud->akeys[1].iov_buf, (daos_size_t)create_ud->akeys[1].iov_len);
-        create_ud->md_rw_cb_ud.iod[1].iod_nr = 1u;
-        create_ud->md_rw_cb_ud.iod[1].iod_size = (uint64_t)space_size;
-        create_ud->md_rw_cb_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
-        create_ud->md_rw_cb_ud.iod[1].iod_flags = DAOS_COND_AKEY_INSERT;
-
-        /* iod[2] contains the key for the ACPL */
-        daos_iov_set(&create_ud->md_rw_cb_ud.iod[2].iod_name,
-                (void *)create_ud->akeys[2].iov_buf, (daos_size_t)create_ud->akeys[2].iov_len);
-        create_ud->md_rw_cb_ud.iod[2].iod_nr = 1u;
-        create_ud->md_rw_cb_ud.iod[2].iod_size = (uint64_t)acpl_size;
-        create_ud->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
-        create_ud->md_rw_cb_ud.iod[2].iod_flags = DAOS_COND_AKEY_INSERT;
+        if(packed) {
+            /* Set up iod.  iod[0] contains the key for the packed metadata
+             * record, which is stored under the datatype key so that
+             * attribute names conflict across layouts. */
+            daos_iov_set(&create_ud->md_rw_cb_ud.iod[0].iod_name,
+                    (void *)create_ud->akeys[0].iov_buf, (daos_size_t)create_ud->akeys[0].iov_len);
+            create_ud->md_rw_cb_ud.iod[0].iod_nr = 1u;
+            create_ud->md_rw_cb_ud.iod[0].iod_size = (uint64_t)packed_size;
+            create_ud->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+            create_ud->md_rw_cb_ud.iod[0].iod_flags = DAOS_COND_AKEY_INSERT;
+
+            /* Set up sgl.  sgl[0] contains the packed metadata record, set up
+             * above. */
+            create_ud->md_rw_cb_ud.sgl[0].sg_nr = 1;
+            create_ud->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+            create_ud->md_rw_cb_ud.sgl[0].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[0];
 
-        create_ud->md_rw_cb_ud.free_akeys = FALSE;
+            /* Set nr */
+            create_ud->md_rw_cb_ud.nr = 1u;
+        } /* end if */
+        else {
+            /* Set up iod */
 
-        /* Set up sgl */
+            /* iod[0] contains the key for the datatype description */
+            daos_iov_set(&create_ud->md_rw_cb_ud.iod[0].iod_name,
+                    (void *)create_ud->akeys[0].iov_buf, (daos_size_t)create_ud->akeys[0].iov_len);
+            create_ud->md_rw_cb_ud.iod[0].iod_nr = 1u;
+            create_ud->md_rw_cb_ud.iod[0].iod_size = (uint64_t)type_size;
+            create_ud->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+            create_ud->md_rw_cb_ud.iod[0].iod_flags = DAOS_COND_AKEY_INSERT;
+
+            /* iod[1] contains the key for the dataspace description */
+            daos_iov_set(&create_ud->md_rw_cb_ud.iod[1].iod_name,
+                    (void *)create_ud->akeys[1].iov_buf, (daos_size_t)create_ud->akeys[1].iov_len);
+            create_ud->md_rw_cb_ud.iod[1].iod_nr = 1u;
+            create_ud->md_rw_cb_ud.iod[1].iod_size = (uint64_t)space_size;
+            create_ud->md_rw_cb_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
+            create_ud->md_rw_cb_ud.iod[1].iod_flags = DAOS_COND_AKEY_INSERT;
+
+            /* iod[2] contains the key for the ACPL */
+            daos_iov_set(&create_ud->md_rw_cb_ud.iod[2].iod_name,
+                    (void *)create_ud->akeys[2].iov_buf, (daos_size_t)create_ud->akeys[2].iov_len);
+            create_ud->md_rw_cb_ud.iod[2].iod_nr = 1u;
+            create_ud->md_rw_cb_ud.iod[2].iod_size = (uint64_t)acpl_size;
+            create_ud->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
+            create_ud->md_rw_cb_ud.iod[2].iod_flags = DAOS_COND_AKEY_INSERT;
+
+            /* Set up sgl */
+
+            /* sgl[0] contains the serialized datatype description */
+            daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[0], type_buf, (daos_size_t)type_size);
+            create_ud->md_rw_cb_ud.sgl[0].sg_nr = 1;
+            create_ud->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+            create_ud->md_rw_cb_ud.sgl[0].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[0];
+            create_ud->md_rw_cb_ud.free_sg_iov[0] = FALSE;
+
+            /* sgl[1] contains the serialized dataspace description */
+            daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[1], space_buf, (daos_size_t)space_size);
+            create_ud->md_rw_cb_ud.sgl[1].sg_nr = 1;
+            create_ud->md_rw_cb_ud.sgl[1].sg_nr_out = 0;
+            create_ud->md_rw_cb_ud.sgl[1].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[1];
+            create_ud->md_rw_cb_ud.free_sg_iov[1] = FALSE;
+
+            /* sgl[2] contains the serialized ACPL */
+            daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[2], acpl_buf, (daos_size_t)acpl_size);
+            create_ud->md_rw_cb_ud.sgl[2].sg_nr = 1;
+            create_ud->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
+            create_ud->md_rw_cb_ud.sgl[2].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[2];
+            create_ud->md_rw_cb_ud.free_sg_iov[2] = FALSE;
 
-        /* sgl[0] contains the serialized datatype description */
-        daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[0], type_buf, (daos_size_t)type_size);
-        create_ud->md_rw_cb_ud.sgl[0].sg_nr = 1;
-        create_ud->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-        create_ud->md_rw_cb_ud.sgl[0].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[0];
-        create_ud->md_rw_cb_ud.free_sg_iov[0] = FALSE;
-
-        /* sgl[1] contains the serialized dataspace description */
-        daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[1], space_buf, (daos_size_t)space_size);
-        create_ud->md_rw_cb_ud.sgl[1].sg_nr = 1;
-        create_ud->md_rw_cb_ud.sgl[1].sg_nr_out = 0;
-        create_ud->md_rw_cb_ud.sgl[1].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[1];
-        create_ud->md_rw_cb_ud.free_sg_iov[1] = FALSE;
-
-        /* sgl[2] contains the serialized ACPL */
-        daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[2], acpl_buf, (daos_size_t)acpl_size);
-        create_ud->md_rw_cb_ud.sgl[2].sg_nr = 1;
-        create_ud->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
-        create_ud->md_rw_cb_ud.sgl[2].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[2];
-        create_ud->md_rw_cb_ud.free_sg_iov[2] = FALSE;
-
-        /* Set nr */
-        create_ud->md_rw_cb_ud.nr = 3u;
+            /* Set nr */
+            create_ud->md_rw_cb_ud.nr = 3u;
+        } /* end else */
 
         /* Set task name */
         create_ud->md_rw_cb_ud.task_name = "attribute metadata write";
@@ -854,19 +1061,15 @@ H5_daos_attribute_create_helper(H5_daos_item_t *item, const H5VL_loc_params_t *l
         create_ud = NULL;
     } /* end if */
 
-    /* Finish setting up attribute struct */
-    if((attr->type_id = H5Tcopy(type_id)) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "failed to copy datatype");
-    if((attr->file_type_id = H5VLget_file_type(item->file, H5_DAOS_g, type_id)) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, NULL, "failed to get file datatype");
-    if(0 == (attr->file_type_size = H5Tget_size(attr->file_type_id)))
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, NULL, "can't get file datatype size");
-    if((attr->space_id = H5Scopy(space_id)) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "failed to copy dataspace");
-    if(!default_acpl && (attr->acpl_id = H5Pcopy(acpl_id)) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, NULL, "failed to copy ACPL");
-    if(H5Sselect_all(attr->space_id) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, NULL, "can't change selection");
+    /* Other processes still need the packed metadata record to write inline
+     * raw data */
+    if(inline_raw_size && !attr->packed_md)
+        if(H5_daos_attribute_encode_packed(item->file, type_id, space_id, acpl_id,
+                H5_DAOS_ATTR_PACKED_RAW_INLINE, 0, &attr->packed_md, &attr->packed_md_len) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, NULL, "can't encode packed attribute metadata");
+
+    /* Try this attribute's layout first on subsequent opens */
+    item->file->attr_open_try_packed = packed;
 
     ret_value = (void *)attr;
 
@@ -925,6 +1128,8 @@ done:
         int_int_req = NULL;
 
         /* Free memory */
+        if(create_ud && create_ud->md_rw_cb_ud.free_sg_iov[0])
+            DV_free(create_ud->md_rw_cb_ud.sg_iov[0].iov_buf);
         create_ud = DV_free(create_ud);
     } /* end if */
 
@@ -1090,54 +1295,59 @@ H5_daos_attribute_create_get_crt_order_info(H5_daos_attr_create_ud_t *create_ud,
     assert(req);
     assert(first_task);
     assert(dep_task);
-    assert(create_ud->md_rw_cb_ud.nr == 3u);
+    assert(create_ud->md_rw_cb_ud.nr == 3u || create_ud->md_rw_cb_ud.nr == 1u);
+
+    /* The creation order iods follow the attribute metadata iods */
+    create_ud->corder_iod = create_ud->md_rw_cb_ud.nr;
 
     /* Create task to read object's current number of attributes
      * and maximum attribute creation order value
      */
 
-    /* Modify existing iod. iod[3] contains the key for the number of attributes.
-     * iod[4] contains the key for the object's max. attribute creation order value.
-     * iod[0], iod[1] and iod[2] are assumed to already be set.
+    /* Modify existing iod.  Creation order iods are numbered from corder_iod
+     * (3, or 1 for the packed layout), which follow the attribute metadata
+     * iods that are assumed to already be set.  iod[corder_iod] contains the
+     * key for the number of attributes.  iod[corder_iod + 1] contains the key
+     * for the object's max. attribute creation order value.
      */
-    daos_const_iov_set((d_const_iov_t *)&create_ud->md_rw_cb_ud.iod[3].iod_name,
+    daos_const_iov_set((d_const_iov_t *)&create_ud->md_rw_cb_ud.iod[create_ud->corder_iod].iod_name,
             H5_daos_nattr_key_g, H5_daos_nattr_key_size_g);
-    create_ud->md_rw_cb_ud.iod[3].iod_nr = 1u;
-    create_ud->md_rw_cb_ud.iod[3].iod_size = (uint64_t)8;
-    create_ud->md_rw_cb_ud.iod[3].iod_type = DAOS_IOD_SINGLE;
-    create_ud->md_rw_cb_ud.iod[3].iod_flags = 0;
+    create_ud->md_rw_cb_ud.iod[create_ud->corder_iod].iod_nr = 1u;
+    create_ud->md_rw_cb_ud.iod[create_ud->corder_iod].iod_size = (uint64_t)8;
+    create_ud->md_rw_cb_ud.iod[create_ud->corder_iod].iod_type = DAOS_IOD_SINGLE;
+    create_ud->md_rw_cb_ud.iod[create_ud->corder_iod].iod_flags = 0;
 
-    daos_const_iov_set((d_const_iov_t *)&create_ud->md_rw_cb_ud.iod[4].iod_name,
+    daos_const_iov_set((d_const_iov_t *)&create_ud->md_rw_cb_ud.iod[create_ud->corder_iod + 1].iod_name,
             H5_daos_max_attr_corder_key_g, H5_daos_max_attr_corder_key_size_g);
-    create_ud->md_rw_cb_ud.iod[4].iod_nr = 1u;
-    create_ud->md_rw_cb_ud.iod[4].iod_size = (uint64_t)8;
-    create_ud->md_rw_cb_ud.iod[4].iod_type = DAOS_IOD_SINGLE;
-    create_ud->md_rw_cb_ud.iod[4].iod_flags = 0;
+    create_ud->md_rw_cb_ud.iod[create_ud->corder_iod + 1].iod_nr = 1u;
+    create_ud->md_rw_cb_ud.iod[create_ud->corder_iod + 1].iod_size = (uint64_t)8;
+    create_ud->md_rw_cb_ud.iod[create_ud->corder_iod + 1].iod_type = DAOS_IOD_SINGLE;
+    create_ud->md_rw_cb_ud.iod[create_ud->corder_iod + 1].iod_flags = 0;
 
     /* Modify existing sgl.
      *
-     * sgl[3] contains the read buffer for the number of attributes.
-     * We will reuse this buffer in sgl[5] after the read operation.  When it's
+     * sgl[corder_iod] contains the read buffer for the number of attributes.
+     * We will reuse this buffer in sgl[corder_iod + 2] after the read operation.  When it's
      * written to disk it needs to contain a leading 0 byte to guarantee it
      * doesn't conflict with a string akey used in the attribute dkey, so we
      * will read the number of attributes to the last 8 bytes of the buffer.
      *
-     * sgl[4] contains the read buffer for the object's max. attribute creation
+     * sgl[corder_iod + 1] contains the read buffer for the object's max. attribute creation
      * order value. It is used to determine an attribute's permanent creation
      * order value.
      */
     create_ud->nattr_old_buf[0] = 0;
-    daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[3], &create_ud->nattr_old_buf[1], (daos_size_t)8);
-    create_ud->md_rw_cb_ud.sgl[3].sg_nr = 1;
-    create_ud->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
-    create_ud->md_rw_cb_ud.sgl[3].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[3];
-    create_ud->md_rw_cb_ud.free_sg_iov[3] = FALSE;
-
-    daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[4], create_ud->max_corder_old_buf, (daos_size_t)8);
-    create_ud->md_rw_cb_ud.sgl[4].sg_nr = 1;
-    create_ud->md_rw_cb_ud.sgl[4].sg_nr_out = 0;
-    create_ud->md_rw_cb_ud.sgl[4].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[4];
-    create_ud->md_rw_cb_ud.free_sg_iov[4] = FALSE;
+    daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[create_ud->corder_iod], &create_ud->nattr_old_buf[1], (daos_size_t)8);
+    create_ud->md_rw_cb_ud.sgl[create_ud->corder_iod].sg_nr = 1;
+    create_ud->md_rw_cb_ud.sgl[create_ud->corder_iod].sg_nr_out = 0;
+    create_ud->md_rw_cb_ud.sgl[create_ud->corder_iod].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[create_ud->corder_iod];
+    create_ud->md_rw_cb_ud.free_sg_iov[create_ud->corder_iod] = FALSE;
+
+    daos_iov_set(&create_ud->md_rw_cb_ud.sg_iov[create_ud->corder_iod + 1], create_ud->max_corder_old_buf, (daos_size_t)8);
+    create_ud->md_rw_cb_ud.sgl[create_ud->corder_iod + 1].sg_nr = 1;
+    create_ud->md_rw_cb_ud.sgl[create_ud->corder_iod + 1].sg_nr_out = 0;
+    create_ud->md_rw_cb_ud.sgl[create_ud->corder_iod + 1].sg_iovs = &create_ud->md_rw_cb_ud.sg_iov[create_ud->corder_iod + 1];
+    create_ud->md_rw_cb_ud.free_sg_iov[create_ud->corder_iod + 1] = FALSE;
 
     /* Create task for attribute creation order metadata fetch */
     if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
@@ -1207,8 +1417,8 @@ H5_daos_attribute_create_get_crt_order_info_prep_cb(tse_task_t *task,
         update_args->flags = udata->md_rw_cb_ud.flags;
         update_args->dkey = &udata->md_rw_cb_ud.dkey;
         update_args->nr = 2u;
-        update_args->iods = &udata->md_rw_cb_ud.iod[3];
-        update_args->sgls = &udata->md_rw_cb_ud.sgl[3];
+        update_args->iods = &udata->md_rw_cb_ud.iod[udata->corder_iod];
+        update_args->sgls = &udata->md_rw_cb_ud.sgl[udata->corder_iod];
     } /* end if */
     else
         tse_task_complete(task, 0);
@@ -1266,16 +1476,16 @@ H5_daos_attribute_create_get_crt_order_info_comp_cb(tse_task_t *task,
         p = &udata->nattr_old_buf[1];
 
         /* Check for no num attributes found, in this case it must be 0 */
-        if(udata->md_rw_cb_ud.iod[3].iod_size == (uint64_t)0) {
+        if(udata->md_rw_cb_ud.iod[udata->corder_iod].iod_size == (uint64_t)0) {
             nattr = 0;
             UINT64ENCODE(p, nattr);
 
             /* Reset iod size */
-            udata->md_rw_cb_ud.iod[3].iod_size = (uint64_t)8;
+            udata->md_rw_cb_ud.iod[udata->corder_iod].iod_size = (uint64_t)8;
         } /* end if */
         else {
             /* Verify the iod size was 8 as expected */
-            if(udata->md_rw_cb_ud.iod[3].iod_size != (uint64_t)8)
+            if(udata->md_rw_cb_ud.iod[udata->corder_iod].iod_size != (uint64_t)8)
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTDECODE, -H5_DAOS_BAD_VALUE,
                         "invalid size of number of attributes value");
 
@@ -1289,16 +1499,16 @@ H5_daos_attribute_create_get_crt_order_info_comp_cb(tse_task_t *task,
         p = udata->max_corder_old_buf;
 
         /* Check for no max creation order record found, in which case it must be 0 */
-        if(udata->md_rw_cb_ud.iod[4].iod_size == (uint64_t)0) {
+        if(udata->md_rw_cb_ud.iod[udata->corder_iod + 1].iod_size == (uint64_t)0) {
             max_corder = 0;
             UINT64ENCODE(p, max_corder);
 
             /* Reset iod size */
-            udata->md_rw_cb_ud.iod[4].iod_size = (uint64_t)8;
+            udata->md_rw_cb_ud.iod[udata->corder_iod + 1].iod_size = (uint64_t)8;
         } /* end if */
         else {
             /* Verify the iod size was 8 as expected */
-            if(udata->md_rw_cb_ud.iod[4].iod_size != (uint64_t)8)
+            if(udata->md_rw_cb_ud.iod[udata->corder_iod + 1].iod_size != (uint64_t)8)
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTDECODE, -H5_DAOS_BAD_VALUE,
                         "invalid size of maximum attribute creation order record");
 
@@ -1317,67 +1527,73 @@ H5_daos_attribute_create_get_crt_order_info_comp_cb(tse_task_t *task,
         UINT64ENCODE(p, max_corder);
 
         /* Set up iod for subsequent daos_obj_update call.
-         * iod[3] contains the key for the number of attributes.
+         * iod[corder_iod] contains the key for the number of attributes.
          * Already set up from read operation.
-         * iod[4] contains the key for the object's maximum attribute
+         * iod[corder_iod + 1] contains the key for the object's maximum attribute
          * creation order value. Already set up from read operation.
          */
 
-        /* iod[5] contains the creation order of the new attribute, used as
+        /* Sparse creation order indices are keyed by the attribute's
+         * permanent creation order value instead of its position in the
+         * index */
+        if(H5_DAOS_OBJ_SPARSE_CORDER(udata->attr->parent))
+            memcpy(&udata->nattr_old_buf[1], udata->max_corder_old_buf, H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+
+        /* iod[corder_iod + 2] contains the creation order of the new attribute, used as
          * an akey for retrieving the attribute name to enable attribute
          * lookup by creation order */
-        daos_iov_set(&udata->md_rw_cb_ud.iod[5].iod_name, (void *)udata->nattr_old_buf, 9);
-        udata->md_rw_cb_ud.iod[5].iod_nr = 1u;
-        udata->md_rw_cb_ud.iod[5].iod_size = (uint64_t)name_len;
-        udata->md_rw_cb_ud.iod[5].iod_type = DAOS_IOD_SINGLE;
-        udata->md_rw_cb_ud.iod[5].iod_flags = 0;
+        daos_iov_set(&udata->md_rw_cb_ud.iod[udata->corder_iod + 2].iod_name, (void *)udata->nattr_old_buf, 9);
+        udata->md_rw_cb_ud.iod[udata->corder_iod + 2].iod_nr = 1u;
+        udata->md_rw_cb_ud.iod[udata->corder_iod + 2].iod_size = (uint64_t)name_len;
+        udata->md_rw_cb_ud.iod[udata->corder_iod + 2].iod_type = DAOS_IOD_SINGLE;
+        udata->md_rw_cb_ud.iod[udata->corder_iod + 2].iod_flags = 0;
 
-        /* iod[6] contains the key for the creation order, to enable attribute
+        /* iod[corder_iod + 3] contains the key for the creation order, to enable attribute
          * creation order lookup by name */
-        daos_iov_set(&udata->md_rw_cb_ud.iod[6].iod_name,
+        daos_iov_set(&udata->md_rw_cb_ud.iod[udata->corder_iod + 3].iod_name,
                 udata->akeys[3].iov_buf, (daos_size_t)udata->akeys[3].iov_len);
-        udata->md_rw_cb_ud.iod[6].iod_nr = 1u;
-        udata->md_rw_cb_ud.iod[6].iod_size = (uint64_t)8;
-        udata->md_rw_cb_ud.iod[6].iod_type = DAOS_IOD_SINGLE;
-        udata->md_rw_cb_ud.iod[6].iod_flags = 0;
+        udata->md_rw_cb_ud.iod[udata->corder_iod + 3].iod_nr = 1u;
+        udata->md_rw_cb_ud.iod[udata->corder_iod + 3].iod_size = (uint64_t)8;
+        udata->md_rw_cb_ud.iod[udata->corder_iod + 3].iod_type = DAOS_IOD_SINGLE;
+        udata->md_rw_cb_ud.iod[udata->corder_iod + 3].iod_flags = 0;
 
         /* Set up sgl for subsequent daos_obj_update call. */
 
-        /* sgl[3] contains the number of attributes, updated to include
+        /* sgl[corder_iod] contains the number of attributes, updated to include
          * the new attribute */
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[3], udata->nattr_new_buf, (daos_size_t)8);
-        udata->md_rw_cb_ud.sgl[3].sg_nr = 1;
-        udata->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
-        udata->md_rw_cb_ud.sgl[3].sg_iovs = &udata->md_rw_cb_ud.sg_iov[3];
-        udata->md_rw_cb_ud.free_sg_iov[3] = FALSE;
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[udata->corder_iod], udata->nattr_new_buf, (daos_size_t)8);
+        udata->md_rw_cb_ud.sgl[udata->corder_iod].sg_nr = 1;
+        udata->md_rw_cb_ud.sgl[udata->corder_iod].sg_nr_out = 0;
+        udata->md_rw_cb_ud.sgl[udata->corder_iod].sg_iovs = &udata->md_rw_cb_ud.sg_iov[udata->corder_iod];
+        udata->md_rw_cb_ud.free_sg_iov[udata->corder_iod] = FALSE;
 
-        /* sgl[4] contains the object's maximum creation order value, updated
+        /* sgl[corder_iod + 1] contains the object's maximum creation order value, updated
          * to include the new attribute
          */
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[4], udata->max_corder_new_buf, (daos_size_t)8);
-        udata->md_rw_cb_ud.sgl[4].sg_nr = 1;
-        udata->md_rw_cb_ud.sgl[4].sg_nr_out = 0;
-        udata->md_rw_cb_ud.sgl[4].sg_iovs = &udata->md_rw_cb_ud.sg_iov[4];
-        udata->md_rw_cb_ud.free_sg_iov[4] = FALSE;
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[udata->corder_iod + 1], udata->max_corder_new_buf, (daos_size_t)8);
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 1].sg_nr = 1;
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 1].sg_nr_out = 0;
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 1].sg_iovs = &udata->md_rw_cb_ud.sg_iov[udata->corder_iod + 1];
+        udata->md_rw_cb_ud.free_sg_iov[udata->corder_iod + 1] = FALSE;
 
-        /* sgl[5] contains the attribute name, here indexed using the creation
+        /* sgl[corder_iod + 2] contains the attribute name, here indexed using the creation
          * order as the akey to enable attribute lookup by creation order */
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[5], (void *)udata->attr->name, (daos_size_t)name_len);
-        udata->md_rw_cb_ud.sgl[5].sg_nr = 1;
-        udata->md_rw_cb_ud.sgl[5].sg_nr_out = 0;
-        udata->md_rw_cb_ud.sgl[5].sg_iovs = &udata->md_rw_cb_ud.sg_iov[5];
-        udata->md_rw_cb_ud.free_sg_iov[5] = FALSE;
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[udata->corder_iod + 2], (void *)udata->attr->name, (daos_size_t)name_len);
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 2].sg_nr = 1;
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 2].sg_nr_out = 0;
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 2].sg_iovs = &udata->md_rw_cb_ud.sg_iov[udata->corder_iod + 2];
+        udata->md_rw_cb_ud.free_sg_iov[udata->corder_iod + 2] = FALSE;
 
-        /* sgl[6] contains the creation order (with no leading 0), to enable
+        /* sgl[corder_iod + 3] contains the creation order (with no leading 0), to enable
          * attribute creation order lookup by name */
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[6], udata->max_corder_old_buf, (daos_size_t)8);
-        udata->md_rw_cb_ud.sgl[6].sg_nr = 1;
-        udata->md_rw_cb_ud.sgl[6].sg_nr_out = 0;
-        udata->md_rw_cb_ud.sgl[6].sg_iovs = &udata->md_rw_cb_ud.sg_iov[6];
-        udata->md_rw_cb_ud.free_sg_iov[6] = FALSE;
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[udata->corder_iod + 3], udata->max_corder_old_buf, (daos_size_t)8);
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 3].sg_nr = 1;
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 3].sg_nr_out = 0;
+        udata->md_rw_cb_ud.sgl[udata->corder_iod + 3].sg_iovs = &udata->md_rw_cb_ud.sg_iov[udata->corder_iod + 3];
+        udata->md_rw_cb_ud.free_sg_iov[udata->corder_iod + 3] = FALSE;
 
         /* Update nr for subsequent daos_obj_update call */
-        udata->md_rw_cb_ud.nr = 7u;
+        udata->md_rw_cb_ud.nr = udata->corder_iod + 4;
 
         /* Set conditional per-akey insert for the attribute metadata write operation */
         udata->md_rw_cb_ud.flags = DAOS_COND_PER_AKEY;
@@ -1543,7 +1759,6 @@ H5_daos_attribute_open_helper(H5_daos_item_t *item, const H5VL_loc_params_t *loc
     H5_daos_attr_ibcast_ud_t *bcast_udata = NULL;
     H5_daos_attr_t *attr = NULL;
     daos_key_t akeys[3];
-    size_t ainfo_buf_size = 0;
     void *akeys_buf = NULL;
     H5_daos_req_t *int_int_req = NULL;
     int ret;
@@ -1587,12 +1802,7 @@ H5_daos_attribute_open_helper(H5_daos_item_t *item, const H5VL_loc_params_t *loc
         bcast_udata->bcast_ud.count = H5_DAOS_AINFO_BCAST_BUF_SIZE;
         bcast_udata->bcast_ud.comm = req->file->comm;
         bcast_udata->attr = attr;
-
-        ainfo_buf_size = H5_DAOS_AINFO_BCAST_BUF_SIZE;
     } /* end if */
-    else
-        ainfo_buf_size = H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE
-                + H5_DAOS_ACPL_BUF_SIZE;
 
     /* Determine attribute's name and parent object */
     switch (loc_params->type) {
@@ -1668,7 +1878,7 @@ H5_daos_attribute_open_helper(H5_daos_item_t *item, const H5VL_loc_params_t *loc
 
     if(!collective || (item->file->my_rank == 0)) {
         tse_task_t *fetch_task;
-        uint8_t *p;
+        unsigned i;
 
         /* Set up akey strings (attribute name prefixed with 'T-', 'S-' and 'P-' for
          * datatype, dataspace and ACPL, respectively) */
@@ -1677,9 +1887,16 @@ H5_daos_attribute_open_helper(H5_daos_item_t *item, const H5VL_loc_params_t *loc
 
         /* Allocate argument struct for fetch task */
         if(NULL == (open_udata = (H5_daos_attr_open_ud_t *)DV_calloc(sizeof(H5_daos_attr_open_ud_t)
-                + (bcast_udata ? 0 : ainfo_buf_size))))
+                + (bcast_udata ? 0 : H5_DAOS_AINFO_BCAST_BUF_SIZE))))
             D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate buffer for fetch callback arguments");
         open_udata->attr = attr;
+        if(!bcast_udata) {
+            open_udata->ainfo_buf = open_udata->flex_buf;
+            open_udata->ainfo_buf_len = H5_DAOS_AINFO_BCAST_BUF_SIZE;
+        } /* end if */
+
+        /* Try the layout last seen in this file first */
+        open_udata->packed = item->file->attr_open_try_packed;
 
         /* Set up operation to read datatype, dataspace, and ACPL sizes from attribute */
         /* Set up ud struct */
@@ -1691,55 +1908,23 @@ H5_daos_attribute_open_helper(H5_daos_item_t *item, const H5VL_loc_params_t *loc
         daos_const_iov_set((d_const_iov_t *)&open_udata->md_rw_cb_ud.dkey, H5_daos_attr_key_g, H5_daos_attr_key_size_g);
         open_udata->md_rw_cb_ud.free_dkey = FALSE;
 
-        /* Set up iod */
-        daos_iov_set(&open_udata->md_rw_cb_ud.iod[0].iod_name, akeys[0].iov_buf, (daos_size_t)akeys[0].iov_len);
-        open_udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
-        open_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
-        open_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
-
-        daos_iov_set(&open_udata->md_rw_cb_ud.iod[1].iod_name, akeys[1].iov_buf, (daos_size_t)akeys[1].iov_len);
-        open_udata->md_rw_cb_ud.iod[1].iod_nr = 1u;
-        open_udata->md_rw_cb_ud.iod[1].iod_size = DAOS_REC_ANY;
-        open_udata->md_rw_cb_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
-
-        daos_iov_set(&open_udata->md_rw_cb_ud.iod[2].iod_name, akeys[2].iov_buf, (daos_size_t)akeys[2].iov_len);
-        open_udata->md_rw_cb_ud.iod[2].iod_nr = 1u;
-        open_udata->md_rw_cb_ud.iod[2].iod_size = DAOS_REC_ANY;
-        open_udata->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
-
+        /* Set up iods and sgls for both layouts.  The packed layout uses
+         * only the first, with the datatype key. */
+        for(i = 0; i < 3; i++) {
+            daos_iov_set(&open_udata->md_rw_cb_ud.iod[i].iod_name, akeys[i].iov_buf, (daos_size_t)akeys[i].iov_len);
+            open_udata->md_rw_cb_ud.iod[i].iod_nr = 1u;
+            open_udata->md_rw_cb_ud.iod[i].iod_type = DAOS_IOD_SINGLE;
+
+            open_udata->md_rw_cb_ud.sgl[i].sg_nr = 1;
+            open_udata->md_rw_cb_ud.sgl[i].sg_iovs = &open_udata->md_rw_cb_ud.sg_iov[i];
+            open_udata->md_rw_cb_ud.free_sg_iov[i] = FALSE;
+        } /* end for */
         open_udata->md_rw_cb_ud.free_akeys = FALSE;
-
-        /* Set up buffer */
-        if(bcast_udata)
-            p = bcast_udata->flex_buf + (3 * H5_DAOS_ENCODED_UINT64_T_SIZE);
-        else
-            p = open_udata->flex_buf;
-
-        /* Set up sgl */
-        daos_iov_set(&open_udata->md_rw_cb_ud.sg_iov[0], p, (daos_size_t)H5_DAOS_TYPE_BUF_SIZE);
-        open_udata->md_rw_cb_ud.sgl[0].sg_nr = 1;
-        open_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-        open_udata->md_rw_cb_ud.sgl[0].sg_iovs = &open_udata->md_rw_cb_ud.sg_iov[0];
-        open_udata->md_rw_cb_ud.free_sg_iov[0] = FALSE;
-        p += H5_DAOS_TYPE_BUF_SIZE;
-        daos_iov_set(&open_udata->md_rw_cb_ud.sg_iov[1], p, (daos_size_t)H5_DAOS_SPACE_BUF_SIZE);
-        open_udata->md_rw_cb_ud.sgl[1].sg_nr = 1;
-        open_udata->md_rw_cb_ud.sgl[1].sg_nr_out = 0;
-        open_udata->md_rw_cb_ud.sgl[1].sg_iovs = &open_udata->md_rw_cb_ud.sg_iov[1];
-        open_udata->md_rw_cb_ud.free_sg_iov[1] = FALSE;
-        p += H5_DAOS_SPACE_BUF_SIZE;
-        daos_iov_set(&open_udata->md_rw_cb_ud.sg_iov[2], p, (daos_size_t)H5_DAOS_ACPL_BUF_SIZE);
-        open_udata->md_rw_cb_ud.sgl[2].sg_nr = 1;
-        open_udata->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
-        open_udata->md_rw_cb_ud.sgl[2].sg_iovs = &open_udata->md_rw_cb_ud.sg_iov[2];
-        open_udata->md_rw_cb_ud.free_sg_iov[2] = FALSE;
+        H5_daos_ainfo_fetch_setup(open_udata, FALSE);
 
         /* Set conditional akey fetch for attribute metadata read operation */
         open_udata->md_rw_cb_ud.flags = DAOS_COND_AKEY_FETCH;
 
-        /* Set nr */
-        open_udata->md_rw_cb_ud.nr = 3u;
-
         /* Set task name */
         open_udata->md_rw_cb_ud.task_name = "attribute metadata read";
 
@@ -1781,7 +1966,7 @@ done:
     /* Broadcast attribute info */
     if(bcast_udata) {
         if(H5_daos_mpi_ibcast((H5_daos_mpi_ibcast_ud_t *)bcast_udata, NULL,
-                ainfo_buf_size, NULL == ret_value ? TRUE : FALSE, NULL,
+                H5_DAOS_AINFO_BCAST_BUF_SIZE, NULL == ret_value ? TRUE : FALSE, NULL,
                 item->file->my_rank == 0 ? H5_daos_attribute_open_bcast_comp_cb : H5_daos_attribute_open_recv_comp_cb,
                 req, first_task, dep_task) < 0) {
             DV_free(bcast_udata);
@@ -1895,7 +2080,7 @@ H5_daos_attribute_open_by_idx_helper(H5_daos_obj_t *target_obj, const H5VL_loc_p
     /* Retrieve the attribute's name by index */
     if(H5_daos_attribute_get_name_by_idx_alloc(attr_parent_obj,
             loc_params->loc_data.loc_by_idx.idx_type, loc_params->loc_data.loc_by_idx.order,
-            (uint64_t)loc_params->loc_data.loc_by_idx.n, &target_attr_name,
+            (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL, &target_attr_name,
             &target_attr_name_len, &attr_name_buf, NULL, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute name");
 
@@ -2058,6 +2243,7 @@ H5_daos_attribute_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *arg
         udata->bcast_ud.req->failed_task = "MPI_Ibcast attribute info";
     } /* end if */
     else if(task->dt_result == 0) {
+        uint64_t flags = 0;
         uint64_t type_buf_len = 0;
         uint64_t space_buf_len = 0;
         uint64_t acpl_buf_len = 0;
@@ -2069,7 +2255,8 @@ H5_daos_attribute_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *arg
         assert(udata->attr->parent->item.file);
         assert(udata->attr->parent->item.file->my_rank > 0);
 
-        /* Decode serialized info lengths */
+        /* Decode layout flags and serialized info lengths */
+        UINT64DECODE(p, flags)
         UINT64DECODE(p, type_buf_len)
         UINT64DECODE(p, space_buf_len)
         UINT64DECODE(p, acpl_buf_len)
@@ -2079,7 +2266,7 @@ H5_daos_attribute_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *arg
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_REMOTE_ERROR, "lead process failed to open attribute");
 
         /* Calculate data length */
-        ainfo_len = (size_t)type_buf_len + (size_t)space_buf_len + (size_t)acpl_buf_len + 3 * sizeof(uint64_t);
+        ainfo_len = (size_t)type_buf_len + (size_t)space_buf_len + (size_t)acpl_buf_len + H5_DAOS_AINFO_HDR_SIZE;
 
         /* Reissue bcast if necesary */
         if(ainfo_len > (size_t)udata->bcast_ud.count) {
@@ -2107,7 +2294,7 @@ H5_daos_attribute_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *arg
         }
         else {
             /* Finish building attribute object */
-            if(0 != (ret = H5_daos_attribute_open_end(udata->attr, p, type_buf_len, space_buf_len, acpl_buf_len)))
+            if(0 != (ret = H5_daos_attribute_open_end(udata->attr, p, flags, type_buf_len, space_buf_len, acpl_buf_len)))
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, ret, "can't finish opening attribute");
         } /* end else */
     } /* end else */
@@ -2157,7 +2344,10 @@ done:
  * Function:    H5_daos_attribute_open_end
  *
  * Purpose:     Decode serialized attribute info from a buffer and fill
- *              caches.
+ *              caches.  Records the attribute's layout from
+ *              H5_DAOS_AINFO_PACKED in flags.  If flags has
+ *              H5_DAOS_ATTR_PACKED_RAW_INLINE set, also rebuilds the
+ *              attribute's packed metadata record for raw data I/O.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2165,8 +2355,8 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_attribute_open_end(H5_daos_attr_t *attr, uint8_t *p, uint64_t type_buf_len,
-    uint64_t space_buf_len, uint64_t acpl_buf_len)
+H5_daos_attribute_open_end(H5_daos_attr_t *attr, uint8_t *p, uint64_t flags,
+    uint64_t type_buf_len, uint64_t space_buf_len, uint64_t acpl_buf_len)
 {
     int ret_value = 0;
 
@@ -2175,6 +2365,25 @@ H5_daos_attribute_open_end(H5_daos_attr_t *attr, uint8_t *p, uint64_t type_buf_l
     assert(p);
     assert(type_buf_len > 0);
 
+    attr->packed = (flags & H5_DAOS_AINFO_PACKED) ? TRUE : FALSE;
+
+    /* Rebuild packed metadata record if raw data is stored inline */
+    if(flags & H5_DAOS_ATTR_PACKED_RAW_INLINE) {
+        uint8_t *md_p;
+
+        attr->packed_md_len = H5_DAOS_ATTR_PACKED_HDR_SIZE + (size_t)type_buf_len
+                + (size_t)space_buf_len + (size_t)acpl_buf_len;
+        if(NULL == (attr->packed_md = (uint8_t *)DV_malloc(attr->packed_md_len)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for packed attribute metadata");
+        md_p = attr->packed_md;
+        *md_p++ = H5_DAOS_ATTR_PACKED_SIG;
+        *md_p++ = (uint8_t)flags;
+        UINT64ENCODE(md_p, type_buf_len)
+        UINT64ENCODE(md_p, space_buf_len)
+        UINT64ENCODE(md_p, acpl_buf_len)
+        memcpy(md_p, p, attr->packed_md_len - H5_DAOS_ATTR_PACKED_HDR_SIZE);
+    } /* end if */
+
     /* Decode datatype */
     if((attr->type_id = H5Tdecode(p)) < 0)
         D_GOTO_ERROR(H5E_ARGS, H5E_CANTDECODE, -H5_DAOS_H5_DECODE_ERROR, "can't deserialize datatype");
@@ -2208,6 +2417,73 @@ done:
 } /* end H5_daos_attribute_open_end() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_ainfo_fetch_setup
+ *
+ * Purpose:     Sets up the iods and sgls of an attribute metadata fetch
+ *              for the layout in udata->packed, in the attribute info
+ *              buffer after its header.  For the packed layout the
+ *              record's own header is placed so that its lengths land in
+ *              the attribute info header.  If exact is TRUE the iod sizes
+ *              returned by the previous fetch are used, otherwise the
+ *              sizes are reset.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_ainfo_fetch_setup(H5_daos_attr_open_ud_t *udata, hbool_t exact)
+{
+    uint8_t *p;
+    size_t buf_len;
+
+    assert(udata);
+
+    if(udata->bcast_udata) {
+        p = udata->bcast_udata->buffer;
+        buf_len = (size_t)udata->bcast_udata->buffer_len;
+    } /* end if */
+    else {
+        p = udata->ainfo_buf;
+        buf_len = udata->ainfo_buf_len;
+    } /* end else */
+    assert(buf_len >= H5_DAOS_AINFO_BCAST_BUF_SIZE);
+
+    if(udata->packed) {
+        p += H5_DAOS_AINFO_HDR_SIZE - H5_DAOS_ATTR_PACKED_HDR_SIZE;
+        if(!exact)
+            udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], p, exact ? udata->md_rw_cb_ud.iod[0].iod_size
+                : (daos_size_t)(buf_len - H5_DAOS_AINFO_HDR_SIZE + H5_DAOS_ATTR_PACKED_HDR_SIZE));
+        udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+        udata->md_rw_cb_ud.nr = 1u;
+    } /* end if */
+    else {
+        p += H5_DAOS_AINFO_HDR_SIZE;
+        if(!exact) {
+            udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
+            udata->md_rw_cb_ud.iod[1].iod_size = DAOS_REC_ANY;
+            udata->md_rw_cb_ud.iod[2].iod_size = DAOS_REC_ANY;
+        } /* end if */
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], p, exact ? udata->md_rw_cb_ud.iod[0].iod_size
+                : (daos_size_t)H5_DAOS_TYPE_BUF_SIZE);
+        udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+        p += udata->md_rw_cb_ud.sg_iov[0].iov_buf_len;
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[1], p, exact ? udata->md_rw_cb_ud.iod[1].iod_size
+                : (daos_size_t)H5_DAOS_SPACE_BUF_SIZE);
+        udata->md_rw_cb_ud.sgl[1].sg_nr_out = 0;
+        p += udata->md_rw_cb_ud.sg_iov[1].iov_buf_len;
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[2], p, exact ? udata->md_rw_cb_ud.iod[2].iod_size
+                : (daos_size_t)H5_DAOS_ACPL_BUF_SIZE);
+        udata->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
+        udata->md_rw_cb_ud.nr = 3u;
+    } /* end else */
+
+    return;
+} /* end H5_daos_ainfo_fetch_setup() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_ainfo_read_comp_cb
  *
@@ -2223,6 +2499,7 @@ static int
 H5_daos_ainfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
     H5_daos_attr_open_ud_t *udata;
+    hbool_t reissue = FALSE;
     uint8_t *p;
     int ret;
     int ret_value = 0;
@@ -2239,65 +2516,50 @@ H5_daos_ainfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
     /* Check for buffer not large enough */
     if(task->dt_result == -DER_REC2BIG) {
-        tse_task_t *fetch_task;
-        size_t daos_info_len = udata->md_rw_cb_ud.iod[0].iod_size
-                + udata->md_rw_cb_ud.iod[1].iod_size
-                + udata->md_rw_cb_ud.iod[2].iod_size;
+        size_t ainfo_len;
+        uint8_t *ainfo_buf;
 
         assert(udata->md_rw_cb_ud.obj);
 
-        /* Verify iod size makes sense */
-        if(udata->md_rw_cb_ud.sg_iov[0].iov_buf_len != H5_DAOS_TYPE_BUF_SIZE
-                || udata->md_rw_cb_ud.sg_iov[1].iov_buf_len != H5_DAOS_SPACE_BUF_SIZE
-                || udata->md_rw_cb_ud.sg_iov[2].iov_buf_len != H5_DAOS_ACPL_BUF_SIZE)
-            D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "buffer length does not match expected value");
+        /* Calculate attribute info length */
+        if(udata->packed)
+            ainfo_len = H5_DAOS_AINFO_HDR_SIZE - H5_DAOS_ATTR_PACKED_HDR_SIZE
+                    + udata->md_rw_cb_ud.iod[0].iod_size;
+        else
+            ainfo_len = H5_DAOS_AINFO_HDR_SIZE + udata->md_rw_cb_ud.iod[0].iod_size
+                    + udata->md_rw_cb_ud.iod[1].iod_size
+                    + udata->md_rw_cb_ud.iod[2].iod_size;
 
+        /* Reallocate attribute info buffer if necessary */
         if(udata->bcast_udata) {
-            assert(udata->bcast_udata->buffer == ((H5_daos_attr_ibcast_ud_t *)udata->bcast_udata)->flex_buf);
-
-            /* Reallocate attribute info buffer if necessary */
-            if(daos_info_len > H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE + H5_DAOS_ACPL_BUF_SIZE) {
-                if(NULL == (udata->bcast_udata->buffer = DV_malloc(daos_info_len + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE)))
+            if(ainfo_len > (size_t)udata->bcast_udata->buffer_len) {
+                if(NULL == (ainfo_buf = DV_malloc(ainfo_len)))
                     D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for serialized attribute info");
-                udata->bcast_udata->buffer_len = (int)daos_info_len + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE;
+                if(udata->bcast_udata->buffer != ((H5_daos_attr_ibcast_ud_t *)udata->bcast_udata)->flex_buf)
+                    DV_free(udata->bcast_udata->buffer);
+                udata->bcast_udata->buffer = ainfo_buf;
+                udata->bcast_udata->buffer_len = (int)ainfo_len;
             } /* end if */
-
-            /* Set starting point for fetch sg_iovs */
-            p = (uint8_t *)udata->bcast_udata->buffer + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE;
         } /* end if */
-        else {
-            assert(udata->md_rw_cb_ud.sg_iov[0].iov_buf == udata->flex_buf);
-
-            /* Reallocate attribute info buffer if necessary */
-            if(daos_info_len > H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE + H5_DAOS_ACPL_BUF_SIZE) {
-                if(NULL == (udata->md_rw_cb_ud.sg_iov[0].iov_buf = DV_malloc(daos_info_len)))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for serialized attribute info");
-                 udata->md_rw_cb_ud.free_sg_iov[0] = TRUE;
-            } /* end if */
-
-            /* Set starting point for fetch sg_iovs */
-            p = (uint8_t *)udata->md_rw_cb_ud.sg_iov[0].iov_buf;
-        } /* end else */
-
-        /* Set up sgl */
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], p, udata->md_rw_cb_ud.iod[0].iod_size);
-        udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-        p += udata->md_rw_cb_ud.iod[0].iod_size;
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[1], p, udata->md_rw_cb_ud.iod[1].iod_size);
-        udata->md_rw_cb_ud.sgl[1].sg_nr_out = 0;
-        p += udata->md_rw_cb_ud.iod[1].iod_size;
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[2], p, udata->md_rw_cb_ud.iod[2].iod_size);
-        udata->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
-
-        /* Create task for reissued attribute metadata read */
-        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_attribute_md_rw_prep_cb,
-                H5_daos_ainfo_read_comp_cb, udata, &fetch_task) < 0)
-            D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to read attribute metadata");
+        else if(ainfo_len > udata->ainfo_buf_len) {
+            if(NULL == (ainfo_buf = DV_malloc(ainfo_len)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for serialized attribute info");
+            if(udata->ainfo_buf != udata->flex_buf)
+                DV_free(udata->ainfo_buf);
+            udata->ainfo_buf = ainfo_buf;
+            udata->ainfo_buf_len = ainfo_len;
+        } /* end if */
 
-        /* Schedule reissued attribute metadata read task */
-        if(0 != (ret = tse_task_schedule(fetch_task, false)))
-            D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, ret, "can't schedule task to read attribute metadata: %s", H5_daos_err_to_string(ret));
-        udata = NULL;
+        /* Set up sgls with the sizes returned */
+        H5_daos_ainfo_fetch_setup(udata, TRUE);
+        reissue = TRUE;
+    } /* end if */
+    else if(task->dt_result == -DER_NONEXIST && !udata->packed && !udata->tried_other) {
+        /* The dataspace or ACPL key is missing, try the packed layout */
+        udata->packed = TRUE;
+        udata->tried_other = TRUE;
+        H5_daos_ainfo_fetch_setup(udata, FALSE);
+        reissue = TRUE;
     } /* end if */
     else {
         /* Handle errors in fetch task.  Only record error in udata->req_status
@@ -2309,34 +2571,104 @@ H5_daos_ainfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
         } /* end if */
         else if(task->dt_result == 0) {
-            uint64_t type_buf_len = (uint64_t)((char *)udata->md_rw_cb_ud.sg_iov[1].iov_buf
-                    - (char *)udata->md_rw_cb_ud.sg_iov[0].iov_buf);
-            uint64_t space_buf_len = (uint64_t)((char *)udata->md_rw_cb_ud.sg_iov[2].iov_buf
-                    - (char *)udata->md_rw_cb_ud.sg_iov[1].iov_buf);
-            uint64_t acpl_buf_len = (uint64_t)(udata->md_rw_cb_ud.iod[2].iod_size);
-
-            /* Check for missing metadata */
-            if(udata->md_rw_cb_ud.iod[0].iod_size == 0
-                    || udata->md_rw_cb_ud.iod[1].iod_size == 0
-                    || udata->md_rw_cb_ud.iod[2].iod_size == 0)
-                D_GOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, -H5_DAOS_DAOS_GET_ERROR, "internal metadata not found");
-
-            if(udata->bcast_udata) {
-                /* Encode serialized info lengths */
-                p = udata->bcast_udata->buffer;
+            uint8_t *ainfo_buf = udata->bcast_udata ? (uint8_t *)udata->bcast_udata->buffer : udata->ainfo_buf;
+            uint64_t flags = 0;
+            uint64_t type_buf_len;
+            uint64_t space_buf_len;
+            uint64_t acpl_buf_len;
+
+            if(udata->packed) {
+                p = ainfo_buf + H5_DAOS_AINFO_HDR_SIZE - H5_DAOS_ATTR_PACKED_HDR_SIZE;
+
+                /* Check for the packed layout signature.  If it is not
+                 * present this is an attribute in the original layout. */
+                if(udata->md_rw_cb_ud.iod[0].iod_size == 0
+                        || p[0] != H5_DAOS_ATTR_PACKED_SIG) {
+                    if(udata->tried_other)
+                        D_GOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, -H5_DAOS_DAOS_GET_ERROR, "internal metadata not found");
+                    udata->packed = FALSE;
+                    udata->tried_other = TRUE;
+                    H5_daos_ainfo_fetch_setup(udata, FALSE);
+                    reissue = TRUE;
+                } /* end if */
+                else {
+                    /* Decode layout flags and serialized info lengths.  The
+                     * lengths are already in place in the attribute info
+                     * header. */
+                    if(udata->md_rw_cb_ud.iod[0].iod_size < H5_DAOS_ATTR_PACKED_HDR_SIZE)
+                        D_GOTO_ERROR(H5E_ATTR, H5E_CANTDECODE, -H5_DAOS_BAD_VALUE, "invalid size of packed attribute metadata");
+                    flags = (uint64_t)p[1];
+                    p += 2;
+                    UINT64DECODE(p, type_buf_len)
+                    UINT64DECODE(p, space_buf_len)
+                    UINT64DECODE(p, acpl_buf_len)
+                    if(type_buf_len == 0 || H5_DAOS_ATTR_PACKED_HDR_SIZE + type_buf_len + space_buf_len
+                            + acpl_buf_len > udata->md_rw_cb_ud.iod[0].iod_size)
+                        D_GOTO_ERROR(H5E_ATTR, H5E_CANTDECODE, -H5_DAOS_BAD_VALUE, "invalid packed attribute metadata lengths");
+                } /* end else */
+            } /* end if */
+            else {
+                type_buf_len = (uint64_t)((char *)udata->md_rw_cb_ud.sg_iov[1].iov_buf
+                        - (char *)udata->md_rw_cb_ud.sg_iov[0].iov_buf);
+                space_buf_len = (uint64_t)((char *)udata->md_rw_cb_ud.sg_iov[2].iov_buf
+                        - (char *)udata->md_rw_cb_ud.sg_iov[1].iov_buf);
+                acpl_buf_len = (uint64_t)(udata->md_rw_cb_ud.iod[2].iod_size);
+
+                /* Check for missing metadata */
+                if(udata->md_rw_cb_ud.iod[0].iod_size == 0
+                        || udata->md_rw_cb_ud.iod[1].iod_size == 0
+                        || udata->md_rw_cb_ud.iod[2].iod_size == 0)
+                    D_GOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, -H5_DAOS_DAOS_GET_ERROR, "internal metadata not found");
+
+                /* An encoded datatype never starts with the packed layout
+                 * signature */
+                if(((uint8_t *)udata->md_rw_cb_ud.sg_iov[0].iov_buf)[0] == H5_DAOS_ATTR_PACKED_SIG)
+                    D_GOTO_ERROR(H5E_ATTR, H5E_CANTDECODE, -H5_DAOS_BAD_VALUE, "inconsistent attribute metadata layout");
+            } /* end else */
+
+            if(!reissue) {
+                /* Try this layout first on subsequent opens */
+                udata->attr->item.file->attr_open_try_packed = udata->packed;
+
+                /* Mark the layout for other processes */
+                if(udata->packed)
+                    flags |= H5_DAOS_AINFO_PACKED;
+
+                /* Encode layout flags and serialized info lengths */
+                p = ainfo_buf;
+                UINT64ENCODE(p, flags)
                 UINT64ENCODE(p, type_buf_len)
                 UINT64ENCODE(p, space_buf_len)
                 UINT64ENCODE(p, acpl_buf_len)
-                assert(p == udata->md_rw_cb_ud.sg_iov[0].iov_buf);
-            } /* end if */
 
-            /* Finish building attribute object */
-            if(0 != (ret = H5_daos_attribute_open_end(udata->attr,
-                    udata->md_rw_cb_ud.sg_iov[0].iov_buf, type_buf_len, space_buf_len, acpl_buf_len)))
-                D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, ret, "can't finish opening attribute");
+                /* Only broadcast the metadata, not any inline raw data */
+                if(udata->bcast_udata)
+                    udata->bcast_udata->buffer_len = (int)MAX(H5_DAOS_AINFO_HDR_SIZE + type_buf_len
+                            + space_buf_len + acpl_buf_len, H5_DAOS_AINFO_BCAST_BUF_SIZE);
+
+                /* Finish building attribute object */
+                if(0 != (ret = H5_daos_attribute_open_end(udata->attr, p, flags,
+                        type_buf_len, space_buf_len, acpl_buf_len)))
+                    D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, ret, "can't finish opening attribute");
+            } /* end if */
         } /* end else */
     } /* end else */
 
+    /* Reissue attribute metadata read if necessary */
+    if(reissue) {
+        tse_task_t *fetch_task;
+
+        /* Create task for reissued attribute metadata read */
+        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_attribute_md_rw_prep_cb,
+                H5_daos_ainfo_read_comp_cb, udata, &fetch_task) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to read attribute metadata");
+
+        /* Schedule reissued attribute metadata read task */
+        if(0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, ret, "can't schedule task to read attribute metadata: %s", H5_daos_err_to_string(ret));
+        udata = NULL;
+    } /* end if */
+
 done:
     /* Return task to task list */
     if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
@@ -2353,9 +2685,9 @@ done:
             if(udata->md_rw_cb_ud.req->status < -H5_DAOS_INCOMPLETE)
                 (void)memset(udata->bcast_udata->buffer, 0, (size_t)udata->bcast_udata->count);
         } /* end if */
-        else if(udata->md_rw_cb_ud.free_sg_iov[0])
+        else if(udata->ainfo_buf != udata->flex_buf)
             /* No broadcast, free buffer */
-            DV_free(udata->md_rw_cb_ud.sg_iov[0].iov_buf);
+            DV_free(udata->ainfo_buf);
 
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except
@@ -2524,10 +2856,11 @@ H5_daos_attr_io_int_end_task(tse_task_t *task)
 
     /* Free private data */
     DV_free(udata->akey_buf);
+    DV_free(udata->md_buf);
     if(udata->reuse != H5_DAOS_TCONV_REUSE_TCONV)
-        DV_free(udata->tconv_buf);
+        H5_daos_bufpool_free(udata->tconv_buf);
     if(udata->reuse != H5_DAOS_TCONV_REUSE_BKG)
-        DV_free(udata->bkg_buf);
+        H5_daos_bufpool_free(udata->bkg_buf);
     DV_free(udata);
 
 done:
@@ -2542,6 +2875,95 @@ done:
 } /* end H5_daos_attr_io_int_end_task() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_attribute_io_setup
+ *
+ * Purpose:     Helper routine to set up the akey, iod and sgl for reading
+ *              or writing an attribute's raw data, once sg_iov[0] points
+ *              to the data buffer.  Raw data is either the raw data akey
+ *              array, or is stored inline after the attribute's packed
+ *              metadata record, which must be rewritten unchanged on
+ *              writes and is read into a scratch buffer on reads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_attribute_io_setup(H5_daos_attr_io_ud_t *udata, hbool_t fetch)
+{
+    H5_daos_attr_t *attr;
+    herr_t ret_value = SUCCEED;
+
+    assert(udata);
+    assert(udata->attr);
+    assert(udata->md_rw_cb_ud.sg_iov[0].iov_buf);
+
+    attr = udata->attr;
+
+    if(attr->packed_md) {
+        /* Create akey string (prefix "T-") */
+        if(!udata->akey_buf && H5_daos_attribute_get_akeys(attr->name, &udata->akey,
+                NULL, NULL, NULL, NULL, &udata->akey_buf) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get akey string for packed metadata akey");
+
+        /* Set up iov for packed metadata record */
+        if(fetch) {
+            if(!udata->md_buf && NULL == (udata->md_buf = DV_malloc(attr->packed_md_len)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for packed attribute metadata");
+            daos_iov_set(&udata->packed_iov[0], udata->md_buf, (daos_size_t)attr->packed_md_len);
+        } /* end if */
+        else
+            daos_iov_set(&udata->packed_iov[0], attr->packed_md, (daos_size_t)attr->packed_md_len);
+        udata->packed_iov[1] = udata->md_rw_cb_ud.sg_iov[0];
+
+        /* Set up iod */
+        daos_iov_set(&udata->md_rw_cb_ud.iod[0].iod_name,
+                udata->akey.iov_buf, udata->akey.iov_len);
+        udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
+        udata->md_rw_cb_ud.iod[0].iod_recxs = NULL;
+        udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)attr->packed_md_len
+                + (daos_size_t)(udata->attr_nelmts * (uint64_t)udata->file_type_size);
+        udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+
+        /* Set up sgl */
+        udata->md_rw_cb_ud.sgl[0].sg_nr = 2;
+        udata->md_rw_cb_ud.sgl[0].sg_iovs = udata->packed_iov;
+    } /* end if */
+    else {
+        /* Create akey string (prefix "V-") */
+        if(!udata->akey_buf && H5_daos_attribute_get_akeys(attr->name, NULL, NULL,
+                NULL, NULL, &udata->akey, &udata->akey_buf) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get akey string for raw data akey");
+
+        /* Set up recx */
+        udata->recx.rx_idx = (uint64_t)0;
+        udata->recx.rx_nr = udata->attr_nelmts;
+
+        /* Set up iod */
+        daos_iov_set(&udata->md_rw_cb_ud.iod[0].iod_name,
+                udata->akey.iov_buf, udata->akey.iov_len);
+        udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
+        udata->md_rw_cb_ud.iod[0].iod_recxs = &udata->recx;
+        udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)udata->file_type_size;
+        udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_ARRAY;
+
+        /* Set up sgl */
+        udata->md_rw_cb_ud.sgl[0].sg_nr = 1;
+        udata->md_rw_cb_ud.sgl[0].sg_iovs = &udata->md_rw_cb_ud.sg_iov[0];
+    } /* end else */
+
+    udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+    udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set nr */
+    udata->md_rw_cb_ud.nr = 1u;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_attribute_io_setup() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_attribute_read_int
  *
@@ -2708,34 +3130,8 @@ H5_daos_attribute_read_int(H5_daos_attr_t *attr, hid_t mem_type_id,
             } /* end else */
 
             /* Set up operation to read data */
-
-            /* Create akey string (prefix "V-") */
-            if(H5_daos_attribute_get_akeys(attr->name, NULL, NULL, NULL, NULL,
-                    &udata->akey, &udata->akey_buf) < 0)
-                D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get akey string for raw data akey");
-
-            /* Set up recx */
-            udata->recx.rx_idx = (uint64_t)0;
-            udata->recx.rx_nr = attr_nelmts;
-
-            /* Set up iod */
-            daos_iov_set(&udata->md_rw_cb_ud.iod[0].iod_name,
-                    udata->akey.iov_buf, udata->akey.iov_len);
-            udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
-            udata->md_rw_cb_ud.iod[0].iod_recxs = &udata->recx;
-            udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)file_type_size;
-            udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_ARRAY;
-
-            udata->md_rw_cb_ud.free_akeys = FALSE;
-
-            /* Finish setting up sgl */
-            assert(udata->md_rw_cb_ud.sg_iov[0].iov_buf);
-            udata->md_rw_cb_ud.sgl[0].sg_nr = 1;
-            udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-            udata->md_rw_cb_ud.sgl[0].sg_iovs = &udata->md_rw_cb_ud.sg_iov[0];
-
-            /* Set nr */
-            udata->md_rw_cb_ud.nr = 1u;
+            if(H5_daos_attribute_io_setup(udata, TRUE) < 0)
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't set up attribute read");
 
             /* Set task name */
             udata->md_rw_cb_ud.task_name = "attribute read";
@@ -2794,9 +3190,9 @@ done:
     /* Cleanup on failure */
     if(ret_value < 0) {
         if(reuse != H5_DAOS_TCONV_REUSE_TCONV)
-            tconv_buf = DV_free(tconv_buf);
+            tconv_buf = H5_daos_bufpool_free(tconv_buf);
         if(reuse != H5_DAOS_TCONV_REUSE_BKG)
-            bkg_buf = DV_free(bkg_buf);
+            bkg_buf = H5_daos_bufpool_free(bkg_buf);
 
         /* Close udata if end_task won't */
         if(udata && !udata->end_task) {
@@ -2809,10 +3205,11 @@ done:
                 D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close attribute");
 
             DV_free(udata->akey_buf);
+            DV_free(udata->md_buf);
             if(udata->reuse != H5_DAOS_TCONV_REUSE_TCONV)
-                DV_free(udata->tconv_buf);
+                H5_daos_bufpool_free(udata->tconv_buf);
             if(udata->reuse != H5_DAOS_TCONV_REUSE_BKG)
-                DV_free(udata->bkg_buf);
+                H5_daos_bufpool_free(udata->bkg_buf);
             udata = DV_free(udata);
         } /* end if */
     } /* end if */
@@ -3063,8 +3460,8 @@ H5_daos_attribute_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                 udata = NULL;
             else {
                 /* Type conversion */
-                if(H5Tconvert(udata->attr->file_type_id, udata->mem_type_id, udata->attr_nelmts,
-                        udata->tconv_buf, udata->bkg_buf, udata->md_rw_cb_ud.req->dxpl_id) < 0)
+                if(H5_daos_tconv_convert_from_file(udata->attr->item.file, udata->attr->file_type_id, udata->mem_type_id,
+                        udata->attr_nelmts, udata->tconv_buf, udata->bkg_buf, udata->md_rw_cb_ud.req->dxpl_id) < 0)
                     D_GOTO_ERROR(H5E_ATTR, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
 
                 /* Copy to user's buffer if necessary */
@@ -3101,10 +3498,11 @@ done:
                 D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
             DV_free(udata->akey_buf);
+            DV_free(udata->md_buf);
             if(udata->reuse != H5_DAOS_TCONV_REUSE_TCONV)
-                DV_free(udata->tconv_buf);
+                H5_daos_bufpool_free(udata->tconv_buf);
             if(udata->reuse != H5_DAOS_TCONV_REUSE_BKG)
-                DV_free(udata->bkg_buf);
+                H5_daos_bufpool_free(udata->bkg_buf);
             DV_free(udata);
         } /* end if */
     } /* end if */
@@ -3201,8 +3599,8 @@ H5_daos_attr_read_tconv(tse_task_t *task)
     assert(udata->need_tconv);
 
     /* Type conversion */
-    if(H5Tconvert(udata->attr->file_type_id, udata->mem_type_id, udata->attr_nelmts,
-            udata->tconv_buf, udata->bkg_buf, udata->md_rw_cb_ud.req->dxpl_id) < 0)
+    if(H5_daos_tconv_convert_from_file(udata->attr->item.file, udata->attr->file_type_id, udata->mem_type_id,
+            udata->attr_nelmts, udata->tconv_buf, udata->bkg_buf, udata->md_rw_cb_ud.req->dxpl_id) < 0)
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
 
     /* Copy to user's buffer if necessary */
@@ -3230,10 +3628,11 @@ done:
                 D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
             DV_free(udata->akey_buf);
+            DV_free(udata->md_buf);
             if(udata->reuse != H5_DAOS_TCONV_REUSE_TCONV)
-                DV_free(udata->tconv_buf);
+                H5_daos_bufpool_free(udata->tconv_buf);
             if(udata->reuse != H5_DAOS_TCONV_REUSE_BKG)
-                DV_free(udata->bkg_buf);
+                H5_daos_bufpool_free(udata->bkg_buf);
             DV_free(udata);
         } /* end if */
     } /* end if */
@@ -3360,34 +3759,6 @@ H5_daos_attribute_write_int(H5_daos_attr_t *attr, hid_t mem_type_id,
     daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.dkey, H5_daos_attr_key_g, H5_daos_attr_key_size_g);
     udata->md_rw_cb_ud.free_dkey = FALSE;
 
-    /* Set up operation to write data */
-
-    /* Create akey string (prefix "V-") */
-    if(H5_daos_attribute_get_akeys(attr->name, NULL, NULL, NULL, NULL, &udata->akey, &udata->akey_buf) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get akey string for raw data akey");
-
-    /* Set up recx */
-    udata->recx.rx_idx = (uint64_t)0;
-    udata->recx.rx_nr = attr_nelmts;
-
-    /* Set up iod */
-    daos_iov_set(&udata->md_rw_cb_ud.iod[0].iod_name,
-            udata->akey.iov_buf, udata->akey.iov_len);
-    udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
-    udata->md_rw_cb_ud.iod[0].iod_recxs = &udata->recx;
-    udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)file_type_size;
-    udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_ARRAY;
-
-    udata->md_rw_cb_ud.free_akeys = FALSE;
-
-    /* Set up constant sgl info */
-    udata->md_rw_cb_ud.sgl[0].sg_nr = 1;
-    udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-    udata->md_rw_cb_ud.sgl[0].sg_iovs = &udata->md_rw_cb_ud.sg_iov[0];
-
-    /* Set nr */
-    udata->md_rw_cb_ud.nr = 1u;
-
     /* Set task name */
     udata->md_rw_cb_ud.task_name = "attribute write";
 
@@ -3406,6 +3777,10 @@ H5_daos_attribute_write_int(H5_daos_attr_t *attr, hid_t mem_type_id,
             daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->bkg_buf,
                     (daos_size_t)(attr_nelmts * (uint64_t)file_type_size));
 
+            /* Set up operation to read background buffer */
+            if(H5_daos_attribute_io_setup(udata, TRUE) < 0)
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't set up background buffer read");
+
             /* Create task for reading to background buffer */
             if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
                     H5_daos_md_rw_prep_cb, H5_daos_attribute_read_bkg_comp_cb, udata, &bkg_fill_task) < 0)
@@ -3429,7 +3804,8 @@ H5_daos_attribute_write_int(H5_daos_attr_t *attr, hid_t mem_type_id,
                     (daos_size_t)(attr_nelmts * (uint64_t)file_type_size));
 
             /* Perform type conversion */
-            if(H5Tconvert(mem_type_id, attr->file_type_id, attr_nelmts, udata->tconv_buf, udata->bkg_buf, req->dxpl_id) < 0)
+            if(H5_daos_tconv_convert_to_file(attr->item.file, mem_type_id, attr->file_type_id, attr_nelmts,
+                    udata->tconv_buf, udata->bkg_buf, req->dxpl_id) < 0)
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
 
             /* Set up sgl_iov to point to tconv_buf */
@@ -3443,7 +3819,11 @@ H5_daos_attribute_write_int(H5_daos_attr_t *attr, hid_t mem_type_id,
         daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->buf.rbuf,
                 (daos_size_t)(attr_nelmts * (uint64_t)file_type_size));
 
-    assert(udata->md_rw_cb_ud.sg_iov[0].iov_buf);
+    /* Set up operation to write data.  If the background buffer is being
+     * filled this is done after the fetch by
+     * H5_daos_attribute_read_bkg_comp_cb. */
+    if(!fill_bkg && H5_daos_attribute_io_setup(udata, FALSE) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, FAIL, "can't set up attribute write");
 
     /* Create task for attribute write */
     if(H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
@@ -3463,8 +3843,8 @@ H5_daos_attribute_write_int(H5_daos_attr_t *attr, hid_t mem_type_id,
 done:
     /* Cleanup on failure */
     if(ret_value < 0) {
-        tconv_buf = DV_free(tconv_buf);
-        bkg_buf = DV_free(bkg_buf);
+        tconv_buf = H5_daos_bufpool_free(tconv_buf);
+        bkg_buf = H5_daos_bufpool_free(bkg_buf);
 
         /* Close udata if end_task won't */
         if(udata && !udata->end_task) {
@@ -3477,8 +3857,9 @@ done:
                 D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close attribute");
 
             DV_free(udata->akey_buf);
-            DV_free(udata->tconv_buf);
-            DV_free(udata->bkg_buf);
+            DV_free(udata->md_buf);
+            H5_daos_bufpool_free(udata->tconv_buf);
+            H5_daos_bufpool_free(udata->bkg_buf);
             udata = DV_free(udata);
         } /* end if */
     } /* end if */
@@ -3719,17 +4100,17 @@ H5_daos_attribute_read_bkg_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args
     } /* end if */
     else if(task->dt_result == 0) {
         /* Perform type conversion */
-        if(H5Tconvert(udata->mem_type_id, udata->attr->file_type_id, udata->attr_nelmts,
-                udata->tconv_buf, udata->bkg_buf, udata->md_rw_cb_ud.req->dxpl_id) < 0)
+        if(H5_daos_tconv_convert_to_file(udata->attr->item.file, udata->mem_type_id, udata->attr->file_type_id,
+                udata->attr_nelmts, udata->tconv_buf, udata->bkg_buf, udata->md_rw_cb_ud.req->dxpl_id) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
 
-        /* Reset iod_size, if the attribute was not writted to then it could
-         * have been overwritten by daos_obj_fetch */
-        udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)udata->file_type_size;
-
-        /* Retarget sg_iov to write from tconv_buf */
+        /* Retarget sg_iov to write from tconv_buf and reset the iod (the
+         * iod_size could have been overwritten by daos_obj_fetch if the
+         * attribute was not written to) */
         daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->tconv_buf,
                 (daos_size_t)(udata->attr_nelmts * (uint64_t)udata->file_type_size));
+        if(H5_daos_attribute_io_setup(udata, FALSE) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't set up attribute write");
     } /* end if */
 
 done:
@@ -3808,8 +4189,9 @@ H5_daos_attribute_write_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
         DV_free(udata->akey_buf);
-        DV_free(udata->tconv_buf);
-        DV_free(udata->bkg_buf);
+        DV_free(udata->md_buf);
+        H5_daos_bufpool_free(udata->tconv_buf);
+        H5_daos_bufpool_free(udata->bkg_buf);
         DV_free(udata);
     } /* end if */
 
@@ -4377,6 +4759,7 @@ H5_daos_attribute_close_real(H5_daos_attr_t *attr)
         if(attr->acpl_id != H5I_INVALID_HID && attr->acpl_id != H5P_ATTRIBUTE_CREATE_DEFAULT)
             if(H5Idec_ref(attr->acpl_id) < 0)
                 D_DONE_ERROR(H5E_ATTR, H5E_CANTDEC, FAIL, "failed to close acpl");
+        attr->packed_md = DV_free(attr->packed_md);
         attr = H5FL_FREE(H5_daos_attr_t, attr);
     } /* end if */
 
@@ -4612,7 +4995,7 @@ H5_daos_attribute_get_name(H5_daos_obj_t *target_obj, const H5VL_loc_params_t *l
 
             if(H5_daos_attribute_get_name_by_idx(parent_obj, loc_params->loc_data.loc_by_idx.idx_type,
                     loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
-                    attr_name_out, attr_name_out_size, size_ret, req, first_task, dep_task) < 0)
+                    NULL, attr_name_out, attr_name_out_size, size_ret, req, first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, (-1), "can't get attribute name by index");
 
             break;
@@ -4995,7 +5378,7 @@ H5_daos_attribute_delete(H5_daos_obj_t *attr_container_obj, const H5VL_loc_param
         if(H5VL_OBJECT_BY_IDX == loc_params->type) {
             if(H5_daos_attribute_get_name_by_idx_alloc(attr_container_obj,
                     loc_params->loc_data.loc_by_idx.idx_type, loc_params->loc_data.loc_by_idx.order,
-                    (uint64_t)loc_params->loc_data.loc_by_idx.n, &delete_udata->target_attr_name,
+                    (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL, &delete_udata->target_attr_name,
                     &delete_udata->target_attr_name_len, &delete_udata->attr_name_buf,
                     NULL, req, first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute name");
@@ -5205,7 +5588,7 @@ H5_daos_attribute_remove_from_crt_idx(H5_daos_obj_t *target_obj,
     uint64_t delete_idx = 0;
     uint8_t idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1];
     uint8_t *p;
-    hsize_t obj_nattrs_remaining;
+    hsize_t obj_nattrs_remaining = 0;
     int ret;
     herr_t ret_value = SUCCEED;
 
@@ -5217,56 +5600,65 @@ H5_daos_attribute_remove_from_crt_idx(H5_daos_obj_t *target_obj,
     assert(dep_task);
     H5daos_compile_assert(H5_DAOS_ENCODED_CRT_ORDER_SIZE == 8);
 
-    /* Retrieve the current number of attributes attached to the object */
-    if(H5_daos_object_get_num_attrs(target_obj, &obj_nattrs_remaining, FALSE,
-            req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get the number of attributes attached to object");
-
-    H5_DAOS_WAIT_ON_ASYNC_CHAIN(req, *first_task, *dep_task,
-            H5E_ATTR, H5E_CANTINIT, FAIL);
-
-    /* Determine the index value of the attribute to be removed */
-    if(H5VL_OBJECT_BY_IDX == loc_params->type) {
-        /* DSINC - no check for safe cast here */
-        /*
-         * Note that this assumes this routine is always called after an attribute's
-         * akeys are punched during deletion, so the number of attributes attached to
-         * the object should reflect the number after the attribute has been removed.
-         */
-        delete_idx = (H5_ITER_DEC == loc_params->loc_data.loc_by_idx.order) ?
-                (uint64_t)obj_nattrs_remaining - (uint64_t)loc_params->loc_data.loc_by_idx.n :
-                (uint64_t)loc_params->loc_data.loc_by_idx.n;
+    /* Determine the index value of the attribute to be removed.  Sparse
+     * creation order indices are keyed by the attribute's permanent creation
+     * order value, which can be looked up directly from its name whether the
+     * attribute was specified by name or by index. */
+    if(H5_DAOS_OBJ_SPARSE_CORDER(target_obj)) {
+        if(H5_daos_attribute_get_crt_order_by_name(target_obj, attr_name, &delete_idx) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute's creation order value");
     } /* end if */
     else {
-        H5_daos_attr_crt_idx_iter_ud_t iter_cb_ud;
-        H5_daos_iter_data_t iter_data;
-
-        /* Initialize iteration data */
-        iter_cb_ud.target_attr_name = attr_name;
-        iter_cb_ud.attr_idx_out = &delete_idx;
-        H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_ATTR, H5_INDEX_CRT_ORDER, H5_ITER_INC,
-                FALSE, NULL, H5I_INVALID_HID, &iter_cb_ud, NULL, req);
-        iter_data.u.attr_iter_data.u.attr_iter_op = H5_daos_attribute_remove_from_crt_idx_name_cb;
-
-        /*
-         * TODO: Currently, deleting an attribute directly (H5Adelete) or by name (H5Adelete_by_name)
-         *       means that we need to iterate through the attribute creation order index until we
-         *       find the value corresponding to the attribute being deleted. This is especially
-         *       important because the deletion of attributes might cause the target attribute's
-         *       index value to shift downwards.
-         *
-         *       Once iteration restart is supported for attribute iteration, performance can
-         *       be improved here by first looking up the original, permanent creation order
-         *       value of the attribute using the 'attribute name -> creation order' mapping
-         *       and then using that value as the starting point for iteration. In this case,
-         *       the iteration order MUST be switched to H5_ITER_DEC or the key will not be
-         *       found by the iteration.
-         */
-        if(H5_daos_attribute_iterate(target_obj, &iter_data, req, first_task, dep_task) < 0)
-            D_GOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "attribute iteration failed");
+        /* Retrieve the current number of attributes attached to the object */
+        if(H5_daos_object_get_num_attrs(target_obj, &obj_nattrs_remaining, FALSE,
+                req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get the number of attributes attached to object");
 
         H5_DAOS_WAIT_ON_ASYNC_CHAIN(req, *first_task, *dep_task,
                 H5E_ATTR, H5E_CANTINIT, FAIL);
+
+        if(H5VL_OBJECT_BY_IDX == loc_params->type) {
+            /* DSINC - no check for safe cast here */
+            /*
+             * Note that this assumes this routine is always called after an attribute's
+             * akeys are punched during deletion, so the number of attributes attached to
+             * the object should reflect the number after the attribute has been removed.
+             */
+            delete_idx = (H5_ITER_DEC == loc_params->loc_data.loc_by_idx.order) ?
+                    (uint64_t)obj_nattrs_remaining - (uint64_t)loc_params->loc_data.loc_by_idx.n :
+                    (uint64_t)loc_params->loc_data.loc_by_idx.n;
+        } /* end if */
+        else {
+            H5_daos_attr_crt_idx_iter_ud_t iter_cb_ud;
+            H5_daos_iter_data_t iter_data;
+
+            /* Initialize iteration data */
+            iter_cb_ud.target_attr_name = attr_name;
+            iter_cb_ud.attr_idx_out = &delete_idx;
+            H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_ATTR, H5_INDEX_CRT_ORDER, H5_ITER_INC,
+                    FALSE, NULL, H5I_INVALID_HID, &iter_cb_ud, NULL, req);
+            iter_data.u.attr_iter_data.u.attr_iter_op = H5_daos_attribute_remove_from_crt_idx_name_cb;
+
+            /*
+             * TODO: Currently, deleting an attribute directly (H5Adelete) or by name (H5Adelete_by_name)
+             *       means that we need to iterate through the attribute creation order index until we
+             *       find the value corresponding to the attribute being deleted. This is especially
+             *       important because the deletion of attributes might cause the target attribute's
+             *       index value to shift downwards.
+             *
+             *       Once iteration restart is supported for attribute iteration, performance can
+             *       be improved here by first looking up the original, permanent creation order
+             *       value of the attribute using the 'attribute name -> creation order' mapping
+             *       and then using that value as the starting point for iteration. In this case,
+             *       the iteration order MUST be switched to H5_ITER_DEC or the key will not be
+             *       found by the iteration.
+             */
+            if(H5_daos_attribute_iterate(target_obj, &iter_data, req, first_task, dep_task) < 0)
+                D_GOTO_ERROR(H5E_ATTR, H5E_BADITER, FAIL, "attribute iteration failed");
+
+            H5_DAOS_WAIT_ON_ASYNC_CHAIN(req, *first_task, *dep_task,
+                    H5E_ATTR, H5E_CANTINIT, FAIL);
+        } /* end else */
     } /* end else */
 
     /* Set up dkey */
@@ -5282,6 +5674,19 @@ H5_daos_attribute_remove_from_crt_idx(H5_daos_obj_t *target_obj,
     if(0 != (ret = daos_obj_punch_akeys(target_obj->obj_oh, DAOS_TX_NONE, DAOS_COND_PUNCH, &dkey, 1, &crt_akey, NULL /*event*/)))
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTREMOVE, FAIL, "failed to punch attribute akey: %s", H5_daos_err_to_string(ret));
 
+    /*
+     * Sparse creation order indices leave a hole for the removed attribute and
+     * never reset the max. attribute creation order value, so only the index's
+     * hole count tree needs to be updated.
+     */
+    if(H5_DAOS_OBJ_SPARSE_CORDER(target_obj)) {
+        if(H5_daos_corder_idx_remove(target_obj, H5_DAOS_CORDER_IDX_ATTR, &delete_idx,
+                req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTMODIFY, FAIL, "failed to update attribute creation order index");
+
+        H5_DAOS_WAIT_ON_ASYNC_CHAIN(req, *first_task, *dep_task,
+                H5E_ATTR, H5E_CANTINIT, FAIL);
+    } /* end if */
     /*
      * If there are still attributes remaining on the object and we didn't delete
      * the attribute currently at the end of the creation order index, shift the
@@ -5289,7 +5694,7 @@ H5_daos_attribute_remove_from_crt_idx(H5_daos_obj_t *target_obj,
      * maintains the ability to directly index into the attribute creation order
      * index.
      */
-    if((obj_nattrs_remaining > 0) && (delete_idx < (uint64_t)obj_nattrs_remaining)) {
+    else if((obj_nattrs_remaining > 0) && (delete_idx < (uint64_t)obj_nattrs_remaining)) {
         if(H5_daos_attribute_shift_crt_idx_keys_down(target_obj, delete_idx + 1, (uint64_t)obj_nattrs_remaining) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTMODIFY, FAIL, "failed to update attribute creation order index");
     } /* end if */
@@ -5568,12 +5973,14 @@ H5_daos_attribute_exists(H5_daos_obj_t *attr_container_obj, const char *attr_nam
         hbool_t may_track_acorder = (attr_container_obj->item.open_req->status < 0 && !attr_container_obj->item.created)
                 || attr_container_obj->ocpl_cache.track_acorder;
 
-        /* Set number of records.  Do not include creation order key, the prep
-         * callback will add it if appropriate. */
-        attr_exists_ud->nr = H5_DAOS_ATTR_NUM_AKEYS - 2;
+        /* Set number of records.  Only the datatype key is checked, since it
+         * is present for attributes in both the original and the packed
+         * layout.  Do not include creation order key, the prep callback will
+         * add it if appropriate. */
+        attr_exists_ud->nr = 1;
 
-        if(H5_daos_attribute_get_akeys(attr_name, &attr_exists_ud->akeys[0], &attr_exists_ud->akeys[1],
-                &attr_exists_ud->akeys[2], may_track_acorder ? &attr_exists_ud->akeys[3] : NULL,
+        if(H5_daos_attribute_get_akeys(attr_name, &attr_exists_ud->akeys[0], NULL,
+                NULL, may_track_acorder ? &attr_exists_ud->akeys[1] : NULL,
                         NULL, &attr_exists_ud->akeys_buf) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get akey strings");
 
@@ -5587,28 +5994,16 @@ H5_daos_attribute_exists(H5_daos_obj_t *attr_container_obj, const char *attr_nam
         attr_exists_ud->iod[0].iod_type = DAOS_IOD_SINGLE;
         attr_exists_ud->iod[0].iod_size = DAOS_REC_ANY;
 
-        daos_iov_set(&attr_exists_ud->iod[1].iod_name,
-                attr_exists_ud->akeys[1].iov_buf, (daos_size_t)attr_exists_ud->akeys[1].iov_len);
-        attr_exists_ud->iod[1].iod_nr = 1u;
-        attr_exists_ud->iod[1].iod_type = DAOS_IOD_SINGLE;
-        attr_exists_ud->iod[1].iod_size = DAOS_REC_ANY;
-
-        daos_iov_set(&attr_exists_ud->iod[2].iod_name,
-                attr_exists_ud->akeys[2].iov_buf, (daos_size_t)attr_exists_ud->akeys[2].iov_len);
-        attr_exists_ud->iod[2].iod_nr = 1u;
-        attr_exists_ud->iod[2].iod_type = DAOS_IOD_SINGLE;
-        attr_exists_ud->iod[2].iod_size = DAOS_REC_ANY;
-
         /* Check for creation order tracking.  If we're not sure if creation
          * order is tracked because the parent object open isn't complete, call
          * the function anyways, the prep callback will check for creation order
          * before actually fetching any info. */
         if(may_track_acorder) {
-            daos_iov_set(&attr_exists_ud->iod[3].iod_name,
-                    attr_exists_ud->akeys[3].iov_buf, (daos_size_t)attr_exists_ud->akeys[3].iov_len);
-            attr_exists_ud->iod[3].iod_nr = 1u;
-            attr_exists_ud->iod[3].iod_type = DAOS_IOD_SINGLE;
-            attr_exists_ud->iod[3].iod_size = DAOS_REC_ANY;
+            daos_iov_set(&attr_exists_ud->iod[1].iod_name,
+                    attr_exists_ud->akeys[1].iov_buf, (daos_size_t)attr_exists_ud->akeys[1].iov_len);
+            attr_exists_ud->iod[1].iod_nr = 1u;
+            attr_exists_ud->iod[1].iod_type = DAOS_IOD_SINGLE;
+            attr_exists_ud->iod[1].iod_size = DAOS_REC_ANY;
         } /* end if */
 
         /* Create task for fetch */
@@ -5752,18 +6147,15 @@ H5_daos_attr_exists_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         hbool_t attr_exists = FALSE;
         hbool_t attr_missing = FALSE;
 
-        /* Attribute exists if all of its metadata keys are present. */
-        attr_exists = (udata->iod[0].iod_size != 0)
-                   && (udata->iod[1].iod_size != 0)
-                   && (udata->iod[2].iod_size != 0);
+        /* Attribute exists if its datatype key is present (this key holds
+         * all metadata for attributes in the packed layout). */
+        attr_exists = (udata->iod[0].iod_size != 0);
 
         /*
-         * Conversely, the attribute doesn't exist if all of its
-         * metadata keys are missing.
+         * Conversely, the attribute doesn't exist if its datatype key is
+         * missing.
          */
-        attr_missing = (udata->iod[0].iod_size == 0)
-                    && (udata->iod[1].iod_size == 0)
-                    && (udata->iod[2].iod_size == 0);
+        attr_missing = (udata->iod[0].iod_size == 0);
 
         /*
          * Check for the presence or absence of the attribute creation
@@ -5771,8 +6163,8 @@ H5_daos_attr_exists_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
          * creation order tracking enabled.
          */
         if(udata->bcast_ud.obj->ocpl_cache.track_acorder) {
-            attr_exists = attr_exists && (udata->iod[3].iod_size != 0);
-            attr_missing = attr_missing && (udata->iod[3].iod_size == 0);
+            attr_exists = attr_exists && (udata->iod[1].iod_size != 0);
+            attr_missing = attr_missing && (udata->iod[1].iod_size == 0);
         } /* end if */
 
         assert(udata->exists);
@@ -6248,8 +6640,10 @@ H5_daos_attribute_iterate_by_name_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSE
                 if(udata->u.name_order_data.kds[i].kd_key_len < 3)
                     D_GOTO_ERROR(H5E_ATTR, H5E_CANTDECODE, -H5_DAOS_BAD_VALUE, "attribute akey too short");
 
-                /* Only do callbacks for "S-" (dataspace) keys, to avoid duplication */
-                if(p[0] == 'S') {
+                /* Only do callbacks for "T-" (datatype) keys, to avoid
+                 * duplication.  Attributes in both the original and the
+                 * packed layout have this key. */
+                if(p[0] == 'T' && p[1] == '-') {
                     char tmp_char;
 
                     /* Add null terminator temporarily */
@@ -6322,6 +6716,7 @@ static herr_t
 H5_daos_attribute_iterate_by_crt_order(H5_daos_attr_iterate_ud_t *iterate_udata,
     H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
+    H5_daos_corder_walk_t corder_walk;
     uint64_t cur_idx;
     const char *target_attr_name = NULL;
     size_t target_attr_name_len = 0;
@@ -6358,10 +6753,14 @@ H5_daos_attribute_iterate_by_crt_order(H5_daos_attr_iterate_ud_t *iterate_udata,
         D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
     iterate_udata->attr_container_obj->item.rc++;
 
+    /* Walk the creation order index so each name lookup continues from the
+     * previous attribute */
+    memset(&corder_walk, 0, sizeof(corder_walk));
+
     for(cur_idx = 0; cur_idx < (uint64_t)iterate_udata->u.crt_order_data.obj_nattrs; cur_idx++) {
         if(H5_daos_attribute_get_name_by_idx_alloc(iterate_udata->attr_container_obj,
                 iterate_udata->iter_data.index_type, iterate_udata->iter_data.iter_order,
-                cur_idx, &target_attr_name, &target_attr_name_len, &attr_name_buf,
+                cur_idx, &corder_walk, &target_attr_name, &target_attr_name_len, &attr_name_buf,
                 NULL, req, first_task, dep_task) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get attribute name");
 
@@ -6741,6 +7140,7 @@ H5_daos_attribute_rename(H5_daos_obj_t *attr_container_obj, const char *cur_attr
     hssize_t attr_space_nelmts;
     size_t attr_type_size;
     void *attr_data_buf = NULL;
+    hid_t new_acpl_id = H5I_INVALID_HID;
     H5_daos_req_t *int_int_req = NULL;
     int ret;
     herr_t ret_value = SUCCEED;
@@ -6793,8 +7193,15 @@ H5_daos_attribute_rename(H5_daos_obj_t *attr_container_obj, const char *cur_attr
                 NULL, NULL, req, H5I_INVALID_HID)))
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, FAIL, "can't create DAOS request");
 
+        /* Carry the attribute's layout over explicitly, since the layout
+         * property is not encoded with the attribute's ACPL */
+        if((new_acpl_id = H5Pcopy(cur_attr->acpl_id)) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTCOPY, FAIL, "can't copy ACPL");
+        if(H5_daos_set_packed_attr_layout_prop(new_acpl_id, cur_attr->packed) < 0)
+            D_GOTO_ERROR(H5E_ATTR, H5E_CANTSET, FAIL, "can't set packed attribute layout property");
+
         if(NULL == (new_attr = (H5_daos_attr_t *)H5_daos_attribute_create_helper(&attr_container_obj->item, &sub_loc_params,
-                cur_attr->type_id, cur_attr->space_id, cur_attr->acpl_id, H5P_ATTRIBUTE_ACCESS_DEFAULT,
+                cur_attr->type_id, cur_attr->space_id, new_acpl_id, H5P_ATTRIBUTE_ACCESS_DEFAULT,
                 new_attr_name, FALSE, int_int_req, first_task, dep_task)))
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTCREATE, FAIL, "can't create new attribute");
 
@@ -6847,6 +7254,9 @@ done:
 
     attr_data_buf = DV_free(attr_data_buf);
 
+    if(new_acpl_id >= 0 && H5Pclose(new_acpl_id) < 0)
+        D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close ACPL");
+
     if(new_attr) {
         if(H5_daos_attribute_close_real(new_attr) < 0)
             D_DONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, FAIL, "can't close attribute");
@@ -6904,7 +7314,8 @@ H5_daos_attr_gnbi_alloc_task(tse_task_t *task)
 
         /* Reissue call with larger buffer and transfer ownership of udata */
         if(H5_daos_attribute_get_name_by_idx(udata->target_obj, udata->index_type,
-                udata->iter_order, udata->idx, *udata->attr_name_buf, udata->cur_attr_name_size,
+                udata->iter_order, udata->idx, udata->corder_walk, *udata->attr_name_buf,
+                udata->cur_attr_name_size,
                 udata->attr_name_size, udata->req,
                 &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get attribute name by index");
@@ -6974,7 +7385,8 @@ done:
 static herr_t
 H5_daos_attribute_get_name_by_idx_alloc(H5_daos_obj_t *target_obj,
     H5_index_t index_type, H5_iter_order_t iter_order, uint64_t idx,
-    const char **attr_name, size_t *attr_name_size, char **attr_name_buf,
+    H5_daos_corder_walk_t *corder_walk, const char **attr_name, size_t *attr_name_size,
+    char **attr_name_buf,
     size_t *attr_name_buf_size, H5_daos_req_t *req, tse_task_t **first_task,
     tse_task_t **dep_task)
 {
@@ -6990,6 +7402,7 @@ H5_daos_attribute_get_name_by_idx_alloc(H5_daos_obj_t *target_obj,
     gnbi_udata->index_type = index_type;
     gnbi_udata->iter_order = iter_order;
     gnbi_udata->idx = idx;
+    gnbi_udata->corder_walk = corder_walk;
     gnbi_udata->attr_name = attr_name;
     gnbi_udata->attr_name_size = attr_name_size;
     gnbi_udata->attr_name_buf = attr_name_buf;
@@ -7010,7 +7423,7 @@ H5_daos_attribute_get_name_by_idx_alloc(H5_daos_obj_t *target_obj,
 
     /* Call underlying function */
     if(H5_daos_attribute_get_name_by_idx(target_obj, index_type, iter_order, idx,
-            *gnbi_udata->attr_name_buf, gnbi_udata->cur_attr_name_size,
+            corder_walk, *gnbi_udata->attr_name_buf, gnbi_udata->cur_attr_name_size,
             gnbi_udata->attr_name_size, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get link name by index");
 
@@ -7057,15 +7470,21 @@ done:
  *              size_ret. If non-NULL, the attribute's name is stored in
  *              attr_name_out.
  *
+ *              corder_walk may be NULL.  When retrieving the names of
+ *              consecutive attributes in the creation order index, pass
+ *              the same zeroed walk to each call (see
+ *              H5_daos_corder_idx_lookup()).  It is ignored for the name
+ *              index.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
 H5_daos_attribute_get_name_by_idx(H5_daos_obj_t *target_obj, H5_index_t index_type,
-    H5_iter_order_t iter_order, uint64_t idx, char *attr_name_out, size_t attr_name_out_size,
-    size_t *attr_name_size, H5_daos_req_t *req, tse_task_t **first_task,
-    tse_task_t **dep_task)
+    H5_iter_order_t iter_order, uint64_t idx, H5_daos_corder_walk_t *corder_walk,
+    char *attr_name_out, size_t attr_name_out_size, size_t *attr_name_size,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_attr_get_name_by_idx_ud_t *get_name_udata = NULL;
     herr_t ret_value = SUCCEED;
@@ -7083,6 +7502,7 @@ H5_daos_attribute_get_name_by_idx(H5_daos_obj_t *target_obj, H5_index_t index_ty
     get_name_udata->index_type = index_type;
     get_name_udata->iter_order = iter_order;
     get_name_udata->idx = idx;
+    get_name_udata->corder_walk = corder_walk;
     get_name_udata->attr_name_out = attr_name_out;
     get_name_udata->attr_name_out_size = attr_name_out_size;
     get_name_udata->attr_name_size_ret = attr_name_size;
@@ -7320,6 +7740,12 @@ H5_daos_attribute_get_name_by_crt_order(H5_daos_attr_get_name_by_idx_ud_t *get_n
             req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't get number of attributes attached to object");
 
+    /* Find the key of the attribute in the object's creation order index */
+    if(H5_daos_corder_idx_lookup(get_name_udata->target_obj, H5_DAOS_CORDER_IDX_ATTR,
+            &get_name_udata->obj_nattrs, get_name_udata->iter_order, get_name_udata->idx,
+            get_name_udata->corder_walk, &get_name_udata->u.by_crt_order_data.idx_key, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't look up attribute in creation order index");
+
     get_name_udata->u.by_crt_order_data.md_rw_cb_ud.obj = get_name_udata->target_obj;
     get_name_udata->u.by_crt_order_data.md_rw_cb_ud.req = req;
 
@@ -7397,7 +7823,6 @@ H5_daos_attribute_get_name_by_crt_order_prep_cb(tse_task_t *task, void H5VL_DAOS
 {
     H5_daos_attr_get_name_by_idx_ud_t *udata;
     daos_obj_rw_t *fetch_args;
-    uint64_t fetch_idx = 0;
     uint8_t *p;
     int ret_value = 0;
 
@@ -7413,19 +7838,11 @@ H5_daos_attribute_get_name_by_crt_order_prep_cb(tse_task_t *task, void H5VL_DAOS
     assert(udata->u.by_crt_order_data.md_rw_cb_ud.obj);
     assert(udata->u.by_crt_order_data.md_rw_cb_ud.req->file);
 
-    /* Ensure the index is within range */
-    if(udata->idx >= (uint64_t)udata->obj_nattrs)
-        D_GOTO_ERROR(H5E_ATTR, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
-
-    /* Calculate the correct index of the attribute, based upon the iteration order */
-    if(H5_ITER_DEC == udata->iter_order)
-        fetch_idx = (uint64_t)udata->obj_nattrs - udata->idx - 1;
-    else
-        fetch_idx = udata->idx;
-
+    /* Encode the key of the attribute in the creation order index, found by
+     * H5_daos_corder_idx_lookup() */
     p = udata->u.by_crt_order_data.idx_buf;
     *p++ = 0;
-    UINT64ENCODE(p, fetch_idx);
+    UINT64ENCODE(p, udata->u.by_crt_order_data.idx_key);
 
     /* Set fetch task arguments */
     if(NULL == (fetch_args = daos_task_get_args(task)))
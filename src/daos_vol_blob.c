@@ -18,7 +18,29 @@
 #include "util/daos_vol_err.h"  /* DAOS connector error handling           */
 #include "util/daos_vol_mem.h"  /* DAOS connector memory management        */
 
+/* Task user data for batched blob I/O.  For writes, the blob data is copied
+ * into the same allocation, following the struct. */
+typedef struct H5_daos_blob_batch_ud_t {
+    H5_daos_blob_batch_status_t *status;
+    uint8_t blob_id[H5_DAOS_BLOB_ID_SIZE];
+    daos_key_t dkey;
+    daos_iod_t iod;
+    daos_sg_list_t sgl;
+    daos_iov_t sg_iov;
+} H5_daos_blob_batch_ud_t;
+
 static int H5_daos_blob_io_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_blob_batch_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_blob_batch_add(H5_daos_file_t *file,
+    H5_daos_blob_batch_t *batch, daos_opc_t opc, const void *blob_id,
+    void *buf, size_t size, hbool_t copy);
+static int H5_daos_blob_prefetch_cmp(const void *_ent1, const void *_ent2);
+static void H5_daos_blob_inline_encode(uint8_t *blob_id, const void *buf,
+    size_t size);
+static void H5_daos_blob_inline_decode(const uint8_t *blob_id, void *buf,
+    size_t size);
+static herr_t H5_daos_blob_batch_flush(H5_daos_blob_batch_t *batch);
+static void H5_daos_blob_batch_status_release(H5_daos_blob_batch_status_t *status);
 
 
 /*-------------------------------------------------------------------------
@@ -58,6 +80,575 @@ done:
 }
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_batch_comp_cb
+ *
+ * Purpose:     Complete callback for batched blob reads and writes.
+ *              Records the first error in the batch, releases the task's
+ *              reference to the batch status and frees the task's user
+ *              data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_blob_batch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_blob_batch_ud_t *udata = NULL;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for blob I/O task");
+
+    /* Record first error */
+    if(task->dt_result != 0 && udata->status->status == 0)
+        udata->status->status = task->dt_result;
+
+done:
+    /* Free udata (and blob data) */
+    if(udata) {
+        H5_daos_blob_batch_status_release(udata->status);
+        udata = DV_free(udata);
+    } /* end if */
+
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_batch_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_inline_encode
+ *
+ * Purpose:     Encodes size bytes of data in buf as an inline blob ID in
+ *              blob_id.  size must be at most H5_DAOS_BLOB_INLINE_MAX.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_blob_inline_encode(uint8_t *blob_id, const void *buf, size_t size)
+{
+    size_t nfirst = MIN(size, H5_DAOS_BLOB_INLINE_FLAG_POS);
+
+    assert(size <= H5_DAOS_BLOB_INLINE_MAX);
+
+    (void)memset(blob_id, 0, H5_DAOS_BLOB_ID_SIZE);
+    (void)memcpy(blob_id, buf, nfirst);
+    blob_id[H5_DAOS_BLOB_INLINE_FLAG_POS] = H5_DAOS_BLOB_INLINE_FLAG;
+    if(size > nfirst)
+        (void)memcpy(blob_id + H5_DAOS_BLOB_INLINE_FLAG_POS + 1, (const uint8_t *)buf + nfirst, size - nfirst);
+
+    return;
+} /* end H5_daos_blob_inline_encode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_inline_decode
+ *
+ * Purpose:     Decodes size bytes of data from the inline blob ID blob_id
+ *              into buf.  size must be at most H5_DAOS_BLOB_INLINE_MAX.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_blob_inline_decode(const uint8_t *blob_id, void *buf, size_t size)
+{
+    size_t nfirst = MIN(size, H5_DAOS_BLOB_INLINE_FLAG_POS);
+
+    assert(size <= H5_DAOS_BLOB_INLINE_MAX);
+    assert(H5_DAOS_BLOB_IS_INLINE(blob_id));
+
+    (void)memcpy(buf, blob_id, nfirst);
+    if(size > nfirst)
+        (void)memcpy((uint8_t *)buf + nfirst, blob_id + H5_DAOS_BLOB_INLINE_FLAG_POS + 1, size - nfirst);
+
+    return;
+} /* end H5_daos_blob_inline_decode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_batch_begin
+ *
+ * Purpose:     Starts (or nests within) a blob batch on file.
+ *              Until the matching H5_daos_blob_batch_end, blob puts to
+ *              file are issued asynchronously instead of waited on one at
+ *              a time.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_blob_batch_begin(H5_daos_file_t *file)
+{
+    assert(file);
+
+    file->blob_batch.nest++;
+
+    return;
+} /* end H5_daos_blob_batch_begin() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_batch_end
+ *
+ * Purpose:     Ends a blob batch on file.  When the outermost batch ends,
+ *              waits for all blob I/O in the batch to complete.
+ *
+ * Return:      Non-negative on success/Negative on failure (including if
+ *              any blob I/O in the batch failed)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_blob_batch_end(H5_daos_file_t *file)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+    assert(file->blob_batch.nest > 0);
+
+    if(--file->blob_batch.nest == 0) {
+        if(H5_daos_blob_batch_flush(&file->blob_batch) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "can't flush blob batch");
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_batch_end() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_batch_status_release
+ *
+ * Purpose:     Releases a reference to a blob batch status, freeing it
+ *              when the last reference is released.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_blob_batch_status_release(H5_daos_blob_batch_status_t *status)
+{
+    assert(status);
+    assert(status->rc > 0);
+
+    if(--status->rc == 0)
+        DV_free(status);
+
+    return;
+} /* end H5_daos_blob_batch_status_release() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_batch_flush
+ *
+ * Purpose:     Schedules all blob I/O in batch and waits for it to
+ *              complete.  The batch is taken over and reset before
+ *              waiting, since the scheduler may run code that adds blob
+ *              I/O to (or flushes) the same batch while we wait.
+ *
+ * Return:      Non-negative on success/Negative on failure (including if
+ *              any blob I/O in the batch failed)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_blob_batch_flush(H5_daos_blob_batch_t *batch)
+{
+    tse_task_t *first_task = NULL;
+    tse_task_t *end_task = NULL;
+    H5_daos_blob_batch_status_t *status = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(batch);
+
+    if(batch->ntasks == 0) {
+        assert(!batch->first_task);
+        assert(!batch->status);
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+    assert(batch->first_task);
+    assert(batch->status);
+
+    /* Create task that completes when all I/O in the batch completes.  This
+     * registers the dependencies, so batch->tasks is not needed after. */
+    if(H5_daos_create_task(H5_daos_metatask_autocomplete, (unsigned)batch->ntasks, batch->tasks,
+            NULL, NULL, NULL, &end_task) < 0)
+        end_task = NULL;
+
+    /* Take over the batch and reset it */
+    first_task = batch->first_task;
+    status = batch->status;
+    batch->first_task = NULL;
+    batch->status = NULL;
+    batch->ntasks = 0;
+    batch->nbytes = 0;
+
+    if(!end_task)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create end task for blob batch");
+
+    /* Schedule end task */
+    if(0 != (ret = tse_task_schedule(end_task, false)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule end task for blob batch: %s", H5_daos_err_to_string(ret));
+
+    /* Start the I/O and wait for it to complete */
+    if(H5_daos_task_wait(&first_task, &end_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+    if(0 != status->status)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTOPERATE, FAIL, "blob I/O failed: %s", H5_daos_err_to_string(status->status));
+
+done:
+    /* If the batch could not be waited on, at least start it so the tasks
+     * complete and free their resources */
+    if(first_task) {
+        assert(ret_value < 0);
+        if(0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule first task for blob batch: %s", H5_daos_err_to_string(ret));
+        first_task = NULL;
+    } /* end if */
+
+    /* Release our reference to the status */
+    if(status)
+        H5_daos_blob_batch_status_release(status);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_batch_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_batch_add
+ *
+ * Purpose:     Adds a read (opc DAOS_OPC_OBJ_FETCH) or write (opc
+ *              DAOS_OPC_OBJ_UPDATE) of size bytes of the blob with ID
+ *              blob_id in file, to or from buf, to batch.  If copy is
+ *              TRUE the data in buf is copied so the caller may reuse it
+ *              immediately, otherwise buf must remain valid until the
+ *              batch is flushed.  Flushes the batch first if it is full.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_blob_batch_add(H5_daos_file_t *file, H5_daos_blob_batch_t *batch,
+    daos_opc_t opc, const void *blob_id, void *buf, size_t size, hbool_t copy)
+{
+    H5_daos_blob_batch_ud_t *udata = NULL;
+    daos_obj_rw_t *rw_args;
+    tse_task_t *io_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(batch->nest > 0);
+    assert(size > 0);
+    assert(!copy || opc == DAOS_OPC_OBJ_UPDATE);
+
+    /* Flush first if this operation would make the batch too large */
+    if(batch->ntasks == H5_DAOS_BLOB_BATCH_MAX_TASKS
+            || (batch->ntasks > 0 && batch->nbytes + size > H5_DAOS_BLOB_BATCH_MAX_BYTES))
+        if(H5_daos_blob_batch_flush(batch) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTOPERATE, FAIL, "can't flush blob batch");
+
+    /* Create first task and status for the batch if necessary.  The first
+     * task is not scheduled until the batch is flushed.  The flush holds the
+     * first reference to the status. */
+    if(!batch->status) {
+        if(NULL == (batch->status = (H5_daos_blob_batch_status_t *)DV_calloc(sizeof(H5_daos_blob_batch_status_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate status for blob batch");
+        batch->status->rc = 1;
+    } /* end if */
+    if(!batch->first_task)
+        if(H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL,
+                &batch->first_task) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create first task for blob batch");
+
+    /* Allocate udata, along with space for a copy of the blob if
+     * requested */
+    if(NULL == (udata = (H5_daos_blob_batch_ud_t *)DV_malloc(sizeof(H5_daos_blob_batch_ud_t) + (copy ? size : 0))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate user data struct for blob I/O task");
+    udata->status = batch->status;
+    (void)memcpy(udata->blob_id, blob_id, H5_DAOS_BLOB_ID_SIZE);
+    if(copy) {
+        (void)memcpy(udata + 1, buf, size);
+        buf = udata + 1;
+    } /* end if */
+
+    /* Set up dkey */
+    daos_iov_set(&udata->dkey, udata->blob_id, H5_DAOS_BLOB_ID_SIZE);
+
+    /* Set up iod */
+    memset(&udata->iod, 0, sizeof(udata->iod));
+    daos_const_iov_set((d_const_iov_t *)&udata->iod.iod_name, H5_daos_blob_key_g, H5_daos_blob_key_size_g);
+    udata->iod.iod_nr = 1u;
+    udata->iod.iod_size = (uint64_t)size;
+    udata->iod.iod_type = DAOS_IOD_SINGLE;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->sg_iov, buf, (daos_size_t)size);
+    udata->sgl.sg_nr = 1;
+    udata->sgl.sg_nr_out = 0;
+    udata->sgl.sg_iovs = &udata->sg_iov;
+
+    /* Create task for blob I/O */
+    if(H5_daos_create_daos_task(opc, 1, &batch->first_task, NULL,
+            H5_daos_blob_batch_comp_cb, udata, &io_task) < 0) {
+        /* The task (if any) has already been completed, without udata */
+        io_task = NULL;
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task for blob I/O");
+    } /* end if */
+
+    /* The task's complete callback releases this reference */
+    batch->status->rc++;
+
+    /* Set I/O task arguments */
+    if(NULL == (rw_args = daos_task_get_args(io_task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get arguments for blob I/O task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh = file->glob_md_oh;
+    rw_args->th = DAOS_TX_NONE;
+    rw_args->dkey = &udata->dkey;
+    rw_args->nr = 1u;
+    rw_args->iods = &udata->iod;
+    rw_args->sgls = &udata->sgl;
+
+    /* Schedule I/O task.  It will not run until first_task does. */
+    if(0 != (ret = tse_task_schedule(io_task, false)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task for blob I/O: %s", H5_daos_err_to_string(ret));
+    udata = NULL;
+
+    /* Add to batch */
+    batch->tasks[batch->ntasks++] = io_task;
+    batch->nbytes += size;
+
+done:
+    if(ret_value < 0 && io_task && udata) {
+        /* Task was not scheduled, so complete it here.  The complete
+         * callback frees udata. */
+        tse_task_complete(io_task, -H5_DAOS_SETUP_ERROR);
+        udata = NULL;
+    } /* end if */
+    udata = DV_free(udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_batch_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_prefetch_cmp
+ *
+ * Purpose:     Compares two prefetched blobs by blob ID, for qsort and
+ *              bsearch.
+ *
+ * Return:      Negative, zero or positive as with memcmp
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_blob_prefetch_cmp(const void *_ent1, const void *_ent2)
+{
+    const H5_daos_blob_prefetch_ent_t *ent1 = (const H5_daos_blob_prefetch_ent_t *)_ent1;
+    const H5_daos_blob_prefetch_ent_t *ent2 = (const H5_daos_blob_prefetch_ent_t *)_ent2;
+
+    return memcmp(ent1->blob_id, ent2->blob_id, H5_DAOS_BLOB_ID_SIZE);
+} /* end H5_daos_blob_prefetch_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_prefetch
+ *
+ * Purpose:     Reads all blobs referenced by nelmts elements of
+ *              file_type_id in buf (other than inline blobs), as a
+ *              batch, so the blob gets made when converting buf to a
+ *              memory type are served from memory instead of each waiting
+ *              for its own fetch.  Only variable length sequences and
+ *              strings whose base type contains no variable length or
+ *              reference data are handled.
+ *              At most H5_DAOS_BLOB_PREFETCH_MAX_BYTES are prefetched;
+ *              gets for later blobs read them as usual.
+ *
+ *              Sets *prefetched to TRUE if any blobs were prefetched, in
+ *              which case the caller must call
+ *              H5_daos_blob_prefetch_release when the conversion is done.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_blob_prefetch(H5_daos_file_t *file, hid_t file_type_id, size_t nelmts,
+    const void *buf, hbool_t *prefetched)
+{
+    H5_daos_blob_batch_t batch;
+    H5_daos_blob_prefetch_ent_t *ents = NULL;
+    uint8_t *prefetch_buf = NULL;
+    uint8_t nul_buf[H5_DAOS_BLOB_ID_SIZE];
+    hid_t base_type_id = -1;
+    H5T_class_t type_class;
+    size_t base_size;
+    size_t elem_size;
+    size_t nents = 0;
+    size_t nbytes = 0;
+    size_t blob_size;
+    const uint8_t *p;
+    uint32_t seq_len;
+    htri_t is_vl;
+    hbool_t batch_begun = FALSE;
+    size_t i, j;
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+    assert(buf || nelmts == 0);
+    assert(prefetched);
+
+    *prefetched = FALSE;
+
+    /* Only one set of blobs may be prefetched at a time */
+    if(file->blob_prefetch.ents)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Check if the type is a variable length sequence or string, and get
+     * the size of its base type */
+    if(H5T_NO_CLASS == (type_class = H5Tget_class(file_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype class");
+    if(type_class == H5T_STRING) {
+        if((is_vl = H5Tis_variable_str(file_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check for variable length string");
+        if(!is_vl)
+            D_GOTO_DONE(SUCCEED);
+        base_size = 1;
+    } /* end if */
+    else if(type_class == H5T_VLEN) {
+        if((base_type_id = H5Tget_super(file_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get base datatype");
+        if((is_vl = H5_daos_detect_vl_vlstr_ref(base_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't check for vl or reference type");
+        if(is_vl)
+            D_GOTO_DONE(SUCCEED);
+        if((base_size = H5Tget_size(base_type_id)) == 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get base datatype size");
+    } /* end if */
+    else
+        D_GOTO_DONE(SUCCEED);
+
+    /* Each element is encoded as a 4 byte sequence length followed by the
+     * blob ID */
+    if((elem_size = H5Tget_size(file_type_id)) == 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype size");
+    if(elem_size != 4 + H5_DAOS_BLOB_ID_SIZE)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Count blobs to prefetch, skipping empty and NULL elements */
+    (void)memset(nul_buf, 0, sizeof(nul_buf));
+    for(i = 0; i < nelmts; i++) {
+        p = (const uint8_t *)buf + i * elem_size;
+        UINT32DECODE(p, seq_len);
+        if(seq_len == 0 || !memcmp(p, nul_buf, H5_DAOS_BLOB_ID_SIZE)
+                || H5_DAOS_BLOB_IS_INLINE(p))
+            continue;
+        blob_size = (size_t)seq_len * base_size;
+        if(nbytes + blob_size > H5_DAOS_BLOB_PREFETCH_MAX_BYTES)
+            break;
+        nents++;
+        nbytes += blob_size;
+    } /* end for */
+    if(nents == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Allocate blob table and buffer */
+    if(NULL == (ents = (H5_daos_blob_prefetch_ent_t *)DV_malloc(nents * sizeof(H5_daos_blob_prefetch_ent_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate prefetched blob table");
+    if(NULL == (prefetch_buf = (uint8_t *)DV_malloc(nbytes)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate prefetched blob buffer");
+
+    /* Fill in blob table and add reads to a batch of our own, so the reads
+     * are not mixed with (or flushed by) other blob I/O on the file while we
+     * wait for them */
+    (void)memset(&batch, 0, sizeof(batch));
+    batch.nest = 1;
+    batch_begun = TRUE;
+    nbytes = 0;
+    for(i = 0, j = 0; j < nents; i++) {
+        assert(i < nelmts);
+        p = (const uint8_t *)buf + i * elem_size;
+        UINT32DECODE(p, seq_len);
+        if(seq_len == 0 || !memcmp(p, nul_buf, H5_DAOS_BLOB_ID_SIZE)
+                || H5_DAOS_BLOB_IS_INLINE(p))
+            continue;
+        (void)memcpy(ents[j].blob_id, p, H5_DAOS_BLOB_ID_SIZE);
+        ents[j].size = (size_t)seq_len * base_size;
+        ents[j].data = prefetch_buf + nbytes;
+        if(H5_daos_blob_batch_add(file, &batch, DAOS_OPC_OBJ_FETCH, ents[j].blob_id, ents[j].data, ents[j].size, FALSE) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "can't add blob read to batch");
+        nbytes += ents[j].size;
+        j++;
+    } /* end for */
+
+done:
+    /* Wait for the reads (always, since they reference prefetch_buf) */
+    if(batch_begun)
+        if(H5_daos_blob_batch_flush(&batch) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_READERROR, FAIL, "can't read blobs");
+
+    /* The table is only published once the reads are done.  Another
+     * prefetch may have been published while we waited, in that case ours
+     * is dropped. */
+    if(ret_value >= 0 && ents && !file->blob_prefetch.ents) {
+        /* Sort by blob ID for lookup, and make the blobs available to blob
+         * gets */
+        qsort(ents, nents, sizeof(H5_daos_blob_prefetch_ent_t), H5_daos_blob_prefetch_cmp);
+        file->blob_prefetch.ents = ents;
+        file->blob_prefetch.nents = nents;
+        file->blob_prefetch.buf = prefetch_buf;
+        *prefetched = TRUE;
+    } /* end if */
+    else {
+        ents = DV_free(ents);
+        prefetch_buf = DV_free(prefetch_buf);
+    } /* end else */
+
+    if(base_type_id >= 0 && H5Tclose(base_type_id) < 0)
+        D_DONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close base datatype");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_prefetch_release
+ *
+ * Purpose:     Frees the blobs prefetched by H5_daos_blob_prefetch.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_blob_prefetch_release(H5_daos_file_t *file)
+{
+    assert(file);
+
+    file->blob_prefetch.ents = DV_free(file->blob_prefetch.ents);
+    file->blob_prefetch.nents = 0;
+    file->blob_prefetch.buf = DV_free(file->blob_prefetch.buf);
+
+    return;
+} /* end H5_daos_blob_prefetch_release() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_blob_put
  *
@@ -98,14 +689,25 @@ H5_daos_blob_put(void *_file, const void *buf, size_t size, void *blob_id,
 
     H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
+    /* Store short blobs in the blob ID itself if requested */
+    if(size > 0 && size <= H5_DAOS_BLOB_INLINE_MAX && file->fapl_cache.inline_vl) {
+        H5_daos_blob_inline_encode((uint8_t *)blob_id, buf, size);
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
     /* Generate blob ID as a UUID */
     uuid_generate(blob_uuid);
 
     /* Copy uuid to blob_id output buffer */
     (void)memcpy(blob_id, &blob_uuid, H5_DAOS_BLOB_ID_SIZE);
 
-    /* Only write if size > 0 */
-    if(size > 0) {
+    /* Only write if size > 0.  If a batch is open, add the write to it
+     * instead of waiting on it here. */
+    if(size > 0 && file->blob_batch.nest > 0) {
+        if(H5_daos_blob_batch_add(file, &file->blob_batch, DAOS_OPC_OBJ_UPDATE, blob_id, (void *)buf, size, TRUE) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "can't add blob write to batch");
+    } /* end if */
+    else if(size > 0) {
         /* Set up dkey */
         daos_iov_set(&dkey, blob_id, H5_DAOS_BLOB_ID_SIZE);
 
@@ -199,6 +801,28 @@ H5_daos_blob_get(void *_file, const void *blob_id, void *buf, size_t size,
 
     H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
+    /* Decode inline blobs from the blob ID */
+    if(size > 0 && H5_DAOS_BLOB_IS_INLINE(blob_id)) {
+        if(size > H5_DAOS_BLOB_INLINE_MAX)
+            D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "size of inline blob is too large");
+        H5_daos_blob_inline_decode((const uint8_t *)blob_id, buf, size);
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Serve from prefetched blobs if possible */
+    if(size > 0 && file->blob_prefetch.ents) {
+        H5_daos_blob_prefetch_ent_t key;
+        H5_daos_blob_prefetch_ent_t *ent;
+
+        (void)memcpy(key.blob_id, blob_id, H5_DAOS_BLOB_ID_SIZE);
+        if(NULL != (ent = (H5_daos_blob_prefetch_ent_t *)bsearch(&key, file->blob_prefetch.ents,
+                file->blob_prefetch.nents, sizeof(H5_daos_blob_prefetch_ent_t), H5_daos_blob_prefetch_cmp))
+                && ent->size == size) {
+            (void)memcpy(buf, ent->data, size);
+            D_GOTO_DONE(SUCCEED);
+        } /* end if */
+    } /* end if */
+
     /* Only read if size > 0 */
     if(size > 0) {
         /* Set up dkey */
@@ -325,6 +949,10 @@ H5_daos_blob_specific(void *_file, void *blob_id,
             {
                 daos_key_t dkey;
 
+                /* Inline blobs have nothing stored */
+                if(H5_DAOS_BLOB_IS_INLINE(blob_id))
+                    break;
+
                 /* Set up dkey */
                 daos_iov_set(&dkey, blob_id, H5_DAOS_BLOB_ID_SIZE);
 
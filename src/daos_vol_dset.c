@@ -32,6 +32,23 @@
 #define H5O_LAYOUT_NDIMS                 (H5S_MAX_RANK+1)
 #define CHUNK_DKEY_BUF_SIZE              (1 + (sizeof(uint64_t) * H5S_MAX_RANK))
 
+/* Maximum number of chunks whose I/O tasks share a single batch (udata
+ * allocation, references to the request and dataset, and a single dependency
+ * for the end task) */
+#define H5_DAOS_CHUNK_IO_BATCH_SIZE      64
+
+/* Definitions for filtered chunks.  A filtered chunk is stored as a single
+ * value holding a header (format version, filter mask and size of the
+ * unfiltered chunk) followed by the filtered chunk.  The filters may make a
+ * chunk up to H5_DAOS_FILTERED_CHUNK_SLACK bytes larger than the unfiltered
+ * chunk; if they make it larger still it is stored unfiltered instead.  A
+ * record is therefore never larger than the header plus the unfiltered
+ * chunk size plus the slack, so a chunk can always be read with a single
+ * fetch into a buffer of that size. */
+#define H5_DAOS_FILTERED_CHUNK_VERSION   1
+#define H5_DAOS_FILTERED_CHUNK_HDR_SIZE  (1 + 4 + 8)
+#define H5_DAOS_FILTERED_CHUNK_SLACK     64
+
 /* Definitions for automatic chunking */
 /* Maximum size for contiguous datasets (target size * sqrt(2)) */
 #define H5_DAOS_MAX_CONTIG_SIZE ((uint64_t)((double)H5_daos_chunk_target_size_g * 1.41421356237))
@@ -42,12 +59,6 @@
 /* Local Type and Struct Definition */
 /************************************/
 
-/* Udata type for H5Dscatter callback */
-typedef struct H5_daos_scatter_cb_ud_t {
-    void *buf;
-    size_t len;
-} H5_daos_scatter_cb_ud_t;
-
 /* Udata type for memory space H5Diterate callback */
 typedef struct {
     daos_iod_t *iods;
@@ -66,15 +77,21 @@ typedef struct {
     uint64_t idx;
 } H5_daos_vl_file_ud_t;
 
+/* Forward declarations of chunk I/O batch and stream structs */
+struct H5_daos_chunk_io_batch_t;
+struct H5_daos_chunk_io_stream_t;
+
 /* Typedef for function to perform I/O on a single chunk */
 typedef herr_t (*H5_daos_chunk_io_func)(H5_daos_select_chunk_info_t *chunk_info,
-    H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
-    void *buf, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+    void *buf, struct H5_daos_chunk_io_batch_t *batch, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
 
 /* Task user data for raw data I/O on a single chunk */
 typedef struct H5_daos_chunk_io_ud_t {
     H5_daos_req_t *req;
     H5_daos_dset_t *dset;
+    struct H5_daos_chunk_io_batch_t *batch;
     daos_key_t dkey;
     uint8_t dkey_buf[CHUNK_DKEY_BUF_SIZE];
     uint8_t akey_buf;
@@ -89,8 +106,9 @@ typedef struct H5_daos_chunk_io_ud_t {
     struct {
         hssize_t num_elem;
         hid_t mem_type_id;
-        hid_t mem_space_id;
-        void *buf;
+        daos_iov_t mem_iov;
+        daos_iov_t *mem_iovs;
+        size_t mem_niov;
         H5_daos_io_type_t io_type;
         H5_daos_tconv_reuse_t reuse;
         hbool_t fill_bkg;
@@ -98,9 +116,151 @@ typedef struct H5_daos_chunk_io_ud_t {
         size_t file_type_size;
         void *tconv_buf;
         void *bkg_buf;
+        H5_daos_tconv_kernel_t kernel;
+        H5_daos_tpool_job_t job;
     } tconv;
+
+    /* Fields used for filtered chunks */
+    struct {
+        uint8_t hdr_buf[H5_DAOS_FILTERED_CHUNK_HDR_SIZE];
+        daos_iov_t sg_iovs[2];
+        size_t nrecx;
+        size_t chunk_nbytes;
+        void *buf;
+        size_t buf_size;
+        daos_size_t fetch_size;
+        hbool_t need_tconv;
+        hbool_t rmw;
+    } filter;
+
+    /* Fields used for I/O through the chunk cache */
+    struct {
+        H5_daos_chunk_cache_ent_t *ent;
+        size_t nrecx;
+        void *fetch_buf;
+        daos_recx_t fetch_recx;
+        hbool_t need_tconv;
+    } cache;
+
+    /* Fields used for hole-aware reads.  iom.iom_recxs is NULL unless the
+     * fill value must be written to records that do not exist. */
+    struct {
+        daos_iom_t iom;
+        daos_recx_t iom_recx;
+    } hole;
+
+    /* Task that stands in for the I/O task as other tasks' dependency, when
+     * the I/O may finish after the I/O task's completion callback (because
+     * the fetch is reissued or conversion is done by a worker thread).  Only
+     * used outside of batches. */
+    tse_task_t *metatask;
 } H5_daos_chunk_io_ud_t;
 
+/* Batch of chunk I/O operations.  The per-chunk task udata structs are
+ * allocated together and the batch, not the individual chunk tasks, holds the
+ * references to the request and dataset, and the copy of the memory datatype
+ * used for type conversion.  The metatask is completed when the last chunk
+ * task in the batch finishes. */
+typedef struct H5_daos_chunk_io_batch_t {
+    H5_daos_req_t *req;
+    H5_daos_dset_t *dset;
+    H5_daos_chunk_io_ud_t *chunk_io_ud;
+    size_t nalloc;
+    size_t nused;
+    size_t rc;
+    tse_task_t *metatask;
+    hid_t mem_type_id;
+    struct H5_daos_chunk_io_stream_t *stream;
+} H5_daos_chunk_io_batch_t;
+
+/* Write back of entries in a dataset's chunk cache.  The metatask is
+ * completed when the last chunk update finishes.  rc counts the chunk
+ * updates in flight, plus one for the task creating them. */
+typedef struct H5_daos_chunk_cache_flush_ud_t {
+    H5_daos_req_t *req;
+    H5_daos_dset_t *dset;
+    hbool_t evict;
+    size_t max_nbytes;
+    hbool_t trim;
+    int ndims;
+    hsize_t extent[H5S_MAX_RANK];
+    size_t rc;
+    tse_task_t *metatask;
+} H5_daos_chunk_cache_flush_ud_t;
+
+/* Task user data for writing back a single chunk cache entry.  If the entry
+ * was evicted it is owned by this struct and freed when the update
+ * finishes. */
+typedef struct H5_daos_chunk_cache_wb_ud_t {
+    H5_daos_chunk_cache_flush_ud_t *flush_ud;
+    H5_daos_chunk_cache_ent_t *ent;
+    hbool_t evicted;
+    daos_key_t dkey;
+    uint8_t akey_buf;
+    daos_iod_t iod;
+    daos_sg_list_t sgl;
+    daos_recx_t *recxs;
+    daos_iov_t *sg_iovs;
+} H5_daos_chunk_cache_wb_ud_t;
+
+/* Iterator over the chunks selected in a file dataspace, used to set up the
+ * chunk info for the selected chunks one batch at a time instead of for the
+ * whole selection up front (see H5_daos_chunk_iter_next()).  start_coords
+ * and end_coords are the bounds of the next chunk to check for intersection
+ * with the file selection, and num_sel_points is the number of selected
+ * elements not yet covered by the chunks returned.  If own_spaces is TRUE
+ * the file and memory dataspaces are copies owned by the iterator. */
+typedef struct H5_daos_chunk_iter_t {
+    hid_t file_space_id;
+    hid_t mem_space_id;
+    hbool_t own_spaces;
+    H5S_sel_type file_space_type;
+    int fspace_ndims;
+    int mspace_ndims;
+    hsize_t file_space_dims[H5S_MAX_RANK];
+    hsize_t mem_space_dims[H5S_MAX_RANK];
+    hsize_t chunk_dims[H5S_MAX_RANK];
+    hsize_t file_sel_start[H5S_MAX_RANK];
+    hsize_t file_sel_end[H5S_MAX_RANK];
+    hsize_t selection_start_coords[H5O_LAYOUT_NDIMS];
+    hsize_t start_coords[H5O_LAYOUT_NDIMS];
+    hsize_t end_coords[H5O_LAYOUT_NDIMS];
+    hssize_t chunk_file_space_adjust[H5O_LAYOUT_NDIMS];
+    htri_t space_same_shape;
+    hid_t entire_chunk_sel_space_id;
+    hssize_t num_sel_points;
+} H5_daos_chunk_iter_t;
+
+/* Stream of chunk I/O batches, used when more chunks are selected than may be
+ * in flight at once.  Batches are issued as earlier ones complete, and the
+ * stream, not the individual batches, holds the references to the request
+ * and dataset and owns the selected chunk info array.  If use_chunk_iter is
+ * TRUE, the chunk info for each batch is set up in the first entries of the
+ * array from chunk_iter just before the batch is issued.  The metatask is
+ * completed when the last batch in the stream finishes. */
+typedef struct H5_daos_chunk_io_stream_t {
+    H5_daos_req_t *req;
+    H5_daos_dset_t *dset;
+    H5_daos_select_chunk_info_t *chunk_info;
+    size_t chunk_info_nalloc;
+    H5_daos_chunk_iter_t chunk_iter;
+    hbool_t use_chunk_iter;
+    H5_daos_chunk_sel_pattern_t sel_pattern;
+    hbool_t use_sel_pattern;
+    size_t nchunks_sel;
+    size_t next_chunk;
+    size_t max_in_flight;
+    size_t batch_size;
+    size_t nin_flight;
+    hbool_t issuing;
+    H5_daos_chunk_io_func single_chunk_io_func;
+    uint64_t dset_ndims;
+    hid_t mem_type_id;
+    H5_daos_io_type_t io_type;
+    void *buf;
+    tse_task_t *metatask;
+} H5_daos_chunk_io_stream_t;
+
 /* Task user data struct for I/O operations (API level) */
 typedef struct H5_daos_io_task_ud_t {
     H5_daos_req_t *req;
@@ -135,6 +295,8 @@ typedef struct H5_daos_dset_set_extent_ud_t {
 /********************/
 
 static herr_t H5_daos_dset_fill_dcpl_cache(H5_daos_dset_t *dset);
+static herr_t H5_daos_dset_init_filters(H5_daos_dset_t *dset,
+    hbool_t set_local);
 static int H5_daos_fill_val_bcast_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_bcast_fill_val(H5_daos_dset_t *dset, H5_daos_req_t *req,
     size_t fill_val_size, tse_task_t **first_task, tse_task_t **dep_task);
@@ -146,24 +308,123 @@ static int H5_daos_dset_open_recv_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_dset_fill_io_cache(H5_daos_dset_t *dset,
     hid_t file_space_id, hid_t mem_space_id);
 static int H5_daos_dinfo_read_comp_cb(tse_task_t *task, void *args);
-static herr_t H5_daos_sel_to_recx_iov(hid_t sel_iter_id, size_t type_size,
+static herr_t H5_daos_sel_to_recx_iov(hid_t space_id, hid_t sel_iter_id,
+    size_t type_size, void *buf, daos_recx_t **recxs, daos_iov_t **sg_iovs,
+    size_t *list_nused);
+static htri_t H5_daos_get_regular_sel(hid_t space_id, int *ndims,
+    hsize_t *dims, hsize_t *start, hsize_t *stride, hsize_t *count,
+    hsize_t *block);
+static htri_t H5_daos_get_chunk_sel_pattern(hid_t file_space_id,
+    hid_t mem_space_id, H5_daos_chunk_sel_pattern_t *sel_pattern);
+static hsize_t H5_daos_chunk_sel_pattern_clip(
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, int dim, hsize_t lo,
+    hsize_t hi, hsize_t *first_block, hsize_t *last_block);
+static herr_t H5_daos_chunk_sel_to_recx_iov(
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, const hsize_t *chunk_dims,
+    const uint64_t *chunk_coords, hbool_t mem_space, size_t type_size,
     void *buf, daos_recx_t **recxs, daos_iov_t **sg_iovs, size_t *list_nused);
-static herr_t H5_daos_scatter_cb(const void **src_buf,
-    size_t *src_buf_bytes_used, void *_udata);
+static void H5_daos_iov_gather(const daos_iov_t *iovs, size_t niov,
+    void *dst_buf);
+static void H5_daos_iov_scatter(const void *src_buf, const daos_iov_t *iovs,
+    size_t niov);
+static herr_t H5_daos_chunk_io_batch_create(H5_daos_dset_t *dset,
+    size_t nalloc, H5_daos_req_t *req, tse_task_t *end_task,
+    H5_daos_chunk_io_stream_t *stream, H5_daos_chunk_io_batch_t **batch);
+static int H5_daos_chunk_io_batch_release(H5_daos_chunk_io_batch_t *batch);
+static H5_daos_chunk_io_ud_t *H5_daos_chunk_io_ud_alloc(
+    H5_daos_chunk_io_batch_t *batch);
+static herr_t H5_daos_get_chunk_io_max_in_flight(hid_t dxpl_id,
+    size_t *max_in_flight);
+static herr_t H5_daos_free_chunk_info(H5_daos_select_chunk_info_t *chunk_info,
+    size_t nalloc);
+static herr_t H5_daos_chunk_io_stream_issue(H5_daos_chunk_io_stream_t *stream,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static int H5_daos_chunk_io_stream_finish(H5_daos_chunk_io_stream_t *stream);
+static int H5_daos_chunk_io_stream_batch_done(H5_daos_chunk_io_stream_t *stream,
+    size_t nchunks);
+static herr_t H5_daos_dataset_io_chunks(H5_daos_select_chunk_info_t *chunk_info,
+    H5_daos_chunk_iter_t *chunk_iter,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, size_t nchunks_sel,
+    H5_daos_chunk_io_func single_chunk_io_func, H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id,
+    H5_daos_io_type_t io_type, void *buf, tse_task_t *end_task,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_chunk_io_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_chunk_io_comp_cb(tse_task_t *task, void *args);
+static void H5_daos_chunk_fill_holes(H5_daos_chunk_io_ud_t *udata);
 static herr_t H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info,
-    H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
-    void *buf, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+    void *buf, H5_daos_chunk_io_batch_t *batch, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_chunk_io_tconv_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_chunk_io_tconv_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_chunk_io_tconv_free(H5_daos_chunk_io_ud_t *udata,
+    int ret_value);
+static int H5_daos_chunk_io_tconv_job(void *_udata);
+static int H5_daos_chunk_io_tconv_job_comp(void *_udata, int ret);
 static int H5_daos_chunk_fill_bkg_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_chunk_fill_bkg_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info,
-    H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
-    void *buf, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+    void *buf, H5_daos_chunk_io_batch_t *batch, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static void H5_daos_chunk_seq_copy(void *chunk_buf, const daos_recx_t *recxs,
+    size_t nrecx, size_t elem_size, const daos_iov_t *iovs, size_t niov,
+    hbool_t to_chunk);
+static void H5_daos_chunk_buf_fill(H5_daos_dset_t *dset, void *buf,
+    size_t nbytes);
+static int H5_daos_filtered_chunk_decode(H5_daos_chunk_io_ud_t *udata,
+    daos_size_t rec_size, hbool_t *exists);
+static int H5_daos_chunk_io_filtered_fetch_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_chunk_io_filtered_fetch_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_chunk_io_filtered_update_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_chunk_io_filtered_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_dataset_io_filtered(H5_daos_select_chunk_info_t *chunk_info,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+    void *buf, H5_daos_chunk_io_batch_t *batch, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static uint64_t H5_daos_chunk_cache_hash(dv_hash_table_key_t key);
+static int H5_daos_chunk_cache_equal(dv_hash_table_key_t key1,
+    dv_hash_table_key_t key2);
+static herr_t H5_daos_dset_init_chunk_cache(H5_daos_dset_t *dset);
+static void H5_daos_chunk_cache_remove(H5_daos_chunk_cache_t *cache,
+    H5_daos_chunk_cache_ent_t *ent);
+static void H5_daos_chunk_cache_ent_free(H5_daos_chunk_cache_ent_t *ent);
+static herr_t H5_daos_chunk_cache_free(H5_daos_dset_t *dset);
+static int H5_daos_chunk_cache_lookup(H5_daos_chunk_cache_t *cache,
+    const uint8_t *dkey_buf, size_t dkey_len, H5_daos_chunk_cache_ent_t **ent);
+static int H5_daos_recx_cmp(const void *_recx1, const void *_recx2);
+static int H5_daos_chunk_cache_add_dirty(H5_daos_chunk_cache_ent_t *ent,
+    const daos_recx_t *recxs, size_t nrecx);
+static int H5_daos_chunk_cache_copy(H5_daos_chunk_io_ud_t *udata);
+static int H5_daos_chunk_cache_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_chunk_cache_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_dataset_io_cached(H5_daos_select_chunk_info_t *chunk_info,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+    void *buf, H5_daos_chunk_io_batch_t *batch, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t H5_daos_dataset_io_chunks_cached(H5_daos_select_chunk_info_t *chunk_info,
+    H5_daos_chunk_iter_t *chunk_iter,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, size_t nchunks_sel,
+    H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id,
+    H5_daos_io_type_t io_type, void *buf, tse_task_t *end_task,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t H5_daos_chunk_cache_flush(H5_daos_dset_t *dset, hbool_t evict,
+    size_t max_nbytes, const hsize_t *extent, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static hbool_t H5_daos_chunk_cache_ent_outside(H5_daos_chunk_cache_flush_ud_t *flush_ud,
+    H5_daos_chunk_cache_ent_t *ent);
+static int H5_daos_chunk_cache_flush_task(tse_task_t *task);
+static int H5_daos_chunk_cache_write_back(H5_daos_chunk_cache_flush_ud_t *flush_ud,
+    H5_daos_chunk_cache_ent_t *ent, hbool_t evicted);
+static int H5_daos_chunk_cache_flush_release(H5_daos_chunk_cache_flush_ud_t *flush_ud);
+static int H5_daos_chunk_cache_wb_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_chunk_cache_wb_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_dset_io_int_task(tse_task_t *task);
 static int H5_daos_dset_io_int_end_task(tse_task_t *task);
+static herr_t H5_daos_dataset_io_multi(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hid_t dxpl_id, H5_daos_io_type_t io_type,
+    const void *buf[]);
 #if H5VL_VERSION >= 2
 static herr_t H5_daos_dataset_get_realize(void *future_object,
     hid_t *actual_object_id);
@@ -180,6 +441,25 @@ static hid_t H5_daos_point_and_block(hid_t point_space, hsize_t rank,
 static herr_t H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
     hid_t file_space_id, hid_t mem_space_id,
     H5_daos_select_chunk_info_t **chunk_info, size_t *chunk_info_len,
+    size_t *nchunks_selected, H5_daos_chunk_sel_pattern_t *sel_pattern,
+    hbool_t *use_sel_pattern, H5_daos_chunk_iter_t *chunk_iter,
+    hbool_t *use_chunk_iter);
+static herr_t H5_daos_chunk_iter_init(H5_daos_chunk_iter_t *iter,
+    const H5_daos_dcpl_cache_t *dcpl_cache, hid_t file_space_id,
+    hid_t mem_space_id, hssize_t num_sel_points);
+static herr_t H5_daos_chunk_iter_copy(H5_daos_chunk_iter_t *dst,
+    const H5_daos_chunk_iter_t *src);
+static herr_t H5_daos_chunk_iter_term(H5_daos_chunk_iter_t *iter);
+static hbool_t H5_daos_chunk_iter_advance(const H5_daos_chunk_iter_t *iter,
+    hsize_t *start_coords, hsize_t *end_coords);
+static herr_t H5_daos_chunk_iter_count(const H5_daos_chunk_iter_t *iter,
+    size_t *nchunks);
+static herr_t H5_daos_chunk_iter_next(H5_daos_chunk_iter_t *iter,
+    H5_daos_select_chunk_info_t *chunk_info, size_t nchunks);
+static herr_t H5_daos_get_selected_chunk_info_pattern(
+    H5_daos_dcpl_cache_t *dcpl_cache,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, hssize_t num_sel_points,
+    H5_daos_select_chunk_info_t **chunk_info, size_t *chunk_info_nalloc,
     size_t *nchunks_selected);
 
 
@@ -261,6 +541,187 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_dset_fill_dcpl_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_dcpl_filtered_chunks
+ *
+ * Purpose:     Checks whether a dataset created with the DCPL dcpl_id
+ *              stores its chunks as filtered chunk records, i.e. whether
+ *              the DCPL has filters and does not select the legacy chunk
+ *              format.  The result is recorded in the dataset's oid (see
+ *              H5_DAOS_FILTERED_CHUNKS).
+ *
+ * Return:      Success:        TRUE or FALSE
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5_daos_dset_dcpl_filtered_chunks(hid_t dcpl_id)
+{
+    hbool_t legacy = FALSE;
+    htri_t prop_exists;
+    int nfilters;
+    htri_t ret_value = FALSE;
+
+    if(dcpl_id == H5P_DEFAULT || dcpl_id == H5P_DATASET_CREATE_DEFAULT)
+        D_GOTO_DONE(FALSE);
+
+    if((nfilters = H5Pget_nfilters(dcpl_id)) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of filters");
+    if(nfilters == 0)
+        D_GOTO_DONE(FALSE);
+
+    /* Check for legacy chunk format */
+    if((prop_exists = H5Pexist(dcpl_id, H5_DAOS_LEGACY_CHUNK_FORMAT_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for legacy chunk format property");
+    if(prop_exists && H5Pget(dcpl_id, H5_DAOS_LEGACY_CHUNK_FORMAT_PROP_NAME, &legacy) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get legacy chunk format property");
+
+    ret_value = !legacy;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_dcpl_filtered_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_init_filters
+ *
+ * Purpose:     Sets up the filter pipeline in the "dcpl_cache" field of
+ *              the dataset struct from the dataset's DCPL, and checks
+ *              that the dataset can be filtered.  If create is TRUE
+ *              (on dataset creation), the filters' "set local" callbacks
+ *              are called, which may modify the DCPL.  Must be called
+ *              after the layout in the DCPL cache is final.
+ *
+ *              Datasets that do not store filtered chunk records (see
+ *              H5_DAOS_FILTERED_CHUNKS) ignore the filters in their DCPL
+ *              and get no pipeline, so their chunks are accessed as
+ *              arrays.  On creation this is decided from the DCPL, as
+ *              the oid is not generated yet.  On open it is decided
+ *              from the oid.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dset_init_filters(H5_daos_dset_t *dset, hbool_t create)
+{
+    htri_t filtered;
+    htri_t is_vl_ref;
+    herr_t ret_value = SUCCEED;
+
+    assert(dset);
+    assert(!dset->dcpl_cache.pipeline);
+
+    /* Check chunk format */
+    if(create) {
+        if((filtered = H5_daos_dset_dcpl_filtered_chunks(dset->dcpl_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check chunk format");
+    } /* end if */
+    else
+        filtered = H5_DAOS_DSET_FILTERED_CHUNKS(dset);
+    if(!filtered)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Read filter pipeline */
+    if(H5_daos_filter_pipeline_init(dset->dcpl_id, dset->type_id, dset->space_id,
+            create, &dset->dcpl_cache.pipeline) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize filter pipeline");
+    if(!dset->dcpl_cache.pipeline)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Filters are only supported for chunked datasets with fixed size
+     * datatypes */
+    if(dset->dcpl_cache.layout != H5D_CHUNKED)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "filters can only be used with chunked layout");
+    if((is_vl_ref = H5_daos_detect_vl_vlstr_ref(dset->type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for vl or reference type");
+    if(is_vl_ref)
+        D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "filters are not supported with variable-length or reference datatypes");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_init_filters() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_init_chunk_cache
+ *
+ * Purpose:     Sets up the chunk cache for a dataset, if one was
+ *              requested in the DAPL.  The cache is only used for
+ *              chunked datasets without filters with fixed size
+ *              datatypes, and only if it can hold at least one chunk.
+ *              Otherwise it is disabled.  Must be called after the
+ *              dataset's datatype, dataspace, DCPL cache and filter
+ *              pipeline are set up.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dset_init_chunk_cache(H5_daos_dset_t *dset)
+{
+    H5_daos_chunk_cache_t *cache;
+    htri_t is_vl_ref;
+    size_t chunk_nbytes;
+    int ndims;
+    int i;
+    herr_t ret_value = SUCCEED;
+
+    assert(dset);
+
+    cache = &dset->chunk_cache;
+    assert(!cache->table);
+
+    /* Check if the cache was requested */
+    if(cache->nbytes_max == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Check if the dataset can be cached, disable the cache otherwise */
+    if(dset->dcpl_cache.layout != H5D_CHUNKED || dset->dcpl_cache.pipeline) {
+        cache->nbytes_max = 0;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+    if((is_vl_ref = H5_daos_detect_vl_vlstr_ref(dset->type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for vl or reference type");
+    if(is_vl_ref) {
+        cache->nbytes_max = 0;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Calculate chunk size */
+    if((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dimensions");
+    chunk_nbytes = dset->file_type_size;
+    for(i = 0; i < ndims; i++)
+        chunk_nbytes *= (size_t)dset->dcpl_cache.chunk_dims[i];
+    if(chunk_nbytes > cache->nbytes_max) {
+        cache->nbytes_max = 0;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+    cache->chunk_nbytes = chunk_nbytes;
+
+    /* Create hash table of cache entries */
+    if(NULL == (cache->table = dv_hash_table_new(H5_daos_chunk_cache_hash, H5_daos_chunk_cache_equal)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk cache hash table");
+
+    /* Add dataset to the file's list of datasets with a chunk cache, so the
+     * cache is written back when the file is flushed */
+    cache->file_prev = NULL;
+    cache->file_next = dset->obj.item.file->cached_dsets;
+    if(cache->file_next)
+        cache->file_next->chunk_cache.file_prev = dset;
+    dset->obj.item.file->cached_dsets = dset;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_init_chunk_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_fill_val_bcast_comp_cb
@@ -471,7 +932,7 @@ H5_daos_dataset_create(void *_item,
      * rank. */
     if(name) {
         if(NULL == (target_obj = H5_daos_group_traverse(item, name, lcpl_id, int_req,
-                collective, &path_buf, &target_name, &target_name_len, &first_task,
+                collective, FALSE, &path_buf, &target_name, &target_name_len, &first_task,
                 &dep_task)))
             D_GOTO_ERROR(H5E_DATASET, H5E_BADITER, NULL, "can't traverse path");
 
@@ -651,6 +1112,8 @@ H5_daos_dataset_create_helper(H5_daos_file_t *file, hid_t type_id, hid_t space_i
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "failed to copy dcpl");
     if((dapl_id != H5P_DATASET_ACCESS_DEFAULT) && (dset->dapl_id = H5Pcopy(dapl_id)) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "failed to copy dapl");
+    if(H5_daos_get_chunk_cache_nbytes(dset->dapl_id, &dset->chunk_cache.nbytes_max) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get chunk cache size");
 
     /* Fill DCPL cache */
     if(H5_daos_dset_fill_dcpl_cache(dset) < 0)
@@ -741,6 +1204,15 @@ H5_daos_dataset_create_helper(H5_daos_file_t *file, hid_t type_id, hid_t space_i
         } /* end if */
     } /* end if */
 
+    /* Set up filter pipeline.  This may modify the filter parameters in the
+     * DCPL, so it must be done before the DCPL is encoded. */
+    if(H5_daos_dset_init_filters(dset, TRUE) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "failed to set up filter pipeline");
+
+    /* Set up chunk cache */
+    if(H5_daos_dset_init_chunk_cache(dset) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "failed to set up chunk cache");
+
     /* Generate dataset oid */
     if(H5_daos_oid_generate(&dset->obj.oid, H5I_DATASET,
             (default_dcpl ? H5P_DEFAULT : dset->dcpl_id),
@@ -1119,6 +1591,14 @@ H5_daos_dset_open_end(H5_daos_dset_t *dset, uint8_t *p, uint64_t type_buf_len,
     if(H5_daos_dset_fill_dcpl_cache(dset) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_CPL_CACHE_ERROR, "failed to fill DCPL cache");
 
+    /* Set up filter pipeline */
+    if(H5_daos_dset_init_filters(dset, FALSE) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_CPL_CACHE_ERROR, "failed to set up filter pipeline");
+
+    /* Set up chunk cache */
+    if(H5_daos_dset_init_chunk_cache(dset) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_CPL_CACHE_ERROR, "failed to set up chunk cache");
+
     /* Check for fill value */
     if(fill_val_len > 0) {
         htri_t is_vl_ref;
@@ -1194,11 +1674,11 @@ done:
             if(H5Sclose(scalar_space_id) < 0)
                 D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close scalar dataspace");
         } /* end else */
-        tconv_buf = DV_free(tconv_buf);
+        tconv_buf = H5_daos_bufpool_free(tconv_buf);
     } /* end if */
 
     /* Free bkg_buf */
-    bkg_buf = DV_free(bkg_buf);
+    bkg_buf = H5_daos_bufpool_free(bkg_buf);
 
     return ret_value;
 } /* end H5_daos_dset_open_end() */
@@ -1567,7 +2047,7 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             udata->md_rw_cb_ud.req->status = task->dt_result;
             udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
         } /* end if */
-        else if(task->dt_result == 0) {
+        else if(task->dt_result == 0 || udata->omd_cache_hit) {
             uint64_t type_buf_len = (uint64_t)((char *)udata->md_rw_cb_ud.sg_iov[1].iov_buf
                     - (char *)udata->md_rw_cb_ud.sg_iov[0].iov_buf);
             uint64_t space_buf_len = (uint64_t)((char *)udata->md_rw_cb_ud.sg_iov[2].iov_buf
@@ -1608,6 +2088,20 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                     (uint64_t)udata->md_rw_cb_ud.iod[3].iod_size,
                     udata->md_rw_cb_ud.req->dxpl_id)))
                 D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't finish opening dataset");
+
+            /* Add fetched metadata to the object metadata cache */
+            if(!udata->omd_cache_hit) {
+                const uint8_t *field_bufs[4];
+                size_t field_lens[4];
+                unsigned i;
+
+                for(i = 0; i < 4; i++) {
+                    field_bufs[i] = udata->md_rw_cb_ud.sg_iov[i].iov_buf;
+                    field_lens[i] = (size_t)udata->md_rw_cb_ud.iod[i].iod_size;
+                } /* end for */
+                if(0 != (ret = H5_daos_omd_cache_insert(udata->md_rw_cb_ud.obj, 4, field_bufs, field_lens)))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't add dataset metadata to object metadata cache");
+            } /* end if */
         } /* end else */
     } /* end else */
 
@@ -1745,7 +2239,7 @@ H5_daos_dataset_open(void *_item,
 
         /* Traverse the path */
         if(NULL == (target_obj = H5_daos_group_traverse(item, name, H5P_LINK_CREATE_DEFAULT,
-                int_req, collective, &path_buf, &target_name, &target_name_len, &first_task, &dep_task)))
+                int_req, collective, TRUE, &path_buf, &target_name, &target_name_len, &first_task, &dep_task)))
             D_GOTO_ERROR(H5E_DATASET, H5E_BADITER, NULL, "can't traverse path");
 
         /* Check for no target_name, in this case just return target_obj */
@@ -1926,6 +2420,8 @@ H5_daos_dataset_open_helper(H5_daos_file_t *file, hid_t dapl_id, hbool_t collect
     dset->io_cache.mem_sel_iter_id = H5I_INVALID_HID;
     if((dapl_id != H5P_DATASET_ACCESS_DEFAULT) && (dset->dapl_id = H5Pcopy(dapl_id)) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, NULL, "failed to copy dapl");
+    if(H5_daos_get_chunk_cache_nbytes(dset->dapl_id, &dset->chunk_cache.nbytes_max) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, NULL, "can't get chunk cache size");
 
     /* Set up broadcast user data (if appropriate) and calculate initial dataset
      * info buffer size */
@@ -2049,7 +2545,7 @@ H5_daos_dataset_open_helper(H5_daos_file_t *file, hid_t dapl_id, hbool_t collect
 
         /* Create task for dataset metadata read */
         assert(*dep_task);
-        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_md_rw_prep_cb,
+        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_omd_fetch_prep_cb,
                 H5_daos_dinfo_read_comp_cb, fetch_udata, &fetch_task) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't create task to read dataset metadata");
 
@@ -2105,14 +2601,14 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_sel_to_recx_iov
+ * Function:    H5_daos_sel_iter_to_recx_iov
  *
- * Purpose:     Given a dataspace with a selection and the datatype
- *              (element) size, build a list of DAOS records (recxs)
- *              and/or scatter/gather list I/O vectors (sg_iovs). *recxs
- *              and *sg_iovs should, if requested, point to a (probably
- *              statically allocated) single element.  Does not release
- *              buffers on error.
+ * Purpose:     Given a selection iterator (which must have been reset to
+ *              the desired dataspace) and the datatype (element) size,
+ *              build a list of DAOS records (recxs) and/or scatter/gather
+ *              list I/O vectors (sg_iovs). *recxs and *sg_iovs should, if
+ *              requested, point to a (probably statically allocated)
+ *              single element.  Does not release buffers on error.
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -2122,8 +2618,8 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_sel_to_recx_iov(hid_t sel_iter_id, size_t type_size, void *buf,
+herr_t
+H5_daos_sel_iter_to_recx_iov(hid_t sel_iter_id, size_t type_size, void *buf,
     daos_recx_t **recxs, daos_iov_t **sg_iovs, size_t *list_nused)
 {
     size_t nseq;
@@ -2190,127 +2686,3849 @@ H5_daos_sel_to_recx_iov(hid_t sel_iter_id, size_t type_size, void *buf,
 
 done:
     D_FUNC_LEAVE;
-} /* end H5_daos_sel_to_recx_iov() */
+} /* end H5_daos_sel_iter_to_recx_iov() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_scatter_cb
+ * Function:    H5_daos_sel_to_recx_iov_regular
+ *
+ * Purpose:     Same as H5_daos_sel_iter_to_recx_iov(), but computes the
+ *              recxs and/or sg_iovs directly from the selection in
+ *              space_id if it is an "all", "none" or regular hyperslab
+ *              selection, without iterating over it.  Adjacent blocks,
+ *              and blocks that span entire faster-changing dimensions,
+ *              are merged into single sequences.  The sequences cover the
+ *              same elements in the same order as those generated by the
+ *              iterator.  The arrays are allocated at exactly the
+ *              required size.  Does not release buffers on error.
+ *
+ * Return:      Success:        TRUE if the lists were generated, FALSE if
+ *                              the selection is not regular and the
+ *                              iterator must be used instead
+ *              Failure:        -1
  *
- * Purpose:     Callback function for H5Dscatter.  Simply passes the
- *              entire buffer described by udata to H5Dscatter.
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5_daos_sel_to_recx_iov_regular(hid_t space_id, size_t type_size, void *buf,
+    daos_recx_t **recxs, daos_iov_t **sg_iovs, size_t *list_nused)
+{
+    H5S_sel_type sel_type;
+    hsize_t dims[H5S_MAX_RANK];
+    hsize_t start[H5S_MAX_RANK];
+    hsize_t stride[H5S_MAX_RANK];
+    hsize_t count[H5S_MAX_RANK];
+    hsize_t block[H5S_MAX_RANK];
+    hsize_t dim_size[H5S_MAX_RANK];
+    hsize_t pos[H5S_MAX_RANK];
+    hsize_t seq_len;
+    hsize_t off;
+    size_t nseq;
+    size_t seq_idx;
+    hsize_t j;
+    int ndims;
+    int seq_dim;
+    int i;
+    htri_t is_regular;
+    htri_t ret_value = TRUE;
+
+    assert(recxs || sg_iovs);
+    assert(!recxs || *recxs);
+    assert(!sg_iovs || *sg_iovs);
+    assert(list_nused);
+
+    /* Initialize list_nused */
+    *list_nused = 0;
+
+    /* Check selection type */
+    if(H5S_SEL_ERROR == (sel_type = H5Sget_select_type(space_id)))
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection type");
+    if(sel_type == H5S_SEL_NONE)
+        D_GOTO_DONE(TRUE);
+    if(sel_type == H5S_SEL_POINTS)
+        D_GOTO_DONE(FALSE);
+
+    /* Get dataspace extent */
+    if((ndims = H5Sget_simple_extent_dims(space_id, dims, NULL)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace dimensions");
+
+    if(sel_type == H5S_SEL_ALL || ndims == 0) {
+        hssize_t npoints;
+
+        /* The whole dataspace is a single sequence */
+        if((npoints = H5Sget_select_npoints(space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of selected points");
+        if(npoints == 0)
+            D_GOTO_DONE(TRUE);
+        if(recxs) {
+            (*recxs)[0].rx_idx = 0;
+            (*recxs)[0].rx_nr = (uint64_t)npoints;
+        } /* end if */
+        if(sg_iovs)
+            daos_iov_set(&(*sg_iovs)[0], buf, (daos_size_t)npoints * (daos_size_t)type_size);
+        *list_nused = 1;
+
+        D_GOTO_DONE(TRUE);
+    } /* end if */
+
+    /* Only regular hyperslabs can be handled without the iterator */
+    assert(sel_type == H5S_SEL_HYPERSLABS);
+    if((is_regular = H5Sis_regular_hyperslab(space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check if hyperslab selection is regular");
+    if(!is_regular)
+        D_GOTO_DONE(FALSE);
+    if(H5Sget_regular_hyperslab(space_id, start, stride, count, block) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get regular hyperslab selection");
+
+    /* The selection bounds include any offset set on the dataspace, which
+     * H5Sget_regular_hyperslab() does not, so fall back to the iterator if
+     * they do not match */
+    if(H5Sget_select_bounds(space_id, pos, dim_size) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds");
+    for(i = 0; i < ndims; i++)
+        if(pos[i] != start[i])
+            D_GOTO_DONE(FALSE);
+
+    /* Compute number of elements spanned by a single index in each dimension,
+     * and merge adjacent blocks */
+    dim_size[ndims - 1] = 1;
+    for(i = ndims - 1; i >= 0; i--) {
+        if(i < ndims - 1)
+            dim_size[i] = dim_size[i + 1] * dims[i + 1];
+        if(count[i] == 0 || block[i] == 0)
+            D_GOTO_DONE(TRUE);
+        if(count[i] > 1 && stride[i] == block[i]) {
+            block[i] *= count[i];
+            count[i] = 1;
+        } /* end if */
+    } /* end for */
+
+    /* Find the slowest-changing dimension contained in each sequence.  Each
+     * block in this dimension is a sequence, since all faster-changing
+     * dimensions are selected in their entirety.  seq_len is in elements. */
+    seq_dim = ndims - 1;
+    seq_len = block[seq_dim];
+    while(seq_dim > 0 && count[seq_dim] == 1 && block[seq_dim] == dims[seq_dim]) {
+        seq_dim--;
+        seq_len *= block[seq_dim];
+    } /* end while */
+
+    /* Count sequences */
+    nseq = (size_t)count[seq_dim];
+    for(i = 0; i < seq_dim; i++)
+        nseq *= (size_t)(count[i] * block[i]);
+    assert(nseq > 0);
+
+    /* Allocate exactly sized lists if necessary */
+    if(nseq > 1) {
+        if(recxs)
+            if(NULL == (*recxs = (daos_recx_t *)DV_malloc(nseq * sizeof(daos_recx_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for records");
+        if(sg_iovs)
+            if(NULL == (*sg_iovs = (daos_iov_t *)DV_malloc(nseq * sizeof(daos_iov_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for sgl iovs");
+    } /* end if */
+
+    /* Generate sequences, iterating over the position in the selected area of
+     * each dimension slower than seq_dim, and over the blocks in seq_dim */
+    memset(pos, 0, sizeof(pos));
+    seq_idx = 0;
+    do {
+        /* Compute offset of the start of this row of sequences */
+        off = start[seq_dim] * dim_size[seq_dim];
+        for(i = 0; i < seq_dim; i++)
+            off += (start[i] + ((pos[i] / block[i]) * stride[i]) + (pos[i] % block[i])) * dim_size[i];
+
+        /* Add sequences for each block in seq_dim */
+        for(j = 0; j < count[seq_dim]; j++) {
+            assert(seq_idx < nseq);
+            if(recxs) {
+                (*recxs)[seq_idx].rx_idx = (uint64_t)off;
+                (*recxs)[seq_idx].rx_nr = (uint64_t)seq_len;
+            } /* end if */
+            if(sg_iovs)
+                daos_iov_set(&(*sg_iovs)[seq_idx], (uint8_t *)buf + (off * type_size),
+                        (daos_size_t)seq_len * (daos_size_t)type_size);
+            seq_idx++;
+            off += stride[seq_dim] * dim_size[seq_dim];
+        } /* end for */
+
+        /* Advance position in slower dimensions */
+        for(i = seq_dim - 1; i >= 0; i--) {
+            if(++pos[i] < count[i] * block[i])
+                break;
+            pos[i] = 0;
+        } /* end for */
+    } while(i >= 0);
+    assert(seq_idx == nseq);
+
+    *list_nused = nseq;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_sel_to_recx_iov_regular() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_sel_to_recx_iov
  *
- * Return:      SUCCEED (never fails)
+ * Purpose:     Given a dataspace with a selection and the datatype
+ *              (element) size, build a list of DAOS records (recxs)
+ *              and/or scatter/gather list I/O vectors (sg_iovs). *recxs
+ *              and *sg_iovs should, if requested, point to a (probably
+ *              statically allocated) single element.  Regular selections
+ *              are converted directly, other selections are iterated over
+ *              using sel_iter_id.  Does not release buffers on error.
  *
- * Programmer:  Neil Fortner
- *              March, 2017
+ * Return:      Success:        0
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_scatter_cb(const void **src_buf, size_t *src_buf_bytes_used,
-    void *_udata)
+H5_daos_sel_to_recx_iov(hid_t space_id, hid_t sel_iter_id, size_t type_size,
+    void *buf, daos_recx_t **recxs, daos_iov_t **sg_iovs, size_t *list_nused)
 {
-    H5_daos_scatter_cb_ud_t *udata = (H5_daos_scatter_cb_ud_t *)_udata;
+    htri_t is_regular;
     herr_t ret_value = SUCCEED;
 
-    /* Set src_buf and src_buf_bytes_used to use the entire buffer */
-    *src_buf = udata->buf;
-    *src_buf_bytes_used = udata->len;
+    /* Try to generate the lists directly */
+    if((is_regular = H5_daos_sel_to_recx_iov_regular(space_id, type_size, buf,
+            recxs, sg_iovs, list_nused)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't generate sequence lists for regular selection");
 
-    /* DSINC - This function used to always return SUCCEED without needing an
-     * herr_t. Might need an additional FUNC_LEAVE macro to do this, or modify
-     * the current one to take in the ret_value.
-     */
+    if(!is_regular) {
+        /* Reset selection iterator for dataspace */
+        if(H5Ssel_iter_reset(sel_iter_id, space_id) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset dataspace selection iterator");
+
+        /* Iterate over selection */
+        if(H5_daos_sel_iter_to_recx_iov(sel_iter_id, type_size, buf, recxs,
+                sg_iovs, list_nused) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't generate sequence lists from selection iterator");
+    } /* end if */
+
+done:
     D_FUNC_LEAVE;
-} /* end H5_daos_scatter_cb() */
+} /* end H5_daos_sel_to_recx_iov() */
 
 
+
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_io_prep_cb
+ * Function:    H5_daos_get_regular_sel
  *
- * Purpose:     Prepare callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for raw data I/O.  Currently checks for
- *              errors from previous tasks then sets arguments for daos
- *              task.
+ * Purpose:     Retrieves the selection in space_id as a regular hyperslab,
+ *              if it is an "all" or regular hyperslab selection without
+ *              an offset.  Adjacent blocks are merged, and the stride is
+ *              set to the block size in dimensions with only one block.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Success:        TRUE if the selection is regular, FALSE
+ *                              otherwise
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_chunk_io_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static htri_t
+H5_daos_get_regular_sel(hid_t space_id, int *ndims, hsize_t *dims,
+    hsize_t *start, hsize_t *stride, hsize_t *count, hsize_t *block)
 {
-    H5_daos_chunk_io_ud_t *udata;
-    daos_obj_rw_t *update_args;
-    int ret_value = 0;
-
-    /* Get private data */
-    if(NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
-
-    assert(udata->req);
+    H5S_sel_type sel_type;
+    hsize_t bounds_start[H5S_MAX_RANK];
+    hsize_t bounds_end[H5S_MAX_RANK];
+    htri_t is_regular;
+    int i;
+    htri_t ret_value = TRUE;
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+    assert(ndims);
 
-    assert(udata->dset);
-    assert(udata->req->file);
+    /* Get dataspace extent */
+    if((*ndims = H5Sget_simple_extent_dims(space_id, dims, NULL)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace dimensions");
+    if(*ndims == 0)
+        D_GOTO_DONE(FALSE);
+
+    /* Get selection type */
+    if(H5S_SEL_ERROR == (sel_type = H5Sget_select_type(space_id)))
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection type");
+
+    if(sel_type == H5S_SEL_ALL) {
+        /* The entire extent is a single block */
+        for(i = 0; i < *ndims; i++) {
+            start[i] = 0;
+            count[i] = 1;
+            block[i] = dims[i];
+            stride[i] = dims[i];
+        } /* end for */
 
-    /* Set I/O task arguments */
-    if(NULL == (update_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
-    memset(update_args, 0, sizeof(*update_args));
-    update_args->oh = udata->dset->obj.obj_oh;
-    update_args->th = udata->req->th;
-    update_args->dkey = &udata->dkey;
-    update_args->nr = 1;
-    update_args->iods = &udata->iod;
-    update_args->sgls = &udata->sgl;
+        D_GOTO_DONE(TRUE);
+    } /* end if */
+    if(sel_type != H5S_SEL_HYPERSLABS)
+        D_GOTO_DONE(FALSE);
+
+    /* Get regular hyperslab */
+    if((is_regular = H5Sis_regular_hyperslab(space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check if hyperslab selection is regular");
+    if(!is_regular)
+        D_GOTO_DONE(FALSE);
+    if(H5Sget_regular_hyperslab(space_id, start, stride, count, block) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get regular hyperslab selection");
+
+    /* The selection bounds include any offset set on the dataspace, which
+     * H5Sget_regular_hyperslab() does not */
+    if(H5Sget_select_bounds(space_id, bounds_start, bounds_end) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds");
+
+    for(i = 0; i < *ndims; i++) {
+        if(bounds_start[i] != start[i] || count[i] == 0 || block[i] == 0)
+            D_GOTO_DONE(FALSE);
+
+        /* Merge adjacent blocks */
+        if(count[i] > 1 && stride[i] == block[i]) {
+            block[i] *= count[i];
+            count[i] = 1;
+        } /* end if */
+        if(count[i] == 1)
+            stride[i] = block[i];
+    } /* end for */
 
 done:
-    if(ret_value < 0)
-        tse_task_complete(task, ret_value);
-
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_io_prep_cb() */
+} /* end H5_daos_get_regular_sel() */
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_io_comp_cb
+ * Function:    H5_daos_get_chunk_sel_pattern
  *
- * Purpose:     Complete callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for raw data I/O.  Currently checks for a
- *              failed task then frees private data.
+ * Purpose:     Checks if the file and memory selections can be described
+ *              by a lightweight selection pattern, which is the case if
+ *              both are "all" or regular hyperslab selections with the
+ *              same rank and shape.  If so, fills in *sel_pattern.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Success:        TRUE if *sel_pattern can be used, FALSE
+ *                              otherwise
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_chunk_io_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static htri_t
+H5_daos_get_chunk_sel_pattern(hid_t file_space_id, hid_t mem_space_id,
+    H5_daos_chunk_sel_pattern_t *sel_pattern)
 {
-    H5_daos_chunk_io_ud_t *udata;
-    int ret_value = 0;
+    hsize_t mem_stride[H5S_MAX_RANK];
+    hsize_t mem_count[H5S_MAX_RANK];
+    hsize_t mem_block[H5S_MAX_RANK];
+    int mem_ndims;
+    int i;
+    htri_t ret_value = TRUE;
 
-    assert(H5_daos_task_list_g);
+    assert(sel_pattern);
+
+    /* Get file selection */
+    if((ret_value = H5_daos_get_regular_sel(file_space_id, &sel_pattern->ndims,
+            sel_pattern->file_dims, sel_pattern->file_start, sel_pattern->stride,
+            sel_pattern->count, sel_pattern->block)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get regular file selection");
+    if(!ret_value)
+        D_GOTO_DONE(FALSE);
+
+    /* Check for same file and memory space */
+    if(mem_space_id == file_space_id) {
+        memcpy(sel_pattern->mem_dims, sel_pattern->file_dims, (size_t)sel_pattern->ndims * sizeof(hsize_t));
+        memcpy(sel_pattern->mem_start, sel_pattern->file_start, (size_t)sel_pattern->ndims * sizeof(hsize_t));
+
+        D_GOTO_DONE(TRUE);
+    } /* end if */
+
+    /* Get memory selection */
+    if((ret_value = H5_daos_get_regular_sel(mem_space_id, &mem_ndims,
+            sel_pattern->mem_dims, sel_pattern->mem_start, mem_stride, mem_count,
+            mem_block)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get regular memory selection");
+    if(!ret_value)
+        D_GOTO_DONE(FALSE);
+
+    /* Check that the memory selection is the file selection, translated */
+    if(mem_ndims != sel_pattern->ndims)
+        D_GOTO_DONE(FALSE);
+    for(i = 0; i < mem_ndims; i++)
+        if(mem_count[i] != sel_pattern->count[i] || mem_block[i] != sel_pattern->block[i]
+                || mem_stride[i] != sel_pattern->stride[i])
+            D_GOTO_DONE(FALSE);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_chunk_sel_pattern() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_sel_pattern_clip
+ *
+ * Purpose:     Clips the file selection described by sel_pattern in
+ *              dimension dim to the range [lo, hi].  Returns the indices
+ *              of the first and last blocks that intersect the range in
+ *              *first_block and *last_block.
+ *
+ * Return:      Number of elements selected in the range (0 if none, in
+ *              which case *first_block and *last_block are undefined)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5_daos_chunk_sel_pattern_clip(const H5_daos_chunk_sel_pattern_t *sel_pattern,
+    int dim, hsize_t lo, hsize_t hi, hsize_t *first_block, hsize_t *last_block)
+{
+    hsize_t start = sel_pattern->file_start[dim];
+    hsize_t stride = sel_pattern->stride[dim];
+    hsize_t count = sel_pattern->count[dim];
+    hsize_t block = sel_pattern->block[dim];
+    hsize_t block_start;
+    hsize_t block_end;
+    hsize_t ret_value;
+
+    assert(stride > 0);
+    assert(count > 0);
+    assert(block > 0);
+
+    /* Check for no intersection with the selection bounds */
+    if(hi < start || lo > start + ((count - 1) * stride) + block - 1)
+        return 0;
+
+    /* Find first block ending at or after lo, and last block starting at or
+     * before hi */
+    *first_block = (lo < start + block) ? 0 : ((lo - start - block) / stride) + 1;
+    *last_block = MIN(count - 1, (hi - start) / stride);
+    if(*first_block > *last_block)
+        return 0;
+
+    /* Count elements in the blocks, then subtract the parts outside the
+     * range */
+    ret_value = (*last_block - *first_block + 1) * block;
+    block_start = start + (*first_block * stride);
+    if(lo > block_start)
+        ret_value -= lo - block_start;
+    block_end = start + (*last_block * stride) + block - 1;
+    if(hi < block_end)
+        ret_value -= block_end - hi;
+
+    return ret_value;
+} /* end H5_daos_chunk_sel_pattern_clip() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_sel_to_recx_iov
+ *
+ * Purpose:     Same as H5_daos_sel_to_recx_iov(), but uses the selection
+ *              pattern sel_pattern clipped to the chunk at chunk_coords
+ *              instead of a dataspace.  If mem_space is FALSE, offsets
+ *              are relative to the chunk (with extent chunk_dims),
+ *              otherwise they are relative to the memory dataspace.  The
+ *              arrays are allocated at exactly the required size.  Does
+ *              not release buffers on error.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_sel_to_recx_iov(const H5_daos_chunk_sel_pattern_t *sel_pattern,
+    const hsize_t *chunk_dims, const uint64_t *chunk_coords, hbool_t mem_space,
+    size_t type_size, void *buf, daos_recx_t **recxs, daos_iov_t **sg_iovs,
+    size_t *list_nused)
+{
+    hsize_t lo[H5S_MAX_RANK];
+    hsize_t hi[H5S_MAX_RANK];
+    hsize_t first_block[H5S_MAX_RANK];
+    hsize_t last_block[H5S_MAX_RANK];
+    hsize_t nelem[H5S_MAX_RANK];
+    hsize_t sub[H5S_MAX_RANK];
+    const hsize_t *add;
+    const hsize_t *extent;
+    hsize_t dim_size[H5S_MAX_RANK];
+    hsize_t cur_block[H5S_MAX_RANK];
+    hsize_t cur_coord[H5S_MAX_RANK];
+    hsize_t block_start;
+    hsize_t seq_start;
+    hsize_t seq_end;
+    hsize_t row_off;
+    hsize_t off;
+    hsize_t k;
+    size_t nseq;
+    size_t seq_idx;
+    int ndims;
+    int seq_dim;
+    int i;
+    herr_t ret_value = SUCCEED;
+
+    assert(sel_pattern);
+    assert(chunk_dims);
+    assert(chunk_coords);
+    assert(recxs || sg_iovs);
+    assert(!recxs || *recxs);
+    assert(!sg_iovs || *sg_iovs);
+    assert(list_nused);
+
+    /* Initialize list_nused */
+    *list_nused = 0;
+
+    ndims = sel_pattern->ndims;
+    assert(ndims > 0);
+
+    /* Clip selection to chunk in each dimension.  Coordinates are converted
+     * to the output space by subtracting sub and adding add. */
+    if(mem_space) {
+        memcpy(sub, sel_pattern->file_start, (size_t)ndims * sizeof(hsize_t));
+        add = sel_pattern->mem_start;
+        extent = sel_pattern->mem_dims;
+    } /* end if */
+    else {
+        for(i = 0; i < ndims; i++)
+            sub[i] = (hsize_t)chunk_coords[i];
+        add = NULL;
+        extent = chunk_dims;
+    } /* end else */
+    for(i = 0; i < ndims; i++) {
+        lo[i] = (hsize_t)chunk_coords[i];
+        hi[i] = MIN(lo[i] + chunk_dims[i], sel_pattern->file_dims[i]) - 1;
+        if(0 == (nelem[i] = H5_daos_chunk_sel_pattern_clip(sel_pattern, i,
+                lo[i], hi[i], &first_block[i], &last_block[i])))
+            D_GOTO_DONE(SUCCEED);
+    } /* end for */
+
+    /* Compute number of elements spanned by a single index in each dimension
+     * of the output space */
+    dim_size[ndims - 1] = 1;
+    for(i = ndims - 2; i >= 0; i--)
+        dim_size[i] = dim_size[i + 1] * extent[i + 1];
+
+    /* Find the slowest-changing dimension contained in each sequence.  Each
+     * (clipped) block in this dimension is a sequence, since all
+     * faster-changing dimensions are selected in their entirety. */
+    seq_dim = ndims - 1;
+    while(seq_dim > 0 && first_block[seq_dim] == last_block[seq_dim]
+            && nelem[seq_dim] == extent[seq_dim])
+        seq_dim--;
+
+    /* Count sequences */
+    nseq = (size_t)(last_block[seq_dim] - first_block[seq_dim] + 1);
+    for(i = 0; i < seq_dim; i++)
+        nseq *= (size_t)nelem[i];
+
+    /* Allocate exactly sized lists if necessary */
+    if(nseq > 1) {
+        if(recxs)
+            if(NULL == (*recxs = (daos_recx_t *)DV_malloc(nseq * sizeof(daos_recx_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for records");
+        if(sg_iovs)
+            if(NULL == (*sg_iovs = (daos_iov_t *)DV_malloc(nseq * sizeof(daos_iov_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for sgl iovs");
+    } /* end if */
+
+    /* Initialize position in dimensions slower than seq_dim */
+    for(i = 0; i < seq_dim; i++) {
+        cur_block[i] = first_block[i];
+        cur_coord[i] = MAX(lo[i], sel_pattern->file_start[i] + (first_block[i] * sel_pattern->stride[i]));
+    } /* end for */
+
+    /* Generate sequences */
+    seq_idx = 0;
+    do {
+        /* Compute offset of the start of this row of sequences */
+        row_off = 0;
+        for(i = 0; i < seq_dim; i++)
+            row_off += (cur_coord[i] - sub[i] + (add ? add[i] : 0)) * dim_size[i];
+
+        /* Add sequences for each block in seq_dim */
+        for(k = first_block[seq_dim]; k <= last_block[seq_dim]; k++) {
+            block_start = sel_pattern->file_start[seq_dim] + (k * sel_pattern->stride[seq_dim]);
+            seq_start = MAX(lo[seq_dim], block_start);
+            seq_end = MIN(hi[seq_dim], block_start + sel_pattern->block[seq_dim] - 1);
+            off = row_off + ((seq_start - sub[seq_dim] + (add ? add[seq_dim] : 0)) * dim_size[seq_dim]);
+
+            assert(seq_idx < nseq);
+            if(recxs) {
+                (*recxs)[seq_idx].rx_idx = (uint64_t)off;
+                (*recxs)[seq_idx].rx_nr = (uint64_t)((seq_end - seq_start + 1) * dim_size[seq_dim]);
+            } /* end if */
+            if(sg_iovs)
+                daos_iov_set(&(*sg_iovs)[seq_idx], (uint8_t *)buf + (off * type_size),
+                        (daos_size_t)((seq_end - seq_start + 1) * dim_size[seq_dim]) * (daos_size_t)type_size);
+            seq_idx++;
+        } /* end for */
+
+        /* Advance position in slower dimensions */
+        for(i = seq_dim - 1; i >= 0; i--) {
+            block_start = sel_pattern->file_start[i] + (cur_block[i] * sel_pattern->stride[i]);
+
+            /* Next element in current block */
+            if(cur_coord[i] < MIN(hi[i], block_start + sel_pattern->block[i] - 1)) {
+                cur_coord[i]++;
+                break;
+            } /* end if */
+
+            /* First element in next block */
+            if(cur_block[i] < last_block[i]) {
+                cur_block[i]++;
+                cur_coord[i] = block_start + sel_pattern->stride[i];
+                break;
+            } /* end if */
+
+            /* Wrap around to first block and advance next slower dimension */
+            cur_block[i] = first_block[i];
+            cur_coord[i] = MAX(lo[i], sel_pattern->file_start[i] + (first_block[i] * sel_pattern->stride[i]));
+        } /* end for */
+    } while(i >= 0);
+    assert(seq_idx == nseq);
+
+    *list_nused = nseq;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_sel_to_recx_iov() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_iov_gather
+ *
+ * Purpose:     Gathers the data described by the I/O vectors iovs into
+ *              the contiguous buffer dst_buf.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_iov_gather(const daos_iov_t *iovs, size_t niov, void *dst_buf)
+{
+    uint8_t *p = (uint8_t *)dst_buf;
+    size_t i;
+
+    for(i = 0; i < niov; i++) {
+        (void)memcpy(p, iovs[i].iov_buf, (size_t)iovs[i].iov_len);
+        p += iovs[i].iov_len;
+    } /* end for */
+
+    return;
+} /* end H5_daos_iov_gather() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_iov_scatter
+ *
+ * Purpose:     Scatters the data in the contiguous buffer src_buf to the
+ *              locations described by the I/O vectors iovs.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_iov_scatter(const void *src_buf, const daos_iov_t *iovs, size_t niov)
+{
+    const uint8_t *p = (const uint8_t *)src_buf;
+    size_t i;
+
+    for(i = 0; i < niov; i++) {
+        (void)memcpy(iovs[i].iov_buf, p, (size_t)iovs[i].iov_len);
+        p += iovs[i].iov_len;
+    } /* end for */
+
+    return;
+} /* end H5_daos_iov_scatter() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_batch_create
+ *
+ * Purpose:     Creates a batch of up to nalloc chunk I/O operations.  If
+ *              stream is NULL, the batch takes a single reference to req
+ *              and dset on behalf of all of its chunk tasks, and creates
+ *              and schedules a metatask that end_task depends on.  The
+ *              metatask is completed once the caller has released its
+ *              reference (via H5_daos_chunk_io_batch_release()) and all
+ *              chunk tasks in the batch have completed.  If stream is not
+ *              NULL, the stream holds these references and is notified
+ *              when the batch completes instead.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_io_batch_create(H5_daos_dset_t *dset, size_t nalloc,
+    H5_daos_req_t *req, tse_task_t *end_task, H5_daos_chunk_io_stream_t *stream,
+    H5_daos_chunk_io_batch_t **batch)
+{
+    H5_daos_chunk_io_batch_t *new_batch = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(dset);
+    assert(nalloc > 0);
+    assert(req);
+    assert(end_task || stream);
+    assert(batch);
+
+    /* Allocate batch struct and per-chunk udata array */
+    if(NULL == (new_batch = (H5_daos_chunk_io_batch_t *)DV_calloc(sizeof(H5_daos_chunk_io_batch_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk I/O batch");
+    if(NULL == (new_batch->chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(nalloc * sizeof(H5_daos_chunk_io_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
+    new_batch->nalloc = nalloc;
+    new_batch->req = req;
+    new_batch->dset = dset;
+    new_batch->stream = stream;
+    new_batch->mem_type_id = H5I_INVALID_HID;
+
+    if(!stream) {
+        /* Create metatask for batch.  This empty task will be completed when
+         * the last chunk task in the batch finishes. */
+        if(H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &new_batch->metatask) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create metatask for chunk I/O batch");
+
+        /* Schedule metatask */
+        if(0 != (ret = tse_task_schedule(new_batch->metatask, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule metatask for chunk I/O batch: %s", H5_daos_err_to_string(ret));
+
+        /* Set up dependency on metatask for end task */
+        if(0 != (ret = tse_task_register_deps(end_task, 1, &new_batch->metatask)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk I/O batch: %s", H5_daos_err_to_string(ret));
+
+        /* The batch holds a reference to req and dset for all chunk tasks */
+        req->rc++;
+        dset->obj.item.rc++;
+    } /* end if */
+
+    /* The batch holds the caller's reference until it is released */
+    new_batch->rc = 1;
+    dset->io_stats.nbatches++;
+
+    *batch = new_batch;
+    new_batch = NULL;
+
+done:
+    /* Cleanup on failure */
+    if(new_batch) {
+        assert(ret_value < 0);
+        DV_free(new_batch->chunk_io_ud);
+        new_batch = DV_free(new_batch);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_batch_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_batch_release
+ *
+ * Purpose:     Releases a reference to a chunk I/O batch.  When the last
+ *              reference is released, frees the batch and either notifies
+ *              the batch's stream, or releases the batch's references to
+ *              the request and dataset and completes the batch metatask.
+ *              Errors from individual chunk tasks are recorded in the
+ *              request by the chunk task callbacks.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_batch_release(H5_daos_chunk_io_batch_t *batch)
+{
+    int ret_value = 0;
+
+    assert(batch);
+    assert(batch->rc > 0);
+
+    if(--batch->rc == 0) {
+        if(batch->stream) {
+            H5_daos_chunk_io_stream_t *stream = batch->stream;
+            size_t nchunks = batch->nalloc;
+
+            /* Close shared memory datatype */
+            if(batch->mem_type_id >= 0 && H5Tclose(batch->mem_type_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
+
+            /* Free batch */
+            DV_free(batch->chunk_io_ud);
+            DV_free(batch);
+
+            /* Notify stream, this may issue more batches */
+            if((ret_value = H5_daos_chunk_io_stream_batch_done(stream, nchunks)) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, ret_value, "can't complete chunk I/O batch in stream");
+        } /* end if */
+        else {
+            /* Close shared memory datatype */
+            if(batch->mem_type_id >= 0 && H5Tclose(batch->mem_type_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
+
+            /* Close dataset */
+            if(H5_daos_dataset_close_real(batch->dset) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+            /* Handle errors in this function */
+            /* Do not place any code that can issue errors after this block, except for
+             * H5_daos_req_free_int, which updates req->status if it sees an error */
+            if(ret_value < -H5_DAOS_SHORT_CIRCUIT && batch->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+                batch->req->status = ret_value;
+                batch->req->failed_task = "raw data I/O batch completion";
+            } /* end if */
+
+            /* Release our reference to req */
+            if(H5_daos_req_free_int(batch->req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+            /* Return metatask to task list */
+            if(H5_daos_task_list_put(H5_daos_task_list_g, batch->metatask) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+            /* Complete batch metatask */
+            tse_task_complete(batch->metatask, ret_value);
+
+            /* Free batch */
+            DV_free(batch->chunk_io_ud);
+            DV_free(batch);
+        } /* end else */
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_batch_release() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_ud_alloc
+ *
+ * Purpose:     Allocates the task udata for I/O on a single chunk.  If
+ *              batch is not NULL, the next unused udata struct in the
+ *              batch is returned, otherwise a new one is allocated.
+ *
+ * Return:      Success:        Pointer to zeroed udata struct
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_daos_chunk_io_ud_t *
+H5_daos_chunk_io_ud_alloc(H5_daos_chunk_io_batch_t *batch)
+{
+    H5_daos_chunk_io_ud_t *ret_value = NULL;
+
+    if(batch) {
+        assert(batch->nused < batch->nalloc);
+        ret_value = &batch->chunk_io_ud[batch->nused];
+
+        /* The slot may have been partially set up for a chunk with no
+         * selection, so clear it */
+        memset(ret_value, 0, sizeof(*ret_value));
+        ret_value->batch = batch;
+    } /* end if */
+    else if(NULL == (ret_value = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate buffer for I/O callback arguments");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_ud_alloc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_chunk_io_max_in_flight
+ *
+ * Purpose:     Retrieves the maximum number of chunk I/O operations that
+ *              may be in flight at once for a single dataset I/O call.
+ *              Uses the value set on the DXPL if present, otherwise the
+ *              value from the H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT environment
+ *              variable or the default.  0 means no limit.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_get_chunk_io_max_in_flight(hid_t dxpl_id, size_t *max_in_flight)
+{
+    htri_t prop_exists = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    assert(max_in_flight);
+
+    /* Check if the property is present on the DXPL */
+    if(dxpl_id >= 0 && dxpl_id != H5P_DATASET_XFER_DEFAULT)
+        if((prop_exists = H5Pexist(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME)) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for chunk I/O window property");
+
+    if(prop_exists) {
+        if(H5Pget(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME, max_in_flight) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk I/O window property");
+    } /* end if */
+    else
+        *max_in_flight = H5_daos_chunk_io_max_in_flight_g;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_chunk_io_max_in_flight() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_free_chunk_info
+ *
+ * Purpose:     Closes the dataspaces in, and frees, a selected chunk info
+ *              array of nalloc elements.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_free_chunk_info(H5_daos_select_chunk_info_t *chunk_info, size_t nalloc)
+{
+    size_t i;
+    herr_t ret_value = SUCCEED;
+
+    assert(chunk_info);
+
+    for(i = 0; i < nalloc; i++) {
+        if((chunk_info[i].fspace_id >= 0)
+                && (H5Sclose(chunk_info[i].fspace_id) < 0))
+            D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk file dataspace");
+        if((chunk_info[i].mspace_id >= 0)
+                && (H5Sclose(chunk_info[i].mspace_id) < 0))
+            D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk memory dataspace");
+    } /* end for */
+
+    DV_free(chunk_info);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_free_chunk_info() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_stream_issue
+ *
+ * Purpose:     Issues batches of chunk I/O operations for a stream until
+ *              either all chunks have been issued or the stream's limit
+ *              on in-flight chunks has been reached.  Stops issuing new
+ *              chunks if the request has failed.  The chunk tasks depend
+ *              on *dep_task, and the first is returned in *first_task if
+ *              that is NULL on entry.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_io_stream_issue(H5_daos_chunk_io_stream_t *stream,
+    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_chunk_io_batch_t *batch = NULL;
+    tse_task_t *io_task;
+    size_t batch_nchunks;
+    size_t i;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(stream);
+    assert(!stream->issuing);
+    assert(first_task);
+    assert(dep_task);
+    assert(*dep_task);
+
+    /* Prevent batches that complete while we are issuing from recursively
+     * issuing more */
+    stream->issuing = TRUE;
+
+    while(stream->next_chunk < stream->nchunks_sel
+            && (stream->nin_flight == 0
+            || stream->nin_flight + stream->batch_size <= stream->max_in_flight)
+            && stream->req->status >= -H5_DAOS_INCOMPLETE) {
+        batch_nchunks = MIN(stream->batch_size, stream->nchunks_sel - stream->next_chunk);
+
+        /* Set up the chunk info for this batch */
+        if(stream->use_chunk_iter && H5_daos_chunk_iter_next(&stream->chunk_iter,
+                stream->chunk_info, batch_nchunks) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
+
+        /* Create batch */
+        if(H5_daos_chunk_io_batch_create(stream->dset, batch_nchunks, stream->req,
+                NULL, stream, &batch) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk I/O batch");
+        stream->nin_flight += batch_nchunks;
+
+        /* Perform I/O on each chunk in the batch */
+        for(i = 0; i < batch_nchunks; i++) {
+            io_task = *dep_task;
+            if(stream->single_chunk_io_func(&stream->chunk_info[stream->use_chunk_iter ? i : stream->next_chunk],
+                    stream->use_sel_pattern ? &stream->sel_pattern : NULL, stream->dset, stream->dset_ndims, stream->mem_type_id,
+                    stream->io_type, stream->buf, batch, stream->req, first_task, &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't perform I/O on chunk");
+            stream->next_chunk++;
+        } /* end for */
+
+        /* Release our reference to the batch */
+        ret = H5_daos_chunk_io_batch_release(batch);
+        batch = NULL;
+        if(ret < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release chunk I/O batch: %s", H5_daos_err_to_string(ret));
+    } /* end while */
+
+done:
+    if(ret_value < 0) {
+        /* Do not issue any more chunks */
+        stream->nchunks_sel = stream->next_chunk;
+
+        /* Release partially filled batch */
+        if(batch && H5_daos_chunk_io_batch_release(batch) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release chunk I/O batch");
+    } /* end if */
+
+    stream->issuing = FALSE;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_stream_issue() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_stream_finish
+ *
+ * Purpose:     Finishes a chunk I/O stream once all of its chunks have
+ *              completed, if it is not already finished.  Releases the
+ *              stream's resources and references, and completes the
+ *              stream metatask.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_stream_finish(H5_daos_chunk_io_stream_t *stream)
+{
+    int ret_value = 0;
+
+    assert(stream);
+
+    /* Check if the stream is done */
+    if(stream->issuing || stream->nin_flight > 0
+            || (stream->next_chunk < stream->nchunks_sel
+            && stream->req->status >= -H5_DAOS_INCOMPLETE))
+        D_GOTO_DONE(0);
+
+    /* Free chunk info, the stream took ownership of it from the dataset */
+    if(H5_daos_free_chunk_info(stream->chunk_info, stream->chunk_info_nalloc) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't free selected chunk info");
+
+    /* Release selected chunk iterator */
+    if(stream->use_chunk_iter && H5_daos_chunk_iter_term(&stream->chunk_iter) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't release selected chunk iterator");
+
+    /* Close memory datatype */
+    if(H5Tclose(stream->mem_type_id) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
+
+    /* Close dataset */
+    if(H5_daos_dataset_close_real(stream->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if(ret_value < -H5_DAOS_SHORT_CIRCUIT && stream->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        stream->req->status = ret_value;
+        stream->req->failed_task = "raw data I/O stream completion";
+    } /* end if */
+
+    /* Release our reference to req */
+    if(H5_daos_req_free_int(stream->req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Return metatask to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, stream->metatask) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete stream metatask */
+    tse_task_complete(stream->metatask, ret_value);
+
+    /* Free stream */
+    DV_free(stream);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_stream_finish() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_stream_batch_done
+ *
+ * Purpose:     Called when a batch of nchunks chunk I/O operations in a
+ *              stream completes.  Issues more batches if the stream is
+ *              not currently issuing, then finishes the stream if all of
+ *              its chunks are done.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_stream_batch_done(H5_daos_chunk_io_stream_t *stream,
+    size_t nchunks)
+{
+    tse_task_t *first_task = NULL;
+    tse_task_t *dep_task = NULL;
+    int ret;
+    int ret_value = 0;
+
+    assert(stream);
+    assert(stream->nin_flight >= nchunks);
+
+    stream->nin_flight -= nchunks;
+
+    /* If the stream is currently issuing (from H5_daos_chunk_io_stream_issue()
+     * on this stream) it will pick up the freed space itself */
+    if(stream->issuing)
+        D_GOTO_DONE(0);
+
+    /* Issue more chunks if there are any left */
+    if(stream->next_chunk < stream->nchunks_sel
+            && stream->req->status >= -H5_DAOS_INCOMPLETE) {
+        /* Create empty first task for the new chunk tasks to depend on */
+        if(H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL,
+                NULL, &first_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create first metatask for chunk I/O stream");
+        dep_task = first_task;
+
+        if(H5_daos_chunk_io_stream_issue(stream, &first_task, &dep_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't issue chunk I/O");
+
+        /* Schedule first task */
+        if(0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule first task for chunk I/O stream: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+
+done:
+    /* Handle errors in this function */
+    if(ret_value < -H5_DAOS_SHORT_CIRCUIT && stream->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        stream->req->status = ret_value;
+        stream->req->failed_task = "raw data I/O stream";
+    } /* end if */
+
+    /* Finish the stream if it is done */
+    if((ret = H5_daos_chunk_io_stream_finish(stream)) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, ret, "can't finish chunk I/O stream: %s", H5_daos_err_to_string(ret));
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_stream_batch_done() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_chunks
+ *
+ * Purpose:     Performs I/O on all selected chunks using
+ *              single_chunk_io_func.  If more than one chunk is selected,
+ *              the chunk tasks are grouped into batches of up to
+ *              H5_DAOS_CHUNK_IO_BATCH_SIZE chunks, each of which shares a
+ *              single udata allocation and a single dependency for
+ *              end_task, which must be provided in this case.  DAOS does
+ *              not expose the dkey placement of chunks, so chunks are
+ *              grouped in selection order.
+ *
+ *              If more chunks are selected than the maximum number of
+ *              chunk operations allowed in flight (see
+ *              H5_daos_get_chunk_io_max_in_flight()), the chunks are
+ *              instead streamed: only that many are issued up front, and
+ *              more are issued as earlier batches complete, so memory
+ *              used for chunk I/O does not grow with the selection.
+ *
+ *              If sel_pattern is not NULL, the selection in each chunk is
+ *              computed from it instead of the chunk's dataspaces.
+ *
+ *              If chunk_iter is not NULL, chunk_info holds at least
+ *              H5_DAOS_CHUNK_IO_BATCH_SIZE entries and the chunk info for
+ *              each batch is set up in them from chunk_iter just before
+ *              the batch is issued, so dataspaces are only built for one
+ *              batch of chunks at a time.  Otherwise chunk_info holds all
+ *              nchunks_sel selected chunks.
+ *
+ *              On exit, if only one chunk is selected, *dep_task is set
+ *              to the task for that chunk.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_chunks(H5_daos_select_chunk_info_t *chunk_info,
+    H5_daos_chunk_iter_t *chunk_iter,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, size_t nchunks_sel, H5_daos_chunk_io_func single_chunk_io_func,
+    H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id,
+    H5_daos_io_type_t io_type, void *buf, tse_task_t *end_task,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_chunk_io_batch_t *batch = NULL;
+    H5_daos_chunk_io_stream_t *stream = NULL;
+    tse_task_t *io_task;
+    size_t max_in_flight;
+    size_t i;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(chunk_info);
+    assert(nchunks_sel > 0);
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    dset->io_stats.nchunks += (uint64_t)nchunks_sel;
+
+    /* Just perform I/O directly if there is only one chunk selected */
+    if(nchunks_sel == 1) {
+        dset->io_stats.nbatches++;
+
+        if(chunk_iter && H5_daos_chunk_iter_next(chunk_iter, chunk_info, 1) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
+
+        if(single_chunk_io_func(&chunk_info[0], sel_pattern, dset, dset_ndims, mem_type_id,
+                io_type, buf, NULL, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't perform I/O on chunk");
+
+        /* Set up dependency on chunk I/O task for end task */
+        assert(*dep_task);
+        if(end_task && 0 != (ret = tse_task_register_deps(end_task, 1, dep_task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk I/O task: %s", H5_daos_err_to_string(ret));
+
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    assert(*first_task);
+    assert(*dep_task);
+    assert(end_task);
+
+    /* Get limit on chunk operations in flight */
+    if(H5_daos_get_chunk_io_max_in_flight(req->dxpl_id, &max_in_flight) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get maximum number of chunk I/O operations in flight");
+
+    /* Stream chunks if there are more than we may have in flight */
+    if(max_in_flight > 0 && nchunks_sel > max_in_flight) {
+        /* Only chunked datasets can have more than one chunk, and their
+         * chunk info array is cached in the dataset */
+        assert(dset->dcpl_cache.layout == H5D_CHUNKED);
+        assert(chunk_info == dset->io_cache.chunk_info);
+        assert(!chunk_iter || dset->io_cache.chunk_info_nalloc >= H5_DAOS_CHUNK_IO_BATCH_SIZE);
+
+        /* Allocate stream */
+        if(NULL == (stream = (H5_daos_chunk_io_stream_t *)DV_calloc(sizeof(H5_daos_chunk_io_stream_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk I/O stream");
+        stream->mem_type_id = H5I_INVALID_HID;
+        stream->req = req;
+        stream->dset = dset;
+        stream->nchunks_sel = nchunks_sel;
+        stream->max_in_flight = max_in_flight;
+        stream->batch_size = MIN((size_t)H5_DAOS_CHUNK_IO_BATCH_SIZE, max_in_flight);
+        stream->single_chunk_io_func = single_chunk_io_func;
+        stream->dset_ndims = dset_ndims;
+        stream->io_type = io_type;
+        stream->buf = buf;
+
+        /* Copy selection pattern, since the dataset's copy may be overwritten
+         * by later I/O calls while chunks are still being issued */
+        if(sel_pattern) {
+            stream->sel_pattern = *sel_pattern;
+            stream->use_sel_pattern = TRUE;
+        } /* end if */
+
+        /* Copy selected chunk iterator, including its dataspaces, since
+         * chunk info is set up as batches are issued, which may be after the
+         * application regains control */
+        if(chunk_iter) {
+            if(H5_daos_chunk_iter_copy(&stream->chunk_iter, chunk_iter) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy selected chunk iterator");
+            stream->use_chunk_iter = TRUE;
+        } /* end if */
+
+        /* Copy memory datatype, since chunks may be issued after the
+         * application regains control */
+        if((stream->mem_type_id = H5Tcopy(mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+
+        /* Create metatask for stream.  This empty task will be completed when
+         * the last chunk in the stream finishes. */
+        if(H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &stream->metatask) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create metatask for chunk I/O stream");
+
+        /* Schedule metatask */
+        if(0 != (ret = tse_task_schedule(stream->metatask, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule metatask for chunk I/O stream: %s", H5_daos_err_to_string(ret));
+
+        /* Set up dependency on metatask for end task */
+        if(0 != (ret = tse_task_register_deps(end_task, 1, &stream->metatask)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk I/O stream: %s", H5_daos_err_to_string(ret));
+
+        /* Take ownership of the selected chunk info from the dataset, so that
+         * later I/O calls on the dataset do not overwrite it while chunks are
+         * still being issued */
+        stream->chunk_info = dset->io_cache.chunk_info;
+        stream->chunk_info_nalloc = dset->io_cache.chunk_info_nalloc;
+        dset->io_cache.chunk_info = NULL;
+        dset->io_cache.chunk_info_nalloc = 0;
+
+        /* The stream holds a reference to req and dset for all chunk tasks */
+        req->rc++;
+        dset->obj.item.rc++;
+
+        /* Issue the first chunks */
+        if(H5_daos_chunk_io_stream_issue(stream, first_task, dep_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't issue chunk I/O");
+
+        /* Finish the stream now if there is nothing in flight (only possible
+         * on error), otherwise it will be finished by the last batch */
+        if(H5_daos_chunk_io_stream_finish(stream) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't finish chunk I/O stream");
+        stream = NULL;
+
+        D_GOTO_DONE(ret_value);
+    } /* end if */
+
+    /* Perform I/O on each chunk selected */
+    for(i = 0; i < nchunks_sel; i++) {
+        /* Start a new batch if necessary, setting up its chunk info if it
+         * comes from an iterator */
+        if(!batch) {
+            if(chunk_iter && H5_daos_chunk_iter_next(chunk_iter, chunk_info,
+                    MIN((size_t)H5_DAOS_CHUNK_IO_BATCH_SIZE, nchunks_sel - i)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
+            if(H5_daos_chunk_io_batch_create(dset,
+                    MIN((size_t)H5_DAOS_CHUNK_IO_BATCH_SIZE, nchunks_sel - i), req, end_task, NULL, &batch) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk I/O batch");
+        } /* end if */
+
+        io_task = *dep_task;
+        if(single_chunk_io_func(&chunk_info[chunk_iter ? i % H5_DAOS_CHUNK_IO_BATCH_SIZE : i], sel_pattern, dset, dset_ndims, mem_type_id,
+                io_type, buf, batch, req, first_task, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't perform I/O on chunk");
+
+        /* Release our reference to the batch once it is full.  The batch
+         * will complete when all of its chunk tasks do. */
+        if(((i + 1) % H5_DAOS_CHUNK_IO_BATCH_SIZE == 0) || (i + 1 == nchunks_sel)) {
+            ret = H5_daos_chunk_io_batch_release(batch);
+            batch = NULL;
+            if(ret < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release chunk I/O batch: %s", H5_daos_err_to_string(ret));
+        } /* end if */
+    } /* end for */
+
+done:
+    /* Release partially filled batch on failure */
+    if(batch) {
+        assert(ret_value < 0);
+        if(H5_daos_chunk_io_batch_release(batch) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release chunk I/O batch");
+        batch = NULL;
+    } /* end if */
+
+    /* Clean up stream on failure before any chunks were issued */
+    if(stream) {
+        assert(ret_value < 0);
+        if(stream->use_chunk_iter && H5_daos_chunk_iter_term(&stream->chunk_iter) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release selected chunk iterator");
+        if(stream->mem_type_id >= 0 && H5Tclose(stream->mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        stream = DV_free(stream);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for raw data I/O.  Currently checks for
+ *              errors from previous tasks then sets arguments for daos
+ *              task.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t *update_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    assert(udata->dset);
+    assert(udata->req->file);
+
+    /* Set I/O task arguments */
+    if(NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh = udata->dset->obj.obj_oh;
+    update_args->th = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr = 1;
+    update_args->iods = &udata->iod;
+    update_args->sgls = &udata->sgl;
+
+    /* Request the map of records that exist if we need to fill holes */
+    if(udata->hole.iom.iom_recxs)
+        update_args->ioms = &udata->hole.iom;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for raw data I/O.  Currently checks for a
+ *              failed task, fills holes for hole-aware reads (reissuing
+ *              the fetch if the I/O map was too small) then frees private
+ *              data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    int ret;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->req->file);
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "raw data I/O";
+    } /* end if */
+    else if(task->dt_result == 0 && udata->hole.iom.iom_recxs) {
+        /* Check if the I/O map was too small to hold all the extents found.
+         * If the fetch returned no records there are no extents. */
+        if(udata->iod.iod_size != 0
+                && udata->hole.iom.iom_nr_out > udata->hole.iom.iom_nr) {
+            tse_task_t *fetch_task;
+
+            /* Reallocate I/O map extent buffer */
+            if(udata->hole.iom.iom_recxs != &udata->hole.iom_recx)
+                DV_free(udata->hole.iom.iom_recxs);
+            udata->hole.iom.iom_nr = udata->hole.iom.iom_nr_out;
+            if(NULL == (udata->hole.iom.iom_recxs = (daos_recx_t *)DV_malloc(udata->hole.iom.iom_nr * sizeof(daos_recx_t)))) {
+                udata->hole.iom.iom_recxs = &udata->hole.iom_recx;
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate I/O map extent buffer");
+            } /* end if */
+            udata->hole.iom.iom_nr_out = 0;
+            udata->sgl.sg_nr_out = 0;
+
+            /* Create task for reissued fetch */
+            if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_chunk_io_prep_cb,
+                    H5_daos_chunk_io_comp_cb, udata, &fetch_task) < 0)
+                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to read data");
+
+            /* Schedule reissued fetch task */
+            if(0 != (ret = tse_task_schedule(fetch_task, false)))
+                D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, ret, "can't schedule task to read data: %s", H5_daos_err_to_string(ret));
+
+            /* Relinquish control of udata to the reissued task's completion
+             * callback */
+            udata = NULL;
+        } /* end if */
+        else
+            /* Write the fill value to the records that were not found */
+            H5_daos_chunk_fill_holes(udata);
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if(udata) {
+        /* Close dataset, unless the batch holds the reference */
+        if(!udata->batch && H5_daos_dataset_close_real(udata->dset) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int and H5_daos_chunk_io_batch_release, which update
+         * req->status if they see an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status = ret_value;
+            udata->req->failed_task = "raw data I/O completion callback";
+        } /* end if */
+
+        /* Free private data */
+        if(udata->recxs != &udata->recx)
+            DV_free(udata->recxs);
+        if(udata->sg_iovs != &udata->sg_iov)
+            DV_free(udata->sg_iovs);
+        if(udata->hole.iom.iom_recxs != &udata->hole.iom_recx)
+            DV_free(udata->hole.iom.iom_recxs);
+
+        if(udata->batch) {
+            /* Release our reference to the batch (may free udata) */
+            if(H5_daos_chunk_io_batch_release(udata->batch) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't release chunk I/O batch");
+        } /* end if */
+        else {
+            /* Release our reference to req */
+            if(H5_daos_req_free_int(udata->req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+            /* Complete metatask */
+            if(udata->metatask) {
+                if(H5_daos_task_list_put(H5_daos_task_list_g, udata->metatask) < 0)
+                    D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+                tse_task_complete(udata->metatask, ret_value);
+            } /* end if */
+
+            DV_free(udata);
+        } /* end else */
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_fill_holes
+ *
+ * Purpose:     Writes the fill value to the locations in the memory
+ *              buffer (udata->sg_iovs) that correspond to records in
+ *              udata->recxs that do not exist in the chunk, according to
+ *              the I/O map returned by daos_obj_fetch.  If the fetch
+ *              returned an iod_size of 0 no records exist and the whole
+ *              selection is filled.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_fill_holes(H5_daos_chunk_io_ud_t *udata)
+{
+    daos_recx_t *ext = udata->hole.iom.iom_recxs;
+    size_t next;
+    size_t file_type_size = udata->dset->file_type_size;
+    size_t iov_idx = 0;
+    size_t iov_off = 0;
+    size_t ext_idx = 0;
+    uint64_t prev_end = 0;
+    uint64_t pos;
+    uint64_t end;
+    uint64_t seg_end;
+    size_t nbytes;
+    size_t len;
+    hbool_t fill;
+    size_t i;
+
+    assert(udata->dset->dcpl_cache.fill_method != H5_DAOS_NO_FILL);
+    assert(ext);
+
+    /* Get the extents that exist, sorted by index */
+    next = udata->iod.iod_size == 0 ? 0 : (size_t)udata->hole.iom.iom_nr_out;
+    assert(next <= udata->hole.iom.iom_nr);
+    if(next > 1)
+        qsort(ext, next, sizeof(daos_recx_t), H5_daos_recx_cmp);
+
+    /* Walk the requested recxs and the memory sequences together */
+    for(i = 0; i < (size_t)udata->iod.iod_nr; i++) {
+        pos = udata->recxs[i].rx_idx;
+        end = pos + udata->recxs[i].rx_nr;
+
+        /* Restart the extent search if the recxs are not in increasing
+         * order */
+        if(pos < prev_end)
+            ext_idx = 0;
+        prev_end = end;
+
+        while(pos < end) {
+            /* Skip extents entirely before this position */
+            while(ext_idx < next && ext[ext_idx].rx_idx + ext[ext_idx].rx_nr <= pos)
+                ext_idx++;
+
+            /* Find the end of the current run of existing records or hole */
+            if(ext_idx < next && ext[ext_idx].rx_idx <= pos) {
+                seg_end = MIN(end, ext[ext_idx].rx_idx + ext[ext_idx].rx_nr);
+                fill = FALSE;
+            } /* end if */
+            else {
+                seg_end = ext_idx < next ? MIN(end, ext[ext_idx].rx_idx) : end;
+                fill = TRUE;
+            } /* end else */
+
+            /* Advance through the memory sequences, filling if this is a
+             * hole */
+            nbytes = (size_t)(seg_end - pos) * file_type_size;
+            while(nbytes > 0) {
+                assert(iov_idx < (size_t)udata->sgl.sg_nr);
+                len = MIN(nbytes, (size_t)udata->sg_iovs[iov_idx].iov_len - iov_off);
+                if(fill)
+                    H5_daos_chunk_buf_fill(udata->dset, (uint8_t *)udata->sg_iovs[iov_idx].iov_buf + iov_off, len);
+                nbytes -= len;
+                iov_off += len;
+                if(iov_off == (size_t)udata->sg_iovs[iov_idx].iov_len) {
+                    iov_idx++;
+                    iov_off = 0;
+                } /* end if */
+            } /* end while */
+
+            pos = seg_end;
+        } /* end while */
+    } /* end for */
+
+    return;
+} /* end H5_daos_chunk_fill_holes() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_types_equal
+ *
+ * Purpose:     Internal helper routine to perform I/O on a dataset
+ *              composed of a non-variable-length datatype where the
+ *              datatype specified for the memory buffer matches the
+ *              dataset's datatype. In this case, datatype conversion is
+ *              not necessary.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset I/O not performed.
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset,
+    uint64_t dset_ndims, hid_t H5VL_DAOS_UNUSED mem_type_id,
+    H5_daos_io_type_t io_type, void *buf, H5_daos_chunk_io_batch_t *batch,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
+    daos_opc_t daos_op;
+    size_t tot_nseq;
+    size_t file_type_size;
+    tse_task_t *io_task;
+    uint64_t i;
+    uint8_t *p;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(chunk_info);
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Filtered chunks are stored as single values and cannot be accessed as
+     * arrays */
+    if(dset->dcpl_cache.pipeline)
+        D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "can't perform array I/O on filtered dataset");
+
+    /* Allocate argument struct (or get it from the batch) */
+    if(NULL == (chunk_io_ud = H5_daos_chunk_io_ud_alloc(batch)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
+    chunk_io_ud->recxs = &chunk_io_ud->recx;
+    chunk_io_ud->sg_iovs = &chunk_io_ud->sg_iov;
+
+    /* Point to dset */
+    chunk_io_ud->dset = dset;
+
+    /* Point to req */
+    chunk_io_ud->req = req;
+
+    /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
+     * collisions with other d-keys in this object.
+     */
+    p = chunk_io_ud->dkey_buf;
+    *p++ = (uint8_t)'\0';
+    for(i = 0; i < dset_ndims; i++)
+        UINT64ENCODE(p, chunk_info->chunk_coords[i]);
+
+    /* Set up dkey */
+    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
+            (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
+
+    file_type_size = dset->file_type_size;
+
+    /* Set up iod */
+    memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
+    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
+            (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
+    chunk_io_ud->iod.iod_size = (daos_size_t)file_type_size;
+    chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
+
+    if(sel_pattern) {
+        /* Calculate recxs from file selection pattern, clipped to the chunk */
+        if(H5_daos_chunk_sel_to_recx_iov(sel_pattern, dset->dcpl_cache.chunk_dims, chunk_info->chunk_coords,
+                FALSE, file_type_size, buf, &chunk_io_ud->recxs, NULL, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
+
+        /* Calculate sg_iovs from memory selection pattern */
+        if(H5_daos_chunk_sel_to_recx_iov(sel_pattern, dset->dcpl_cache.chunk_dims, chunk_info->chunk_coords,
+                TRUE, file_type_size, buf, NULL, &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->sgl.sg_nr = (uint32_t)tot_nseq;
+        chunk_io_ud->sgl.sg_nr_out = 0;
+    } /* end if */
+    /* Check if the memory space and file space IDs are the same; use file space in this case */
+    else if(chunk_info->mspace_id == chunk_info->fspace_id) {
+        /* Calculate both recxs and sg_iovs at the same time from file space */
+        if(H5_daos_sel_to_recx_iov(chunk_info->fspace_id, dset->io_cache.file_sel_iter_id, file_type_size, buf,
+                &chunk_io_ud->recxs, &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
+        chunk_io_ud->sgl.sg_nr = (uint32_t)tot_nseq;
+        chunk_io_ud->sgl.sg_nr_out = 0;
+    } /* end if */
+    else {
+        /* Calculate recxs from file space */
+        if(H5_daos_sel_to_recx_iov(chunk_info->fspace_id, dset->io_cache.file_sel_iter_id, file_type_size, buf,
+                &chunk_io_ud->recxs, NULL, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
+
+        /* Calculate sg_iovs from mem space */
+        if(H5_daos_sel_to_recx_iov(chunk_info->mspace_id, dset->io_cache.mem_sel_iter_id, file_type_size, buf,
+                NULL, &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->sgl.sg_nr = (uint32_t)tot_nseq;
+        chunk_io_ud->sgl.sg_nr_out = 0;
+    } /* end else */
+
+    /* Point iod and sgl to lists generated above */
+    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
+    chunk_io_ud->sgl.sg_iovs = chunk_io_ud->sg_iovs;
+
+    /* No selection in the file */
+    if(chunk_io_ud->iod.iod_nr == 0) {
+        *dep_task = NULL;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    if(io_type == IO_READ) {
+        /* Handle fill values.  Rather than writing the fill value to the
+         * whole selection before the fetch (and then overwriting most of it
+         * for densely written chunks), request the map of existing records
+         * from the fetch and only fill the holes once it completes.  Start
+         * with room for one extent per recx, the fetch will be reissued if
+         * more are found. */
+        if(dset->dcpl_cache.fill_method != H5_DAOS_NO_FILL) {
+            chunk_io_ud->hole.iom.iom_type = DAOS_IOD_ARRAY;
+            chunk_io_ud->hole.iom.iom_size = (daos_size_t)file_type_size;
+            chunk_io_ud->hole.iom.iom_flags = DAOS_IOMF_DETAIL;
+            chunk_io_ud->hole.iom.iom_nr = chunk_io_ud->iod.iod_nr;
+            if(chunk_io_ud->iod.iod_nr == 1)
+                chunk_io_ud->hole.iom.iom_recxs = &chunk_io_ud->hole.iom_recx;
+            else if(NULL == (chunk_io_ud->hole.iom.iom_recxs = (daos_recx_t *)DV_malloc(chunk_io_ud->iod.iod_nr * sizeof(daos_recx_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate I/O map extent buffer");
+
+            /* If the fetch is not part of a batch, other tasks may depend on
+             * it directly, so create a metatask to stand in for it in case
+             * it must be reissued */
+            if(!batch) {
+                if(H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &chunk_io_ud->metatask) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create meta task for dataset read");
+                if(0 != (ret = tse_task_schedule(chunk_io_ud->metatask, false))) {
+                    tse_task_complete(chunk_io_ud->metatask, ret);
+                    chunk_io_ud->metatask = NULL;
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule meta task for dataset read: %s", H5_daos_err_to_string(ret));
+                } /* end if */
+            } /* end if */
+        } /* end if */
+
+        /* Create task to read data from dataset */
+        daos_op = DAOS_OPC_OBJ_FETCH;
+    } /* end (io_type == IO_READ) */
+    else /* (io_type == IO_WRITE) */
+        /* Create task to write data to dataset */
+        daos_op = DAOS_OPC_OBJ_UPDATE;
+
+    if(H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            H5_daos_chunk_io_prep_cb, H5_daos_chunk_io_comp_cb, chunk_io_ud, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
+                (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
+
+    /* Schedule IO task (or save it to be scheduled later) */
+    if(*first_task) {
+        assert(*dep_task);
+        if(0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
+    } /* end if */
+    else
+        *first_task = io_task;
+    *dep_task = chunk_io_ud->metatask ? chunk_io_ud->metatask : io_task;
+
+    /* Task will be scheduled, give it a reference to req and the dataset, or
+     * to the batch, which holds those references */
+    if(batch) {
+        batch->nused++;
+        batch->rc++;
+    } /* end if */
+    else {
+        chunk_io_ud->req->rc++;
+        chunk_io_ud->dset->obj.item.rc++;
+    } /* end else */
+
+done:
+    /* Cleanup on failure */
+    if(ret_value < 0 && chunk_io_ud) {
+        if(chunk_io_ud->recxs != &chunk_io_ud->recx)
+            DV_free(chunk_io_ud->recxs);
+        if(chunk_io_ud->sg_iovs != &chunk_io_ud->sg_iov)
+            DV_free(chunk_io_ud->sg_iovs);
+        if(chunk_io_ud->hole.iom.iom_recxs != &chunk_io_ud->hole.iom_recx)
+            DV_free(chunk_io_ud->hole.iom.iom_recxs);
+        if(chunk_io_ud->metatask) {
+            tse_task_complete(chunk_io_ud->metatask, -H5_DAOS_SETUP_ERROR);
+            chunk_io_ud->metatask = NULL;
+        } /* end if */
+        if(!batch)
+            chunk_io_ud = DV_free(chunk_io_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_types_equal() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_tconv_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for raw data I/O with type conversion.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_tconv_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t *update_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->req->file);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    /* If writing, gather the write buffer data to the type conversion buffer */
+    if(udata->tconv.io_type == IO_WRITE) {
+        /* Gather data to conversion buffer */
+        H5_daos_iov_gather(udata->tconv.mem_iovs, udata->tconv.mem_niov, udata->tconv.tconv_buf);
+
+        /* Perform type conversion */
+        if(H5_daos_tconv_convert_to_file(udata->dset->obj.item.file, udata->tconv.mem_type_id, udata->dset->file_type_id,
+                (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+    } /* end if */
+
+    /* Set sg_iov to point to tconv_buf */
+    daos_iov_set(&udata->sg_iov, udata->tconv.tconv_buf,
+            (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+
+    /* Set I/O task arguments */
+    if(NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh = udata->dset->obj.obj_oh;
+    update_args->th = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr = 1;
+    update_args->iods = &udata->iod;
+    update_args->sgls = &udata->sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_tconv_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_tconv_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for raw data I/O with type conversion.  For
+ *              reads, performs type conversion, or hands the converted
+ *              chunk to the file's thread pool if the conversion can be
+ *              done on a worker thread.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_tconv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->req->file);
+    assert(udata->dset);
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "raw data I/O";
+    } /* end if */
+
+    /* If reading we must perform type conversion on the read data */
+    if(udata->tconv.io_type == IO_READ) {
+        if(udata->tconv.kernel.func && udata->dset->obj.item.file->tconv_pool
+                && task->dt_result == 0 && udata->req->status >= -H5_DAOS_INCOMPLETE) {
+            /* Convert and scatter on a worker thread.  The job's completion
+             * callback frees udata. */
+            assert(udata->dset->obj.item.file->tconv_pool);
+            udata->tconv.job.func = H5_daos_chunk_io_tconv_job;
+            udata->tconv.job.comp = H5_daos_chunk_io_tconv_job_comp;
+            udata->tconv.job.arg = udata;
+            if(H5_daos_tpool_submit(udata->dset->obj.item.file->tconv_pool, &udata->tconv.job) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't submit type conversion job");
+            udata = NULL;
+        } /* end if */
+        else {
+            /* Perform type conversion */
+            if(udata->tconv.kernel.func)
+                udata->tconv.kernel.func(&udata->tconv.kernel, udata->tconv.tconv_buf, (size_t)udata->tconv.num_elem);
+            else if(H5_daos_tconv_convert_from_file(udata->dset->obj.item.file, udata->dset->file_type_id, udata->tconv.mem_type_id,
+                    (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+
+            /* Scatter data to memory buffer if necessary */
+            if(udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
+                H5_daos_iov_scatter(udata->tconv.tconv_buf, udata->tconv.mem_iovs, udata->tconv.mem_niov);
+        } /* end else */
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if(udata)
+        ret_value = H5_daos_chunk_io_tconv_free(udata, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_tconv_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_tconv_free
+ *
+ * Purpose:     Releases the resources held by a type converted chunk I/O
+ *              operation, recording ret_value as the request's error if it
+ *              indicates failure.  Frees udata unless it belongs to a
+ *              batch.
+ *
+ * Return:      Success:        ret_value
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_tconv_free(H5_daos_chunk_io_ud_t *udata, int ret_value)
+{
+    assert(udata);
+    assert(udata->req);
+    assert(udata->dset);
+
+    /* Close dataset, unless the batch holds the reference */
+    if(!udata->batch && H5_daos_dataset_close_real(udata->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+    /* Close memory type ID, unless it is shared by the batch */
+    if(!udata->batch && H5Tclose(udata->tconv.mem_type_id) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int and H5_daos_chunk_io_batch_release, which update
+     * req->status if they see an error */
+    if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = ret_value;
+        udata->req->failed_task = "raw data I/O completion callback";
+    } /* end if */
+
+    /* Free private data */
+    if(udata->recxs != &udata->recx)
+        DV_free(udata->recxs);
+    if(udata->tconv.mem_iovs != &udata->tconv.mem_iov)
+        DV_free(udata->tconv.mem_iovs);
+    if(udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
+        H5_daos_bufpool_free(udata->tconv.tconv_buf);
+    if(udata->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
+        H5_daos_bufpool_free(udata->tconv.bkg_buf);
+
+    if(udata->batch) {
+        /* Release our reference to the batch (may free udata) */
+        if(H5_daos_chunk_io_batch_release(udata->batch) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't release chunk I/O batch");
+    } /* end if */
+    else {
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Complete metatask */
+        if(udata->metatask) {
+            if(H5_daos_task_list_put(H5_daos_task_list_g, udata->metatask) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+            tse_task_complete(udata->metatask, ret_value);
+        } /* end if */
+
+        DV_free(udata);
+    } /* end else */
+
+    return ret_value;
+} /* end H5_daos_chunk_io_tconv_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_tconv_job
+ *
+ * Purpose:     Thread pool job that converts a fetched chunk in the type
+ *              conversion buffer and scatters it to the read buffer.  Runs
+ *              on a worker thread, so must not call into HDF5 or DAOS.
+ *
+ * Return:      0
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_tconv_job(void *_udata)
+{
+    H5_daos_chunk_io_ud_t *udata = (H5_daos_chunk_io_ud_t *)_udata;
+
+    assert(udata);
+    assert(udata->tconv.kernel.func);
+
+    /* Perform type conversion */
+    udata->tconv.kernel.func(&udata->tconv.kernel, udata->tconv.tconv_buf, (size_t)udata->tconv.num_elem);
+
+    /* Scatter data to memory buffer if necessary */
+    if(udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
+        H5_daos_iov_scatter(udata->tconv.tconv_buf, udata->tconv.mem_iovs, udata->tconv.mem_niov);
+
+    return 0;
+} /* end H5_daos_chunk_io_tconv_job() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_tconv_job_comp
+ *
+ * Purpose:     Completion callback for H5_daos_chunk_io_tconv_job, run by
+ *              the progress function.  Frees the chunk I/O udata, which
+ *              releases the batch or completes the metatask that later
+ *              tasks depend on.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_tconv_job_comp(void *_udata, int ret)
+{
+    H5_daos_chunk_io_ud_t *udata = (H5_daos_chunk_io_ud_t *)_udata;
+
+    assert(udata);
+
+    return H5_daos_chunk_io_tconv_free(udata, ret);
+} /* end H5_daos_chunk_io_tconv_job_comp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_fill_bkg_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for filling background buffer for type
+ *              conversion.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_fill_bkg_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t *update_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->req->file);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    /* Set sg_iov to point to background buffer */
+    daos_iov_set(&udata->sg_iov, udata->tconv.bkg_buf,
+            (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+
+    /* Set I/O task arguments */
+    if(NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh = udata->dset->obj.obj_oh;
+    update_args->th = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr = 1;
+    update_args->iods = &udata->iod;
+    update_args->sgls = &udata->sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_fill_bkg_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_fill_bkg_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for filling background buffer for type
+ *              conversion.  Does not free data, will be freed by
+ *              H5_daos_chunk_io_tconv_comp_cb().
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_fill_bkg_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata);
+    assert(udata->req);
+    assert(udata->req->file);
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "background buffer fill (daos_obj_fetch) for raw data write";
+    } /* end if */
+
+    /* Reset iod_size, if the dataset was not allocated then it could
+     * have been overwritten by daos_obj_fetch */
+    udata->iod.iod_size = udata->tconv.file_type_size;
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_fill_bkg_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_types_unequal
+ *
+ * Purpose:     Internal helper routine to perform I/O on a dataset
+ *              composed of a non-variable-length datatype where the
+ *              datatype specified for the memory buffer doesn't match the
+ *              dataset's datatype. In this case, datatype conversion must
+ *              be performed.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset I/O not performed.
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset,
+    uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type, void *buf, H5_daos_chunk_io_batch_t *batch, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
+    daos_opc_t daos_op;
+    hbool_t contig = FALSE;
+    size_t tot_nseq;
+    size_t mem_type_size;
+    tse_task_t *io_task = NULL;
+    tse_task_t *fill_bkg_task = NULL;
+    H5T_conv_except_func_t conv_cb = NULL;
+    void *conv_cb_data = NULL;
+    uint64_t i;
+    uint8_t *p;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(chunk_info);
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Filtered chunks are stored as single values and cannot be accessed as
+     * arrays */
+    if(dset->dcpl_cache.pipeline)
+        D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "can't perform array I/O on filtered dataset");
+
+    /* Allocate argument struct (or get it from the batch) */
+    if(NULL == (chunk_io_ud = H5_daos_chunk_io_ud_alloc(batch)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
+
+    /* Setup type conversion-related fields.  Chunks in a batch share a
+     * single copy of the memory datatype. */
+    chunk_io_ud->tconv.num_elem = chunk_info->num_elem_sel_file;
+    chunk_io_ud->tconv.mem_type_id = H5I_INVALID_HID;
+    if(batch) {
+        if(batch->mem_type_id < 0 && (batch->mem_type_id = H5Tcopy(mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+        chunk_io_ud->tconv.mem_type_id = batch->mem_type_id;
+    } /* end if */
+    else if((chunk_io_ud->tconv.mem_type_id = H5Tcopy(mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+    chunk_io_ud->tconv.io_type = io_type;
+    chunk_io_ud->recxs = &chunk_io_ud->recx;
+    chunk_io_ud->tconv.mem_iovs = &chunk_io_ud->tconv.mem_iov;
+    assert(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_NONE);
+
+    /* Build the I/O vectors for the memory selection, used to gather data
+     * to and scatter data from the type conversion buffer */
+    if(0 == (mem_type_size = H5Tget_size(mem_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get memory datatype size");
+    if(sel_pattern) {
+        if(H5_daos_chunk_sel_to_recx_iov(sel_pattern, dset->dcpl_cache.chunk_dims, chunk_info->chunk_coords,
+                TRUE, mem_type_size, buf, NULL, &chunk_io_ud->tconv.mem_iovs, &chunk_io_ud->tconv.mem_niov) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate memory sequence list");
+    } /* end if */
+    else if(H5_daos_sel_to_recx_iov(chunk_info->mspace_id, dset->io_cache.mem_sel_iter_id, mem_type_size, buf,
+            NULL, &chunk_io_ud->tconv.mem_iovs, &chunk_io_ud->tconv.mem_niov) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate memory sequence list");
+
+    /* Point to dset */
+    chunk_io_ud->dset = dset;
+
+    /* Point to req */
+    chunk_io_ud->req = req;
+
+    /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
+     * collisions with other d-keys in this object.
+     */
+    p = chunk_io_ud->dkey_buf;
+    *p++ = (uint8_t)'\0';
+    for(i = 0; i < dset_ndims; i++)
+        UINT64ENCODE(p, chunk_info->chunk_coords[i]);
+
+    /* Set up dkey */
+    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
+            (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
+
+    if(io_type == IO_READ) {
+        /* Check if the memory selection is contiguous */
+        contig = (chunk_io_ud->tconv.mem_niov == 1);
+
+        /* Initialize type conversion */
+        if(H5_daos_tconv_init(
+                dset->file_type_id,
+                &chunk_io_ud->tconv.file_type_size,
+                mem_type_id,
+                &chunk_io_ud->tconv.mem_type_size,
+                (size_t)chunk_info->num_elem_sel_file,
+                dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL,
+                FALSE,
+                &chunk_io_ud->tconv.tconv_buf,
+                &chunk_io_ud->tconv.bkg_buf,
+                contig ? &chunk_io_ud->tconv.reuse : NULL,
+                &chunk_io_ud->tconv.fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+
+        /* Reuse buffer as appropriate */
+        if(contig) {
+            if(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_TCONV)
+                chunk_io_ud->tconv.tconv_buf = chunk_io_ud->tconv.mem_iovs[0].iov_buf;
+            else if(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_BKG)
+                chunk_io_ud->tconv.bkg_buf = chunk_io_ud->tconv.mem_iovs[0].iov_buf;
+        } /* end if */
+
+        /* Check if the conversion can be done by a conversion kernel, which
+         * cannot call a conversion exception callback or use a background
+         * buffer filled from the file */
+        if(H5Pget_type_conv_cb(req->dxpl_id, &conv_cb, &conv_cb_data) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get conversion exception callback");
+        if(!conv_cb && !chunk_io_ud->tconv.fill_bkg && H5_daos_tconv_get_kernel(dset->file_type_id, mem_type_id, &chunk_io_ud->tconv.kernel) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't look up type conversion kernel");
+
+        /* If there is a kernel it can be run by the file's thread pool.
+         * Create the thread pool on first use. */
+        if(chunk_io_ud->tconv.kernel.func && dset->obj.item.file->fapl_cache.tconv_nthreads > 0
+                && !dset->obj.item.file->tconv_pool && H5_daos_tpool_create(dset->obj.item.file->fapl_cache.tconv_nthreads,
+                &dset->obj.item.file->tconv_pool) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create type conversion thread pool");
+    } /* end (io_type == IO_READ) */
+    else
+        /* Initialize type conversion */
+        if(H5_daos_tconv_init(
+                mem_type_id,
+                &chunk_io_ud->tconv.mem_type_size,
+                dset->file_type_id,
+                &chunk_io_ud->tconv.file_type_size,
+                (size_t)chunk_info->num_elem_sel_file,
+                FALSE,
+                TRUE,
+                &chunk_io_ud->tconv.tconv_buf,
+                &chunk_io_ud->tconv.bkg_buf,
+                NULL,
+                &chunk_io_ud->tconv.fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+
+    /* Set up iod */
+    memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
+    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
+            (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
+    chunk_io_ud->iod.iod_size = (daos_size_t)chunk_io_ud->tconv.file_type_size;
+    chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
+
+    /* Build recxs and sg_iovs */
+
+    /* Calculate recxs from file space */
+    if(sel_pattern) {
+        if(H5_daos_chunk_sel_to_recx_iov(sel_pattern, dset->dcpl_cache.chunk_dims, chunk_info->chunk_coords,
+                FALSE, chunk_io_ud->tconv.file_type_size, buf, &chunk_io_ud->recxs, NULL, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+    } /* end if */
+    else if(H5_daos_sel_to_recx_iov(chunk_info->fspace_id, dset->io_cache.file_sel_iter_id, chunk_io_ud->tconv.file_type_size, buf,
+            &chunk_io_ud->recxs, NULL, &tot_nseq) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+    chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
+    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
+
+    /* No selection in the file */
+    if(chunk_io_ud->iod.iod_nr == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Set up constant sgl info */
+    chunk_io_ud->sgl.sg_nr = 1;
+    chunk_io_ud->sgl.sg_nr_out = 0;
+    chunk_io_ud->sgl.sg_iovs = &chunk_io_ud->sg_iov;
+
+    if(io_type == IO_READ) {
+        /* Gather data to background buffer if necessary */
+        if(chunk_io_ud->tconv.fill_bkg && (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG))
+            H5_daos_iov_gather(chunk_io_ud->tconv.mem_iovs, chunk_io_ud->tconv.mem_niov,
+                    chunk_io_ud->tconv.bkg_buf);
+
+        /* Handle fill values */
+        if(dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL) {
+            /* H5_daos_tconv_init() will have cleared the tconv buf, but not if
+             * we're reusing buf as tconv_buf */
+            if(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_TCONV)
+                (void)memset(chunk_io_ud->tconv.tconv_buf, 0,
+                        (daos_size_t)chunk_info->num_elem_sel_file * (daos_size_t)chunk_io_ud->tconv.file_type_size);
+        } /* end if */
+        else if(dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+            hssize_t j;
+
+            assert(dset->fill_val);
+
+            /* Copy the fill value to every element in tconv_buf */
+            for(j = 0; j < chunk_info->num_elem_sel_file; j++)
+                (void)memcpy((uint8_t *)chunk_io_ud->tconv.tconv_buf + ((size_t)j * chunk_io_ud->tconv.file_type_size),
+                        dset->fill_val, chunk_io_ud->tconv.file_type_size);
+        } /* end if */
+
+        /* If the conversion will be done by a worker thread and the fetch is
+         * not part of a batch, other tasks may depend on the fetch directly,
+         * so create a metatask to stand in for it until the conversion
+         * finishes */
+        if(chunk_io_ud->tconv.kernel.func && dset->obj.item.file->tconv_pool && !batch) {
+            if(H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &chunk_io_ud->metatask) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create meta task for dataset read");
+            if(0 != (ret = tse_task_schedule(chunk_io_ud->metatask, false))) {
+                tse_task_complete(chunk_io_ud->metatask, ret);
+                chunk_io_ud->metatask = NULL;
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule meta task for dataset read: %s", H5_daos_err_to_string(ret));
+            } /* end if */
+        } /* end if */
+
+        /* Create task to read data from dataset */
+        daos_op = DAOS_OPC_OBJ_FETCH;
+    } /* end (io_type == IO_READ) */
+    else {
+        /* Check if we need to fill background buffer */
+        if(chunk_io_ud->tconv.fill_bkg) {
+            assert(chunk_io_ud->tconv.bkg_buf);
+
+            /* Create task to read data from dataset */
+            if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                    H5_daos_chunk_fill_bkg_prep_cb, H5_daos_chunk_fill_bkg_comp_cb, chunk_io_ud, &fill_bkg_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read data to background buffer");
+
+            /* Save bkg fill task to be scheduled later */
+            if(*first_task) {
+                if(0 != (ret = tse_task_schedule(fill_bkg_task, false)))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule background buffer fill task");
+            } /* end if */
+            else
+                *first_task = fill_bkg_task;
+            *dep_task = fill_bkg_task;
+        } /* end if */
+
+        /* Create task to write data to dataset */
+        daos_op = DAOS_OPC_OBJ_UPDATE;
+    } /* end (io_type == IO_WRITE) */
+
+    if(H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            H5_daos_chunk_io_tconv_prep_cb, H5_daos_chunk_io_tconv_comp_cb, chunk_io_ud, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
+                (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
+
+    /* Schedule IO task (or save it to be scheduled later) */
+    if(*first_task) {
+        assert(*dep_task);
+        if(0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
+    } /* end if */
+    else
+        *first_task = io_task;
+    *dep_task = chunk_io_ud->metatask ? chunk_io_ud->metatask : io_task;
+
+    /* Task will be scheduled, give it a reference to req and the dataset, or
+     * to the batch, which holds those references */
+    if(batch) {
+        batch->nused++;
+        batch->rc++;
+    } /* end if */
+    else {
+        chunk_io_ud->req->rc++;
+        chunk_io_ud->dset->obj.item.rc++;
+    } /* end else */
+
+done:
+    /* Cleanup on failure */
+    if(ret_value < 0 && chunk_io_ud && !fill_bkg_task) {
+        if(!batch && chunk_io_ud->tconv.mem_type_id >= 0 && H5Tclose(chunk_io_ud->tconv.mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        if(chunk_io_ud->recxs != &chunk_io_ud->recx)
+            DV_free(chunk_io_ud->recxs);
+        if(chunk_io_ud->tconv.mem_iovs && chunk_io_ud->tconv.mem_iovs != &chunk_io_ud->tconv.mem_iov)
+            DV_free(chunk_io_ud->tconv.mem_iovs);
+        if(chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
+            chunk_io_ud->tconv.tconv_buf = H5_daos_bufpool_free(chunk_io_ud->tconv.tconv_buf);
+        if(chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
+            chunk_io_ud->tconv.bkg_buf = H5_daos_bufpool_free(chunk_io_ud->tconv.bkg_buf);
+        if(chunk_io_ud->metatask) {
+            tse_task_complete(chunk_io_ud->metatask, -H5_DAOS_SETUP_ERROR);
+            chunk_io_ud->metatask = NULL;
+        } /* end if */
+        if(!batch)
+            chunk_io_ud = DV_free(chunk_io_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_types_unequal() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_seq_copy
+ *
+ * Purpose:     Copies data between the sequences of elements described
+ *              by recxs in the chunk buffer chunk_buf and the locations
+ *              described by the I/O vectors iovs.  If to_chunk is TRUE
+ *              the data is copied to the chunk buffer, otherwise it is
+ *              copied from it.  The total size of the sequences and I/O
+ *              vectors must be the same.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_seq_copy(void *chunk_buf, const daos_recx_t *recxs,
+    size_t nrecx, size_t elem_size, const daos_iov_t *iovs, size_t niov,
+    hbool_t to_chunk)
+{
+    size_t recx_idx = 0;
+    size_t recx_off = 0;
+    size_t iov_idx = 0;
+    size_t iov_off = 0;
+
+    while(recx_idx < nrecx && iov_idx < niov) {
+        size_t recx_len = (size_t)recxs[recx_idx].rx_nr * elem_size;
+        size_t iov_len = (size_t)iovs[iov_idx].iov_len;
+        size_t copy_len = MIN(recx_len - recx_off, iov_len - iov_off);
+        uint8_t *chunk_p = (uint8_t *)chunk_buf
+                + ((size_t)recxs[recx_idx].rx_idx * elem_size) + recx_off;
+        uint8_t *iov_p = (uint8_t *)iovs[iov_idx].iov_buf + iov_off;
+
+        if(to_chunk)
+            (void)memcpy(chunk_p, iov_p, copy_len);
+        else
+            (void)memcpy(iov_p, chunk_p, copy_len);
+
+        /* Advance to the next sequence and/or I/O vector */
+        if((recx_off += copy_len) == recx_len) {
+            recx_idx++;
+            recx_off = 0;
+        } /* end if */
+        if((iov_off += copy_len) == iov_len) {
+            iov_idx++;
+            iov_off = 0;
+        } /* end if */
+    } /* end while */
+
+    return;
+} /* end H5_daos_chunk_seq_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_buf_fill
+ *
+ * Purpose:     Initializes a buffer of nbytes bytes holding a whole chunk
+ *              that has not been written, according to the dataset's
+ *              fill method.  With H5_DAOS_NO_FILL the buffer is cleared.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_buf_fill(H5_daos_dset_t *dset, void *buf, size_t nbytes)
+{
+    size_t file_type_size = dset->file_type_size;
+    size_t i;
+
+    if(dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+        assert(dset->fill_val);
+
+        for(i = 0; i < nbytes; i += file_type_size)
+            (void)memcpy((uint8_t *)buf + i, dset->fill_val, file_type_size);
+    } /* end if */
+    else
+        (void)memset(buf, 0, nbytes);
+
+    return;
+} /* end H5_daos_chunk_buf_fill() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filtered_chunk_decode
+ *
+ * Purpose:     Decodes the filtered chunk record of rec_size bytes
+ *              fetched into the header and chunk buffers, and reverses
+ *              the filter pipeline, leaving the unfiltered chunk in the
+ *              chunk buffer.  If rec_size is 0 the chunk has not been
+ *              written and *exists is set to FALSE.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_filtered_chunk_decode(H5_daos_chunk_io_ud_t *udata,
+    daos_size_t rec_size, hbool_t *exists)
+{
+    uint8_t *p;
+    uint32_t filter_mask;
+    uint64_t chunk_nbytes;
+    size_t nbytes;
+    int ret_value = 0;
+
+    assert(udata);
+    assert(exists);
+
+    /* Check for unwritten chunk */
+    if(rec_size == 0) {
+        *exists = FALSE;
+        D_GOTO_DONE(0);
+    } /* end if */
+    *exists = TRUE;
+
+    /* Decode header */
+    if(rec_size < H5_DAOS_FILTERED_CHUNK_HDR_SIZE)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "filtered chunk record is too small");
+    p = udata->filter.hdr_buf;
+    if(*p++ != H5_DAOS_FILTERED_CHUNK_VERSION)
+        D_GOTO_ERROR(H5E_DATASET, H5E_VERSION, -H5_DAOS_BAD_VALUE, "unknown filtered chunk version");
+    UINT32DECODE(p, filter_mask);
+    UINT64DECODE(p, chunk_nbytes);
+    if(chunk_nbytes != (uint64_t)udata->filter.chunk_nbytes)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "size of filtered chunk does not match chunk dimensions");
+
+    /* Reverse filter pipeline */
+    nbytes = (size_t)rec_size - H5_DAOS_FILTERED_CHUNK_HDR_SIZE;
+    if(H5_daos_filter_pipeline_apply(udata->dset->dcpl_cache.pipeline, TRUE, &filter_mask,
+            &nbytes, &udata->filter.buf_size, &udata->filter.buf) < 0)
+        D_GOTO_ERROR(H5E_PLINE, H5E_READERROR, -H5_DAOS_H5_DECODE_ERROR, "filter pipeline failed on chunk");
+    if(nbytes != udata->filter.chunk_nbytes)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "size of unfiltered chunk does not match chunk dimensions");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_filtered_chunk_decode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_filtered_fetch_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch of a
+ *              filtered chunk record, for a read or for the read part of
+ *              a read-modify-write.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_filtered_fetch_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t *fetch_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->req->file);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    /* Fetch up to the largest possible record into the header and chunk
+     * buffers */
+    udata->iod.iod_size = (daos_size_t)(H5_DAOS_FILTERED_CHUNK_HDR_SIZE + udata->filter.buf_size);
+    daos_iov_set(&udata->filter.sg_iovs[0], udata->filter.hdr_buf,
+            (daos_size_t)H5_DAOS_FILTERED_CHUNK_HDR_SIZE);
+    daos_iov_set(&udata->filter.sg_iovs[1], udata->filter.buf,
+            (daos_size_t)udata->filter.buf_size);
+
+    /* Set I/O task arguments */
+    if(NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh = udata->dset->obj.obj_oh;
+    fetch_args->th = udata->req->th;
+    fetch_args->dkey = &udata->dkey;
+    fetch_args->nr = 1;
+    fetch_args->iods = &udata->iod;
+    fetch_args->sgls = &udata->sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_filtered_fetch_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_filtered_fetch_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch for the
+ *              read part of a read-modify-write of a filtered chunk.
+ *              Saves the size of the fetched record.  Does not free data,
+ *              will be freed by H5_daos_chunk_io_filtered_comp_cb().
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_filtered_fetch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->req->file);
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "filtered chunk fetch (daos_obj_fetch) for raw data write";
+    } /* end if */
+
+    /* Save size of fetched record (0 if the chunk has not been written) */
+    udata->filter.fetch_size = udata->iod.iod_size;
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_filtered_fetch_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_filtered_update_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update of a
+ *              filtered chunk record.  Merges the write buffer data into
+ *              the unfiltered chunk (after unfiltering the existing chunk
+ *              for a read-modify-write), runs the chunk through the
+ *              filter pipeline, and encodes the record header.  If the
+ *              filters expand the chunk by more than
+ *              H5_DAOS_FILTERED_CHUNK_SLACK bytes, the chunk is stored
+ *              unfiltered with all filters masked.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_filtered_update_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t *update_args;
+    daos_iov_t tconv_iov;
+    void *filt_buf = NULL;
+    size_t filt_buf_size;
+    size_t nbytes;
+    uint32_t filter_mask = 0;
+    hbool_t exists;
+    uint8_t *p;
+    int ret;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->req->file);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    /* Unfilter the existing chunk, or fill it if it has not been written */
+    if(udata->filter.rmw) {
+        if((ret = H5_daos_filtered_chunk_decode(udata, udata->filter.fetch_size, &exists)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, ret, "can't decode filtered chunk");
+        if(!exists)
+            H5_daos_chunk_buf_fill(udata->dset, udata->filter.buf, udata->filter.chunk_nbytes);
+    } /* end if */
+
+    /* Merge write buffer data into chunk */
+    if(udata->filter.need_tconv) {
+        /* Gather data to conversion buffer */
+        H5_daos_iov_gather(udata->tconv.mem_iovs, udata->tconv.mem_niov, udata->tconv.tconv_buf);
+
+        /* Fill background buffer from chunk if necessary */
+        daos_iov_set(&tconv_iov, udata->tconv.bkg_buf,
+                (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+        if(udata->tconv.fill_bkg)
+            H5_daos_chunk_seq_copy(udata->filter.buf, udata->recxs, udata->filter.nrecx,
+                    udata->tconv.file_type_size, &tconv_iov, 1, FALSE);
+
+        /* Perform type conversion */
+        if(H5_daos_tconv_convert_to_file(udata->dset->obj.item.file, udata->tconv.mem_type_id, udata->dset->file_type_id,
+                (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+
+        /* Copy converted data to chunk */
+        daos_iov_set(&tconv_iov, udata->tconv.tconv_buf,
+                (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+        H5_daos_chunk_seq_copy(udata->filter.buf, udata->recxs, udata->filter.nrecx,
+                udata->tconv.file_type_size, &tconv_iov, 1, TRUE);
+    } /* end if */
+    else
+        H5_daos_chunk_seq_copy(udata->filter.buf, udata->recxs, udata->filter.nrecx,
+                udata->dset->file_type_size, udata->tconv.mem_iovs, udata->tconv.mem_niov, TRUE);
+
+    /* Run a copy of the chunk through the filter pipeline, so the unfiltered
+     * chunk can be stored if the filters expand it too much */
+    filt_buf_size = udata->filter.buf_size;
+    if(NULL == (filt_buf = H5allocate_memory(filt_buf_size, FALSE)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for filtered chunk");
+    (void)memcpy(filt_buf, udata->filter.buf, udata->filter.chunk_nbytes);
+    nbytes = udata->filter.chunk_nbytes;
+    if(H5_daos_filter_pipeline_apply(udata->dset->dcpl_cache.pipeline, FALSE, &filter_mask,
+            &nbytes, &filt_buf_size, &filt_buf) < 0)
+        D_GOTO_ERROR(H5E_PLINE, H5E_WRITEERROR, -H5_DAOS_H5_ENCODE_ERROR, "filter pipeline failed on chunk");
+    if(nbytes > udata->filter.chunk_nbytes + H5_DAOS_FILTERED_CHUNK_SLACK) {
+        /* Store unfiltered chunk */
+        filter_mask = UINT32_MAX;
+        nbytes = udata->filter.chunk_nbytes;
+    } /* end if */
+    else {
+        /* Replace chunk buffer with filtered chunk */
+        H5free_memory(udata->filter.buf);
+        udata->filter.buf = filt_buf;
+        udata->filter.buf_size = filt_buf_size;
+        filt_buf = NULL;
+    } /* end else */
+
+    /* Encode header */
+    p = udata->filter.hdr_buf;
+    *p++ = (uint8_t)H5_DAOS_FILTERED_CHUNK_VERSION;
+    UINT32ENCODE(p, filter_mask);
+    UINT64ENCODE(p, (uint64_t)udata->filter.chunk_nbytes);
+
+    /* Set up iod and sgl for record */
+    udata->iod.iod_size = (daos_size_t)(H5_DAOS_FILTERED_CHUNK_HDR_SIZE + nbytes);
+    daos_iov_set(&udata->filter.sg_iovs[0], udata->filter.hdr_buf,
+            (daos_size_t)H5_DAOS_FILTERED_CHUNK_HDR_SIZE);
+    daos_iov_set(&udata->filter.sg_iovs[1], udata->filter.buf, (daos_size_t)nbytes);
+
+    /* Set I/O task arguments */
+    if(NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh = udata->dset->obj.obj_oh;
+    update_args->th = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr = 1;
+    update_args->iods = &udata->iod;
+    update_args->sgls = &udata->sgl;
+
+done:
+    if(filt_buf)
+        H5free_memory(filt_buf);
+
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_filtered_update_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_filtered_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch or
+ *              daos_obj_update of a filtered chunk record.  If reading,
+ *              unfilters the chunk and copies the selected elements to
+ *              the read buffer, with type conversion if necessary.  Then
+ *              frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_filtered_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    daos_iov_t tconv_iov;
+    hbool_t exists;
+    int ret;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->req->file);
+    assert(udata->dset);
+
+    /* Handle errors in I/O task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "raw data I/O on filtered chunk";
+    } /* end if */
+
+    /* If reading, unfilter the chunk and copy out the selected elements */
+    if(udata->tconv.io_type == IO_READ && task->dt_result == 0) {
+        if((ret = H5_daos_filtered_chunk_decode(udata, udata->iod.iod_size, &exists)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, ret, "can't decode filtered chunk");
+
+        /* Handle unwritten chunk.  With no fill the read buffer is left
+         * untouched. */
+        if(!exists) {
+            if(udata->dset->dcpl_cache.fill_method == H5_DAOS_NO_FILL)
+                D_GOTO_DONE(0);
+            H5_daos_chunk_buf_fill(udata->dset, udata->filter.buf, udata->filter.chunk_nbytes);
+        } /* end if */
+
+        if(udata->filter.need_tconv) {
+            /* Gather selected elements to conversion buffer */
+            daos_iov_set(&tconv_iov, udata->tconv.tconv_buf,
+                    (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+            H5_daos_chunk_seq_copy(udata->filter.buf, udata->recxs, udata->filter.nrecx,
+                    udata->tconv.file_type_size, &tconv_iov, 1, FALSE);
+
+            /* Gather data to background buffer if necessary */
+            if(udata->tconv.fill_bkg)
+                H5_daos_iov_gather(udata->tconv.mem_iovs, udata->tconv.mem_niov, udata->tconv.bkg_buf);
+
+            /* Perform type conversion */
+            if(H5_daos_tconv_convert_from_file(udata->dset->obj.item.file, udata->dset->file_type_id, udata->tconv.mem_type_id,
+                    (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+
+            /* Scatter data to memory buffer */
+            H5_daos_iov_scatter(udata->tconv.tconv_buf, udata->tconv.mem_iovs, udata->tconv.mem_niov);
+        } /* end if */
+        else
+            H5_daos_chunk_seq_copy(udata->filter.buf, udata->recxs, udata->filter.nrecx,
+                    udata->dset->file_type_size, udata->tconv.mem_iovs, udata->tconv.mem_niov, FALSE);
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if(udata) {
+        /* Close dataset, unless the batch holds the reference */
+        if(!udata->batch && H5_daos_dataset_close_real(udata->dset) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+        /* Close memory type ID, unless it is shared by the batch */
+        if(!udata->batch && udata->tconv.mem_type_id >= 0 && H5Tclose(udata->tconv.mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int and H5_daos_chunk_io_batch_release, which update
+         * req->status if they see an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status = ret_value;
+            udata->req->failed_task = "raw data I/O on filtered chunk completion callback";
+        } /* end if */
+
+        /* Free private data */
+        if(udata->recxs != &udata->recx)
+            DV_free(udata->recxs);
+        if(udata->tconv.mem_iovs != &udata->tconv.mem_iov)
+            DV_free(udata->tconv.mem_iovs);
+        H5_daos_bufpool_free(udata->tconv.tconv_buf);
+        H5_daos_bufpool_free(udata->tconv.bkg_buf);
+        if(udata->filter.buf)
+            H5free_memory(udata->filter.buf);
+
+        if(udata->batch) {
+            /* Release our reference to the batch (may free udata) */
+            if(H5_daos_chunk_io_batch_release(udata->batch) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't release chunk I/O batch");
+        } /* end if */
+        else {
+            /* Release our reference to req */
+            if(H5_daos_req_free_int(udata->req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+            DV_free(udata);
+        } /* end else */
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_filtered_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_filtered
+ *
+ * Purpose:     Internal helper routine to perform I/O on a single chunk
+ *              of a dataset with a filter pipeline.  Filtered chunks are
+ *              stored as a single value holding a header and the whole
+ *              filtered chunk.  Reads fetch the record and unfilter it in
+ *              the completion callback.  Writes that do not cover the
+ *              whole chunk fetch the existing record first and merge the
+ *              new data into it (read-modify-write).  Type conversion is
+ *              performed if the memory datatype does not match the
+ *              dataset's datatype.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset I/O not performed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_filtered(H5_daos_select_chunk_info_t *chunk_info,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset,
+    uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+    void *buf, H5_daos_chunk_io_batch_t *batch, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
+    htri_t need_tconv;
+    hsize_t chunk_nelem = 1;
+    size_t file_type_size;
+    size_t mem_type_size;
+    tse_task_t *fetch_task = NULL;
+    tse_task_t *io_task = NULL;
+    uint64_t i;
+    uint8_t *p;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(chunk_info);
+    assert(dset);
+    assert(dset->dcpl_cache.pipeline);
+    assert(dset->dcpl_cache.layout == H5D_CHUNKED);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct (or get it from the batch) */
+    if(NULL == (chunk_io_ud = H5_daos_chunk_io_ud_alloc(batch)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
+    chunk_io_ud->recxs = &chunk_io_ud->recx;
+    chunk_io_ud->tconv.mem_iovs = &chunk_io_ud->tconv.mem_iov;
+    chunk_io_ud->tconv.mem_type_id = H5I_INVALID_HID;
+    chunk_io_ud->tconv.num_elem = chunk_info->num_elem_sel_file;
+    chunk_io_ud->tconv.io_type = io_type;
+
+    /* Point to dset */
+    chunk_io_ud->dset = dset;
+
+    /* Point to req */
+    chunk_io_ud->req = req;
+
+    /* Calculate size of unfiltered chunk */
+    file_type_size = dset->file_type_size;
+    for(i = 0; i < dset_ndims; i++)
+        chunk_nelem *= dset->dcpl_cache.chunk_dims[i];
+    chunk_io_ud->filter.chunk_nbytes = (size_t)chunk_nelem * file_type_size;
+
+    /* Calculate sequences of selected elements in the chunk */
+    if(sel_pattern) {
+        if(H5_daos_chunk_sel_to_recx_iov(sel_pattern, dset->dcpl_cache.chunk_dims, chunk_info->chunk_coords,
+                FALSE, file_type_size, buf, &chunk_io_ud->recxs, NULL, &chunk_io_ud->filter.nrecx) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+    } /* end if */
+    else if(H5_daos_sel_to_recx_iov(chunk_info->fspace_id, dset->io_cache.file_sel_iter_id, file_type_size, buf,
+            &chunk_io_ud->recxs, NULL, &chunk_io_ud->filter.nrecx) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+
+    /* No selection in the file */
+    if(chunk_io_ud->filter.nrecx == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Build the I/O vectors for the memory selection */
+    if(0 == (mem_type_size = H5Tget_size(mem_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get memory datatype size");
+    if(sel_pattern) {
+        if(H5_daos_chunk_sel_to_recx_iov(sel_pattern, dset->dcpl_cache.chunk_dims, chunk_info->chunk_coords,
+                TRUE, mem_type_size, buf, NULL, &chunk_io_ud->tconv.mem_iovs, &chunk_io_ud->tconv.mem_niov) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate memory sequence list");
+    } /* end if */
+    else if(H5_daos_sel_to_recx_iov(chunk_info->mspace_id, dset->io_cache.mem_sel_iter_id, mem_type_size, buf,
+            NULL, &chunk_io_ud->tconv.mem_iovs, &chunk_io_ud->tconv.mem_niov) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate memory sequence list");
+
+    /* Set up type conversion if necessary.  Chunks in a batch share a single
+     * copy of the memory datatype. */
+    if((need_tconv = H5_daos_need_tconv(dset->file_type_id, mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+    chunk_io_ud->filter.need_tconv = (hbool_t)need_tconv;
+    if(need_tconv) {
+        if(batch) {
+            if(batch->mem_type_id < 0 && (batch->mem_type_id = H5Tcopy(mem_type_id)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+            chunk_io_ud->tconv.mem_type_id = batch->mem_type_id;
+        } /* end if */
+        else if((chunk_io_ud->tconv.mem_type_id = H5Tcopy(mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+
+        if(io_type == IO_READ) {
+            if(H5_daos_tconv_init(dset->file_type_id, &chunk_io_ud->tconv.file_type_size,
+                    mem_type_id, &chunk_io_ud->tconv.mem_type_size,
+                    (size_t)chunk_info->num_elem_sel_file, FALSE, FALSE,
+                    &chunk_io_ud->tconv.tconv_buf, &chunk_io_ud->tconv.bkg_buf,
+                    NULL, &chunk_io_ud->tconv.fill_bkg) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+        } /* end if */
+        else
+            if(H5_daos_tconv_init(mem_type_id, &chunk_io_ud->tconv.mem_type_size,
+                    dset->file_type_id, &chunk_io_ud->tconv.file_type_size,
+                    (size_t)chunk_info->num_elem_sel_file, FALSE, TRUE,
+                    &chunk_io_ud->tconv.tconv_buf, &chunk_io_ud->tconv.bkg_buf,
+                    NULL, &chunk_io_ud->tconv.fill_bkg) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+    } /* end if */
+
+    /* Allocate chunk buffer.  This is allocated with the library's allocator
+     * since filters may reallocate it. */
+    chunk_io_ud->filter.buf_size = chunk_io_ud->filter.chunk_nbytes + H5_DAOS_FILTERED_CHUNK_SLACK;
+    if(NULL == (chunk_io_ud->filter.buf = H5allocate_memory(chunk_io_ud->filter.buf_size, FALSE)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk buffer");
+
+    /* Writes that do not cover the whole chunk must merge with the existing
+     * chunk.  So must writes with a conversion that needs a background
+     * buffer, since it is filled from the existing chunk. */
+    chunk_io_ud->filter.rmw = (io_type == IO_WRITE)
+            && (((hsize_t)chunk_info->num_elem_sel_file < chunk_nelem)
+            || (need_tconv && chunk_io_ud->tconv.fill_bkg));
+
+    /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
+     * collisions with other d-keys in this object.
+     */
+    p = chunk_io_ud->dkey_buf;
+    *p++ = (uint8_t)'\0';
+    for(i = 0; i < dset_ndims; i++)
+        UINT64ENCODE(p, chunk_info->chunk_coords[i]);
+
+    /* Set up dkey */
+    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
+            (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
+
+    /* Set up iod.  The record size is set in the prep callbacks. */
+    memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
+    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
+            (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
+    chunk_io_ud->iod.iod_type = DAOS_IOD_SINGLE;
+    chunk_io_ud->iod.iod_nr = 1;
+
+    /* Set up sgl, header and chunk data */
+    chunk_io_ud->sgl.sg_nr = 2;
+    chunk_io_ud->sgl.sg_nr_out = 0;
+    chunk_io_ud->sgl.sg_iovs = chunk_io_ud->filter.sg_iovs;
+
+    if(io_type == IO_READ) {
+        /* Create task to read chunk */
+        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                H5_daos_chunk_io_filtered_fetch_prep_cb, H5_daos_chunk_io_filtered_comp_cb, chunk_io_ud, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read data");
+    } /* end if */
+    else {
+        /* Read existing chunk if necessary */
+        if(chunk_io_ud->filter.rmw) {
+            if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                    H5_daos_chunk_io_filtered_fetch_prep_cb, H5_daos_chunk_io_filtered_fetch_comp_cb,
+                    chunk_io_ud, &fetch_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read existing chunk");
+
+            /* Schedule fetch task (or save it to be scheduled later) */
+            if(*first_task) {
+                if(0 != (ret = tse_task_schedule(fetch_task, false)))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule existing chunk read task");
+            } /* end if */
+            else
+                *first_task = fetch_task;
+            *dep_task = fetch_task;
+        } /* end if */
+
+        /* Create task to write chunk */
+        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                H5_daos_chunk_io_filtered_update_prep_cb, H5_daos_chunk_io_filtered_comp_cb, chunk_io_ud, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to write data");
+    } /* end else */
+
+    /* Schedule IO task (or save it to be scheduled later) */
+    if(*first_task) {
+        assert(*dep_task);
+        if(0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
+    } /* end if */
+    else
+        *first_task = io_task;
+    *dep_task = io_task;
+
+    /* Task will be scheduled, give it a reference to req and the dataset, or
+     * to the batch, which holds those references */
+    if(batch) {
+        batch->nused++;
+        batch->rc++;
+    } /* end if */
+    else {
+        chunk_io_ud->req->rc++;
+        chunk_io_ud->dset->obj.item.rc++;
+    } /* end else */
+
+done:
+    /* Cleanup if no task was created for this chunk */
+    if(chunk_io_ud && !io_task && !fetch_task) {
+        if(!batch && chunk_io_ud->tconv.mem_type_id >= 0 && H5Tclose(chunk_io_ud->tconv.mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        if(chunk_io_ud->recxs != &chunk_io_ud->recx)
+            DV_free(chunk_io_ud->recxs);
+        if(chunk_io_ud->tconv.mem_iovs && chunk_io_ud->tconv.mem_iovs != &chunk_io_ud->tconv.mem_iov)
+            DV_free(chunk_io_ud->tconv.mem_iovs);
+        chunk_io_ud->tconv.tconv_buf = H5_daos_bufpool_free(chunk_io_ud->tconv.tconv_buf);
+        chunk_io_ud->tconv.bkg_buf = H5_daos_bufpool_free(chunk_io_ud->tconv.bkg_buf);
+        if(chunk_io_ud->filter.buf)
+            H5free_memory(chunk_io_ud->filter.buf);
+        if(!batch)
+            chunk_io_ud = DV_free(chunk_io_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_filtered() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_hash
+ *
+ * Purpose:     Hash function for the chunk cache hash table.  Hashes the
+ *              encoded chunk coordinates of a cache entry.
+ *
+ * Return:      Hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_chunk_cache_hash(dv_hash_table_key_t key)
+{
+    H5_daos_chunk_cache_ent_t *ent = (H5_daos_chunk_cache_ent_t *)key;
+    uint64_t hash = UINT64_C(14695981039346656037);
+    size_t i;
+
+    assert(ent);
+
+    /* FNV-1a */
+    for(i = 0; i < ent->dkey_len; i++) {
+        hash ^= (uint64_t)ent->dkey_buf[i];
+        hash *= UINT64_C(1099511628211);
+    } /* end for */
+
+    return hash;
+} /* end H5_daos_chunk_cache_hash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_equal
+ *
+ * Purpose:     Comparison function for the chunk cache hash table.
+ *
+ * Return:      Non-zero if the two entries are for the same chunk, zero
+ *              otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2)
+{
+    H5_daos_chunk_cache_ent_t *ent1 = (H5_daos_chunk_cache_ent_t *)key1;
+    H5_daos_chunk_cache_ent_t *ent2 = (H5_daos_chunk_cache_ent_t *)key2;
+
+    assert(ent1);
+    assert(ent2);
+
+    return (ent1->dkey_len == ent2->dkey_len)
+            && !memcmp(ent1->dkey_buf, ent2->dkey_buf, ent1->dkey_len);
+} /* end H5_daos_chunk_cache_equal() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_remove
+ *
+ * Purpose:     Removes an entry from a chunk cache's hash table and LRU
+ *              list.  Does not free the entry.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_cache_remove(H5_daos_chunk_cache_t *cache,
+    H5_daos_chunk_cache_ent_t *ent)
+{
+    assert(cache);
+    assert(ent);
+    assert(cache->nbytes >= cache->chunk_nbytes);
+
+    /* Remove from hash table */
+    (void)dv_hash_table_remove(cache->table, ent);
+
+    /* Remove from LRU list */
+    if(ent->prev)
+        ent->prev->next = ent->next;
+    else {
+        assert(cache->head == ent);
+        cache->head = ent->next;
+    } /* end else */
+    if(ent->next)
+        ent->next->prev = ent->prev;
+    else {
+        assert(cache->tail == ent);
+        cache->tail = ent->prev;
+    } /* end else */
+    ent->prev = NULL;
+    ent->next = NULL;
+
+    cache->nbytes -= cache->chunk_nbytes;
+
+    return;
+} /* end H5_daos_chunk_cache_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_ent_free
+ *
+ * Purpose:     Frees a chunk cache entry that is not in a cache.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_cache_ent_free(H5_daos_chunk_cache_ent_t *ent)
+{
+    assert(ent);
+    assert(!ent->prev && !ent->next);
+
+    DV_free(ent->buf);
+    DV_free(ent->dirty);
+    DV_free(ent);
+
+    return;
+} /* end H5_daos_chunk_cache_ent_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_free
+ *
+ * Purpose:     Frees all entries in a dataset's chunk cache and its hash
+ *              table, and removes the dataset from the file's list of
+ *              datasets with a chunk cache.  Dirty data in the cache is
+ *              discarded, the caller must write it back first if
+ *              necessary.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_free(H5_daos_dset_t *dset)
+{
+    H5_daos_chunk_cache_t *cache;
+    H5_daos_chunk_cache_ent_t *ent;
+    herr_t ret_value = SUCCEED;
+
+    assert(dset);
+
+    cache = &dset->chunk_cache;
+
+    /* Free entries */
+    while(NULL != (ent = cache->head)) {
+        H5_daos_chunk_cache_remove(cache, ent);
+        H5_daos_chunk_cache_ent_free(ent);
+    } /* end while */
+    assert(cache->nbytes == 0);
+
+    /* Free hash table and remove dataset from the file's list of datasets
+     * with a chunk cache */
+    if(cache->table) {
+        dv_hash_table_free(cache->table);
+        cache->table = NULL;
+
+        if(cache->file_prev)
+            cache->file_prev->chunk_cache.file_next = cache->file_next;
+        else {
+            assert(dset->obj.item.file->cached_dsets == dset);
+            dset->obj.item.file->cached_dsets = cache->file_next;
+        } /* end else */
+        if(cache->file_next)
+            cache->file_next->chunk_cache.file_prev = cache->file_prev;
+        cache->file_prev = NULL;
+        cache->file_next = NULL;
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_lookup
+ *
+ * Purpose:     Looks up the entry for the chunk with the encoded dkey
+ *              dkey_buf in a chunk cache, creating an empty, unloaded
+ *              entry if the chunk is not in the cache.  The entry is
+ *              moved to the head of the LRU list.  The cache may grow
+ *              past its size limit here, it is trimmed after each I/O
+ *              operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_lookup(H5_daos_chunk_cache_t *cache,
+    const uint8_t *dkey_buf, size_t dkey_len, H5_daos_chunk_cache_ent_t **ent)
+{
+    H5_daos_chunk_cache_ent_t key_ent;
+    H5_daos_chunk_cache_ent_t *new_ent = NULL;
+    int ret_value = 0;
+
+    assert(cache);
+    assert(cache->table);
+    assert(dkey_buf);
+    assert(dkey_len <= sizeof(key_ent.dkey_buf));
+    assert(ent);
+
+    /* Look up entry */
+    (void)memcpy(key_ent.dkey_buf, dkey_buf, dkey_len);
+    key_ent.dkey_len = dkey_len;
+    if(DV_HASH_TABLE_NULL != (*ent = (H5_daos_chunk_cache_ent_t *)dv_hash_table_lookup(cache->table, &key_ent))) {
+        /* Move entry to head of LRU list */
+        if(*ent != cache->head) {
+            (*ent)->prev->next = (*ent)->next;
+            if((*ent)->next)
+                (*ent)->next->prev = (*ent)->prev;
+            else
+                cache->tail = (*ent)->prev;
+            (*ent)->prev = NULL;
+            (*ent)->next = cache->head;
+            cache->head->prev = *ent;
+            cache->head = *ent;
+        } /* end if */
+
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* Create new entry */
+    if(NULL == (new_ent = (H5_daos_chunk_cache_ent_t *)DV_calloc(sizeof(H5_daos_chunk_cache_ent_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate chunk cache entry");
+    (void)memcpy(new_ent->dkey_buf, dkey_buf, dkey_len);
+    new_ent->dkey_len = dkey_len;
+    if(NULL == (new_ent->buf = (uint8_t *)DV_malloc(cache->chunk_nbytes)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate chunk cache entry buffer");
+
+    /* Add entry to hash table */
+    if(!dv_hash_table_insert(cache->table, new_ent, new_ent))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, -H5_DAOS_ALLOC_ERROR, "can't insert chunk cache entry into hash table");
+
+    /* Add entry to head of LRU list */
+    new_ent->next = cache->head;
+    if(cache->head)
+        cache->head->prev = new_ent;
+    else
+        cache->tail = new_ent;
+    cache->head = new_ent;
+    cache->nbytes += cache->chunk_nbytes;
+
+    *ent = new_ent;
+    new_ent = NULL;
+
+done:
+    /* Cleanup on failure */
+    if(new_ent)
+        H5_daos_chunk_cache_ent_free(new_ent);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_recx_cmp
+ *
+ * Purpose:     qsort() comparison function for daos_recx_t, by starting
+ *              index.
+ *
+ * Return:      Negative if _recx1 starts before _recx2, positive if it
+ *              starts after, 0 otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_recx_cmp(const void *_recx1, const void *_recx2)
+{
+    const daos_recx_t *recx1 = (const daos_recx_t *)_recx1;
+    const daos_recx_t *recx2 = (const daos_recx_t *)_recx2;
+
+    return (recx1->rx_idx > recx2->rx_idx) - (recx1->rx_idx < recx2->rx_idx);
+} /* end H5_daos_recx_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_add_dirty
+ *
+ * Purpose:     Adds the nrecx element ranges in recxs to a chunk cache
+ *              entry's dirty ranges, merging overlapping and adjacent
+ *              ranges so the chunk can be written back with as few
+ *              ranges as possible.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_add_dirty(H5_daos_chunk_cache_ent_t *ent,
+    const daos_recx_t *recxs, size_t nrecx)
+{
+    daos_recx_t *tmp_realloc;
+    uint64_t end;
+    size_t nalloc;
+    size_t i, j;
+    int ret_value = 0;
+
+    assert(ent);
+    assert(recxs);
+    assert(nrecx > 0);
+
+    /* Make room for new ranges */
+    if(ent->ndirty + nrecx > ent->dirty_nalloc) {
+        nalloc = MAX(2 * ent->dirty_nalloc, ent->ndirty + nrecx);
+        if(NULL == (tmp_realloc = (daos_recx_t *)DV_realloc(ent->dirty, nalloc * sizeof(daos_recx_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't reallocate chunk cache dirty range list");
+        ent->dirty = tmp_realloc;
+        ent->dirty_nalloc = nalloc;
+    } /* end if */
+
+    /* Append new ranges and sort */
+    (void)memcpy(&ent->dirty[ent->ndirty], recxs, nrecx * sizeof(daos_recx_t));
+    ent->ndirty += nrecx;
+    qsort(ent->dirty, ent->ndirty, sizeof(daos_recx_t), H5_daos_recx_cmp);
+
+    /* Merge overlapping and adjacent ranges */
+    for(i = 0, j = 1; j < ent->ndirty; j++) {
+        if(ent->dirty[j].rx_idx <= ent->dirty[i].rx_idx + ent->dirty[i].rx_nr) {
+            end = MAX(ent->dirty[i].rx_idx + ent->dirty[i].rx_nr,
+                    ent->dirty[j].rx_idx + ent->dirty[j].rx_nr);
+            ent->dirty[i].rx_nr = end - ent->dirty[i].rx_idx;
+        } /* end if */
+        else
+            ent->dirty[++i] = ent->dirty[j];
+    } /* end for */
+    ent->ndirty = i + 1;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_add_dirty() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_copy
+ *
+ * Purpose:     Performs the I/O for a chunk on the chunk's cache entry,
+ *              copying the selected elements between the entry's buffer
+ *              and the application buffer, with type conversion if
+ *              necessary.  Written elements are added to the entry's
+ *              dirty ranges.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_copy(H5_daos_chunk_io_ud_t *udata)
+{
+    H5_daos_chunk_cache_ent_t *ent;
+    size_t file_type_size;
+    daos_iov_t tconv_iov;
+    int ret;
+    int ret_value = 0;
+
+    assert(udata);
+    assert(udata->cache.ent);
+
+    ent = udata->cache.ent;
+    file_type_size = udata->dset->file_type_size;
+
+    if(udata->tconv.io_type == IO_READ) {
+        assert(ent->loaded);
+
+        if(udata->cache.need_tconv) {
+            /* Gather selected elements to conversion buffer */
+            daos_iov_set(&tconv_iov, udata->tconv.tconv_buf,
+                    (daos_size_t)udata->tconv.num_elem * (daos_size_t)file_type_size);
+            H5_daos_chunk_seq_copy(ent->buf, udata->recxs, udata->cache.nrecx,
+                    file_type_size, &tconv_iov, 1, FALSE);
+
+            /* Gather data to background buffer if necessary */
+            if(udata->tconv.fill_bkg)
+                H5_daos_iov_gather(udata->tconv.mem_iovs, udata->tconv.mem_niov, udata->tconv.bkg_buf);
+
+            /* Perform type conversion */
+            if(H5_daos_tconv_convert_from_file(udata->dset->obj.item.file, udata->dset->file_type_id, udata->tconv.mem_type_id,
+                    (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+
+            /* Scatter data to memory buffer */
+            H5_daos_iov_scatter(udata->tconv.tconv_buf, udata->tconv.mem_iovs, udata->tconv.mem_niov);
+        } /* end if */
+        else
+            H5_daos_chunk_seq_copy(ent->buf, udata->recxs, udata->cache.nrecx,
+                    file_type_size, udata->tconv.mem_iovs, udata->tconv.mem_niov, FALSE);
+    } /* end if */
+    else {
+        if(udata->cache.need_tconv) {
+            /* Gather data to conversion buffer */
+            H5_daos_iov_gather(udata->tconv.mem_iovs, udata->tconv.mem_niov, udata->tconv.tconv_buf);
+
+            /* Fill background buffer from chunk if necessary */
+            daos_iov_set(&tconv_iov, udata->tconv.bkg_buf,
+                    (daos_size_t)udata->tconv.num_elem * (daos_size_t)file_type_size);
+            if(udata->tconv.fill_bkg) {
+                assert(ent->loaded);
+                H5_daos_chunk_seq_copy(ent->buf, udata->recxs, udata->cache.nrecx,
+                        file_type_size, &tconv_iov, 1, FALSE);
+            } /* end if */
+
+            /* Perform type conversion */
+            if(H5_daos_tconv_convert_to_file(udata->dset->obj.item.file, udata->tconv.mem_type_id, udata->dset->file_type_id,
+                    (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+
+            /* Copy converted data to chunk */
+            daos_iov_set(&tconv_iov, udata->tconv.tconv_buf,
+                    (daos_size_t)udata->tconv.num_elem * (daos_size_t)file_type_size);
+            H5_daos_chunk_seq_copy(ent->buf, udata->recxs, udata->cache.nrecx,
+                    file_type_size, &tconv_iov, 1, TRUE);
+        } /* end if */
+        else
+            H5_daos_chunk_seq_copy(ent->buf, udata->recxs, udata->cache.nrecx,
+                    file_type_size, udata->tconv.mem_iovs, udata->tconv.mem_niov, TRUE);
+
+        /* Mark written elements dirty */
+        if((ret = H5_daos_chunk_cache_add_dirty(ent, udata->recxs, udata->cache.nrecx)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't add dirty ranges to chunk cache entry");
+
+        /* If the whole chunk has been written there is no need to read it
+         * from DAOS */
+        if(!ent->loaded && ent->ndirty == 1 && ent->dirty[0].rx_idx == 0
+                && (size_t)ent->dirty[0].rx_nr * file_type_size == udata->dset->chunk_cache.chunk_nbytes)
+            ent->loaded = TRUE;
+    } /* end else */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_prep_cb
+ *
+ * Purpose:     Prepare callback for I/O on a chunk through the chunk
+ *              cache.  Looks up the chunk's cache entry.  If the entry
+ *              holds the data needed, the I/O is performed on the cache
+ *              entry and the daos_obj_fetch task is skipped.  Otherwise
+ *              sets up the task to fetch the whole chunk into a buffer
+ *              initialized with the fill value.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    H5_daos_chunk_cache_t *cache;
+    daos_obj_rw_t *fetch_args;
+    int ret;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->req->file);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    cache = &udata->dset->chunk_cache;
+
+    /* Look up the chunk's cache entry */
+    if((ret = H5_daos_chunk_cache_lookup(cache, udata->dkey_buf, (size_t)udata->dkey.iov_len, &udata->cache.ent)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, ret, "can't look up chunk cache entry");
+
+    /* The chunk must be read from DAOS if it is not loaded and this is a
+     * read, or a write that needs a background buffer.  Otherwise perform
+     * the I/O on the cache entry now and skip the fetch. */
+    if(udata->cache.ent->loaded || (udata->tconv.io_type == IO_WRITE
+            && !(udata->cache.need_tconv && udata->tconv.fill_bkg))) {
+        if((ret = H5_daos_chunk_cache_copy(udata)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't perform I/O on chunk cache entry");
+
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+    } /* end if */
+
+    /* Allocate buffer for the whole chunk and initialize it with the fill
+     * value, since elements that have not been written are not returned */
+    if(NULL == (udata->cache.fetch_buf = DV_malloc(cache->chunk_nbytes)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate chunk buffer");
+    H5_daos_chunk_buf_fill(udata->dset, udata->cache.fetch_buf, cache->chunk_nbytes);
+
+    /* Set up iod and sgl to fetch the whole chunk */
+    udata->cache.fetch_recx.rx_idx = (uint64_t)0;
+    udata->cache.fetch_recx.rx_nr = (uint64_t)(cache->chunk_nbytes / udata->dset->file_type_size);
+    daos_iov_set(&udata->sg_iov, udata->cache.fetch_buf, (daos_size_t)cache->chunk_nbytes);
+
+    /* Set I/O task arguments */
+    if(NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh = udata->dset->obj.obj_oh;
+    fetch_args->th = udata->req->th;
+    fetch_args->dkey = &udata->dkey;
+    fetch_args->nr = 1;
+    fetch_args->iods = &udata->iod;
+    fetch_args->sgls = &udata->sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_comp_cb
+ *
+ * Purpose:     Complete callback for I/O on a chunk through the chunk
+ *              cache.  If the chunk was fetched, merges the data written
+ *              to the cache entry since it was created into the fetched
+ *              chunk, makes that the entry's buffer, and performs the I/O
+ *              on the entry.  Then frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    H5_daos_chunk_cache_ent_t *ent;
+    size_t file_type_size;
+    size_t i;
+    int ret;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
 
     /* Get private data */
     if(NULL == (udata = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
 
     assert(udata->req);
-    assert(udata->dset);
     assert(udata->req->file);
+    assert(udata->dset);
 
-    /* Handle errors in update task.  Only record error in udata->req_status if
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
      * it does not already contain an error (it could contain an error if
      * another task this task is not dependent on also failed). */
     if(task->dt_result < -H5_DAOS_PRE_ERROR
             && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
         udata->req->status = task->dt_result;
-        udata->req->failed_task = "raw data I/O";
+        udata->req->failed_task = "chunk fetch (daos_obj_fetch) for chunk cache";
+    } /* end if */
+    else if(task->dt_result == 0) {
+        assert(udata->cache.fetch_buf);
+        ent = udata->cache.ent;
+        assert(ent);
+        assert(!ent->loaded);
+        file_type_size = udata->dset->file_type_size;
+
+        /* Overlay data written to the entry before it was loaded */
+        for(i = 0; i < ent->ndirty; i++)
+            (void)memcpy((uint8_t *)udata->cache.fetch_buf + ((size_t)ent->dirty[i].rx_idx * file_type_size),
+                    ent->buf + ((size_t)ent->dirty[i].rx_idx * file_type_size),
+                    (size_t)ent->dirty[i].rx_nr * file_type_size);
+
+        /* Load fetched chunk into the entry */
+        DV_free(ent->buf);
+        ent->buf = (uint8_t *)udata->cache.fetch_buf;
+        udata->cache.fetch_buf = NULL;
+        ent->loaded = TRUE;
+
+        /* Perform I/O on entry */
+        if((ret = H5_daos_chunk_cache_copy(udata)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't perform I/O on chunk cache entry");
     } /* end if */
 
 done:
@@ -2319,61 +6537,78 @@ done:
         D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
     if(udata) {
-        /* Close dataset */
-        if(H5_daos_dataset_close_real(udata->dset) < 0)
+        /* Close dataset, unless the batch holds the reference */
+        if(!udata->batch && H5_daos_dataset_close_real(udata->dset) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
 
+        /* Close memory type ID, unless it is shared by the batch */
+        if(!udata->batch && udata->tconv.mem_type_id >= 0 && H5Tclose(udata->tconv.mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
+
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
+         * H5_daos_req_free_int and H5_daos_chunk_io_batch_release, which update
+         * req->status if they see an error */
         if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
             udata->req->status = ret_value;
-            udata->req->failed_task = "raw data I/O completion callback";
+            udata->req->failed_task = "raw data I/O through chunk cache completion callback";
         } /* end if */
 
-        /* Release our reference to req */
-        if(H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
         /* Free private data */
         if(udata->recxs != &udata->recx)
             DV_free(udata->recxs);
-        if(udata->sg_iovs != &udata->sg_iov)
-            DV_free(udata->sg_iovs);
-        DV_free(udata);
+        if(udata->tconv.mem_iovs != &udata->tconv.mem_iov)
+            DV_free(udata->tconv.mem_iovs);
+        H5_daos_bufpool_free(udata->tconv.tconv_buf);
+        H5_daos_bufpool_free(udata->tconv.bkg_buf);
+        DV_free(udata->cache.fetch_buf);
+
+        if(udata->batch) {
+            /* Release our reference to the batch (may free udata) */
+            if(H5_daos_chunk_io_batch_release(udata->batch) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't release chunk I/O batch");
+        } /* end if */
+        else {
+            /* Release our reference to req */
+            if(H5_daos_req_free_int(udata->req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+            DV_free(udata);
+        } /* end else */
     } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_io_comp_cb() */
+} /* end H5_daos_chunk_cache_comp_cb() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_io_types_equal
+ * Function:    H5_daos_dataset_io_cached
  *
- * Purpose:     Internal helper routine to perform I/O on a dataset
- *              composed of a non-variable-length datatype where the
- *              datatype specified for the memory buffer matches the
- *              dataset's datatype. In this case, datatype conversion is
- *              not necessary.
+ * Purpose:     Internal helper routine to perform I/O on a single chunk
+ *              of a dataset through the dataset's chunk cache.  The chunk
+ *              is only read from DAOS if it is not in the cache and the
+ *              data in it is needed, in which case the whole chunk is
+ *              fetched.  Writes only modify the cache entry, which is
+ *              written back when it is evicted or the cache is flushed.
+ *              Type conversion is performed if the memory datatype does
+ *              not match the dataset's datatype.
  *
  * Return:      Success:        0
  *              Failure:        -1, dataset I/O not performed.
  *
- * Programmer:  Neil Fortner
- *              November, 2016
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info,
-    H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t H5VL_DAOS_UNUSED mem_type_id,
-    H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_dataset_io_cached(H5_daos_select_chunk_info_t *chunk_info,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, H5_daos_dset_t *dset,
+    uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+    void *buf, H5_daos_chunk_io_batch_t *batch, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
-    daos_opc_t daos_op;
-    size_t tot_nseq;
+    htri_t need_tconv;
     size_t file_type_size;
-    tse_task_t *io_task;
+    size_t mem_type_size;
+    tse_task_t *io_task = NULL;
     uint64_t i;
     uint8_t *p;
     int ret;
@@ -2381,15 +6616,19 @@ H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info,
 
     assert(chunk_info);
     assert(dset);
+    assert(dset->chunk_cache.nbytes_max > 0);
     assert(req);
     assert(first_task);
     assert(dep_task);
 
-    /* Allocate argument struct */
-    if(NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
+    /* Allocate argument struct (or get it from the batch) */
+    if(NULL == (chunk_io_ud = H5_daos_chunk_io_ud_alloc(batch)))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
     chunk_io_ud->recxs = &chunk_io_ud->recx;
-    chunk_io_ud->sg_iovs = &chunk_io_ud->sg_iov;
+    chunk_io_ud->tconv.mem_iovs = &chunk_io_ud->tconv.mem_iov;
+    chunk_io_ud->tconv.mem_type_id = H5I_INVALID_HID;
+    chunk_io_ud->tconv.num_elem = chunk_info->num_elem_sel_file;
+    chunk_io_ud->tconv.io_type = io_type;
 
     /* Point to dset */
     chunk_io_ud->dset = dset;
@@ -2397,8 +6636,67 @@ H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info,
     /* Point to req */
     chunk_io_ud->req = req;
 
+    /* Calculate sequences of selected elements in the chunk */
+    file_type_size = dset->file_type_size;
+    if(sel_pattern) {
+        if(H5_daos_chunk_sel_to_recx_iov(sel_pattern, dset->dcpl_cache.chunk_dims, chunk_info->chunk_coords,
+                FALSE, file_type_size, buf, &chunk_io_ud->recxs, NULL, &chunk_io_ud->cache.nrecx) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+    } /* end if */
+    else if(H5_daos_sel_to_recx_iov(chunk_info->fspace_id, dset->io_cache.file_sel_iter_id, file_type_size, buf,
+            &chunk_io_ud->recxs, NULL, &chunk_io_ud->cache.nrecx) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+
+    /* No selection in the file */
+    if(chunk_io_ud->cache.nrecx == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Build the I/O vectors for the memory selection */
+    if(0 == (mem_type_size = H5Tget_size(mem_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get memory datatype size");
+    if(sel_pattern) {
+        if(H5_daos_chunk_sel_to_recx_iov(sel_pattern, dset->dcpl_cache.chunk_dims, chunk_info->chunk_coords,
+                TRUE, mem_type_size, buf, NULL, &chunk_io_ud->tconv.mem_iovs, &chunk_io_ud->tconv.mem_niov) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate memory sequence list");
+    } /* end if */
+    else if(H5_daos_sel_to_recx_iov(chunk_info->mspace_id, dset->io_cache.mem_sel_iter_id, mem_type_size, buf,
+            NULL, &chunk_io_ud->tconv.mem_iovs, &chunk_io_ud->tconv.mem_niov) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate memory sequence list");
+
+    /* Set up type conversion if necessary.  Chunks in a batch share a single
+     * copy of the memory datatype. */
+    if((need_tconv = H5_daos_need_tconv(dset->file_type_id, mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+    chunk_io_ud->cache.need_tconv = (hbool_t)need_tconv;
+    if(need_tconv) {
+        if(batch) {
+            if(batch->mem_type_id < 0 && (batch->mem_type_id = H5Tcopy(mem_type_id)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+            chunk_io_ud->tconv.mem_type_id = batch->mem_type_id;
+        } /* end if */
+        else if((chunk_io_ud->tconv.mem_type_id = H5Tcopy(mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+
+        if(io_type == IO_READ) {
+            if(H5_daos_tconv_init(dset->file_type_id, &chunk_io_ud->tconv.file_type_size,
+                    mem_type_id, &chunk_io_ud->tconv.mem_type_size,
+                    (size_t)chunk_info->num_elem_sel_file, FALSE, FALSE,
+                    &chunk_io_ud->tconv.tconv_buf, &chunk_io_ud->tconv.bkg_buf,
+                    NULL, &chunk_io_ud->tconv.fill_bkg) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+        } /* end if */
+        else
+            if(H5_daos_tconv_init(mem_type_id, &chunk_io_ud->tconv.mem_type_size,
+                    dset->file_type_id, &chunk_io_ud->tconv.file_type_size,
+                    (size_t)chunk_info->num_elem_sel_file, FALSE, TRUE,
+                    &chunk_io_ud->tconv.tconv_buf, &chunk_io_ud->tconv.bkg_buf,
+                    NULL, &chunk_io_ud->tconv.fill_bkg) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+    } /* end if */
+
     /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
-     * collisions with other d-keys in this object.
+     * collisions with other d-keys in this object.  The dkey is also the
+     * chunk's key in the cache.
      */
     p = chunk_io_ud->dkey_buf;
     *p++ = (uint8_t)'\0';
@@ -2409,102 +6707,30 @@ H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info,
     daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
             (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
 
-    file_type_size = dset->file_type_size;
-
-    /* Set up iod */
+    /* Set up iod to fetch the whole chunk.  The record extent is set in the
+     * prep callback. */
     memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
     chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
     daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
             (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
-    chunk_io_ud->iod.iod_size = (daos_size_t)file_type_size;
     chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
+    chunk_io_ud->iod.iod_size = (daos_size_t)file_type_size;
+    chunk_io_ud->iod.iod_nr = 1;
+    chunk_io_ud->iod.iod_recxs = &chunk_io_ud->cache.fetch_recx;
 
-    /* Check if the memory space and file space IDs are the same; use file space in this case */
-    if(chunk_info->mspace_id == chunk_info->fspace_id) {
-        /* Reset file selection iterator for current file dataspace */
-        if(H5Ssel_iter_reset(dset->io_cache.file_sel_iter_id, chunk_info->fspace_id) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
-
-        /* Calculate both recxs and sg_iovs at the same time from file space */
-        if(H5_daos_sel_to_recx_iov(dset->io_cache.file_sel_iter_id, file_type_size, buf,
-                &chunk_io_ud->recxs, &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
-        chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
-        chunk_io_ud->sgl.sg_nr = (uint32_t)tot_nseq;
-        chunk_io_ud->sgl.sg_nr_out = 0;
-    } /* end if */
-    else {
-        /* Reset file selection iterator for current file dataspace */
-        if(H5Ssel_iter_reset(dset->io_cache.file_sel_iter_id, chunk_info->fspace_id) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
-        /* Reset memory selection iterator for current memory dataspace */
-        if(H5Ssel_iter_reset(dset->io_cache.mem_sel_iter_id, chunk_info->mspace_id) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset memory dataspace selection iterator");
-
-        /* Calculate recxs from file space */
-        if(H5_daos_sel_to_recx_iov(dset->io_cache.file_sel_iter_id, file_type_size, buf,
-                &chunk_io_ud->recxs, NULL, &tot_nseq) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
-        chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
-
-        /* Calculate sg_iovs from mem space */
-        if(H5_daos_sel_to_recx_iov(dset->io_cache.mem_sel_iter_id, file_type_size, buf,
-                NULL, &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
-        chunk_io_ud->sgl.sg_nr = (uint32_t)tot_nseq;
-        chunk_io_ud->sgl.sg_nr_out = 0;
-    } /* end else */
-
-    /* Point iod and sgl to lists generated above */
-    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
-    chunk_io_ud->sgl.sg_iovs = chunk_io_ud->sg_iovs;
-
-    /* No selection in the file */
-    if(chunk_io_ud->iod.iod_nr == 0) {
-        *dep_task = NULL;
-        D_GOTO_DONE(SUCCEED);
-    } /* end if */
-
-    if(io_type == IO_READ) {
-        /* Handle fill values */
-        size_t j;
-
-        if(dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL) {
-            /* Just set all locations pointed to by sg_iovs to zero */
-            for(j = 0; j < tot_nseq; j++)
-                (void)memset(chunk_io_ud->sg_iovs[j].iov_buf, 0, chunk_io_ud->sg_iovs[j].iov_len);
-        } /* end if */
-        else if(dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
-            /* Copy fill value to all locations pointed to by sg_iovs */
-            size_t iov_buf_written;
-
-            assert(dset->fill_val);
-
-            for(j = 0; j < tot_nseq; j++) {
-                for(iov_buf_written = 0;
-                        iov_buf_written < chunk_io_ud->sg_iovs[j].iov_len;
-                        iov_buf_written += file_type_size)
-                    (void)memcpy((uint8_t *)chunk_io_ud->sg_iovs[j].iov_buf + iov_buf_written,
-                            dset->fill_val, file_type_size);
-                assert(iov_buf_written == chunk_io_ud->sg_iovs[j].iov_len);
-            } /* end for */
-        } /* end if */
-
-        /* Create task to read data from dataset */
-        daos_op = DAOS_OPC_OBJ_FETCH;
-    } /* end (io_type == IO_READ) */
-    else /* (io_type == IO_WRITE) */
-        /* Create task to write data to dataset */
-        daos_op = DAOS_OPC_OBJ_UPDATE;
+    /* Set up sgl.  The buffer is set in the prep callback. */
+    chunk_io_ud->sgl.sg_nr = 1;
+    chunk_io_ud->sgl.sg_nr_out = 0;
+    chunk_io_ud->sgl.sg_iovs = &chunk_io_ud->sg_iov;
 
-    if(H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-            H5_daos_chunk_io_prep_cb, H5_daos_chunk_io_comp_cb, chunk_io_ud, &io_task) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
-                (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
+    /* Create task to perform I/O on the cache entry, fetching the chunk
+     * first if necessary */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            H5_daos_chunk_cache_prep_cb, H5_daos_chunk_cache_comp_cb, chunk_io_ud, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for chunk I/O through cache");
 
     /* Schedule IO task (or save it to be scheduled later) */
     if(*first_task) {
-        assert(*dep_task);
         if(0 != (ret = tse_task_schedule(io_task, false)))
             D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
     } /* end if */
@@ -2512,95 +6738,203 @@ H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info,
         *first_task = io_task;
     *dep_task = io_task;
 
-    /* Task will be scheduled, give it a reference to req */
-    chunk_io_ud->req->rc++;
-    chunk_io_ud->dset->obj.item.rc++;
+    /* Task will be scheduled, give it a reference to req and the dataset, or
+     * to the batch, which holds those references */
+    if(batch) {
+        batch->nused++;
+        batch->rc++;
+    } /* end if */
+    else {
+        chunk_io_ud->req->rc++;
+        chunk_io_ud->dset->obj.item.rc++;
+    } /* end else */
 
 done:
-    /* Cleanup on failure */
-    if(ret_value < 0 && chunk_io_ud) {
+    /* Cleanup if no task was created for this chunk */
+    if(chunk_io_ud && !io_task) {
+        if(!batch && chunk_io_ud->tconv.mem_type_id >= 0 && H5Tclose(chunk_io_ud->tconv.mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
         if(chunk_io_ud->recxs != &chunk_io_ud->recx)
             DV_free(chunk_io_ud->recxs);
-        if(chunk_io_ud->sg_iovs != &chunk_io_ud->sg_iov)
-            DV_free(chunk_io_ud->sg_iovs);
-        chunk_io_ud = DV_free(chunk_io_ud);
+        if(chunk_io_ud->tconv.mem_iovs && chunk_io_ud->tconv.mem_iovs != &chunk_io_ud->tconv.mem_iov)
+            DV_free(chunk_io_ud->tconv.mem_iovs);
+        chunk_io_ud->tconv.tconv_buf = H5_daos_bufpool_free(chunk_io_ud->tconv.tconv_buf);
+        chunk_io_ud->tconv.bkg_buf = H5_daos_bufpool_free(chunk_io_ud->tconv.bkg_buf);
+        if(!batch)
+            chunk_io_ud = DV_free(chunk_io_ud);
     } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_io_types_equal() */
+} /* end H5_daos_dataset_io_cached() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_io_tconv_prep_cb
+ * Function:    H5_daos_dataset_io_chunks_cached
  *
- * Purpose:     Prepare callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for raw data I/O with type conversion.
+ * Purpose:     Performs I/O on the nchunks_sel selected chunks in
+ *              chunk_info (or set up from chunk_iter, see
+ *              H5_daos_dataset_io_chunks()) through the dataset's chunk
+ *              cache, then trims the cache to its size limit, writing
+ *              back dirty chunks that are evicted.  end_task, if
+ *              present, is made to depend on all of this.
  *
  * Return:      Success:        0
- *              Failure:        Error code
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_chunk_io_tconv_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_dataset_io_chunks_cached(H5_daos_select_chunk_info_t *chunk_info,
+    H5_daos_chunk_iter_t *chunk_iter,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, size_t nchunks_sel,
+    H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id,
+    H5_daos_io_type_t io_type, void *buf, tse_task_t *end_task,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
-    H5_daos_chunk_io_ud_t *udata;
-    daos_obj_rw_t *update_args;
-    int ret_value = 0;
+    tse_task_t *chunk_end_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
 
-    /* Get private data */
-    if(NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+    assert(dset);
+    assert(dset->chunk_cache.nbytes_max > 0);
+    assert(first_task);
+    assert(dep_task);
 
-    assert(udata->req);
-    assert(udata->dset);
-    assert(udata->req->file);
+    /* The chunk I/O must finish before the cache is trimmed, so give it its
+     * own end task if there is one for the whole operation */
+    if(end_task && H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &chunk_end_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create end task for chunk I/O");
+
+    /* Perform I/O on the selected chunks through the cache */
+    if(H5_daos_dataset_io_chunks(chunk_info, chunk_iter, sel_pattern, nchunks_sel, H5_daos_dataset_io_cached,
+            dset, dset_ndims, mem_type_id, io_type, buf, chunk_end_task, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't perform I/O on chunks through cache");
+
+    /* Schedule chunk end task */
+    if(chunk_end_task) {
+        ret = tse_task_schedule(chunk_end_task, false);
+        *dep_task = chunk_end_task;
+        chunk_end_task = NULL;
+        if(0 != ret)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for chunk I/O: %s", H5_daos_err_to_string(ret));
+    } /* end if */
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+    /* Evict the least recently used chunks until the cache fits within its
+     * size limit */
+    if(H5_daos_chunk_cache_flush(dset, TRUE, dset->chunk_cache.nbytes_max, NULL, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't trim chunk cache");
 
-    /* If writing, gather the write buffer data to the type conversion buffer */
-    if(udata->tconv.io_type == IO_WRITE) {
-        /* Gather data to conversion buffer */
-        if(H5Dgather(udata->tconv.mem_space_id, udata->tconv.buf, udata->tconv.mem_type_id,
-                (size_t)udata->tconv.num_elem * udata->tconv.mem_type_size, udata->tconv.tconv_buf,
-                NULL, NULL) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, H5_DAOS_H5_SCATGATH_ERROR, "can't gather data to conversion buffer");
+    /* Set up dependency for end task */
+    if(end_task && 0 != (ret = tse_task_register_deps(end_task, 1, dep_task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency for end task: %s", H5_daos_err_to_string(ret));
 
-        /* Perform type conversion */
-        if(H5Tconvert(udata->tconv.mem_type_id, udata->dset->file_type_id, (size_t)udata->tconv.num_elem,
-                udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+done:
+    /* Schedule chunk end task on failure, it will complete once any chunk
+     * tasks that were created do */
+    if(chunk_end_task) {
+        assert(ret_value < 0);
+        if(0 != (ret = tse_task_schedule(chunk_end_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for chunk I/O: %s", H5_daos_err_to_string(ret));
     } /* end if */
 
-    /* Set sg_iov to point to tconv_buf */
-    daos_iov_set(&udata->sg_iov, udata->tconv.tconv_buf,
-            (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_chunks_cached() */
 
-    /* Set I/O task arguments */
-    if(NULL == (update_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
-    memset(update_args, 0, sizeof(*update_args));
-    update_args->oh = udata->dset->obj.obj_oh;
-    update_args->th = udata->req->th;
-    update_args->dkey = &udata->dkey;
-    update_args->nr = 1;
-    update_args->iods = &udata->iod;
-    update_args->sgls = &udata->sgl;
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_flush
+ *
+ * Purpose:     Creates tasks to write back dirty entries in a dataset's
+ *              chunk cache.  If evict is TRUE, the least recently used
+ *              entries are removed from the cache until it holds at most
+ *              max_nbytes bytes, and only the removed entries that are
+ *              dirty are written back.  Otherwise all dirty entries are
+ *              written back and kept in the cache, except that if extent
+ *              is not NULL, entries for chunks not entirely within
+ *              extent are also removed (after being written back if
+ *              dirty).  Entries are chosen when the flush task runs,
+ *              after *dep_task.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_flush(H5_daos_dset_t *dset, hbool_t evict,
+    size_t max_nbytes, const hsize_t *extent, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_chunk_cache_flush_ud_t *flush_ud = NULL;
+    tse_task_t *flush_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct */
+    if(NULL == (flush_ud = (H5_daos_chunk_cache_flush_ud_t *)DV_calloc(sizeof(H5_daos_chunk_cache_flush_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for chunk cache flush arguments");
+    flush_ud->req = req;
+    flush_ud->dset = dset;
+    flush_ud->evict = evict;
+    flush_ud->max_nbytes = max_nbytes;
+    if(extent) {
+        assert(!evict);
+        flush_ud->trim = TRUE;
+        if((flush_ud->ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataspace rank");
+        memcpy(flush_ud->extent, extent, (size_t)flush_ud->ndims * sizeof(extent[0]));
+    } /* end if */
+    flush_ud->rc = 1;
+
+    /* Create metatask for flush.  This empty task will be completed when the
+     * flush task and all chunk updates it creates finish. */
+    if(H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &flush_ud->metatask) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create metatask for chunk cache flush");
+
+    /* Create task to select entries and start writing them back */
+    if(H5_daos_create_task(H5_daos_chunk_cache_flush_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            NULL, NULL, flush_ud, &flush_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to flush chunk cache");
+
+    /* Schedule metatask */
+    if(0 != (ret = tse_task_schedule(flush_ud->metatask, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule metatask for chunk cache flush: %s", H5_daos_err_to_string(ret));
+
+    /* Schedule flush task (or save it to be scheduled later) and give it a
+     * reference to req and the dataset */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(flush_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to flush chunk cache: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = flush_task;
+    req->rc++;
+    dset->obj.item.rc++;
+    *dep_task = flush_ud->metatask;
+    flush_ud = NULL;
 
 done:
+    /* Cleanup on failure */
     if(ret_value < 0)
-        tse_task_complete(task, ret_value);
+        flush_ud = DV_free(flush_ud);
+
+    assert(!flush_ud);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_io_tconv_prep_cb() */
+} /* end H5_daos_chunk_cache_flush() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_io_tconv_comp_cb
+ * Function:    H5_daos_chunk_cache_flush_task
  *
- * Purpose:     Complete callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for raw data I/O with type conversion.
+ * Purpose:     Asynchronous task for H5_daos_chunk_cache_flush().
+ *              Removes entries from the cache if evicting, and creates a
+ *              task to write back each dirty entry selected.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2608,97 +6942,135 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_chunk_io_tconv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_chunk_cache_flush_task(tse_task_t *task)
 {
-    H5_daos_chunk_io_ud_t *udata;
-    int ret_value = 0;
-
-    assert(H5_daos_task_list_g);
-
-    /* Get private data */
-    if(NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
-
-    assert(udata->req);
-    assert(udata->req->file);
-    assert(udata->dset);
-
-    /* Handle errors in update task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if(task->dt_result < -H5_DAOS_PRE_ERROR
-            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status = task->dt_result;
-        udata->req->failed_task = "raw data I/O";
-    } /* end if */
+    H5_daos_chunk_cache_flush_ud_t *flush_ud = NULL;
+    H5_daos_chunk_cache_t *cache;
+    H5_daos_chunk_cache_ent_t *ent;
+    H5_daos_chunk_cache_ent_t *next;
+    int ret;
+    int ret_value = 0;
 
-    /* If reading we must perform type conversion on the read data */
-    if(udata->tconv.io_type == IO_READ) {
-        /* Perform type conversion */
-        if(H5Tconvert(udata->dset->file_type_id, udata->tconv.mem_type_id, (size_t)udata->tconv.num_elem,
-                udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (flush_ud = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk cache flush task");
 
-        /* Scatter data to memory buffer if necessary */
-        if(udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV) {
-            H5_daos_scatter_cb_ud_t scatter_cb_ud;
+    assert(flush_ud->req);
+    assert(flush_ud->dset);
 
-            scatter_cb_ud.buf = udata->tconv.tconv_buf;
-            scatter_cb_ud.len = (size_t)udata->tconv.num_elem * udata->tconv.mem_type_size;
-            if(H5Dscatter(H5_daos_scatter_cb, &scatter_cb_ud, udata->tconv.mem_type_id,
-                    udata->tconv.mem_space_id, udata->tconv.buf) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, H5_DAOS_H5_SCATGATH_ERROR, "can't scatter data to read buffer");
-        } /* end if */
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(flush_ud->req, H5E_DATASET);
+
+    /* Check if the cache was disabled when the dataset was opened */
+    cache = &flush_ud->dset->chunk_cache;
+    if(!cache->table)
+        D_GOTO_DONE(0);
+
+    if(flush_ud->evict) {
+        /* Evict least recently used entries until the cache is small
+         * enough, writing back dirty ones */
+        while(cache->tail && cache->nbytes > flush_ud->max_nbytes) {
+            ent = cache->tail;
+            H5_daos_chunk_cache_remove(cache, ent);
+            if(ent->ndirty > 0) {
+                if((ret = H5_daos_chunk_cache_write_back(flush_ud, ent, TRUE)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, ret, "can't write back chunk cache entry");
+            } /* end if */
+            else
+                H5_daos_chunk_cache_ent_free(ent);
+        } /* end while */
     } /* end if */
+    else
+        /* Write back all dirty entries, removing those outside the new
+         * extent if trimming */
+        for(ent = cache->head; ent; ent = next) {
+            next = ent->next;
+            if(flush_ud->trim && H5_daos_chunk_cache_ent_outside(flush_ud, ent)) {
+                H5_daos_chunk_cache_remove(cache, ent);
+                if(ent->ndirty > 0) {
+                    if((ret = H5_daos_chunk_cache_write_back(flush_ud, ent, TRUE)) < 0)
+                        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, ret, "can't write back chunk cache entry");
+                } /* end if */
+                else
+                    H5_daos_chunk_cache_ent_free(ent);
+            } /* end if */
+            else if(ent->ndirty > 0 && (ret = H5_daos_chunk_cache_write_back(flush_ud, ent, FALSE)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, ret, "can't write back chunk cache entry");
+        } /* end for */
 
 done:
     /* Return task to task list */
     if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
         D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-    if(udata) {
-        /* Close dataset */
-        if(H5_daos_dataset_close_real(udata->dset) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
-
-        /* Close space and type IDs */
-        if(H5Sclose(udata->tconv.mem_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory dataspace");
-        if(H5Tclose(udata->tconv.mem_type_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
-
+    if(flush_ud) {
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->req->status = ret_value;
-            udata->req->failed_task = "raw data I/O completion callback";
+         * H5_daos_chunk_cache_flush_release, which updates req->status if it
+         * sees an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && flush_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            flush_ud->req->status = ret_value;
+            flush_ud->req->failed_task = "chunk cache flush task";
         } /* end if */
 
-        /* Release our reference to req */
-        if(H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-        /* Free private data */
-        if(udata->recxs != &udata->recx)
-            DV_free(udata->recxs);
-        if(udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
-            DV_free(udata->tconv.tconv_buf);
-        if(udata->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
-            DV_free(udata->tconv.bkg_buf);
-        DV_free(udata);
+        /* Release our reference to the flush */
+        if(H5_daos_chunk_cache_flush_release(flush_ud) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't release chunk cache flush");
     } /* end if */
 
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_io_tconv_comp_cb() */
+} /* end H5_daos_chunk_cache_flush_task() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_fill_bkg_prep_cb
+ * Function:    H5_daos_chunk_cache_ent_outside
  *
- * Purpose:     Prepare callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for filling background buffer for type
- *              conversion.
+ * Purpose:     Checks whether the chunk held by a chunk cache entry
+ *              extends past the extent being trimmed to.  The chunk's
+ *              coordinates are decoded from the entry's dkey.
+ *
+ * Return:      TRUE if any part of the chunk is outside the extent,
+ *              FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_chunk_cache_ent_outside(H5_daos_chunk_cache_flush_ud_t *flush_ud,
+    H5_daos_chunk_cache_ent_t *ent)
+{
+    const uint8_t *p;
+    uint64_t coord;
+    int i;
+
+    assert(flush_ud);
+    assert(flush_ud->trim);
+    assert(ent);
+
+    /* Skip the '\0' prefix */
+    p = ent->dkey_buf + 1;
+    for(i = 0; i < flush_ud->ndims; i++) {
+        UINT64DECODE(p, coord);
+        if((hsize_t)coord + flush_ud->dset->dcpl_cache.chunk_dims[i] > flush_ud->extent[i])
+            return TRUE;
+    } /* end for */
+
+    return FALSE;
+} /* end H5_daos_chunk_cache_ent_outside() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_write_back
+ *
+ * Purpose:     Creates and schedules a task to write the dirty ranges of
+ *              a chunk cache entry to the chunk's array akey, as a single
+ *              update.  The entry's dirty ranges are cleared.  If evicted
+ *              is TRUE the entry has been removed from the cache and is
+ *              freed when the update completes (or now on failure).
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2706,53 +7078,90 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_chunk_fill_bkg_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_chunk_cache_write_back(H5_daos_chunk_cache_flush_ud_t *flush_ud,
+    H5_daos_chunk_cache_ent_t *ent, hbool_t evicted)
 {
-    H5_daos_chunk_io_ud_t *udata;
-    daos_obj_rw_t *update_args;
+    H5_daos_chunk_cache_wb_ud_t *wb_ud = NULL;
+    tse_task_t *update_task = NULL;
+    size_t file_type_size;
+    size_t i;
+    int ret;
     int ret_value = 0;
 
-    /* Get private data */
-    if(NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+    assert(flush_ud);
+    assert(ent);
+    assert(ent->ndirty > 0);
 
-    assert(udata->req);
-    assert(udata->dset);
-    assert(udata->req->file);
+    file_type_size = flush_ud->dset->file_type_size;
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+    /* Allocate argument struct */
+    if(NULL == (wb_ud = (H5_daos_chunk_cache_wb_ud_t *)DV_calloc(sizeof(H5_daos_chunk_cache_wb_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for chunk write back arguments");
+    wb_ud->flush_ud = flush_ud;
+    wb_ud->ent = ent;
+    wb_ud->evicted = evicted;
+
+    /* Build I/O vectors pointing into the entry's buffer for each dirty
+     * range */
+    if(NULL == (wb_ud->sg_iovs = (daos_iov_t *)DV_malloc(ent->ndirty * sizeof(daos_iov_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate I/O vectors for chunk write back");
+    for(i = 0; i < ent->ndirty; i++)
+        daos_iov_set(&wb_ud->sg_iovs[i], ent->buf + ((size_t)ent->dirty[i].rx_idx * file_type_size),
+                (daos_size_t)ent->dirty[i].rx_nr * (daos_size_t)file_type_size);
 
-    /* Set sg_iov to point to background buffer */
-    daos_iov_set(&udata->sg_iov, udata->tconv.bkg_buf,
-            (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+    /* Set up dkey */
+    daos_iov_set(&wb_ud->dkey, ent->dkey_buf, (daos_size_t)ent->dkey_len);
 
-    /* Set I/O task arguments */
-    if(NULL == (update_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
-    memset(update_args, 0, sizeof(*update_args));
-    update_args->oh = udata->dset->obj.obj_oh;
-    update_args->th = udata->req->th;
-    update_args->dkey = &udata->dkey;
-    update_args->nr = 1;
-    update_args->iods = &udata->iod;
-    update_args->sgls = &udata->sgl;
+    /* Set up iod */
+    wb_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+    daos_iov_set(&wb_ud->iod.iod_name, (void *)&wb_ud->akey_buf, (daos_size_t)(sizeof(wb_ud->akey_buf)));
+    wb_ud->iod.iod_type = DAOS_IOD_ARRAY;
+    wb_ud->iod.iod_size = (daos_size_t)file_type_size;
+    wb_ud->iod.iod_nr = (unsigned)ent->ndirty;
+
+    /* Set up sgl */
+    wb_ud->sgl.sg_nr = (uint32_t)ent->ndirty;
+    wb_ud->sgl.sg_nr_out = 0;
+    wb_ud->sgl.sg_iovs = wb_ud->sg_iovs;
+
+    /* Create task to write chunk */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 0, NULL, H5_daos_chunk_cache_wb_prep_cb,
+            H5_daos_chunk_cache_wb_comp_cb, wb_ud, &update_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to write back chunk");
+
+    /* Take ownership of the dirty range list and clear the entry's */
+    wb_ud->recxs = ent->dirty;
+    wb_ud->iod.iod_recxs = wb_ud->recxs;
+    ent->dirty = NULL;
+    ent->ndirty = 0;
+    ent->dirty_nalloc = 0;
+
+    /* Schedule task and give it a reference to the flush */
+    if(0 != (ret = tse_task_schedule(update_task, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't schedule task to write back chunk: %s", H5_daos_err_to_string(ret));
+    flush_ud->rc++;
+    wb_ud = NULL;
 
 done:
-    if(ret_value < 0)
-        tse_task_complete(task, ret_value);
+    /* Cleanup on failure */
+    if(wb_ud) {
+        assert(ret_value < 0);
+        DV_free(wb_ud->recxs);
+        DV_free(wb_ud->sg_iovs);
+        if(evicted)
+            H5_daos_chunk_cache_ent_free(ent);
+        wb_ud = DV_free(wb_ud);
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_fill_bkg_prep_cb() */
+} /* end H5_daos_chunk_cache_write_back() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_fill_bkg_comp_cb
+ * Function:    H5_daos_chunk_cache_wb_prep_cb
  *
- * Purpose:     Complete callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for filling background buffer for type
- *              conversion.  Does not free data, will be freed by
- *              H5_daos_chunk_io_tconv_comp_cb().
+ * Purpose:     Prepare callback for asynchronous daos_obj_update to write
+ *              back a chunk cache entry.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2760,295 +7169,160 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_chunk_fill_bkg_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_chunk_cache_wb_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_chunk_io_ud_t *udata;
+    H5_daos_chunk_cache_wb_ud_t *wb_ud;
+    daos_obj_rw_t *update_args;
     int ret_value = 0;
 
-    assert(H5_daos_task_list_g);
-
     /* Get private data */
-    if(NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk I/O task");
+    if(NULL == (wb_ud = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk write back task");
 
-    assert(udata);
-    assert(udata->req);
-    assert(udata->req->file);
+    assert(wb_ud->flush_ud);
 
-    /* Handle errors in update task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if(task->dt_result < -H5_DAOS_PRE_ERROR
-            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status = task->dt_result;
-        udata->req->failed_task = "background buffer fill (daos_obj_fetch) for raw data write";
-    } /* end if */
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(wb_ud->flush_ud->req, H5E_IO);
 
-    /* Reset iod_size, if the dataset was not allocated then it could
-     * have been overwritten by daos_obj_fetch */
-    udata->iod.iod_size = udata->tconv.file_type_size;
+    /* Set I/O task arguments */
+    if(NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk write back task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh = wb_ud->flush_ud->dset->obj.obj_oh;
+    update_args->th = wb_ud->flush_ud->req->th;
+    update_args->dkey = &wb_ud->dkey;
+    update_args->nr = 1;
+    update_args->iods = &wb_ud->iod;
+    update_args->sgls = &wb_ud->sgl;
 
 done:
-    /* Return task to task list */
-    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_fill_bkg_comp_cb() */
+} /* end H5_daos_chunk_cache_wb_prep_cb() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_io_types_unequal
+ * Function:    H5_daos_chunk_cache_wb_comp_cb
  *
- * Purpose:     Internal helper routine to perform I/O on a dataset
- *              composed of a non-variable-length datatype where the
- *              datatype specified for the memory buffer doesn't match the
- *              dataset's datatype. In this case, datatype conversion must
- *              be performed.
+ * Purpose:     Complete callback for asynchronous daos_obj_update to
+ *              write back a chunk cache entry.  Frees the entry if it was
+ *              evicted, then releases the flush.
  *
  * Return:      Success:        0
- *              Failure:        -1, dataset I/O not performed.
- *
- * Programmer:  Neil Fortner
- *              November, 2016
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info,
-    H5_daos_dset_t *dset, uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
-    void *buf, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+static int
+H5_daos_chunk_cache_wb_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
-    daos_opc_t daos_op;
-    hbool_t contig = FALSE;
-    size_t tot_nseq;
-    tse_task_t *io_task = NULL;
-    tse_task_t *fill_bkg_task = NULL;
-    uint64_t i;
-    uint8_t *p;
-    int ret;
-    herr_t ret_value = SUCCEED;
-
-    assert(chunk_info);
-    assert(dset);
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
-
-    /* Allocate argument struct */
-    if(NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
-
-    /* Setup type conversion-related fields */
-    chunk_io_ud->tconv.num_elem = chunk_info->num_elem_sel_file;
-    chunk_io_ud->tconv.mem_space_id = H5I_INVALID_HID;
-    if((chunk_io_ud->tconv.mem_type_id = H5Tcopy(mem_type_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
-    if((chunk_io_ud->tconv.mem_space_id = H5Scopy(chunk_info->mspace_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory dataspace");
-    chunk_io_ud->tconv.buf = buf;
-    chunk_io_ud->tconv.io_type = io_type;
-    chunk_io_ud->recxs = &chunk_io_ud->recx;
-    assert(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_NONE);
-
-    /* Point to dset */
-    chunk_io_ud->dset = dset;
-
-    /* Point to req */
-    chunk_io_ud->req = req;
-
-    /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
-     * collisions with other d-keys in this object.
-     */
-    p = chunk_io_ud->dkey_buf;
-    *p++ = (uint8_t)'\0';
-    for(i = 0; i < dset_ndims; i++)
-        UINT64ENCODE(p, chunk_info->chunk_coords[i]);
-
-    /* Set up dkey */
-    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
-            (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
-
-    if(io_type == IO_READ) {
-        size_t nseq_tmp;
-        size_t nelem_tmp;
-        hsize_t sel_off;
-        size_t sel_len;
-
-        /* Reset memory selection iterator for current memory dataspace */
-        if(H5Ssel_iter_reset(dset->io_cache.mem_sel_iter_id, chunk_info->mspace_id) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
-
-        /* Get the sequence list - only check the first sequence because we only
-         * care if it is contiguous and if so where the contiguous selection
-         * begins */
-        if(H5Ssel_iter_get_seq_list(dset->io_cache.mem_sel_iter_id, (size_t)1, (size_t)-1,
-                &nseq_tmp, &nelem_tmp, &sel_off, &sel_len) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed");
-        contig = (sel_len == (size_t)chunk_info->num_elem_sel_file);
-
-        /* Initialize type conversion */
-        if(H5_daos_tconv_init(
-                dset->file_type_id,
-                &chunk_io_ud->tconv.file_type_size,
-                mem_type_id,
-                &chunk_io_ud->tconv.mem_type_size,
-                (size_t)chunk_info->num_elem_sel_file,
-                dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL,
-                FALSE,
-                &chunk_io_ud->tconv.tconv_buf,
-                &chunk_io_ud->tconv.bkg_buf,
-                contig ? &chunk_io_ud->tconv.reuse : NULL,
-                &chunk_io_ud->tconv.fill_bkg) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
-
-        /* Reuse buffer as appropriate */
-        if(contig) {
-            sel_off *= (hsize_t)chunk_io_ud->tconv.mem_type_size;
-            if(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_TCONV)
-                chunk_io_ud->tconv.tconv_buf = (char *)buf + (size_t)sel_off;
-            else if(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_BKG)
-                chunk_io_ud->tconv.bkg_buf = (char *)buf + (size_t)sel_off;
-        } /* end if */
-    } /* end (io_type == IO_READ) */
-    else
-        /* Initialize type conversion */
-        if(H5_daos_tconv_init(
-                mem_type_id,
-                &chunk_io_ud->tconv.mem_type_size,
-                dset->file_type_id,
-                &chunk_io_ud->tconv.file_type_size,
-                (size_t)chunk_info->num_elem_sel_file,
-                FALSE,
-                TRUE,
-                &chunk_io_ud->tconv.tconv_buf,
-                &chunk_io_ud->tconv.bkg_buf,
-                NULL,
-                &chunk_io_ud->tconv.fill_bkg) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
-
-    /* Set up iod */
-    memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
-    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
-    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
-            (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
-    chunk_io_ud->iod.iod_size = (daos_size_t)chunk_io_ud->tconv.file_type_size;
-    chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
-
-    /* Build recxs and sg_iovs */
+    H5_daos_chunk_cache_wb_ud_t *wb_ud;
+    int ret_value = 0;
 
-    /* Reset file selection iterator for current file dataspace */
-    if(H5Ssel_iter_reset(dset->io_cache.file_sel_iter_id, chunk_info->fspace_id) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
+    assert(H5_daos_task_list_g);
 
-    /* Calculate recxs from file space */
-    if(H5_daos_sel_to_recx_iov(dset->io_cache.file_sel_iter_id, chunk_io_ud->tconv.file_type_size, buf,
-            &chunk_io_ud->recxs, NULL, &tot_nseq) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
-    chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
-    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
+    /* Get private data */
+    if(NULL == (wb_ud = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for chunk write back task");
 
-    /* No selection in the file */
-    if(chunk_io_ud->iod.iod_nr == 0)
-        D_GOTO_DONE(SUCCEED);
+    assert(wb_ud->flush_ud);
 
-    /* Set up constant sgl info */
-    chunk_io_ud->sgl.sg_nr = 1;
-    chunk_io_ud->sgl.sg_nr_out = 0;
-    chunk_io_ud->sgl.sg_iovs = &chunk_io_ud->sg_iov;
+    /* Handle errors in update task.  Only record error in req_status if it
+     * does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && wb_ud->flush_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        wb_ud->flush_ud->req->status = task->dt_result;
+        wb_ud->flush_ud->req->failed_task = "chunk cache write back (daos_obj_update)";
+    } /* end if */
 
-    if(io_type == IO_READ) {
-        /* Gather data to background buffer if necessary */
-        if(chunk_io_ud->tconv.fill_bkg && (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG))
-            if(H5Dgather(chunk_info->mspace_id, buf, mem_type_id,
-                    (size_t)chunk_info->num_elem_sel_file * chunk_io_ud->tconv.mem_type_size,
-                    chunk_io_ud->tconv.bkg_buf, NULL, NULL) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't gather data to background buffer");
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-        /* Handle fill values */
-        if(dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL) {
-            /* H5_daos_tconv_init() will have cleared the tconv buf, but not if
-             * we're reusing buf as tconv_buf */
-            if(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_TCONV)
-                (void)memset(chunk_io_ud->tconv.tconv_buf, 0,
-                        (daos_size_t)chunk_info->num_elem_sel_file * (daos_size_t)chunk_io_ud->tconv.file_type_size);
+    if(wb_ud) {
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_chunk_cache_flush_release, which updates req->status if it
+         * sees an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && wb_ud->flush_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            wb_ud->flush_ud->req->status = ret_value;
+            wb_ud->flush_ud->req->failed_task = "chunk cache write back completion callback";
         } /* end if */
-        else if(dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
-            hssize_t j;
 
-            assert(dset->fill_val);
+        /* Free private data */
+        if(wb_ud->evicted)
+            H5_daos_chunk_cache_ent_free(wb_ud->ent);
+        DV_free(wb_ud->recxs);
+        DV_free(wb_ud->sg_iovs);
+
+        /* Release our reference to the flush */
+        if(H5_daos_chunk_cache_flush_release(wb_ud->flush_ud) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't release chunk cache flush");
+        DV_free(wb_ud);
+    } /* end if */
 
-            /* Copy the fill value to every element in tconv_buf */
-            for(j = 0; j < chunk_info->num_elem_sel_file; j++)
-                (void)memcpy((uint8_t *)chunk_io_ud->tconv.tconv_buf + ((size_t)j * chunk_io_ud->tconv.file_type_size),
-                        dset->fill_val, chunk_io_ud->tconv.file_type_size);
-        } /* end if */
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_wb_comp_cb() */
 
-        /* Create task to read data from dataset */
-        daos_op = DAOS_OPC_OBJ_FETCH;
-    } /* end (io_type == IO_READ) */
-    else {
-        /* Check if we need to fill background buffer */
-        if(chunk_io_ud->tconv.fill_bkg) {
-            assert(chunk_io_ud->tconv.bkg_buf);
 
-            /* Create task to read data from dataset */
-            if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                    H5_daos_chunk_fill_bkg_prep_cb, H5_daos_chunk_fill_bkg_comp_cb, chunk_io_ud, &fill_bkg_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read data to background buffer");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_flush_release
+ *
+ * Purpose:     Releases a reference to a chunk cache flush.  When the
+ *              last reference is released, completes the flush metatask
+ *              and releases the flush's references to the request and
+ *              dataset.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_flush_release(H5_daos_chunk_cache_flush_ud_t *flush_ud)
+{
+    int ret_value = 0;
 
-            /* Save bkg fill task to be scheduled later */
-            if(*first_task) {
-                if(0 != (ret = tse_task_schedule(fill_bkg_task, false)))
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule background buffer fill task");
-            } /* end if */
-            else
-                *first_task = fill_bkg_task;
-            *dep_task = fill_bkg_task;
-        } /* end if */
+    assert(flush_ud);
+    assert(flush_ud->rc > 0);
 
-        /* Create task to write data to dataset */
-        daos_op = DAOS_OPC_OBJ_UPDATE;
-    } /* end (io_type == IO_WRITE) */
+    if(--flush_ud->rc > 0)
+        D_GOTO_DONE(0);
 
-    if(H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-            H5_daos_chunk_io_tconv_prep_cb, H5_daos_chunk_io_tconv_comp_cb, chunk_io_ud, &io_task) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
-                (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
+    /* Close dataset */
+    if(H5_daos_dataset_close_real(flush_ud->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
 
-    /* Schedule IO task (or save it to be scheduled later) */
-    if(*first_task) {
-        assert(*dep_task);
-        if(0 != (ret = tse_task_schedule(io_task, false)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if(ret_value < -H5_DAOS_SHORT_CIRCUIT && flush_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        flush_ud->req->status = ret_value;
+        flush_ud->req->failed_task = "chunk cache flush completion";
     } /* end if */
-    else
-        *first_task = io_task;
-    *dep_task = io_task;
 
-    /* Task will be scheduled, give it a reference to req and the dataset */
-    chunk_io_ud->req->rc++;
-    chunk_io_ud->dset->obj.item.rc++;
+    /* Release our reference to req */
+    if(H5_daos_req_free_int(flush_ud->req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-done:
-    /* Cleanup on failure */
-    if(ret_value < 0 && chunk_io_ud && !fill_bkg_task) {
-        if(chunk_io_ud->tconv.mem_type_id >= 0 && H5Tclose(chunk_io_ud->tconv.mem_type_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
-        if(chunk_io_ud->tconv.mem_space_id >= 0 && H5Sclose(chunk_io_ud->tconv.mem_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
-        if(chunk_io_ud->recxs != &chunk_io_ud->recx)
-            DV_free(chunk_io_ud->recxs);
-        if(chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
-            chunk_io_ud->tconv.tconv_buf = DV_free(chunk_io_ud->tconv.tconv_buf);
-        if(chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
-            chunk_io_ud->tconv.bkg_buf = DV_free(chunk_io_ud->tconv.bkg_buf);
-        chunk_io_ud = DV_free(chunk_io_ud);
-    } /* end if */
+    /* Return metatask to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, flush_ud->metatask) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete flush metatask */
+    tse_task_complete(flush_ud->metatask, ret_value);
 
+    /* Free flush */
+    DV_free(flush_ud);
+
+done:
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_io_types_unequal() */
+} /* end H5_daos_chunk_cache_flush_release() */
+
 
 
 /*-------------------------------------------------------------------------
@@ -3283,8 +7557,11 @@ H5_daos_dataset_read_int(H5_daos_dset_t *dset, hid_t mem_type_id,
 {
     H5_daos_select_chunk_info_t *chunk_info = NULL; /* Array of info for each chunk selected in the file */
     H5_daos_chunk_io_func single_chunk_read_func;
-    uint64_t i;
+    H5_daos_chunk_iter_t chunk_iter;
     size_t nchunks_sel;
+    hbool_t use_sel_pattern = FALSE;
+    hbool_t use_chunk_iter = FALSE;
+    hbool_t use_chunk_cache = FALSE;
     hid_t real_file_space_id;
     hid_t real_mem_space_id;
     int ndims;
@@ -3350,9 +7627,12 @@ H5_daos_dataset_read_int(H5_daos_dset_t *dset, hid_t mem_type_id,
             break;
 
         case H5D_CHUNKED:
-            /* Get the coordinates of the currently selected chunks in the file, setting up memory and file dataspaces for them */
+            /* Count the currently selected chunks in the file.  Their memory
+             * and file dataspaces are set up a batch at a time as the chunk
+             * I/O is issued. */
             if(H5_daos_get_selected_chunk_info(&dset->dcpl_cache, real_file_space_id, real_mem_space_id,
-                    &dset->io_cache.chunk_info, &dset->io_cache.chunk_info_nalloc, &nchunks_sel) < 0)
+                    &dset->io_cache.chunk_info, &dset->io_cache.chunk_info_nalloc, &nchunks_sel,
+                    &dset->io_cache.sel_pattern, &use_sel_pattern, &chunk_iter, &use_chunk_iter) < 0)
                 D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
             chunk_info = dset->io_cache.chunk_info;
 
@@ -3367,7 +7647,10 @@ H5_daos_dataset_read_int(H5_daos_dset_t *dset, hid_t mem_type_id,
     assert(nchunks_sel > 0);
 
     /* Setup the appropriate function for reading the selected chunks */
-    if(need_tconv)
+    if(dset->dcpl_cache.pipeline)
+        /* Filtered chunks, type conversion is handled per chunk */
+        single_chunk_read_func = H5_daos_dataset_io_filtered;
+    else if(need_tconv)
         /* Type conversion necessary */
         single_chunk_read_func = H5_daos_dataset_io_types_unequal;
     else
@@ -3392,18 +7675,29 @@ H5_daos_dataset_read_int(H5_daos_dset_t *dset, hid_t mem_type_id,
         }
     } /* end if */
 
+    /* Check if the I/O should go through the chunk cache.  Operations on
+     * more chunks than the cache can hold bypass it, after writing back and
+     * dropping all cached chunks so the cache does not hold stale data. */
+    io_task = *dep_task;
+    if(dset->chunk_cache.nbytes_max > 0) {
+        use_chunk_cache = nchunks_sel <= dset->chunk_cache.nbytes_max / dset->chunk_cache.chunk_nbytes;
+        if(!use_chunk_cache && H5_daos_chunk_cache_flush(dset, TRUE, 0, NULL, req, first_task, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't flush chunk cache");
+    } /* end if */
+
     /* Perform I/O on each chunk selected */
-    for(i = 0; i < nchunks_sel; i++) {
-        io_task = *dep_task;
-        if(single_chunk_read_func(&chunk_info[i], dset, (uint64_t)ndims, mem_type_id,
-                IO_READ, buf, req, first_task, &io_task) < 0)
+    if(use_chunk_cache) {
+        if(H5_daos_dataset_io_chunks_cached(chunk_info, use_chunk_iter ? &chunk_iter : NULL,
+                use_sel_pattern ? &dset->io_cache.sel_pattern : NULL, nchunks_sel,
+                dset, (uint64_t)ndims, mem_type_id, IO_READ, buf, end_task, req,
+                first_task, &io_task) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "dataset read failed");
-
-        /* Set up dependency on io_task for end task */
-        assert(io_task);
-        if(end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk I/O task: %s", H5_daos_err_to_string(ret));
-    } /* end for */
+    } /* end if */
+    else if(H5_daos_dataset_io_chunks(chunk_info, use_chunk_iter ? &chunk_iter : NULL,
+            use_sel_pattern ? &dset->io_cache.sel_pattern : NULL, nchunks_sel,
+            single_chunk_read_func, dset, (uint64_t)ndims, mem_type_id, IO_READ, buf, end_task, req,
+            first_task, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "dataset read failed");
 
 done:
     /* Schedule end_task if appropriate and update *dep_task */
@@ -3415,6 +7709,11 @@ done:
     else
         *dep_task = io_task;
 
+    /* Release selected chunk iterator.  Any chunks not issued yet are set
+     * up from a copy held by the chunk I/O stream. */
+    if(use_chunk_iter && H5_daos_chunk_iter_term(&chunk_iter) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release selected chunk iterator");
+
     D_FUNC_LEAVE;
 } /* end H5_daos_dataset_read_int() */
 
@@ -3463,11 +7762,23 @@ H5_daos_dataset_read(void *_dset, hid_t mem_type_id, hid_t mem_space_id,
         if((need_tconv = H5_daos_need_tconv(dset->file_type_id, mem_type_id)) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
         req_dxpl_id = need_tconv ? dxpl_id : H5P_DATASET_XFER_DEFAULT;
+
+        /* The DXPL is also needed if it limits the chunk I/O operations in
+         * flight */
+        if(!need_tconv && dxpl_id != H5P_DATASET_XFER_DEFAULT) {
+            htri_t prop_exists;
+
+            if((prop_exists = H5Pexist(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME)) < 0)
+                D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for chunk I/O window property");
+            if(prop_exists)
+                req_dxpl_id = dxpl_id;
+        } /* end if */
     } /* end if */
     else
         req_dxpl_id = dxpl_id;
 
-    /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+    /* Start H5 operation. Currently, the DXPL is only copied when datatype
+     * conversion is needed or it sets the chunk I/O window. */
     if(NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset read",
             dset->obj.item.open_req, NULL, NULL, req_dxpl_id)))
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
@@ -3541,9 +7852,11 @@ done:
             int_req->status = -H5_DAOS_SETUP_ERROR;
 
         /* Add the request to the object's request queue.  This will add the
-         * dependency on the dataset open if necessary. */
+         * dependency on the dataset open if necessary.  Reads through the
+         * chunk cache modify it, so they must be serialized. */
         if(H5_daos_req_enqueue(int_req, first_task, &dset->obj.item,
-                H5_DAOS_OP_TYPE_READ, H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+                dset->chunk_cache.nbytes_max > 0 ? H5_DAOS_OP_TYPE_WRITE_ORDERED : H5_DAOS_OP_TYPE_READ,
+                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
 
         /* Check for external async */
@@ -3607,8 +7920,15 @@ H5_daos_dataset_write_int(H5_daos_dset_t *dset, hid_t mem_type_id,
 {
     H5_daos_select_chunk_info_t *chunk_info = NULL; /* Array of info for each chunk selected in the file */
     H5_daos_chunk_io_func single_chunk_write_func;
-    uint64_t i;
+    union {
+        const void *const_buf;
+        void *buf;
+    } safe_buf = {.const_buf = buf};
+    H5_daos_chunk_iter_t chunk_iter;
     size_t nchunks_sel;
+    hbool_t use_sel_pattern = FALSE;
+    hbool_t use_chunk_iter = FALSE;
+    hbool_t use_chunk_cache = FALSE;
     hid_t real_file_space_id;
     hid_t real_mem_space_id;
     int ndims;
@@ -3675,9 +7995,12 @@ H5_daos_dataset_write_int(H5_daos_dset_t *dset, hid_t mem_type_id,
             break;
 
         case H5D_CHUNKED:
-            /* Get the coordinates of the currently selected chunks in the file, setting up memory and file dataspaces for them */
+            /* Count the currently selected chunks in the file.  Their memory
+             * and file dataspaces are set up a batch at a time as the chunk
+             * I/O is issued. */
             if(H5_daos_get_selected_chunk_info(&dset->dcpl_cache, real_file_space_id, real_mem_space_id,
-                    &dset->io_cache.chunk_info, &dset->io_cache.chunk_info_nalloc, &nchunks_sel) < 0)
+                    &dset->io_cache.chunk_info, &dset->io_cache.chunk_info_nalloc, &nchunks_sel,
+                    &dset->io_cache.sel_pattern, &use_sel_pattern, &chunk_iter, &use_chunk_iter) < 0)
                 D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
             chunk_info = dset->io_cache.chunk_info;
 
@@ -3692,7 +8015,10 @@ H5_daos_dataset_write_int(H5_daos_dset_t *dset, hid_t mem_type_id,
     assert(nchunks_sel > 0);
 
     /* Setup the appropriate function for writing the selected chunks */
-    if(need_tconv)
+    if(dset->dcpl_cache.pipeline)
+        /* Filtered chunks, type conversion is handled per chunk */
+        single_chunk_write_func = H5_daos_dataset_io_filtered;
+    else if(need_tconv)
         /* Type conversion necessary */
         single_chunk_write_func = H5_daos_dataset_io_types_unequal;
     else
@@ -3717,23 +8043,29 @@ H5_daos_dataset_write_int(H5_daos_dset_t *dset, hid_t mem_type_id,
         }
     } /* end if */
 
-    /* Perform I/O on each chunk selected */
-    for(i = 0; i < nchunks_sel; i++) {
-        union {
-            const void *const_buf;
-            void *buf;
-        } safe_buf = {.const_buf = buf};
+    /* Check if the I/O should go through the chunk cache.  Operations on
+     * more chunks than the cache can hold bypass it, after writing back and
+     * dropping all cached chunks so the cache does not hold stale data. */
+    io_task = *dep_task;
+    if(dset->chunk_cache.nbytes_max > 0) {
+        use_chunk_cache = nchunks_sel <= dset->chunk_cache.nbytes_max / dset->chunk_cache.chunk_nbytes;
+        if(!use_chunk_cache && H5_daos_chunk_cache_flush(dset, TRUE, 0, NULL, req, first_task, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't flush chunk cache");
+    } /* end if */
 
-        io_task = *dep_task;
-        if(single_chunk_write_func(&chunk_info[i], dset, (uint64_t)ndims, mem_type_id,
-                IO_WRITE, safe_buf.buf, req, first_task, &io_task) < 0)
+    /* Perform I/O on each chunk selected */
+    if(use_chunk_cache) {
+        if(H5_daos_dataset_io_chunks_cached(chunk_info, use_chunk_iter ? &chunk_iter : NULL,
+                use_sel_pattern ? &dset->io_cache.sel_pattern : NULL, nchunks_sel,
+                dset, (uint64_t)ndims, mem_type_id, IO_WRITE, safe_buf.buf, end_task, req,
+                first_task, &io_task) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "dataset write failed");
-
-        /* Set up dependency on io_task for end task */
-        assert(io_task);
-        if(end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk I/O task: %s", H5_daos_err_to_string(ret));
-    } /* end for */
+    } /* end if */
+    else if(H5_daos_dataset_io_chunks(chunk_info, use_chunk_iter ? &chunk_iter : NULL,
+            use_sel_pattern ? &dset->io_cache.sel_pattern : NULL, nchunks_sel,
+            single_chunk_write_func, dset, (uint64_t)ndims, mem_type_id, IO_WRITE, safe_buf.buf, end_task, req,
+            first_task, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "dataset write failed");
 
 done:
     /* Schedule end_task if appropriate and update *dep_task */
@@ -3745,6 +8077,11 @@ done:
     else
         *dep_task = io_task;
 
+    /* Release selected chunk iterator.  Any chunks not issued yet are set
+     * up from a copy held by the chunk I/O stream. */
+    if(use_chunk_iter && H5_daos_chunk_iter_term(&chunk_iter) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release selected chunk iterator");
+
     D_FUNC_LEAVE;
 } /* end H5_daos_dataset_write_int() */
 
@@ -3797,11 +8134,23 @@ H5_daos_dataset_write(void *_dset, hid_t mem_type_id, hid_t mem_space_id,
         if((need_tconv = H5_daos_need_tconv(dset->file_type_id, mem_type_id)) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
         req_dxpl_id = need_tconv ? dxpl_id : H5P_DATASET_XFER_DEFAULT;
+
+        /* The DXPL is also needed if it limits the chunk I/O operations in
+         * flight */
+        if(!need_tconv && dxpl_id != H5P_DATASET_XFER_DEFAULT) {
+            htri_t prop_exists;
+
+            if((prop_exists = H5Pexist(dxpl_id, H5_DAOS_CHUNK_IO_MAX_IN_FLIGHT_PROP_NAME)) < 0)
+                D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for chunk I/O window property");
+            if(prop_exists)
+                req_dxpl_id = dxpl_id;
+        } /* end if */
     } /* end if */
     else
         req_dxpl_id = dxpl_id;
 
-    /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+    /* Start H5 operation. Currently, the DXPL is only copied when datatype
+     * conversion is needed or it sets the chunk I/O window. */
     if(NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset write",
             dset->obj.item.open_req, NULL, NULL, req_dxpl_id)))
         D_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't create DAOS request");
@@ -3875,9 +8224,11 @@ done:
             int_req->status = -H5_DAOS_SETUP_ERROR;
 
         /* Add the request to the object's request queue.  This will add the
-         * dependency on the dataset open if necessary. */
+         * dependency on the dataset open if necessary.  Writes through the
+         * chunk cache must be serialized. */
         if(H5_daos_req_enqueue(int_req, first_task, &dset->obj.item,
-                H5_DAOS_OP_TYPE_WRITE, H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+                dset->chunk_cache.nbytes_max > 0 ? H5_DAOS_OP_TYPE_WRITE_ORDERED : H5_DAOS_OP_TYPE_WRITE,
+                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
 
         /* Check for external async */
@@ -3917,7 +8268,373 @@ done:
     } /* end if */
 
     D_FUNC_LEAVE_API;
-} /* end H5_daos_dataset_write() */
+} /* end H5_daos_dataset_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_multi
+ *
+ * Purpose:     Internal routine for H5daos_dataset_read_multi() and
+ *              H5daos_dataset_write_multi().  Performs I/O on count
+ *              datasets, all in the same file, as a single operation:
+ *              one request, added to every dataset's operation pool, and
+ *              one finalize task.  The chunk I/O for all datasets hangs
+ *              off one shared first task, so chunks from different
+ *              datasets are in flight at the same time, and a collective
+ *              transfer only needs one collective error check.  buf is
+ *              only written to for reads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_multi(size_t count, const hid_t dset_id[],
+    const hid_t mem_type_id[], const hid_t mem_space_id[],
+    const hid_t file_space_id[], hid_t dxpl_id, H5_daos_io_type_t io_type,
+    const void *buf[])
+{
+    H5_daos_dset_t **dsets = NULL;
+    H5_daos_file_t *file = NULL;
+    H5_daos_io_task_ud_t *task_ud = NULL;
+    tse_task_t **end_tasks = NULL;
+    size_t nend_tasks = 0;
+    tse_task_t *io_task = NULL;
+    tse_task_t *first_task = NULL;
+    tse_task_t *dep_task = NULL;
+    H5_daos_req_t *int_req = NULL;
+    H5_daos_op_pool_type_t op_type = io_type == IO_READ
+            ? H5_DAOS_OP_TYPE_READ : H5_DAOS_OP_TYPE_WRITE;
+    hbool_t collective = FALSE;
+    htri_t need_tconv;
+    size_t i;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(count > 0);
+    assert(dset_id);
+    assert(mem_type_id);
+    assert(mem_space_id);
+    assert(file_space_id);
+    assert(buf);
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Look up datasets and make sure they are all in the same file */
+    if(NULL == (dsets = (H5_daos_dset_t **)DV_malloc(count * sizeof(H5_daos_dset_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate dataset array");
+    for(i = 0; i < count; i++) {
+        if(NULL == (dsets[i] = (H5_daos_dset_t *)H5VLobject(dset_id[i])))
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+        if(H5I_DATASET != dsets[i]->obj.item.type)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+        if(i == 0)
+            file = dsets[0]->obj.item.file;
+        else if(dsets[i]->obj.item.file != file)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "datasets are not all in the same file");
+
+        /* Reads and writes through a chunk cache must be serialized */
+        if(dsets[i]->chunk_cache.nbytes_max > 0)
+            op_type = H5_DAOS_OP_TYPE_WRITE_ORDERED;
+    } /* end for */
+
+    /* Check for write access */
+    if(io_type == IO_WRITE && !(file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    /* Check for collective transfer */
+    if(file->num_procs > 1 && dxpl_id != H5P_DATASET_XFER_DEFAULT) {
+        H5FD_mpio_xfer_t xfer_mode;
+
+        if(H5Pget_dxpl_mpio(dxpl_id, &xfer_mode) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode");
+        collective = (xfer_mode == H5FD_MPIO_COLLECTIVE);
+    } /* end if */
+
+    /* Start H5 operation.  The DXPL is always copied since it may be needed
+     * by any of the datasets.  The first dataset's open is a prerequisite
+     * of the request, the others are added as dependencies below. */
+    if(NULL == (int_req = H5_daos_req_create(file, io_type == IO_READ ? "multi-dataset read" : "multi-dataset write",
+            dsets[0]->obj.item.open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Create shared first task.  The I/O for every dataset depends on this
+     * task so none of it starts before the request is ready to run. */
+    if(H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL,
+            NULL, &first_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create first metatask for multi-dataset I/O");
+
+    /* Allocate array of per-dataset end tasks */
+    if(NULL == (end_tasks = (tse_task_t **)DV_malloc(count * sizeof(tse_task_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate end task array");
+
+    /* Set up I/O for each dataset */
+    for(i = 0; i < count; i++) {
+        H5_daos_dset_t *dset = dsets[i];
+
+        /* Add dependency on dataset open if necessary */
+        if(i > 0 && (dset->obj.item.open_req->status == -H5_DAOS_INCOMPLETE
+                || dset->obj.item.open_req->status == -H5_DAOS_SHORT_CIRCUIT))
+            if(0 != (ret = tse_task_register_deps(first_task, 1, &dset->obj.item.open_req->finalize_task)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on dataset open: %s", H5_daos_err_to_string(ret));
+
+        /* Check if we can call the internal routine directly - the dataset
+         * open must be complete and there must not be an in-flight
+         * set_extent. */
+        if((dset->obj.item.open_req->status == 0)
+                && (dset->cur_set_extent_space_id == H5I_INVALID_HID)) {
+            dep_task = first_task;
+
+            /* Check if datatype conversion is needed */
+            if((need_tconv = H5_daos_need_tconv(dset->file_type_id, mem_type_id[i])) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+
+            /* Call internal routine */
+            if(io_type == IO_READ) {
+                if(H5_daos_dataset_read_int(dset, mem_type_id[i], mem_space_id[i], file_space_id[i],
+                        need_tconv, (void *)buf[i], NULL, int_req, &first_task, &dep_task) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "failed to read data from dataset");
+            } /* end if */
+            else
+                if(H5_daos_dataset_write_int(dset, mem_type_id[i], mem_space_id[i], file_space_id[i],
+                        need_tconv, buf[i], NULL, int_req, &first_task, &dep_task) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to write data to dataset");
+
+            /* Add this dataset's last task to the list the operation waits
+             * on, unless nothing was selected */
+            if(dep_task != first_task)
+                end_tasks[nend_tasks++] = dep_task;
+        } /* end if */
+        else {
+            /* Allocate argument struct */
+            if(NULL == (task_ud = (H5_daos_io_task_ud_t *)DV_calloc(sizeof(H5_daos_io_task_ud_t))))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for I/O task udata struct");
+            task_ud->req = int_req;
+            task_ud->io_type = io_type;
+            task_ud->dset = dset;
+            task_ud->mem_type_id = H5I_INVALID_HID;
+            task_ud->mem_space_id = H5I_INVALID_HID;
+            task_ud->file_space_id = H5I_INVALID_HID;
+            if(io_type == IO_READ)
+                task_ud->buf.rbuf = (void *)buf[i];
+            else
+                task_ud->buf.wbuf = buf[i];
+
+            /* Copy dataspaces and datatype */
+            if((task_ud->mem_type_id = H5Tcopy(mem_type_id[i])) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory type ID");
+            if(mem_space_id[i] == H5S_ALL)
+                task_ud->mem_space_id = H5S_ALL;
+            else if((task_ud->mem_space_id = H5Scopy(mem_space_id[i])) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory space ID");
+            if(file_space_id[i] == H5S_ALL)
+                task_ud->file_space_id = H5S_ALL;
+            else if((task_ud->file_space_id = H5Scopy(file_space_id[i])) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy file space ID");
+
+            /* Create end task for I/O */
+            if(H5_daos_create_task(H5_daos_dset_io_int_end_task, 0, NULL, NULL, NULL, task_ud, &task_ud->end_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finish performing I/O operation");
+
+            /* Create task to perform I/O once the shared first task (and
+             * therefore the dataset open) completes */
+            if(H5_daos_create_task(H5_daos_dset_io_int_task, 1, &first_task, NULL, NULL, task_ud, &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform I/O operation");
+
+            /* Schedule I/O task and give it a reference to req and dset */
+            if(0 != (ret = tse_task_schedule(io_task, false)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to perform I/O operation: %s", H5_daos_err_to_string(ret));
+            end_tasks[nend_tasks++] = task_ud->end_task;
+            dset->obj.item.rc++;
+            int_req->rc++;
+            task_ud = NULL;
+        } /* end else */
+    } /* end for */
+
+done:
+    if(int_req) {
+        /* Create task to wait for the I/O on all datasets */
+        dep_task = first_task;
+        if(nend_tasks > 0) {
+            if(H5_daos_create_task(H5_daos_metatask_autocomplete, (unsigned)nend_tasks, end_tasks,
+                    NULL, NULL, NULL, &dep_task) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create last metatask for multi-dataset I/O");
+            else if(0 != (ret = tse_task_schedule(dep_task, false)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule last metatask for multi-dataset I/O: %s", H5_daos_err_to_string(ret));
+        } /* end if */
+
+        /* Perform collective error check if appropriate */
+        if(collective)
+            if(H5_daos_collective_error_check(&dsets[0]->obj, int_req, &first_task, &dep_task) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't perform collective error check");
+
+        /* Create task to finalize H5 operation */
+        if(H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                NULL, NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if(0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s", H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if(ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the request queue of every other dataset.
+         * Each is gated by its own metatask, which the shared first task
+         * depends on, so no I/O starts until every dataset's earlier
+         * operations are done.  Datasets listed more than once are only
+         * added once. */
+        for(i = 1; i < count; i++) {
+            tse_task_t *gate_task = NULL;
+            size_t j;
+
+            for(j = 0; j < i; j++)
+                if(dsets[j] == dsets[i])
+                    break;
+            if(j < i)
+                continue;
+
+            if(H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL,
+                    NULL, &gate_task) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create gate metatask for multi-dataset I/O");
+            else if(0 != (ret = tse_task_register_deps(first_task, 1, &gate_task))) {
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on gate metatask: %s", H5_daos_err_to_string(ret));
+                if(0 != (ret = tse_task_schedule(gate_task, false)))
+                    D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule gate metatask for multi-dataset I/O: %s", H5_daos_err_to_string(ret));
+            } /* end if */
+            else if(H5_daos_req_enqueue(int_req, gate_task, &dsets[i]->obj.item, op_type,
+                    H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+        } /* end for */
+
+        /* Add the request to the first dataset's request queue.  This will
+         * add the dependency on the first dataset's open if necessary, and
+         * schedule the shared first task. */
+        if(H5_daos_req_enqueue(int_req, first_task, &dsets[0]->obj.item, op_type,
+                H5_DAOS_OP_SCOPE_OBJ, collective, TRUE) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes */
+        if(H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if(int_req->status < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "multi-dataset %s failed in task \"%s\": %s", io_type == IO_READ ? "read" : "write", int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+        /* Release our reference to the internal request */
+        if(H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
+
+    /* Cleanup on error */
+    if(task_ud) {
+        assert(ret_value < 0);
+        if(task_ud->mem_type_id >= 0 && H5Tclose(task_ud->mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        if(task_ud->mem_space_id >= 0 && task_ud->mem_space_id != H5S_ALL && H5Sclose(task_ud->mem_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
+        if(task_ud->file_space_id >= 0 && task_ud->file_space_id != H5S_ALL && H5Sclose(task_ud->file_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close file dataspace");
+        task_ud = DV_free(task_ud);
+    } /* end if */
+
+    end_tasks = DV_free(end_tasks);
+    dsets = DV_free(dsets);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_dataset_read_multi
+ *
+ * Purpose:     Reads raw data from count datasets, all in the same file,
+ *              into the buffers in buf, as a single operation.  Each
+ *              dataset is read with the corresponding entries of
+ *              mem_type_id, mem_space_id and file_space_id, as with
+ *              H5Dread().  The chunk reads for all datasets are issued
+ *              together, so this is faster than calling H5Dread() on
+ *              each dataset when the datasets are small.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_dataset_read_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id, void *buf[])
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(count == 0)
+        D_GOTO_DONE(SUCCEED);
+    if(!dset_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset ID array is NULL");
+    if(!mem_type_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "memory datatype ID array is NULL");
+    if(!mem_space_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "memory dataspace ID array is NULL");
+    if(!file_space_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file dataspace ID array is NULL");
+    if(!buf)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer array is NULL");
+
+    if(H5_daos_dataset_io_multi(count, dset_id, mem_type_id, mem_space_id,
+            file_space_id, dxpl_id, IO_READ, (const void **)buf) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data from datasets");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_dataset_read_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_dataset_write_multi
+ *
+ * Purpose:     Writes raw data from the buffers in buf to count datasets,
+ *              all in the same file, as a single operation.  Each dataset
+ *              is written with the corresponding entries of mem_type_id,
+ *              mem_space_id and file_space_id, as with H5Dwrite().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_dataset_write_multi(size_t count, hid_t dset_id[], hid_t mem_type_id[],
+    hid_t mem_space_id[], hid_t file_space_id[], hid_t dxpl_id, const void *buf[])
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(count == 0)
+        D_GOTO_DONE(SUCCEED);
+    if(!dset_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset ID array is NULL");
+    if(!mem_type_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "memory datatype ID array is NULL");
+    if(!mem_space_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "memory dataspace ID array is NULL");
+    if(!file_space_id)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file dataspace ID array is NULL");
+    if(!buf)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buffer array is NULL");
+
+    if(H5_daos_dataset_io_multi(count, dset_id, mem_type_id, mem_space_id,
+            file_space_id, dxpl_id, IO_WRITE, buf) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data to datasets");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_dataset_write_multi() */
 
 #if H5VL_VERSION >= 2
 
@@ -4549,8 +9266,10 @@ H5_daos_dataset_specific(void *_item, H5VL_dataset_specific_t specific_type,
                     D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
 
 #ifdef H5_DAOS_USE_TRANSACTIONS
-                /* Start transaction */
-                if(0 != (ret = daos_tx_open(dset->obj.item.file->coh, &int_req->th, DAOS_TF_RDONLY, NULL /*event*/)))
+                /* Start transaction.  Refresh writes back the chunk cache if
+                 * it is enabled. */
+                if(0 != (ret = daos_tx_open(dset->obj.item.file->coh, &int_req->th,
+                        dset->chunk_cache.nbytes_max > 0 ? 0 : DAOS_TF_RDONLY, NULL /*event*/)))
                     D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't start transaction");
                 int_req->th_open = TRUE;
 #endif /* H5_DAOS_USE_TRANSACTIONS */
@@ -4587,6 +9306,7 @@ done:
          * dependency on the dataset open if necessary. */
         if(H5_daos_req_enqueue(int_req, first_task, &dset->obj.item,
                 specific_type == H5VL_DATASET_SET_EXTENT || specific_type == H5VL_DATASET_FLUSH
+                || dset->chunk_cache.nbytes_max > 0
                 ? H5_DAOS_OP_TYPE_WRITE_ORDERED : H5_DAOS_OP_TYPE_READ,
                 H5_DAOS_OP_SCOPE_OBJ, must_coll_req, !req) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
@@ -4635,7 +9355,6 @@ done:
 herr_t
 H5_daos_dataset_close_real(H5_daos_dset_t *dset)
 {
-    size_t i;
     int ret;
     herr_t ret_value = SUCCEED;
 
@@ -4646,6 +9365,7 @@ H5_daos_dataset_close_real(H5_daos_dset_t *dset)
 
     if(--dset->obj.item.rc == 0) {
         /* Free dataset data structures */
+        H5_daos_omd_cache_release(&dset->obj);
         if(dset->obj.item.cur_op_pool)
             H5_daos_op_pool_free(dset->obj.item.cur_op_pool);
         if(dset->obj.item.open_req)
@@ -4668,6 +9388,11 @@ H5_daos_dataset_close_real(H5_daos_dset_t *dset)
                 D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dapl");
         if(dset->fill_val)
             dset->fill_val = DV_free(dset->fill_val);
+        H5_daos_filter_pipeline_free(dset->dcpl_cache.pipeline);
+        /* Discard chunk cache.  Dirty chunks have been written back by
+         * H5_daos_dataset_close() */
+        if(H5_daos_chunk_cache_free(dset) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't free chunk cache");
         /* Clear dataset I/O cache */
         if((dset->io_cache.file_sel_iter_id > 0) &&
                 (H5Ssel_iter_close(dset->io_cache.file_sel_iter_id) < 0))
@@ -4675,21 +9400,9 @@ H5_daos_dataset_close_real(H5_daos_dset_t *dset)
         if((dset->io_cache.mem_sel_iter_id > 0) &&
                 (H5Ssel_iter_close(dset->io_cache.mem_sel_iter_id) < 0))
             D_DONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to close selection iterator");
-        if(dset->io_cache.chunk_info && (dset->io_cache.chunk_info != &dset->io_cache.single_chunk_info)) {
-            H5_daos_select_chunk_info_t *chunk_info;
-
-            for (i = 0; i < dset->io_cache.chunk_info_nalloc; i++) {
-                chunk_info = &dset->io_cache.chunk_info[i];
-                if((chunk_info->fspace_id >= 0)
-                        && (H5Sclose(chunk_info->fspace_id) < 0))
-                    D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk file dataspace");
-                if((chunk_info->mspace_id >= 0)
-                        && (H5Sclose(chunk_info->mspace_id) < 0))
-                    D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk memory dataspace");
-            }
-
-            DV_free(dset->io_cache.chunk_info);
-        }
+        if(dset->io_cache.chunk_info && (dset->io_cache.chunk_info != &dset->io_cache.single_chunk_info))
+            if(H5_daos_free_chunk_info(dset->io_cache.chunk_info, dset->io_cache.chunk_info_nalloc) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't free selected chunk info");
         dset = H5FL_FREE(H5_daos_dset_t, dset);
     } /* end if */
 
@@ -4731,13 +9444,15 @@ H5_daos_dataset_close(void *_dset, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
 
     /* Check if the dataset's request queue is NULL, if so we can close it
      * immediately.  Also close if the pool is empty and has no start task (and
-     * hence does not depend on anything).  Also close if it is marked to close
+     * hence does not depend on anything), unless there are chunks in the chunk
+     * cache to write back.  Also close if it is marked to close
      * nonblocking. */
     if(((dset->obj.item.open_req->status == 0
             || dset->obj.item.open_req->status < -H5_DAOS_CANCELED)
             && (!dset->obj.item.cur_op_pool
             || (dset->obj.item.cur_op_pool->type == H5_DAOS_OP_TYPE_EMPTY
-            && !dset->obj.item.cur_op_pool->start_task)))
+            && !dset->obj.item.cur_op_pool->start_task))
+            && !dset->chunk_cache.head)
             || dset->obj.item.nonblocking_close) {
         if(H5_daos_dataset_close_real(dset) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close dataset");
@@ -4756,14 +9471,24 @@ H5_daos_dataset_close(void *_dset, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
         task_ud->req = int_req;
         task_ud->item = &dset->obj.item;
 
+        /* Write back and drop the chunk cache */
+        if(dset->chunk_cache.nbytes_max > 0
+                && H5_daos_chunk_cache_flush(dset, TRUE, 0, NULL, int_req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush chunk cache");
+
         /* Create task to close dataset */
-        if(H5_daos_create_task(H5_daos_object_close_task, 0, NULL, NULL, NULL, task_ud, &close_task) < 0)
+        if(H5_daos_create_task(H5_daos_object_close_task, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                NULL, NULL, task_ud, &close_task) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to close dataset");
 
-        /* Save task to be scheduled later and give it a reference to req and
-         * dset */
-        assert(!first_task);
-        first_task = close_task;
+        /* Schedule close task (or save it to be scheduled later) and give it
+         * a reference to req */
+        if(first_task) {
+            if(0 != (ret = tse_task_schedule(close_task, false)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to close dataset: %s", H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            first_task = close_task;
         dep_task = close_task;
         /* No need to take a reference to dset here since the purpose is to
          * release the API's reference */
@@ -4832,9 +9557,10 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_dataset_flush
  *
- * Purpose:     Flushes a DAOS dataset.  Creates a barrier task so all async
- *              ops created before the flush execute before all async ops
- *              created after the flush.
+ * Purpose:     Flushes a DAOS dataset.  If the dataset has a chunk cache,
+ *              writes back all dirty chunks in it.  Otherwise creates a
+ *              barrier task so all async ops created before the flush
+ *              execute before all async ops created after the flush.
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -4845,14 +9571,21 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_dataset_flush(H5_daos_dset_t H5VL_DAOS_UNUSED *dset,
-    H5_daos_req_t H5VL_DAOS_UNUSED *req, tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_dataset_flush(H5_daos_dset_t *dset, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
 {
     tse_task_t *barrier_task = NULL;
     herr_t ret_value = SUCCEED;
 
     assert(dset);
 
+    /* Write back chunk cache */
+    if(dset->chunk_cache.nbytes_max > 0) {
+        if(H5_daos_chunk_cache_flush(dset, FALSE, 0, NULL, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush chunk cache");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
     /* Create task that does nothing but complete itself.  Only necessary
      * because we can't enqueue a request that has no tasks */
     if(H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL,
@@ -5068,6 +9801,15 @@ H5_daos_dataset_refresh(H5_daos_dset_t *dset, hid_t H5VL_DAOS_UNUSED dxpl_id,
     assert(first_task);
     assert(dep_task);
 
+    /* Drop any cached metadata, so the next open fetches it again */
+    H5_daos_omd_cache_evict(dset->obj.item.file, &dset->obj.oid);
+
+    /* Write back and drop the chunk cache, so data written by other
+     * processes is seen */
+    if(dset->chunk_cache.nbytes_max > 0
+            && H5_daos_chunk_cache_flush(dset, TRUE, 0, NULL, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush chunk cache");
+
     /* Set initial size for dataspace buffer */
     space_buf_size = H5_DAOS_SPACE_BUF_SIZE;
 
@@ -5287,6 +10029,9 @@ H5_daos_dataset_set_extent(H5_daos_dset_t *dset, const hsize_t *size,
     if(!(dset->obj.item.file->flags & H5F_ACC_RDWR))
         D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
 
+    /* The cached dataspace will be out of date */
+    H5_daos_omd_cache_evict(dset->obj.item.file, &dset->obj.oid);
+
     /* Get dataspace rank */
     if((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get current dataspace rank");
@@ -5300,6 +10045,12 @@ H5_daos_dataset_set_extent(H5_daos_dset_t *dset, const hsize_t *size,
         if((maxdims[i] != H5S_UNLIMITED) && (size[i] > maxdims[i]))
             D_GOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "requested dataset dimensions exceed maximum dimensions");
 
+    /* Write back dirty cached chunks and drop those not entirely within the
+     * new extent, before the extent is updated */
+    if(dset->chunk_cache.nbytes_max > 0
+            && H5_daos_chunk_cache_flush(dset, FALSE, 0, size, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't flush chunk cache");
+
     /* Allocate task udata */
     if(NULL == (update_cb_ud = (H5_daos_dset_set_extent_ud_t *)DV_calloc(sizeof(H5_daos_dset_set_extent_ud_t))))
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for dataset set extent udata struct");
@@ -5363,8 +10114,8 @@ H5_daos_dataset_set_extent(H5_daos_dset_t *dset, const hsize_t *size,
         /* Don't need to write dataspace to file, but still need to create a
          * task to update dset->space_id at the right time */
         /* Create empty task (comp_cb will update dset->space_id) */
-        if(H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, H5_daos_dset_set_extent_comp_cb,
-                update_cb_ud, &update_task) < 0)
+        if(H5_daos_create_task(H5_daos_metatask_autocomplete, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                NULL, H5_daos_dset_set_extent_comp_cb, update_cb_ud, &update_task) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform get operation");
     } /* end else */
 
@@ -5497,13 +10248,22 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_get_selected_chunk_info
  *
- * Purpose:     Calculates the starting coordinates for the chunks selected
- *              in the file space given by file_space_id and sets up
- *              individual memory and file spaces for each chunk. Selected
- *              chunk's coordinates and dataspaces are returned through the
- *              `chunk_info` struct pointer.
- *
- *              In order to support caching of all of the file and memory
+ * Purpose:     Calculates the number of chunks selected in the file space
+ *              given by file_space_id, returned in *nchunks_selected,
+ *              and prepares to set up individual memory and file spaces
+ *              for each chunk.
+ *
+ *              The memory and file spaces are not set up here.  Instead,
+ *              *chunk_iter is initialized to iterate over the selected
+ *              chunks and *use_chunk_iter is set to TRUE.  The chunk I/O
+ *              routines then set up the chunk info for each batch of
+ *              chunks as it is issued (see H5_daos_chunk_iter_next()),
+ *              so only the chunks in one batch have dataspaces at any
+ *              time.  *chunk_iter must be released with
+ *              H5_daos_chunk_iter_term() if *use_chunk_iter is TRUE on
+ *              exit.
+ *
+ *              In order to support caching of the file and memory
  *              dataspaces that get created for selected chunks, valid
  *              `chunk_info`/`chunk_info_len` pointers that have been
  *              allocated/set by this routine may be passed in. In this
@@ -5511,19 +10271,16 @@ done:
  *              operations rather than creating new ones. Note that this
  *              assumes that the `chunk_info`/`chunk_info_len` pointers
  *              passed in always come from the same dataset object with the
- *              same chunk dimensionality.
+ *              same chunk dimensionality.  The chunk info array holds at
+ *              least H5_DAOS_CHUNK_IO_BATCH_SIZE entries.
  *
- *              NOTE: In several places in this routine, an adjustment is
- *                    calculated in order to move the selection within a
- *                    chunk around by using H5Sselect_adjust. Since this
- *                    API routine accepts an array of signed values, this
- *                    adjustment is calculated by converting unsigned
- *                    coordinates to signed coordinates without a check
- *                    for overflow. In the future, it would be nice if
- *                    HDF5 could support subtracting and adding of
- *                    offsets to selections with routines that accept
- *                    arrays of unsigned offsets so this can be done
- *                    safely.
+ *              If sel_pattern is not NULL and the file and memory
+ *              selections can be described by a selection pattern (see
+ *              H5_daos_get_chunk_sel_pattern()), the pattern is returned
+ *              in *sel_pattern, *use_sel_pattern is set to TRUE and the
+ *              coordinates of all selected chunks are returned in
+ *              `chunk_info` instead.  The chunk I/O routines then compute
+ *              the selection in each chunk from the pattern.
  *
  *              XXX: Note that performance could be increased by
  *                   calculating all of the chunks in the entire dataset
@@ -5544,32 +10301,27 @@ static herr_t
 H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
     hid_t file_space_id, hid_t mem_space_id,
     H5_daos_select_chunk_info_t **chunk_info, size_t *chunk_info_len,
-    size_t *nchunks_selected)
+    size_t *nchunks_selected, H5_daos_chunk_sel_pattern_t *sel_pattern,
+    hbool_t *use_sel_pattern, H5_daos_chunk_iter_t *chunk_iter,
+    hbool_t *use_chunk_iter)
 {
     H5_daos_select_chunk_info_t *_chunk_info = NULL;
-    H5S_sel_type file_space_type;
     hssize_t  num_sel_points;
-    hssize_t  chunk_file_space_adjust[H5O_LAYOUT_NDIMS];
-    hsize_t   file_space_dims[H5S_MAX_RANK], mem_space_dims[H5S_MAX_RANK];
-    hsize_t   *chunk_dims;
-    hsize_t   curr_chunk_dims[H5S_MAX_RANK] = {0};
-    hsize_t   file_sel_start[H5S_MAX_RANK], file_sel_end[H5S_MAX_RANK];
-    hsize_t   mem_sel_start[H5S_MAX_RANK], mem_sel_end[H5S_MAX_RANK];
-    hsize_t   start_coords[H5O_LAYOUT_NDIMS], end_coords[H5O_LAYOUT_NDIMS];
-    hsize_t   selection_start_coords[H5O_LAYOUT_NDIMS] = {0};
-    hbool_t   is_partial_edge_chunk = FALSE;
-    hbool_t   file_mem_space_same = (file_space_id == mem_space_id);
-    htri_t    space_same_shape = FALSE;
     size_t    chunk_info_nalloc = 0;
-    ssize_t   i = -1, j;
-    hid_t     entire_chunk_sel_space_id = H5I_INVALID_HID;
-    int       fspace_ndims, mspace_ndims;
-    int       increment_dim;
+    size_t    nchunks = 0;
+    size_t    i;
     herr_t    ret_value = SUCCEED;
 
     assert(dcpl_cache);
     assert(chunk_info);
     assert(nchunks_selected);
+    assert(!sel_pattern || use_sel_pattern);
+    assert(chunk_iter);
+    assert(use_chunk_iter);
+
+    if (use_sel_pattern)
+        *use_sel_pattern = FALSE;
+    *use_chunk_iter = FALSE;
 
     if ((num_sel_points = H5Sget_select_npoints(file_space_id)) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "can't get number of points selected in file dataspace");
@@ -5583,7 +10335,7 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
         chunk_info_nalloc = H5_DAOS_DEFAULT_NUM_SEL_CHUNKS;
 
         /* Ensure that every chunk info structure's dataspaces are initialized */
-        for (i = 0; i < (ssize_t)chunk_info_nalloc; i++)
+        for (i = 0; i < chunk_info_nalloc; i++)
             _chunk_info[i].fspace_id = _chunk_info[i].mspace_id = H5I_INVALID_HID;
     } /* end if */
     else {
@@ -5591,43 +10343,129 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
         _chunk_info = *chunk_info;
         chunk_info_nalloc = *chunk_info_len;
     } /* end else */
+    assert(chunk_info_nalloc >= H5_DAOS_CHUNK_IO_BATCH_SIZE);
+
+    /* Check if the selections can be described by a selection pattern.  If
+     * so, the selected chunks can be found arithmetically and no per-chunk
+     * dataspaces need to be built. */
+    if (sel_pattern) {
+        htri_t pattern_ret;
+
+        if ((pattern_ret = H5_daos_get_chunk_sel_pattern(file_space_id, mem_space_id, sel_pattern)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check for selection pattern");
+        if (pattern_ret) {
+            if (H5_daos_get_selected_chunk_info_pattern(dcpl_cache, sel_pattern, num_sel_points,
+                    &_chunk_info, &chunk_info_nalloc, &nchunks) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunks from selection pattern");
+            *use_sel_pattern = TRUE;
+
+            D_GOTO_DONE(SUCCEED);
+        } /* end if */
+    } /* end if */
+
+    /* Set up iterator over the selected chunks and count them */
+    if (H5_daos_chunk_iter_init(chunk_iter, dcpl_cache, file_space_id, mem_space_id, num_sel_points) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize selected chunk iterator");
+    *use_chunk_iter = TRUE;
+    if (H5_daos_chunk_iter_count(chunk_iter, &nchunks) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't count selected chunks");
+
+done:
+    if (ret_value < 0) {
+        if (*use_chunk_iter) {
+            if (H5_daos_chunk_iter_term(chunk_iter) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release selected chunk iterator");
+            *use_chunk_iter = FALSE;
+        } /* end if */
+
+        if (_chunk_info && H5_daos_free_chunk_info(_chunk_info, chunk_info_nalloc) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free selected chunk info");
+        *chunk_info = NULL;
+        if (chunk_info_len) *chunk_info_len = 0;
+    }
+    else {
+        if (_chunk_info)
+            *chunk_info = _chunk_info;
+        if (chunk_info_len && _chunk_info)
+            *chunk_info_len = chunk_info_nalloc;
+
+        *nchunks_selected = nchunks;
+    }
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_selected_chunk_info() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_iter_init
+ *
+ * Purpose:     Initializes an iterator over the chunks selected in the
+ *              file space given by file_space_id, which has
+ *              num_sel_points elements selected.  The iterator refers to
+ *              file_space_id and mem_space_id, so these must stay open
+ *              until it is released with H5_daos_chunk_iter_term(), or
+ *              copied with H5_daos_chunk_iter_copy().
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_iter_init(H5_daos_chunk_iter_t *iter,
+    const H5_daos_dcpl_cache_t *dcpl_cache, hid_t file_space_id,
+    hid_t mem_space_id, hssize_t num_sel_points)
+{
+    hsize_t   mem_sel_start[H5S_MAX_RANK], mem_sel_end[H5S_MAX_RANK];
+    hbool_t   file_mem_space_same = (file_space_id == mem_space_id);
+    int       i;
+    herr_t    ret_value = SUCCEED;
+
+    assert(iter);
+    assert(dcpl_cache);
+    assert(num_sel_points > 0);
+
+    memset(iter, 0, sizeof(*iter));
+    iter->file_space_id = file_space_id;
+    iter->mem_space_id = mem_space_id;
+    iter->own_spaces = FALSE;
+    iter->space_same_shape = FALSE;
+    iter->entire_chunk_sel_space_id = H5I_INVALID_HID;
+    iter->num_sel_points = num_sel_points;
 
     /* Get dataspace ranks */
-    if ((fspace_ndims = H5Sget_simple_extent_ndims(file_space_id)) < 0)
+    if ((iter->fspace_ndims = H5Sget_simple_extent_ndims(file_space_id)) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file space dimensionality");
     if (file_mem_space_same)
-        mspace_ndims = fspace_ndims;
-    else if ((mspace_ndims = H5Sget_simple_extent_ndims(mem_space_id)) < 0)
+        iter->mspace_ndims = iter->fspace_ndims;
+    else if ((iter->mspace_ndims = H5Sget_simple_extent_ndims(mem_space_id)) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory space dimensionality");
 
     /* Get dataspace dimensionality */
-    if (H5Sget_simple_extent_dims(file_space_id, file_space_dims, NULL) < 0)
+    if (H5Sget_simple_extent_dims(file_space_id, iter->file_space_dims, NULL) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file dataspace dimensions");
     if (file_mem_space_same)
-        memcpy(mem_space_dims, file_space_dims, (size_t)fspace_ndims * sizeof(hsize_t));
-    else if (H5Sget_simple_extent_dims(mem_space_id, mem_space_dims, NULL) < 0)
+        memcpy(iter->mem_space_dims, iter->file_space_dims, (size_t)iter->fspace_ndims * sizeof(hsize_t));
+    else if (H5Sget_simple_extent_dims(mem_space_id, iter->mem_space_dims, NULL) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory dataspace dimensions");
 
     /* Get the bounding box for the current selection in the file and memory spaces */
-    if (H5Sget_select_bounds(file_space_id, file_sel_start, file_sel_end) < 0)
+    if (H5Sget_select_bounds(file_space_id, iter->file_sel_start, iter->file_sel_end) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get bounding box for file selection");
     if (file_mem_space_same) {
-        memcpy(mem_sel_start, file_sel_start, (size_t)fspace_ndims * sizeof(hsize_t));
-        memcpy(mem_sel_end, file_sel_end, (size_t)fspace_ndims * sizeof(hsize_t));
+        memcpy(mem_sel_start, iter->file_sel_start, (size_t)iter->fspace_ndims * sizeof(hsize_t));
+        memcpy(mem_sel_end, iter->file_sel_end, (size_t)iter->fspace_ndims * sizeof(hsize_t));
     } /* end if */
     else if (H5Sget_select_bounds(mem_space_id, mem_sel_start, mem_sel_end) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get bounding box for memory selection");
 
-    /* Set convenience pointer to chunk dimensions */
-    chunk_dims = dcpl_cache->chunk_dims;
-
-    /* Initialize the curr_chunk_dims array */
-    memcpy(curr_chunk_dims, chunk_dims, (size_t)fspace_ndims * sizeof(hsize_t));
+    /* Copy the chunk dimensions */
+    memcpy(iter->chunk_dims, dcpl_cache->chunk_dims, (size_t)iter->fspace_ndims * sizeof(hsize_t));
 
     /* Calculate the coordinates for the initial chunk */
-    for (i = 0; i < (ssize_t)fspace_ndims; i++) {
-        start_coords[i] = selection_start_coords[i] = (file_sel_start[i] / chunk_dims[i]) * chunk_dims[i];
-        end_coords[i] = (start_coords[i] + chunk_dims[i]) - 1;
+    for (i = 0; i < iter->fspace_ndims; i++) {
+        iter->start_coords[i] = iter->selection_start_coords[i] = (iter->file_sel_start[i] / iter->chunk_dims[i]) * iter->chunk_dims[i];
+        iter->end_coords[i] = (iter->start_coords[i] + iter->chunk_dims[i]) - 1;
     } /* end for */
 
     /* Check if the spaces are the same "shape".  For now, reject spaces that
@@ -5635,61 +10473,288 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
      * H5S_select_construct_projection().  See the note in H5D__read().  With
      * the use of H5Sselect_project_intersection() the performance penalty
      * should be much less than with the native library anyways. */
-    if(fspace_ndims == mspace_ndims) {
+    if(iter->fspace_ndims == iter->mspace_ndims) {
         if(file_mem_space_same)
-            space_same_shape = TRUE;
-        else if(FAIL == (space_same_shape = H5Sselect_shape_same(file_space_id, mem_space_id)))
+            iter->space_same_shape = TRUE;
+        else if(FAIL == (iter->space_same_shape = H5Sselect_shape_same(file_space_id, mem_space_id)))
             D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "can't determine if file and memory dataspaces are the same shape");
     } /* end if */
 
-    if(space_same_shape) {
+    if(iter->space_same_shape) {
         /* Calculate the adjustment for the memory selection from the file selection */
-        for (i = 0; i < (ssize_t)fspace_ndims; i++) {
+        for (i = 0; i < iter->fspace_ndims; i++) {
             /* H5_CHECK_OVERFLOW(file_sel_start[i], hsize_t, hssize_t); */
             /* H5_CHECK_OVERFLOW(mem_sel_start[i], hsize_t, hssize_t); */
-            chunk_file_space_adjust[i] = (hssize_t) file_sel_start[i] - (hssize_t) mem_sel_start[i];
+            iter->chunk_file_space_adjust[i] = (hssize_t) iter->file_sel_start[i] - (hssize_t) mem_sel_start[i];
         } /* end for */
     } /* end if */
     else {
         /* Create temporary dataspace to hold selection of entire chunk */
-        if((entire_chunk_sel_space_id = H5Screate_simple(fspace_ndims, file_space_dims, NULL)) < 0)
+        if((iter->entire_chunk_sel_space_id = H5Screate_simple(iter->fspace_ndims, iter->file_space_dims, NULL)) < 0)
             D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't create entire chunk selection dataspace");
     } /* end else */
 
     /* Get file selection type */
-    if((file_space_type = H5Sget_select_type(file_space_id)) < 0)
+    if((iter->file_space_type = H5Sget_select_type(file_space_id)) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection type");
 
+done:
+    if(ret_value < 0 && H5_daos_chunk_iter_term(iter) < 0)
+        D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't release selected chunk iterator");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_iter_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_iter_copy
+ *
+ * Purpose:     Copies the selected chunk iterator src into dst, including
+ *              its position.  dst owns copies of the file and memory
+ *              dataspaces, so src's dataspaces may be closed afterwards.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_iter_copy(H5_daos_chunk_iter_t *dst,
+    const H5_daos_chunk_iter_t *src)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(dst);
+    assert(src);
+
+    *dst = *src;
+    dst->file_space_id = H5I_INVALID_HID;
+    dst->mem_space_id = H5I_INVALID_HID;
+    dst->entire_chunk_sel_space_id = H5I_INVALID_HID;
+    dst->own_spaces = TRUE;
+
+    if((dst->file_space_id = H5Scopy(src->file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy file dataspace");
+    if(src->mem_space_id == src->file_space_id)
+        dst->mem_space_id = dst->file_space_id;
+    else if((dst->mem_space_id = H5Scopy(src->mem_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy memory dataspace");
+    if(src->entire_chunk_sel_space_id >= 0
+            && (dst->entire_chunk_sel_space_id = H5Scopy(src->entire_chunk_sel_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "can't copy entire chunk selection dataspace");
+
+done:
+    if(ret_value < 0 && H5_daos_chunk_iter_term(dst) < 0)
+        D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't release selected chunk iterator");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_iter_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_iter_term
+ *
+ * Purpose:     Releases the dataspaces held by a selected chunk
+ *              iterator.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_iter_term(H5_daos_chunk_iter_t *iter)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(iter);
+
+    if((iter->entire_chunk_sel_space_id >= 0) && (H5Sclose(iter->entire_chunk_sel_space_id) < 0))
+        D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "failed to close temporary entire chunk dataspace");
+    iter->entire_chunk_sel_space_id = H5I_INVALID_HID;
+
+    if(iter->own_spaces) {
+        if((iter->mem_space_id >= 0) && (iter->mem_space_id != iter->file_space_id)
+                && (H5Sclose(iter->mem_space_id) < 0))
+            D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "failed to close memory dataspace");
+        if((iter->file_space_id >= 0) && (H5Sclose(iter->file_space_id) < 0))
+            D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "failed to close file dataspace");
+        iter->own_spaces = FALSE;
+    } /* end if */
+    iter->file_space_id = H5I_INVALID_HID;
+    iter->mem_space_id = H5I_INVALID_HID;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_iter_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_iter_advance
+ *
+ * Purpose:     Moves start_coords and end_coords to the next chunk, in
+ *              row-major order, within the bounding box of the file
+ *              selection of iter.
+ *
+ * Return:      TRUE if there is a next chunk, FALSE if start_coords was
+ *              the last chunk in the bounding box
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_chunk_iter_advance(const H5_daos_chunk_iter_t *iter,
+    hsize_t *start_coords, hsize_t *end_coords)
+{
+    int increment_dim;
+
+    assert(iter);
+    assert(start_coords);
+    assert(end_coords);
+
+    /* Set current increment dimension */
+    increment_dim = iter->fspace_ndims - 1;
+
+    /* Increment chunk location in fastest changing dimension */
+    start_coords[increment_dim] += iter->chunk_dims[increment_dim];
+    end_coords[increment_dim] += iter->chunk_dims[increment_dim];
+
+    /* Bring chunk location back into bounds, if necessary */
+    while (start_coords[increment_dim] > iter->file_sel_end[increment_dim]) {
+        /* Reset current dimension's location to 0 */
+        start_coords[increment_dim] = iter->selection_start_coords[increment_dim];
+        end_coords[increment_dim] = (start_coords[increment_dim] + iter->chunk_dims[increment_dim]) - 1;
+
+        /* Decrement current dimension */
+        if(increment_dim == 0)
+            return FALSE;
+        increment_dim--;
+
+        /* Increment chunk location in current dimension */
+        start_coords[increment_dim] += iter->chunk_dims[increment_dim];
+        end_coords[increment_dim] = (start_coords[increment_dim] + iter->chunk_dims[increment_dim]) - 1;
+    } /* end while */
+
+    return TRUE;
+} /* end H5_daos_chunk_iter_advance() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_iter_count
+ *
+ * Purpose:     Counts the chunks selected from the current position of
+ *              iter onward, without moving iter or setting up any
+ *              dataspaces.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_iter_count(const H5_daos_chunk_iter_t *iter, size_t *nchunks)
+{
+    hsize_t start_coords[H5O_LAYOUT_NDIMS], end_coords[H5O_LAYOUT_NDIMS];
+    htri_t  intersect;
+    size_t  count = 0;
+    int     i;
+    herr_t  ret_value = SUCCEED;
+
+    assert(iter);
+    assert(nchunks);
+
+    if(iter->num_sel_points == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* With an "all" selection every chunk in the bounding box is selected */
+    if(iter->file_space_type == H5S_SEL_ALL) {
+        assert(!memcmp(iter->start_coords, iter->selection_start_coords, (size_t)iter->fspace_ndims * sizeof(hsize_t)));
+        count = 1;
+        for(i = 0; i < iter->fspace_ndims; i++)
+            count *= (size_t)((iter->file_sel_end[i] / iter->chunk_dims[i])
+                    - (iter->file_sel_start[i] / iter->chunk_dims[i]) + 1);
+
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    memcpy(start_coords, iter->start_coords, (size_t)iter->fspace_ndims * sizeof(hsize_t));
+    memcpy(end_coords, iter->end_coords, (size_t)iter->fspace_ndims * sizeof(hsize_t));
+
+    /* Check each chunk in the bounding box for intersection with the file
+     * selection */
+    do {
+        if((intersect = H5Sselect_intersect_block(iter->file_space_id, start_coords, end_coords)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "cannot determine chunk's intersection with the file dataspace");
+        if(intersect)
+            count++;
+    } while(H5_daos_chunk_iter_advance(iter, start_coords, end_coords));
+
+    if(count == 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "no chunks intersect the file selection");
+
+done:
+    *nchunks = count;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_iter_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_iter_next
+ *
+ * Purpose:     Sets up the chunk info for the next nchunks selected
+ *              chunks of iter in chunk_info[0] through
+ *              chunk_info[nchunks - 1], setting up individual memory and
+ *              file spaces for each chunk, and advances iter past them.
+ *              Dataspaces already present in the chunk info structures
+ *              are re-used where possible.  It is an error to request
+ *              more chunks than remain selected.
+ *
+ *              NOTE: In several places in this routine, an adjustment is
+ *                    calculated in order to move the selection within a
+ *                    chunk around by using H5Sselect_adjust. Since this
+ *                    API routine accepts an array of signed values, this
+ *                    adjustment is calculated by converting unsigned
+ *                    coordinates to signed coordinates without a check
+ *                    for overflow. In the future, it would be nice if
+ *                    HDF5 could support subtracting and adding of
+ *                    offsets to selections with routines that accept
+ *                    arrays of unsigned offsets so this can be done
+ *                    safely.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_iter_next(H5_daos_chunk_iter_t *iter,
+    H5_daos_select_chunk_info_t *chunk_info, size_t nchunks)
+{
+    H5_daos_select_chunk_info_t *curr_chunk_info;
+    hssize_t  chunk_space_adjust[H5O_LAYOUT_NDIMS];
+    hsize_t   curr_chunk_dims[H5S_MAX_RANK];
+    hbool_t   is_partial_edge_chunk;
+    size_t    i = 0;
+    int       j;
+    herr_t    ret_value = SUCCEED;
+
+    assert(iter);
+    assert(chunk_info || nchunks == 0);
+
     /* Iterate through each "chunk" in the dataset */
-    for(i = -1; ; ) {
+    while(i < nchunks) {
         htri_t intersect = FALSE;
 
+        if(iter->num_sel_points == 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "requested more chunks than are selected");
+
         /* Check for intersection of file selection and "chunk". If there is
          * an intersection, set up a valid memory and file space for the chunk. */
-        if (file_space_type == H5S_SEL_ALL)
+        if (iter->file_space_type == H5S_SEL_ALL)
             intersect = TRUE;
-        else if((intersect = H5Sselect_intersect_block(file_space_id, start_coords, end_coords)) < 0)
+        else if((intersect = H5Sselect_intersect_block(iter->file_space_id, iter->start_coords, iter->end_coords)) < 0)
             D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "cannot determine chunk's intersection with the file dataspace");
         if (TRUE == intersect) {
-            hssize_t chunk_space_adjust[H5O_LAYOUT_NDIMS];
-
-            /* Advance index and re-allocate selected chunk info buffer if necessary */
-            if(++i == (ssize_t)chunk_info_nalloc) {
-                void *tmp_realloc;
-
-                if (NULL == (tmp_realloc = DV_realloc(_chunk_info, 2 * chunk_info_nalloc * sizeof(*_chunk_info))))
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't reallocate space for selected chunk info buffer");
-                _chunk_info = (H5_daos_select_chunk_info_t *)tmp_realloc;
-
-                /* Ensure newly-allocated chunk info structures are initialized */
-                memset(&_chunk_info[chunk_info_nalloc], 0, chunk_info_nalloc * sizeof(*_chunk_info));
-                for (j = (ssize_t)chunk_info_nalloc; j < (ssize_t)chunk_info_nalloc * 2; j++)
-                    _chunk_info[j].fspace_id = _chunk_info[j].mspace_id = H5I_INVALID_HID;
-
-                chunk_info_nalloc *= 2;
-            } /* end while */
-
-            assert(i < (ssize_t)chunk_info_nalloc);
+            curr_chunk_info = &chunk_info[i];
 
             /*
              * Set up the file Dataspace for this chunk.
@@ -5702,30 +10767,33 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
              * the correct offset within the chunk, if necessary (for point and hyperslab
              * selections).
              */
-            for(j = 0; j < (ssize_t)fspace_ndims; j++) {
-                if(start_coords[j] + chunk_dims[j] > file_space_dims[j]) {
-                    curr_chunk_dims[j] = file_space_dims[j] - start_coords[j];
+            is_partial_edge_chunk = FALSE;
+            for(j = 0; j < iter->fspace_ndims; j++) {
+                if(iter->start_coords[j] + iter->chunk_dims[j] > iter->file_space_dims[j]) {
+                    curr_chunk_dims[j] = iter->file_space_dims[j] - iter->start_coords[j];
                     is_partial_edge_chunk = TRUE;
                 } /* end if */
-                chunk_space_adjust[j] = (hssize_t)start_coords[j];
+                else
+                    curr_chunk_dims[j] = iter->chunk_dims[j];
+                chunk_space_adjust[j] = (hssize_t)iter->start_coords[j];
             } /* end for */
 
-            switch (file_space_type) {
+            switch (iter->file_space_type) {
                 case H5S_SEL_POINTS:
                     /* Close file space if cached */
-                    if (_chunk_info[i].fspace_id >= 0) {
-                        if (H5Sclose(_chunk_info[i].fspace_id) < 0)
+                    if (curr_chunk_info->fspace_id >= 0) {
+                        if (H5Sclose(curr_chunk_info->fspace_id) < 0)
                             D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk file dataspace");
-                        _chunk_info[i].fspace_id = H5I_INVALID_HID;
+                        curr_chunk_info->fspace_id = H5I_INVALID_HID;
                     } /* end if */
 
                     /* Intersect points with block using connector routine */
-                    if ((_chunk_info[i].fspace_id = H5_daos_point_and_block(file_space_id, (hsize_t)fspace_ndims,
-                            chunk_dims, start_coords, curr_chunk_dims)) < 0)
+                    if ((curr_chunk_info->fspace_id = H5_daos_point_and_block(iter->file_space_id, (hsize_t)iter->fspace_ndims,
+                            iter->chunk_dims, iter->start_coords, curr_chunk_dims)) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't intersect point selection");
 
                     /* Move selection back to have correct offset in chunk */
-                    if (H5Sselect_adjust(_chunk_info[i].fspace_id, chunk_space_adjust) < 0)
+                    if (H5Sselect_adjust(curr_chunk_info->fspace_id, chunk_space_adjust) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection");
 
                     break;
@@ -5733,23 +10801,23 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
                 case H5S_SEL_HYPERSLABS:
                 {
                     /* Create chunk file dataspace if one isn't cached */
-                    if (_chunk_info[i].fspace_id < 0)
-                        if ((_chunk_info[i].fspace_id = H5Screate_simple(fspace_ndims, chunk_dims, NULL)) < 0)
+                    if (curr_chunk_info->fspace_id < 0)
+                        if ((curr_chunk_info->fspace_id = H5Screate_simple(iter->fspace_ndims, iter->chunk_dims, NULL)) < 0)
                             D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't create temporary chunk selection");
 
                     /* Select all elements within this chunk's file dataspace as
                      * a hyperslab (accounting for partial edge chunks) */
-                    if (H5Sselect_hyperslab(_chunk_info[i].fspace_id, H5S_SELECT_SET,
-                            start_coords, NULL, curr_chunk_dims, NULL) < 0)
+                    if (H5Sselect_hyperslab(curr_chunk_info->fspace_id, H5S_SELECT_SET,
+                            iter->start_coords, NULL, curr_chunk_dims, NULL) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't set selection in chunk file dataspace");
 
                     /* Refine chunk file dataspace selection with only elements
                      * that are also selected in whole file dataspace */
-                    if (H5Smodify_select(_chunk_info[i].fspace_id, H5S_SELECT_AND, file_space_id) < 0)
+                    if (H5Smodify_select(curr_chunk_info->fspace_id, H5S_SELECT_AND, iter->file_space_id) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't refine chunk file dataspace selection");
 
                     /* Move selection back to have correct offset in chunk */
-                    if (H5Sselect_adjust(_chunk_info[i].fspace_id, chunk_space_adjust) < 0)
+                    if (H5Sselect_adjust(curr_chunk_info->fspace_id, chunk_space_adjust) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection");
 
                     break;
@@ -5759,19 +10827,19 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
                 {
                     hsize_t zero_offset_start[H5S_MAX_RANK] = { 0 };
 
-                    if (_chunk_info[i].fspace_id < 0) {
+                    if (curr_chunk_info->fspace_id < 0) {
                         /* Create chunk dataspace with full chunk dimensions */
-                        if ((_chunk_info[i].fspace_id = H5Screate_simple(fspace_ndims, chunk_dims, NULL)) < 0)
+                        if ((curr_chunk_info->fspace_id = H5Screate_simple(iter->fspace_ndims, iter->chunk_dims, NULL)) < 0)
                             D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't create temporary chunk selection");
 
                         /* Trim selection down to partial edge chunk size if necessary */
-                        if (is_partial_edge_chunk && H5Sselect_hyperslab(_chunk_info[i].fspace_id,
+                        if (is_partial_edge_chunk && H5Sselect_hyperslab(curr_chunk_info->fspace_id,
                                 H5S_SELECT_SET, zero_offset_start, NULL, curr_chunk_dims, NULL) < 0)
                             D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select partial edge chunk from temporary selection");
                     } /* end if */
                     else {
                         /* Reset selection for cached chunk file dataspace to current chunk dimensions */
-                        if (H5Sselect_hyperslab(_chunk_info[i].fspace_id, H5S_SELECT_SET,
+                        if (H5Sselect_hyperslab(curr_chunk_info->fspace_id, H5S_SELECT_SET,
                                 zero_offset_start, NULL, curr_chunk_dims, NULL) < 0)
                             D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't set chunk file dataspace selection");
                     } /* end else */
@@ -5787,15 +10855,15 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
             } /* end switch */
 
             /* Copy the chunk's coordinates to the selected chunk info buffer */
-            memcpy(_chunk_info[i].chunk_coords, start_coords, (size_t) fspace_ndims * sizeof(hsize_t));
+            memcpy(curr_chunk_info->chunk_coords, iter->start_coords, (size_t)iter->fspace_ndims * sizeof(hsize_t));
 
             /*
              * Now set up the memory Dataspace for this chunk.
              */
-            if (space_same_shape) {
-                if (_chunk_info[i].mspace_id < 0) {
+            if (iter->space_same_shape) {
+                if (curr_chunk_info->mspace_id < 0) {
                     /* Create new memory dataspace */
-                    if ((_chunk_info[i].mspace_id = H5Screate_simple(mspace_ndims, mem_space_dims, NULL)) < 0)
+                    if ((curr_chunk_info->mspace_id = H5Screate_simple(iter->mspace_ndims, iter->mem_space_dims, NULL)) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't create chunk memory dataspace");
                 } /* end if */
                 else {
@@ -5805,32 +10873,32 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
                      * as the current memory dataspace's extent; resize the cached
                      * memory dataspace if not.
                      */
-                    if ((extents_equal = H5Sextent_equal(_chunk_info[i].mspace_id, mem_space_id)) < 0)
+                    if ((extents_equal = H5Sextent_equal(curr_chunk_info->mspace_id, iter->mem_space_id)) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check if memory dataspaces have the same extent");
 
-                    if (!extents_equal && H5Sset_extent_simple(_chunk_info[i].mspace_id,
-                            mspace_ndims, mem_space_dims, NULL) < 0)
+                    if (!extents_equal && H5Sset_extent_simple(curr_chunk_info->mspace_id,
+                            iter->mspace_ndims, iter->mem_space_dims, NULL) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk memory dataspace dimensions");
                 } /* end else */
 
-                if (H5S_SEL_ALL == file_space_type) {
+                if (H5S_SEL_ALL == iter->file_space_type) {
                     /* Set selection to same shape as chunk's file dataspace selection */
-                    if (H5Sselect_hyperslab(_chunk_info[i].mspace_id, H5S_SELECT_SET, start_coords, NULL, curr_chunk_dims, NULL) < 0)
+                    if (H5Sselect_hyperslab(curr_chunk_info->mspace_id, H5S_SELECT_SET, iter->start_coords, NULL, curr_chunk_dims, NULL) < 0)
                         D_GOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't create chunk memory selection");
                 } /* end if */
                 else {
                     /* Copy the chunk's file space selection to its memory space selection */
-                    if (H5Sselect_copy(_chunk_info[i].mspace_id, _chunk_info[i].fspace_id) < 0)
+                    if (H5Sselect_copy(curr_chunk_info->mspace_id, curr_chunk_info->fspace_id) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy selection from temporary chunk's file dataspace to its memory dataspace");
 
                     /* Compute the adjustment for the chunk */
-                    for (j = 0; j < (ssize_t)fspace_ndims; j++) {
-                        /* H5_CHECK_OVERFLOW(_chunk_info[i].chunk_coords[j], hsize_t, hssize_t); */
-                        chunk_space_adjust[j] = chunk_file_space_adjust[j] - (hssize_t) _chunk_info[i].chunk_coords[j];
+                    for (j = 0; j < iter->fspace_ndims; j++) {
+                        /* H5_CHECK_OVERFLOW(curr_chunk_info->chunk_coords[j], hsize_t, hssize_t); */
+                        chunk_space_adjust[j] = iter->chunk_file_space_adjust[j] - (hssize_t) curr_chunk_info->chunk_coords[j];
                     } /* end for */
 
                     /* Adjust the selection */
-                    if (H5Sselect_adjust(_chunk_info[i].mspace_id, chunk_space_adjust) < 0)
+                    if (H5Sselect_adjust(curr_chunk_info->mspace_id, chunk_space_adjust) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust temporary chunk's memory space selection");
                 } /* end else */
             } /* end if */
@@ -5838,96 +10906,187 @@ H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache,
                 /* Select this chunk in the temporary chunk selection dataspace.
                  * Shouldn't matter if it goes beyond the extent since we're not
                  * doing I/O with this space */
-                if (H5Sselect_hyperslab(entire_chunk_sel_space_id, H5S_SELECT_SET, start_coords, NULL, chunk_dims, NULL) < 0)
+                if (H5Sselect_hyperslab(iter->entire_chunk_sel_space_id, H5S_SELECT_SET, iter->start_coords, NULL, iter->chunk_dims, NULL) < 0)
                     D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select entire chunk");
 
                 /* Close memory space if cached */
-                if (_chunk_info[i].mspace_id >= 0) {
-                    if (H5Sclose(_chunk_info[i].mspace_id) < 0)
+                if (curr_chunk_info->mspace_id >= 0) {
+                    if (H5Sclose(curr_chunk_info->mspace_id) < 0)
                         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk memory dataspace");
-                    _chunk_info[i].mspace_id = H5I_INVALID_HID;
+                    curr_chunk_info->mspace_id = H5I_INVALID_HID;
                 } /* end if */
 
                 /* Calculate memory selection for this chunk by projecting
                  * intersection of full file selection and file chunk to full
                  * memory selection */
-                if((_chunk_info[i].mspace_id = H5Sselect_project_intersection(file_space_id, mem_space_id, entire_chunk_sel_space_id)) < 0)
+                if((curr_chunk_info->mspace_id = H5Sselect_project_intersection(iter->file_space_id, iter->mem_space_id, iter->entire_chunk_sel_space_id)) < 0)
                     D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't project intersection");
             } /* end else */
 
             /* Determine if there are more chunks to process */
-            if ((_chunk_info[i].num_elem_sel_file = H5Sget_select_npoints(_chunk_info[i].fspace_id)) < 0)
+            if ((curr_chunk_info->num_elem_sel_file = H5Sget_select_npoints(curr_chunk_info->fspace_id)) < 0)
                 D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of points selected in chunk file space");
 
             /* Make sure we didn't process too many points */
-            if(_chunk_info[i].num_elem_sel_file > num_sel_points)
+            if(curr_chunk_info->num_elem_sel_file > iter->num_sel_points)
                 D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "processed more elements than present in selection");
 
             /* Keep track of the number of elements processed */
-            num_sel_points -= _chunk_info[i].num_elem_sel_file;
+            iter->num_sel_points -= curr_chunk_info->num_elem_sel_file;
+            i++;
 
-            /* Break out if we're done */
-            if(num_sel_points == 0)
-                break;
-
-            /* Clean up after partial edge chunk */
-            if(is_partial_edge_chunk) {
-                memcpy(curr_chunk_dims, chunk_dims, (size_t)fspace_ndims * sizeof(hsize_t));
-                is_partial_edge_chunk = FALSE;
-            } /* end if */
+            /* Stay on the last chunk if we're done */
+            if(iter->num_sel_points == 0)
+                continue;
         } /* end if */
 
-        /* Set current increment dimension */
-        increment_dim = fspace_ndims - 1;
+        /* Move to the next chunk */
+        if(!H5_daos_chunk_iter_advance(iter, iter->start_coords, iter->end_coords))
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "did not find enough elements to process or error traversing chunks");
+    } /* end while */
 
-        /* Increment chunk location in fastest changing dimension */
-        start_coords[increment_dim] += chunk_dims[increment_dim];
-        end_coords[increment_dim] += chunk_dims[increment_dim];
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_iter_next() */
 
-        /* Bring chunk location back into bounds, if necessary */
-        if (start_coords[increment_dim] > file_sel_end[increment_dim]) {
-            do {
-                /* Reset current dimension's location to 0 */
-                start_coords[increment_dim] = selection_start_coords[increment_dim];
-                end_coords[increment_dim] = (start_coords[increment_dim] + chunk_dims[increment_dim]) - 1;
-
-                /* Decrement current dimension */
-                if(increment_dim == 0)
-                    D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "did not find enough elements to process or error traversing chunks");
-                increment_dim--;
-
-                /* Increment chunk location in current dimension */
-                start_coords[increment_dim] += chunk_dims[increment_dim];
-                end_coords[increment_dim] = (start_coords[increment_dim] + chunk_dims[increment_dim]) - 1;
-            } while (start_coords[increment_dim] > file_sel_end[increment_dim]);
-        } /* end if */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_selected_chunk_info_pattern
+ *
+ * Purpose:     Same as H5_daos_get_selected_chunk_info(), but enumerates
+ *              the chunks selected by the selection pattern sel_pattern
+ *              arithmetically, without creating or modifying any
+ *              dataspaces.  Only the chunk_coords and num_elem_sel_file
+ *              fields of each chunk info structure are filled in; the
+ *              selections within each chunk are computed from
+ *              sel_pattern when the I/O is performed.  *chunk_info must
+ *              already be allocated.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_get_selected_chunk_info_pattern(H5_daos_dcpl_cache_t *dcpl_cache,
+    const H5_daos_chunk_sel_pattern_t *sel_pattern, hssize_t num_sel_points,
+    H5_daos_select_chunk_info_t **chunk_info, size_t *chunk_info_nalloc,
+    size_t *nchunks_selected)
+{
+    hsize_t *chunk_dims;
+    hsize_t *dim_chunk_buf = NULL;
+    hsize_t *dim_chunk_coords[H5S_MAX_RANK];
+    hsize_t *dim_chunk_nelem[H5S_MAX_RANK];
+    size_t dim_nchunks[H5S_MAX_RANK];
+    size_t cur_chunk[H5S_MAX_RANK];
+    size_t dim_buf_nalloc = 0;
+    size_t nchunks = 0;
+    hsize_t first_block;
+    hsize_t last_block;
+    hsize_t coord;
+    hsize_t sel_end;
+    hsize_t nelem;
+    int i;
+    herr_t ret_value = SUCCEED;
+
+    assert(dcpl_cache);
+    assert(sel_pattern);
+    assert(chunk_info && *chunk_info);
+    assert(chunk_info_nalloc && *chunk_info_nalloc > 0);
+    assert(nchunks_selected);
+
+    chunk_dims = dcpl_cache->chunk_dims;
+
+    /* Allocate buffer for the coordinates and number of elements selected in
+     * each chunk in each dimension, sized for all chunks spanned by the
+     * selection bounds */
+    for(i = 0; i < sel_pattern->ndims; i++) {
+        sel_end = sel_pattern->file_start[i] + ((sel_pattern->count[i] - 1) * sel_pattern->stride[i]) + sel_pattern->block[i] - 1;
+        dim_buf_nalloc += (size_t)((sel_end / chunk_dims[i]) - (sel_pattern->file_start[i] / chunk_dims[i]) + 1);
+    } /* end for */
+    if(NULL == (dim_chunk_buf = (hsize_t *)DV_malloc(2 * dim_buf_nalloc * sizeof(hsize_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for per-dimension chunk lists");
+
+    /* Build lists of the chunks in each dimension that contain selected
+     * elements.  With a strided selection, chunks that fall entirely
+     * between blocks are skipped. */
+    dim_buf_nalloc = 0;
+    for(i = 0; i < sel_pattern->ndims; i++) {
+        dim_chunk_coords[i] = &dim_chunk_buf[dim_buf_nalloc];
+        dim_nchunks[i] = 0;
+        sel_end = sel_pattern->file_start[i] + ((sel_pattern->count[i] - 1) * sel_pattern->stride[i]) + sel_pattern->block[i] - 1;
+        for(coord = (sel_pattern->file_start[i] / chunk_dims[i]) * chunk_dims[i];
+                coord <= sel_end; coord += chunk_dims[i])
+            if(H5_daos_chunk_sel_pattern_clip(sel_pattern, i, coord,
+                    MIN(coord + chunk_dims[i], sel_pattern->file_dims[i]) - 1,
+                    &first_block, &last_block) > 0)
+                dim_chunk_coords[i][dim_nchunks[i]++] = coord;
+        if(dim_nchunks[i] == 0)
+            D_GOTO_DONE(SUCCEED);
+        dim_buf_nalloc += dim_nchunks[i];
+    } /* end for */
+    for(i = 0; i < sel_pattern->ndims; i++) {
+        dim_chunk_nelem[i] = &dim_chunk_buf[dim_buf_nalloc];
+        dim_buf_nalloc += dim_nchunks[i];
+        for(cur_chunk[i] = 0; cur_chunk[i] < dim_nchunks[i]; cur_chunk[i]++) {
+            coord = dim_chunk_coords[i][cur_chunk[i]];
+            dim_chunk_nelem[i][cur_chunk[i]] = H5_daos_chunk_sel_pattern_clip(sel_pattern, i, coord,
+                    MIN(coord + chunk_dims[i], sel_pattern->file_dims[i]) - 1,
+                    &first_block, &last_block);
+        } /* end for */
+        cur_chunk[i] = 0;
     } /* end for */
 
-done:
-    if (ret_value < 0 && _chunk_info) {
-        for (j = 0; j <= i; j++) {
-            if ((_chunk_info[j].fspace_id >= 0) && (H5Sclose(_chunk_info[j].fspace_id) < 0))
-                D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "failed to close chunk file dataspace ID");
-            if ((_chunk_info[j].mspace_id >= 0) && (H5Sclose(_chunk_info[j].mspace_id) < 0))
-                D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "failed to close chunk memory dataspace ID");
-        }
+    /* Iterate over all combinations of per-dimension chunks, in row-major
+     * order */
+    do {
+        /* Re-allocate selected chunk info buffer if necessary */
+        if(nchunks == *chunk_info_nalloc) {
+            void *tmp_realloc;
+            size_t j;
 
-        DV_free(_chunk_info);
-        if (*chunk_info) *chunk_info = NULL;
-        if (chunk_info_len) *chunk_info_len = 0;
-    }
-    else {
-        *chunk_info = _chunk_info;
-        if (chunk_info_len)
-            *chunk_info_len = chunk_info_nalloc;
+            if(NULL == (tmp_realloc = DV_realloc(*chunk_info, 2 * *chunk_info_nalloc * sizeof(**chunk_info))))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't reallocate space for selected chunk info buffer");
+            *chunk_info = (H5_daos_select_chunk_info_t *)tmp_realloc;
 
-        assert(i + 1 >= 0);
-        *nchunks_selected = (size_t)(i + 1);
-    }
+            /* Ensure newly-allocated chunk info structures are initialized */
+            memset(&(*chunk_info)[*chunk_info_nalloc], 0, *chunk_info_nalloc * sizeof(**chunk_info));
+            for(j = *chunk_info_nalloc; j < 2 * *chunk_info_nalloc; j++)
+                (*chunk_info)[j].fspace_id = (*chunk_info)[j].mspace_id = H5I_INVALID_HID;
 
-    if((entire_chunk_sel_space_id >= 0) && (H5Sclose(entire_chunk_sel_space_id) < 0))
-        D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "failed to close temporary entire chunk dataspace");
+            *chunk_info_nalloc *= 2;
+        } /* end if */
+
+        /* Fill in chunk info */
+        nelem = 1;
+        for(i = 0; i < sel_pattern->ndims; i++) {
+            (*chunk_info)[nchunks].chunk_coords[i] = (uint64_t)dim_chunk_coords[i][cur_chunk[i]];
+            nelem *= dim_chunk_nelem[i][cur_chunk[i]];
+        } /* end for */
+        (*chunk_info)[nchunks].num_elem_sel_file = (hssize_t)nelem;
+
+        /* Make sure we didn't process too many points */
+        if((hssize_t)nelem > num_sel_points)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "processed more elements than present in selection");
+        num_sel_points -= (hssize_t)nelem;
+        nchunks++;
+
+        /* Advance to next chunk */
+        for(i = sel_pattern->ndims - 1; i >= 0; i--) {
+            if(++cur_chunk[i] < dim_nchunks[i])
+                break;
+            cur_chunk[i] = 0;
+        } /* end for */
+    } while(i >= 0);
+
+    if(num_sel_points != 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "did not find enough elements to process");
+
+done:
+    *nchunks_selected = nchunks;
+
+    DV_free(dim_chunk_buf);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_get_selected_chunk_info() */
+} /* end H5_daos_get_selected_chunk_info_pattern() */
 
@@ -20,6 +20,15 @@
 
 #include <libgen.h>
 
+/****************/
+/* Local Macros */
+/****************/
+
+/* Size of the header of the global handles broadcast buffer: the lengths of
+ * the global pool and container handles, and the file's default attribute
+ * layout */
+#define H5_DAOS_GH_HDR_SIZE (3 * H5_DAOS_ENCODED_UINT64_T_SIZE)
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -63,6 +72,18 @@ typedef struct get_obj_ids_udata_t {
     size_t obj_count;
 } get_obj_ids_udata_t;
 
+/* Task user data for reading or writing the file's default attribute layout
+ * in the global metadata object */
+typedef struct H5_daos_packed_attrs_rw_ud_t {
+    H5_daos_req_t *req;
+    H5_daos_file_t *file;
+    daos_key_t dkey;
+    daos_iod_t iod;
+    daos_sg_list_t sgl;
+    daos_iov_t sg_iov;
+    uint8_t packed_buf;
+} H5_daos_packed_attrs_rw_ud_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -101,6 +122,10 @@ static int H5_daos_cont_open_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_cont_open_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_file_set_pool_uuid(H5_daos_file_t *file, const char *filepath);
 static int H5_daos_handles_bcast_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_packed_attrs_rw_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_packed_attrs_rw_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_file_packed_attrs_rw(H5_daos_file_t *file, daos_opc_t opc,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static herr_t H5_daos_file_handles_bcast(H5_daos_file_t *file,
     H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_get_container_handles_task(tse_task_t *task);
@@ -449,8 +474,8 @@ H5_daos_handles_bcast_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             if(udata->buffer_len != udata->count) {
                 tse_task_t *bcast_task;
 
-                assert(udata->count == (2 * H5_DAOS_GH_BUF_SIZE) + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE));
-                assert(udata->buffer_len > (2 * H5_DAOS_GH_BUF_SIZE) + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE));
+                assert(udata->count == (2 * H5_DAOS_GH_BUF_SIZE) + H5_DAOS_GH_HDR_SIZE);
+                assert(udata->buffer_len > (2 * H5_DAOS_GH_BUF_SIZE) + H5_DAOS_GH_HDR_SIZE);
 
                 /* Use full buffer this time */
                 udata->count = udata->buffer_len;
@@ -468,6 +493,7 @@ H5_daos_handles_bcast_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         } /* end if */
         else {
             uint64_t gch_len, gph_len;
+            uint64_t packed_attrs;
             uint8_t *p;
 
             /* Decode container's global pool handle length */
@@ -481,20 +507,23 @@ H5_daos_handles_bcast_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             /* Decode global container handle length */
             UINT64DECODE(p, gch_len)
 
+            /* Decode default attribute layout */
+            UINT64DECODE(p, packed_attrs)
+
             /* Check for gch_len set to 0 - indicates failure */
             if(gch_len == 0)
                 D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_REMOTE_ERROR, "lead process failed to obtain global container handle");
 
             /* Check if we need another bcast */
-            if(gch_len + gph_len + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE) > (size_t)udata->count) {
+            if(gch_len + gph_len + H5_DAOS_GH_HDR_SIZE > (size_t)udata->count) {
                 tse_task_t *bcast_task;
 
-                assert(udata->buffer_len == (2 * H5_DAOS_GH_BUF_SIZE) + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE));
-                assert(udata->count == (2 * H5_DAOS_GH_BUF_SIZE) + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE));
+                assert(udata->buffer_len == (2 * H5_DAOS_GH_BUF_SIZE) + H5_DAOS_GH_HDR_SIZE);
+                assert(udata->count == (2 * H5_DAOS_GH_BUF_SIZE) + H5_DAOS_GH_HDR_SIZE);
 
                 /* Realloc buffer */
                 DV_free(udata->buffer);
-                udata->buffer_len = (int)gch_len + (int)gph_len + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+                udata->buffer_len = (int)gch_len + (int)gph_len + H5_DAOS_GH_HDR_SIZE;
 
                 if(NULL == (udata->buffer = DV_malloc((size_t)udata->buffer_len)))
                     D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "failed to allocate memory for global handles buffer");
@@ -532,6 +561,10 @@ H5_daos_handles_bcast_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                 /* Get container handle */
                 if(0 != (ret = daos_cont_global2local(udata->req->file->container_poh, gch_glob, &udata->req->file->coh)))
                     D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, ret, "can't get global container handle: %s", H5_daos_err_to_string(ret));
+
+                /* Set default attribute layout from the lead process */
+                udata->req->file->packed_attrs = packed_attrs ? TRUE : FALSE;
+                udata->req->file->attr_open_try_packed = udata->req->file->packed_attrs;
             } /* end else */
         } /* end else */
     } /* end else */
@@ -610,7 +643,7 @@ H5_daos_get_container_handles_task(tse_task_t *task)
             D_DONE_ERROR(H5E_VOL, H5E_CANTGET, ret, "can't calculate size of container's global pool handle: %s", H5_daos_err_to_string(ret));
     } /* end if */
 
-    req_buf_len = (2 * H5_DAOS_ENCODED_UINT64_T_SIZE) +
+    req_buf_len = H5_DAOS_GH_HDR_SIZE +
             MAX(gch_glob.iov_buf_len + gph_glob.iov_buf_len, (2 * H5_DAOS_GH_BUF_SIZE));
 
     if(!udata->buffer || (udata->buffer_len < (int)req_buf_len)) {
@@ -621,7 +654,7 @@ H5_daos_get_container_handles_task(tse_task_t *task)
             D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate space for global container handles");
         udata->buffer = tmp;
         udata->buffer_len = (int)req_buf_len;
-        udata->count = (2 * H5_DAOS_GH_BUF_SIZE) + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+        udata->count = (2 * H5_DAOS_GH_BUF_SIZE) + H5_DAOS_GH_HDR_SIZE;
         gch_glob.iov_len = gch_glob.iov_buf_len;
         gph_glob.iov_len = gph_glob.iov_buf_len;
     } /* end if */
@@ -637,6 +670,9 @@ H5_daos_get_container_handles_task(tse_task_t *task)
     /* Encode global container handle length */
     UINT64ENCODE(p, (uint64_t)gch_glob.iov_buf_len)
 
+    /* Encode default attribute layout */
+    UINT64ENCODE(p, (uint64_t)udata->req->file->packed_attrs)
+
     /* Get container's global pool handle */
     gph_glob.iov_buf = p;
     if(0 != (ret = daos_pool_local2global(udata->req->file->container_poh, &gph_glob)))
@@ -677,7 +713,8 @@ done:
  * Function:    H5_daos_file_handles_bcast
  *
  * Purpose:     Broadcast a file's pool handle and container handle to
- *              other processes.
+ *              other processes, along with the file's default attribute
+ *              layout, so only the lead process needs to read it.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -708,7 +745,7 @@ H5_daos_file_handles_bcast(H5_daos_file_t *file, H5_daos_req_t *req,
     bcast_udata->count = 0;
     bcast_udata->comm = req->file->comm;
 
-    buf_size = (2 * H5_DAOS_GH_BUF_SIZE) + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+    buf_size = (2 * H5_DAOS_GH_BUF_SIZE) + H5_DAOS_GH_HDR_SIZE;
 
     /* check if this is the lead rank */
     if(file->my_rank == 0) {
@@ -762,6 +799,202 @@ done:
 } /* end H5_daos_file_handles_bcast() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_packed_attrs_rw_prep_cb
+ *
+ * Purpose:     Prepare callback for reading or writing the file's default
+ *              attribute layout.  Sets the global metadata object handle,
+ *              which is not valid until the object open task completes.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_packed_attrs_rw_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_packed_attrs_rw_ud_t *udata;
+    daos_obj_rw_t *rw_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for default attribute layout I/O task");
+
+    assert(udata->req);
+    assert(udata->file);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_FILE);
+
+    /* Set I/O task arguments */
+    if(NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for default attribute layout I/O task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh = udata->file->glob_md_oh;
+    rw_args->th = DAOS_TX_NONE;
+    rw_args->dkey = &udata->dkey;
+    rw_args->nr = 1u;
+    rw_args->iods = &udata->iod;
+    rw_args->sgls = &udata->sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_packed_attrs_rw_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_packed_attrs_rw_comp_cb
+ *
+ * Purpose:     Complete callback for reading or writing the file's
+ *              default attribute layout.  After a read, sets the file's
+ *              default layout if one is stored in the file.  Frees
+ *              private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_packed_attrs_rw_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_packed_attrs_rw_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for default attribute layout I/O task");
+
+    assert(udata->req);
+    assert(udata->file);
+
+    /* Handle errors in I/O task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "default attribute layout I/O";
+    } /* end if */
+    else if(task->dt_result == 0 && udata->iod.iod_size == (daos_size_t)1) {
+        /* Files created without a default layout do not store one, so only
+         * update the default if the value was found */
+        udata->file->packed_attrs = udata->packed_buf ? TRUE : FALSE;
+        udata->file->attr_open_try_packed = udata->file->packed_attrs;
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_FILE, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if(udata) {
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status = ret_value;
+            udata->req->failed_task = "default attribute layout I/O completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_FILE, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_packed_attrs_rw_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_file_packed_attrs_rw
+ *
+ * Purpose:     Creates a task to write the file's default attribute
+ *              layout (opc DAOS_OPC_OBJ_UPDATE) to, or read it (opc
+ *              DAOS_OPC_OBJ_FETCH) from, the global metadata object.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_file_packed_attrs_rw(H5_daos_file_t *file, daos_opc_t opc,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_packed_attrs_rw_ud_t *udata = NULL;
+    tse_task_t *rw_task;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+    assert(opc == DAOS_OPC_OBJ_UPDATE || opc == DAOS_OPC_OBJ_FETCH);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate task udata struct */
+    if(NULL == (udata = (H5_daos_packed_attrs_rw_ud_t *)DV_calloc(sizeof(H5_daos_packed_attrs_rw_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate user data struct for default attribute layout I/O task");
+    udata->req = req;
+    udata->file = file;
+    udata->packed_buf = (uint8_t)file->packed_attrs;
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&udata->dkey, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g);
+
+    /* Set up iod */
+    daos_const_iov_set((d_const_iov_t *)&udata->iod.iod_name, H5_daos_packed_attr_key_g, H5_daos_packed_attr_key_size_g);
+    udata->iod.iod_nr = 1u;
+    udata->iod.iod_size = (daos_size_t)1;
+    udata->iod.iod_type = DAOS_IOD_SINGLE;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->sg_iov, &udata->packed_buf, (daos_size_t)1);
+    udata->sgl.sg_nr = 1;
+    udata->sgl.sg_nr_out = 0;
+    udata->sgl.sg_iovs = &udata->sg_iov;
+
+    /* Create task for I/O */
+    if(H5_daos_create_daos_task(opc, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            H5_daos_packed_attrs_rw_prep_cb, H5_daos_packed_attrs_rw_comp_cb, udata, &rw_task) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't create task for default attribute layout I/O");
+
+    /* Schedule I/O task (or save it to be scheduled later) and give it a
+     * reference to req and udata */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(rw_task, false)))
+            D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't schedule task for default attribute layout I/O: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = rw_task;
+    *dep_task = rw_task;
+    req->rc++;
+    udata = NULL;
+
+done:
+    /* Clean up */
+    if(udata) {
+        assert(ret_value < 0);
+        udata = DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_file_packed_attrs_rw() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_file_create
  *
@@ -857,6 +1090,12 @@ H5_daos_file_create(const char *name, unsigned flags, hid_t fcpl_id,
     if(H5_daos_fill_enc_plist_cache(file, fapl_id) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "failed to fill encoded property list buffer cache");
 
+    /* Get the default attribute layout from the FCPL */
+    if(fcpl_id != H5P_FILE_CREATE_DEFAULT
+            && H5_daos_get_packed_attr_layout_prop(fcpl_id, &file->packed_attrs) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get packed attribute layout property");
+    file->attr_open_try_packed = file->packed_attrs;
+
     /* Generate oid for global metadata object */
     if(H5_daos_oid_encode(&file->glob_md_oid, H5_DAOS_OIDX_GMD, H5I_GROUP,
             fcpl_id == H5P_FILE_CREATE_DEFAULT ? H5P_DEFAULT : fcpl_id,
@@ -891,6 +1130,12 @@ H5_daos_file_create(const char *name, unsigned flags, hid_t fcpl_id,
     if(H5_daos_obj_open(file, int_req, &file->glob_md_oid, DAOS_OO_RW, &file->glob_md_oh, "global metadata object open", &first_task, &dep_task) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTOPENOBJ, NULL, "can't open global metadata object");
 
+    /* Store the default attribute layout so it applies to all handles for
+     * the file */
+    if(file->packed_attrs && file->my_rank == 0
+            && H5_daos_file_packed_attrs_rw(file, DAOS_OPC_OBJ_UPDATE, int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, NULL, "can't write default attribute layout");
+
     /* Create root group */
     if(NULL == (file->root_grp = (H5_daos_group_t *)H5_daos_group_create_helper(
             file, TRUE, fcpl_id, H5P_GROUP_ACCESS_DEFAULT, NULL, NULL,
@@ -1598,18 +1843,29 @@ H5_daos_file_open(const char *name, unsigned flags, hid_t fapl_id,
     file->item.open_req = int_req;
     int_req->rc++;
 
-    /* Open container on rank 0 */
-    if((file->my_rank == 0) && H5_daos_cont_open(file, flags, int_req, &first_task, &dep_task) < 0)
-        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't open DAOS container");
+    if(file->my_rank == 0) {
+        /* Open container on rank 0 */
+        if(H5_daos_cont_open(file, flags, int_req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't open DAOS container");
+
+        /* Open global metadata object */
+        if(H5_daos_obj_open(file, int_req, &file->glob_md_oid, flags & H5F_ACC_RDWR ? DAOS_COO_RW : DAOS_COO_RO, &file->glob_md_oh, "global metadata object open", &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_FILE, H5E_CANTOPENOBJ, NULL, "can't open global metadata object");
+
+        /* Read the file's default attribute layout.  It is sent to the
+         * other processes with the handles. */
+        if(H5_daos_file_packed_attrs_rw(file, DAOS_OPC_OBJ_FETCH, int_req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_FILE, H5E_READERROR, NULL, "can't read default attribute layout");
+    } /* end if */
 
     /* Broadcast handles (container handle and, optionally, pool handle)
-     * to other procs if any.
+     * and the default attribute layout to other procs if any.
      */
     if((file->num_procs > 1) && (H5_daos_file_handles_bcast(file, int_req, &first_task, &dep_task) < 0))
         D_GOTO_ERROR(H5E_FILE, H5E_CANTSET, NULL, "can't broadcast DAOS container/pool handles");
 
-    /* Open global metadata object */
-    if(H5_daos_obj_open(file, int_req, &file->glob_md_oid, flags & H5F_ACC_RDWR ? DAOS_COO_RW : DAOS_COO_RO, &file->glob_md_oh, "global metadata object open", &first_task, &dep_task) < 0)
+    /* Open global metadata object on other procs */
+    if((file->my_rank != 0) && H5_daos_obj_open(file, int_req, &file->glob_md_oid, flags & H5F_ACC_RDWR ? DAOS_COO_RW : DAOS_COO_RO, &file->glob_md_oh, "global metadata object open", &first_task, &dep_task) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTOPENOBJ, NULL, "can't open global metadata object");
 
     /* Open root group and fill in root group's oid */
@@ -3154,6 +3410,10 @@ H5_daos_file_close_helper(H5_daos_file_t *file)
         /* Free file data structures */
         if(file->item.cur_op_pool)
             H5_daos_op_pool_free(file->item.cur_op_pool);
+        if(file->tconv_pool && H5_daos_tpool_free(file->tconv_pool) < 0)
+            D_DONE_ERROR(H5E_FILE, H5E_CANTFREE, FAIL, "can't free type conversion thread pool");
+        H5_daos_path_cache_invalidate(file);
+        H5_daos_omd_cache_free(file);
         assert(file->item.open_req == NULL);
         if(file->file_name)
             file->file_name = DV_free(file->file_name);
@@ -3388,8 +3648,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_file_flush
  *
- * Purpose:     Flushes a DAOS file.  Currently a no-op, may create a
- *              snapshot in the future.
+ * Purpose:     Flushes a DAOS file.  Writes back the chunk caches of all
+ *              datasets open in the file.  May create a snapshot in the
+ *              future.
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -3400,23 +3661,50 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_file_flush(H5_daos_file_t H5VL_DAOS_UNUSED *file,
-    H5_daos_req_t H5VL_DAOS_UNUSED *req, tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_file_flush(H5_daos_file_t *file, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
 {
+    H5_daos_dset_t *dset;
+    tse_task_t **flush_tasks = NULL;
     tse_task_t *barrier_task = NULL;
+    size_t nflush = 0;
+    size_t i;
+    int ret;
     herr_t ret_value = SUCCEED;    /* Return value */
 
     assert(file);
+    assert(req);
+
+    /* Write back the chunk caches of open datasets.  The write backs run
+     * in parallel, each depends only on *dep_task. */
+    for(dset = file->cached_dsets; dset; dset = dset->chunk_cache.file_next)
+        nflush++;
+    if(nflush > 0) {
+        if(NULL == (flush_tasks = (tse_task_t **)DV_malloc(nflush * sizeof(tse_task_t *))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate array of chunk cache flush tasks");
+        for(dset = file->cached_dsets, i = 0; dset; dset = dset->chunk_cache.file_next, i++) {
+            assert(i < nflush);
+            flush_tasks[i] = *dep_task;
+            if(H5_daos_dataset_flush(dset, req, first_task, &flush_tasks[i]) < 0)
+                D_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't flush dataset");
+        } /* end for */
+    } /* end if */
 
-    /* Create task that does nothing but complete itself.  Only necessary
-     * because we can't enqueue a request that has no tasks */
-    if(H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL,
+    /* Create task that does nothing but complete itself, after all chunk
+     * cache write backs.  Also necessary because we can't enqueue a request
+     * that has no tasks */
+    if(H5_daos_create_task(H5_daos_metatask_autocomplete, nflush > 0 ? (unsigned)nflush : (*dep_task ? 1 : 0),
+            nflush > 0 ? flush_tasks : (*dep_task ? dep_task : NULL),
             NULL, NULL, NULL, &barrier_task) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't create barrier task for file flush");
 
     /* Schedule barrier task (or save it to be scheduled later)  */
-    assert(!*first_task);
-    *first_task = barrier_task;
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(barrier_task, false)))
+            D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't schedule barrier task for file flush: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = barrier_task;
     *dep_task = barrier_task;
 
 #if 0
@@ -3445,6 +3733,8 @@ H5_daos_file_flush(H5_daos_file_t H5VL_DAOS_UNUSED *file,
 #endif
 
 done:
+    flush_tasks = DV_free(flush_tasks);
+
     D_FUNC_LEAVE;
 } /* end H5_daos_file_flush() */
 
@@ -3482,6 +3772,39 @@ H5_daos_fill_fapl_cache(H5_daos_file_t *file, hid_t fapl_id)
     file->fapl_cache.is_collective_md_read = collective_md_read;
     file->fapl_cache.is_collective_md_write = collective_md_write;
 
+    /* Check for number of type conversion worker threads set on fapl_id.
+     * The thread pool itself is created on first use. */
+    if(H5_daos_get_tconv_nthreads(fapl_id, &file->fapl_cache.tconv_nthreads) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get type conversion thread count");
+
+    /* Check for inline variable length storage set on fapl_id */
+    file->fapl_cache.inline_vl = FALSE;
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_INLINE_VL_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for inline variable length property");
+    if(prop_exists && H5Pget(fapl_id, H5_DAOS_INLINE_VL_PROP_NAME, &file->fapl_cache.inline_vl) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get inline variable length property");
+
+    /* Check for path cache settings on fapl_id.  The cache itself is created
+     * on first use. */
+    file->fapl_cache.path_cache_nents = 0;
+    file->fapl_cache.path_cache_ttl = 0.0;
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_PATH_CACHE_NENTS_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for path cache size property");
+    if(prop_exists) {
+        if(H5Pget(fapl_id, H5_DAOS_PATH_CACHE_NENTS_PROP_NAME, &file->fapl_cache.path_cache_nents) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get path cache size");
+        if(H5Pget(fapl_id, H5_DAOS_PATH_CACHE_TTL_PROP_NAME, &file->fapl_cache.path_cache_ttl) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get path cache entry lifetime");
+    } /* end if */
+
+    /* Check for object metadata cache size set on fapl_id.  The cache itself
+     * is created on first use. */
+    file->fapl_cache.obj_cache_nclosed = 0;
+    if((prop_exists = H5Pexist(fapl_id, H5_DAOS_OBJ_CACHE_NCLOSED_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for object metadata cache size property");
+    if(prop_exists && H5Pget(fapl_id, H5_DAOS_OBJ_CACHE_NCLOSED_PROP_NAME, &file->fapl_cache.obj_cache_nclosed) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get object metadata cache size");
+
     /* Check for file default object class set on fapl_id */
     /* Note we do not copy the oclass_str in the property callbacks (there is no
      * "get" callback, so this is more like an H5P_peek, and we do not need to
@@ -0,0 +1,937 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The DAOS VOL connector where access is forwarded to the DAOS
+ * library. Filter pipeline routines.
+ *
+ * The HDF5 library does not expose its filter pipeline to VOL connectors, so
+ * the connector keeps its own table of filter classes.  The table holds the
+ * connector's implementations of the shuffle, Fletcher32 and (if zlib is
+ * available) deflate filters, any filter classes registered by the
+ * application with H5daos_register_filter(), and filter plugins loaded from
+ * the HDF5 plugin search path on first use.
+ */
+
+#include "daos_vol.h"           /* DAOS connector                          */
+
+#include "util/daos_vol_err.h"  /* DAOS connector error handling           */
+#include "util/daos_vol_mem.h"  /* DAOS connector memory management        */
+
+#include <dirent.h>
+#include <dlfcn.h>
+#include <H5PLextern.h>
+
+#ifdef DV_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Initial number of slots in the filter class table */
+#define H5_DAOS_FILTER_TABLE_NALLOC 16
+
+/* Initial number of slots for loaded plugin handles */
+#define H5_DAOS_FILTER_PLUGIN_NALLOC 8
+
+/* Number of leading cd_values of the shuffle filter, which holds the element
+ * size */
+#define H5_DAOS_FILTER_SHUFFLE_NPARMS 1
+
+/* Size of Fletcher32 checksum */
+#define H5_DAOS_FILTER_FLETCHER32_SIZE 4
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static herr_t H5_daos_filter_table_add(const H5Z_class2_t *cls);
+static const H5Z_class2_t *H5_daos_filter_find(H5Z_filter_t id);
+static const H5Z_class2_t *H5_daos_filter_load_plugin(H5Z_filter_t id);
+static const H5Z_class2_t *H5_daos_filter_search_plugin_dir(const char *dir,
+    H5Z_filter_t id);
+static herr_t H5_daos_filter_shuffle_set_local(hid_t dcpl_id, hid_t type_id,
+    hid_t space_id);
+static size_t H5_daos_filter_shuffle(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+static uint32_t H5_daos_filter_fletcher32_checksum(const uint8_t *data,
+    size_t len);
+static size_t H5_daos_filter_fletcher32(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+#ifdef DV_HAVE_ZLIB
+static size_t H5_daos_filter_deflate(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf);
+#endif
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Connector implementations of the predefined HDF5 filters */
+static const H5Z_class2_t H5_daos_filter_shuffle_g[1] = {{
+    H5Z_CLASS_T_VERS,               /* H5Z_class_t version */
+    H5Z_FILTER_SHUFFLE,             /* Filter id number */
+    1,                              /* encoder_present flag (set to true) */
+    1,                              /* decoder_present flag (set to true) */
+    "shuffle",                      /* Filter name for debugging */
+    NULL,                           /* The "can apply" callback */
+    H5_daos_filter_shuffle_set_local, /* The "set local" callback */
+    H5_daos_filter_shuffle          /* The actual filter function */
+}};
+
+static const H5Z_class2_t H5_daos_filter_fletcher32_g[1] = {{
+    H5Z_CLASS_T_VERS,               /* H5Z_class_t version */
+    H5Z_FILTER_FLETCHER32,          /* Filter id number */
+    1,                              /* encoder_present flag (set to true) */
+    1,                              /* decoder_present flag (set to true) */
+    "fletcher32",                   /* Filter name for debugging */
+    NULL,                           /* The "can apply" callback */
+    NULL,                           /* The "set local" callback */
+    H5_daos_filter_fletcher32       /* The actual filter function */
+}};
+
+#ifdef DV_HAVE_ZLIB
+static const H5Z_class2_t H5_daos_filter_deflate_g[1] = {{
+    H5Z_CLASS_T_VERS,               /* H5Z_class_t version */
+    H5Z_FILTER_DEFLATE,             /* Filter id number */
+    1,                              /* encoder_present flag (set to true) */
+    1,                              /* decoder_present flag (set to true) */
+    "deflate",                      /* Filter name for debugging */
+    NULL,                           /* The "can apply" callback */
+    NULL,                           /* The "set local" callback */
+    H5_daos_filter_deflate          /* The actual filter function */
+}};
+#endif
+
+/* Table of known filter classes */
+static const H5Z_class2_t **H5_daos_filter_table_g = NULL;
+static size_t H5_daos_filter_table_nused_g = 0;
+static size_t H5_daos_filter_table_nalloc_g = 0;
+
+/* Handles of loaded filter plugins */
+static void **H5_daos_filter_plugins_g = NULL;
+static size_t H5_daos_filter_plugins_nused_g = 0;
+static size_t H5_daos_filter_plugins_nalloc_g = 0;
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_register_filter
+ *
+ * Purpose:     Registers a filter class with the DAOS VOL connector, so
+ *              that datasets using the filter can be read and written.
+ *              This is only needed for filters that are not predefined by
+ *              the connector and cannot be loaded as plugins from the
+ *              HDF5 plugin search path.  A filter registered with the
+ *              same ID as an existing one replaces it.  Must be called
+ *              after the connector is initialized.  The class struct
+ *              must remain valid until the connector is terminated.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_register_filter(const H5Z_class2_t *cls)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!cls)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "filter class is NULL");
+    if(cls->version != H5Z_CLASS_T_VERS)
+        D_GOTO_ERROR(H5E_ARGS, H5E_VERSION, FAIL, "filter class version number is invalid");
+    if(cls->id < 0 || cls->id > H5Z_FILTER_MAX)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid filter identification number");
+    if(!cls->filter)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no filter function specified");
+
+    if(H5_daos_filter_table_add(cls) < 0)
+        D_GOTO_ERROR(H5E_PLINE, H5E_CANTREGISTER, FAIL, "can't register filter");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_register_filter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_init
+ *
+ * Purpose:     Initializes the filter class table with the connector's
+ *              predefined filters.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_filter_init(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    if(H5_daos_filter_table_add(H5_daos_filter_shuffle_g) < 0)
+        D_GOTO_ERROR(H5E_PLINE, H5E_CANTREGISTER, FAIL, "can't register shuffle filter");
+    if(H5_daos_filter_table_add(H5_daos_filter_fletcher32_g) < 0)
+        D_GOTO_ERROR(H5E_PLINE, H5E_CANTREGISTER, FAIL, "can't register fletcher32 filter");
+#ifdef DV_HAVE_ZLIB
+    if(H5_daos_filter_table_add(H5_daos_filter_deflate_g) < 0)
+        D_GOTO_ERROR(H5E_PLINE, H5E_CANTREGISTER, FAIL, "can't register deflate filter");
+#endif
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_term
+ *
+ * Purpose:     Frees the filter class table and closes any loaded filter
+ *              plugins.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_filter_term(void)
+{
+    size_t i;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_filter_table_g = DV_free(H5_daos_filter_table_g);
+    H5_daos_filter_table_nused_g = 0;
+    H5_daos_filter_table_nalloc_g = 0;
+
+    for(i = 0; i < H5_daos_filter_plugins_nused_g; i++)
+        if(0 != dlclose(H5_daos_filter_plugins_g[i]))
+            D_DONE_ERROR(H5E_PLUGIN, H5E_CLOSEERROR, FAIL, "can't close filter plugin: %s", dlerror());
+    H5_daos_filter_plugins_g = DV_free(H5_daos_filter_plugins_g);
+    H5_daos_filter_plugins_nused_g = 0;
+    H5_daos_filter_plugins_nalloc_g = 0;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_table_add
+ *
+ * Purpose:     Adds a filter class to the filter class table, replacing
+ *              any class with the same ID.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_filter_table_add(const H5Z_class2_t *cls)
+{
+    size_t i;
+    herr_t ret_value = SUCCEED;
+
+    assert(cls);
+
+    /* Replace existing class with the same ID */
+    for(i = 0; i < H5_daos_filter_table_nused_g; i++)
+        if(H5_daos_filter_table_g[i]->id == cls->id) {
+            H5_daos_filter_table_g[i] = cls;
+            D_GOTO_DONE(SUCCEED);
+        } /* end if */
+
+    /* Grow table if necessary */
+    if(H5_daos_filter_table_nused_g == H5_daos_filter_table_nalloc_g) {
+        const H5Z_class2_t **tmp_realloc;
+        size_t new_nalloc = H5_daos_filter_table_nalloc_g
+                ? 2 * H5_daos_filter_table_nalloc_g : H5_DAOS_FILTER_TABLE_NALLOC;
+
+        if(NULL == (tmp_realloc = (const H5Z_class2_t **)DV_realloc(H5_daos_filter_table_g,
+                new_nalloc * sizeof(H5_daos_filter_table_g[0]))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate filter table");
+        H5_daos_filter_table_g = tmp_realloc;
+        H5_daos_filter_table_nalloc_g = new_nalloc;
+    } /* end if */
+
+    H5_daos_filter_table_g[H5_daos_filter_table_nused_g++] = cls;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_table_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_find
+ *
+ * Purpose:     Looks up the filter class for filter id, loading it from
+ *              the HDF5 plugin search path if it is not in the filter
+ *              class table.
+ *
+ * Return:      Success:        Pointer to filter class
+ *              Failure:        NULL (filter not available, does not push
+ *                              an error)
+ *
+ *-------------------------------------------------------------------------
+ */
+static const H5Z_class2_t *
+H5_daos_filter_find(H5Z_filter_t id)
+{
+    size_t i;
+
+    for(i = 0; i < H5_daos_filter_table_nused_g; i++)
+        if(H5_daos_filter_table_g[i]->id == id)
+            return H5_daos_filter_table_g[i];
+
+    return H5_daos_filter_load_plugin(id);
+} /* end H5_daos_filter_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_load_plugin
+ *
+ * Purpose:     Searches the HDF5 plugin search path for a filter plugin
+ *              implementing filter id.  If found, the plugin is kept open
+ *              and its filter class is added to the filter class table.
+ *
+ * Return:      Success:        Pointer to filter class
+ *              Failure:        NULL (filter not found, does not push an
+ *                              error)
+ *
+ *-------------------------------------------------------------------------
+ */
+static const H5Z_class2_t *
+H5_daos_filter_load_plugin(H5Z_filter_t id)
+{
+    unsigned npaths = 0;
+    unsigned plugin_ctrl_mask = 0;
+    char *path = NULL;
+    ssize_t path_len;
+    unsigned i;
+    const H5Z_class2_t *ret_value = NULL;
+
+    /* Check if plugins are enabled */
+    H5E_BEGIN_TRY {
+        if(H5PLget_loading_state(&plugin_ctrl_mask) < 0)
+            plugin_ctrl_mask = 0;
+    } H5E_END_TRY;
+    if(!(plugin_ctrl_mask & H5PL_FILTER_PLUGIN))
+        D_GOTO_DONE(NULL);
+
+    /* Search each directory in the plugin search path */
+    H5E_BEGIN_TRY {
+        if(H5PLsize(&npaths) < 0)
+            npaths = 0;
+    } H5E_END_TRY;
+    for(i = 0; i < npaths && !ret_value; i++) {
+        if((path_len = H5PLget(i, NULL, 0)) <= 0)
+            continue;
+        if(NULL == (path = (char *)DV_malloc((size_t)path_len + 1)))
+            D_GOTO_DONE(NULL);
+        if(H5PLget(i, path, (size_t)path_len + 1) > 0)
+            ret_value = H5_daos_filter_search_plugin_dir(path, id);
+        path = DV_free(path);
+    } /* end for */
+
+done:
+    DV_free(path);
+
+    return ret_value;
+} /* end H5_daos_filter_load_plugin() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_search_plugin_dir
+ *
+ * Purpose:     Searches the plugin directory dir for a filter plugin
+ *              implementing filter id.
+ *
+ * Return:      Success:        Pointer to filter class
+ *              Failure:        NULL (filter not found, does not push an
+ *                              error)
+ *
+ *-------------------------------------------------------------------------
+ */
+static const H5Z_class2_t *
+H5_daos_filter_search_plugin_dir(const char *dir, H5Z_filter_t id)
+{
+    typedef H5PL_type_t (*get_plugin_type_t)(void);
+    typedef const void *(*get_plugin_info_t)(void);
+    DIR *dirp = NULL;
+    struct dirent *dp;
+    char *pathname = NULL;
+    size_t pathname_len;
+    void *handle = NULL;
+    get_plugin_type_t get_plugin_type;
+    get_plugin_info_t get_plugin_info;
+    const H5Z_class2_t *cls;
+    const H5Z_class2_t *ret_value = NULL;
+
+    assert(dir);
+
+    if(NULL == (dirp = opendir(dir)))
+        D_GOTO_DONE(NULL);
+
+    while(!ret_value && NULL != (dp = readdir(dirp))) {
+        /* Only consider shared libraries */
+        if(!strstr(dp->d_name, ".so") && !strstr(dp->d_name, ".dylib"))
+            continue;
+
+        pathname_len = strlen(dir) + strlen(dp->d_name) + 2;
+        if(NULL == (pathname = (char *)DV_malloc(pathname_len)))
+            D_GOTO_DONE(NULL);
+        snprintf(pathname, pathname_len, "%s/%s", dir, dp->d_name);
+
+        /* Open library and check that it is a filter plugin for this ID */
+        if(NULL != (handle = dlopen(pathname, RTLD_LAZY | RTLD_LOCAL))) {
+            get_plugin_type = (get_plugin_type_t)dlsym(handle, "H5PLget_plugin_type");
+            get_plugin_info = (get_plugin_info_t)dlsym(handle, "H5PLget_plugin_info");
+            if(get_plugin_type && get_plugin_info && get_plugin_type() == H5PL_TYPE_FILTER
+                    && NULL != (cls = (const H5Z_class2_t *)get_plugin_info())
+                    && cls->version == H5Z_CLASS_T_VERS && cls->id == id && cls->filter) {
+                /* Keep plugin open */
+                if(H5_daos_filter_plugins_nused_g == H5_daos_filter_plugins_nalloc_g) {
+                    void **tmp_realloc;
+                    size_t new_nalloc = H5_daos_filter_plugins_nalloc_g
+                            ? 2 * H5_daos_filter_plugins_nalloc_g : H5_DAOS_FILTER_PLUGIN_NALLOC;
+
+                    if(NULL == (tmp_realloc = (void **)DV_realloc(H5_daos_filter_plugins_g,
+                            new_nalloc * sizeof(H5_daos_filter_plugins_g[0]))))
+                        D_GOTO_DONE(NULL);
+                    H5_daos_filter_plugins_g = tmp_realloc;
+                    H5_daos_filter_plugins_nalloc_g = new_nalloc;
+                } /* end if */
+                if(H5_daos_filter_table_add(cls) < 0)
+                    D_GOTO_DONE(NULL);
+                H5_daos_filter_plugins_g[H5_daos_filter_plugins_nused_g++] = handle;
+                handle = NULL;
+                ret_value = cls;
+            } /* end if */
+            else {
+                (void)dlclose(handle);
+                handle = NULL;
+            } /* end else */
+        } /* end if */
+
+        pathname = DV_free(pathname);
+    } /* end while */
+
+done:
+    if(handle)
+        (void)dlclose(handle);
+    DV_free(pathname);
+    if(dirp)
+        (void)closedir(dirp);
+
+    return ret_value;
+} /* end H5_daos_filter_search_plugin_dir() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_pipeline_init
+ *
+ * Purpose:     Reads the filter pipeline from dcpl_id and looks up the
+ *              class for each filter.  If set_local is TRUE (on dataset
+ *              creation), first checks that each filter can be applied
+ *              to the dataset and calls each filter's "set local"
+ *              callback, which may modify the filter parameters in
+ *              dcpl_id.  Missing optional filters are skipped on creation.
+ *              Missing mandatory filters are an error on creation, but
+ *              only on I/O otherwise, so datasets using unavailable
+ *              filters can still be opened.  If there are no filters,
+ *              *pipeline is set to NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_filter_pipeline_init(hid_t dcpl_id, hid_t type_id, hid_t space_id,
+    hbool_t set_local, H5_daos_filter_pipeline_t **pipeline)
+{
+    H5_daos_filter_pipeline_t *new_pipeline = NULL;
+    H5_daos_filter_t *filter;
+    const H5Z_class2_t *cls;
+    unsigned flags;
+    size_t cd_nelmts;
+    htri_t can_apply;
+    int nfilters;
+    int i;
+    herr_t ret_value = SUCCEED;
+
+    assert(pipeline);
+
+    *pipeline = NULL;
+
+    if(dcpl_id == H5P_DATASET_CREATE_DEFAULT)
+        D_GOTO_DONE(SUCCEED);
+    if((nfilters = H5Pget_nfilters(dcpl_id)) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of filters");
+    if(nfilters == 0)
+        D_GOTO_DONE(SUCCEED);
+    if(nfilters > H5Z_MAX_NFILTERS)
+        D_GOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "too many filters in pipeline");
+
+    /* Check each filter and call its "set local" callback */
+    if(set_local)
+        for(i = 0; i < nfilters; i++) {
+            H5Z_filter_t id;
+
+            cd_nelmts = 0;
+            if((id = H5Pget_filter2(dcpl_id, (unsigned)i, &flags, &cd_nelmts, NULL, 0, NULL, NULL)) < 0)
+                D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get filter info");
+            if(NULL == (cls = H5_daos_filter_find(id))) {
+                if(flags & H5Z_FLAG_OPTIONAL)
+                    continue;
+                D_GOTO_ERROR(H5E_PLINE, H5E_NOTFOUND, FAIL, "required filter %d is not available", (int)id);
+            } /* end if */
+
+            if(cls->can_apply) {
+                if((can_apply = cls->can_apply(dcpl_id, type_id, space_id)) < 0)
+                    D_GOTO_ERROR(H5E_PLINE, H5E_CANAPPLY, FAIL, "error during user callback");
+                if(!can_apply && !(flags & H5Z_FLAG_OPTIONAL))
+                    D_GOTO_ERROR(H5E_PLINE, H5E_CANAPPLY, FAIL, "filter parameters not appropriate");
+            } /* end if */
+
+            if(cls->set_local && cls->set_local(dcpl_id, type_id, space_id) < 0)
+                D_GOTO_ERROR(H5E_PLINE, H5E_SETLOCAL, FAIL, "error during user callback");
+        } /* end for */
+
+    /* Allocate pipeline */
+    if(NULL == (new_pipeline = (H5_daos_filter_pipeline_t *)DV_calloc(sizeof(H5_daos_filter_pipeline_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate filter pipeline");
+    if(NULL == (new_pipeline->filters = (H5_daos_filter_t *)DV_calloc((size_t)nfilters * sizeof(H5_daos_filter_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate filter pipeline");
+
+    /* Read (possibly modified) filter parameters */
+    for(i = 0; i < nfilters; i++) {
+        filter = &new_pipeline->filters[i];
+
+        /* Get number of parameters */
+        cd_nelmts = 0;
+        if((filter->id = H5Pget_filter2(dcpl_id, (unsigned)i, &flags, &cd_nelmts, NULL, 0, NULL, NULL)) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get filter info");
+        new_pipeline->nfilters++;
+
+        /* Get parameters */
+        if(cd_nelmts > 0) {
+            if(NULL == (filter->cd_values = (unsigned *)DV_malloc(cd_nelmts * sizeof(unsigned))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate filter parameters");
+            filter->cd_nelmts = cd_nelmts;
+            if(H5Pget_filter2(dcpl_id, (unsigned)i, &filter->flags, &filter->cd_nelmts,
+                    filter->cd_values, 0, NULL, NULL) < 0)
+                D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get filter info");
+        } /* end if */
+        else
+            filter->flags = flags;
+
+        filter->cls = H5_daos_filter_find(filter->id);
+    } /* end for */
+
+    *pipeline = new_pipeline;
+    new_pipeline = NULL;
+
+done:
+    if(new_pipeline) {
+        assert(ret_value < 0);
+        H5_daos_filter_pipeline_free(new_pipeline);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_pipeline_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_pipeline_free
+ *
+ * Purpose:     Frees a filter pipeline created by
+ *              H5_daos_filter_pipeline_init().
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_filter_pipeline_free(H5_daos_filter_pipeline_t *pipeline)
+{
+    size_t i;
+
+    if(!pipeline)
+        return;
+
+    if(pipeline->filters) {
+        for(i = 0; i < pipeline->nfilters; i++)
+            DV_free(pipeline->filters[i].cd_values);
+        DV_free(pipeline->filters);
+    } /* end if */
+    DV_free(pipeline);
+
+    return;
+} /* end H5_daos_filter_pipeline_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_pipeline_apply
+ *
+ * Purpose:     Runs the nbytes bytes of data in *buf through the filter
+ *              pipeline, in reverse order if reverse is TRUE.  *buf must
+ *              have been allocated with H5allocate_memory() and have
+ *              *buf_size bytes allocated, and may be reallocated by the
+ *              filters.  On return, *nbytes holds the size of the output.
+ *
+ *              When applying filters, on entry *filter_mask should be 0.
+ *              Failed optional filters are skipped and their bits are set
+ *              in *filter_mask.  When reversing filters, filters whose
+ *              bits are set in *filter_mask are skipped.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_filter_pipeline_apply(const H5_daos_filter_pipeline_t *pipeline,
+    hbool_t reverse, uint32_t *filter_mask, size_t *nbytes, size_t *buf_size,
+    void **buf)
+{
+    const H5_daos_filter_t *filter;
+    size_t new_nbytes;
+    size_t i;
+    herr_t ret_value = SUCCEED;
+
+    assert(pipeline);
+    assert(filter_mask);
+    assert(nbytes);
+    assert(buf_size);
+    assert(buf && *buf);
+
+    for(i = 0; i < pipeline->nfilters; i++) {
+        size_t idx = reverse ? pipeline->nfilters - i - 1 : i;
+
+        filter = &pipeline->filters[idx];
+
+        /* Skip filters that were not applied */
+        if(reverse && (*filter_mask & ((uint32_t)1 << idx)))
+            continue;
+
+        if(!filter->cls) {
+            if(!reverse && (filter->flags & H5Z_FLAG_OPTIONAL)) {
+                *filter_mask |= (uint32_t)1 << idx;
+                continue;
+            } /* end if */
+            D_GOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL, "required filter %d is not available", (int)filter->id);
+        } /* end if */
+
+        if(0 == (new_nbytes = filter->cls->filter(filter->flags | (reverse ? H5Z_FLAG_REVERSE : 0),
+                filter->cd_nelmts, filter->cd_values, *nbytes, buf_size, buf))) {
+            if(!reverse && (filter->flags & H5Z_FLAG_OPTIONAL)) {
+                *filter_mask |= (uint32_t)1 << idx;
+                continue;
+            } /* end if */
+            D_GOTO_ERROR(H5E_PLINE, reverse ? H5E_READERROR : H5E_WRITEERROR, FAIL, "filter '%s' failed",
+                    filter->cls->name ? filter->cls->name : "(unnamed)");
+        } /* end if */
+
+        *nbytes = new_nbytes;
+    } /* end for */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_pipeline_apply() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_shuffle_set_local
+ *
+ * Purpose:     "Set local" callback for the shuffle filter.  Sets the
+ *              element size parameter from the dataset datatype.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_filter_shuffle_set_local(hid_t dcpl_id, hid_t type_id,
+    hid_t H5VL_DAOS_UNUSED space_id)
+{
+    unsigned flags;
+    size_t cd_nelmts = H5_DAOS_FILTER_SHUFFLE_NPARMS;
+    unsigned cd_values[H5_DAOS_FILTER_SHUFFLE_NPARMS];
+    size_t type_size;
+    herr_t ret_value = SUCCEED;
+
+    if(H5Pget_filter_by_id2(dcpl_id, H5Z_FILTER_SHUFFLE, &flags, &cd_nelmts,
+            cd_values, 0, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't get shuffle parameters");
+
+    if(0 == (type_size = H5Tget_size(type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype size");
+    cd_values[0] = (unsigned)type_size;
+
+    if(H5Pmodify_filter(dcpl_id, H5Z_FILTER_SHUFFLE, flags,
+            H5_DAOS_FILTER_SHUFFLE_NPARMS, cd_values) < 0)
+        D_GOTO_ERROR(H5E_PLINE, H5E_CANTSET, FAIL, "can't set shuffle parameters");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_shuffle_set_local() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_shuffle
+ *
+ * Purpose:     Shuffle filter.  Groups the bytes of each element by
+ *              significance, which usually makes data more compressible.
+ *
+ * Return:      Success:        Size of output data
+ *              Failure:        0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5_daos_filter_shuffle(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf)
+{
+    size_t elem_size;
+    size_t nelem;
+    size_t i, j;
+    uint8_t *src;
+    uint8_t *dst;
+    void *dst_buf = NULL;
+
+    if(cd_nelmts < H5_DAOS_FILTER_SHUFFLE_NPARMS || !cd_values)
+        return 0;
+    elem_size = (size_t)cd_values[0];
+
+    /* Nothing to do for single-byte elements or less than 2 elements */
+    if(elem_size <= 1 || nbytes < 2 * elem_size)
+        return nbytes;
+
+    if(NULL == (dst_buf = H5allocate_memory(*buf_size, FALSE)))
+        return 0;
+
+    src = (uint8_t *)*buf;
+    dst = (uint8_t *)dst_buf;
+    nelem = nbytes / elem_size;
+    if(flags & H5Z_FLAG_REVERSE) {
+        for(i = 0; i < elem_size; i++)
+            for(j = 0; j < nelem; j++)
+                dst[(j * elem_size) + i] = src[(i * nelem) + j];
+    } /* end if */
+    else {
+        for(i = 0; i < elem_size; i++)
+            for(j = 0; j < nelem; j++)
+                dst[(i * nelem) + j] = src[(j * elem_size) + i];
+    } /* end else */
+
+    /* Copy any leftover bytes that don't make up a whole element */
+    if(nbytes > nelem * elem_size)
+        (void)memcpy(dst + (nelem * elem_size), src + (nelem * elem_size),
+                nbytes - (nelem * elem_size));
+
+    H5free_memory(*buf);
+    *buf = dst_buf;
+
+    return nbytes;
+} /* end H5_daos_filter_shuffle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_fletcher32_checksum
+ *
+ * Purpose:     Computes the Fletcher32 checksum of len bytes of data, in
+ *              the same way as the HDF5 library.
+ *
+ * Return:      Checksum
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5_daos_filter_fletcher32_checksum(const uint8_t *data, size_t len)
+{
+    size_t nwords = len / 2;
+    uint32_t sum1 = 0, sum2 = 0;
+
+    while(nwords) {
+        size_t tlen = nwords > 360 ? 360 : nwords;
+
+        nwords -= tlen;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while(--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end while */
+
+    /* Check for odd number of bytes */
+    if(len % 2) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end if */
+
+    /* Second reduction step to reduce sums to 16 bits */
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return (sum2 << 16) | sum1;
+} /* end H5_daos_filter_fletcher32_checksum() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_fletcher32
+ *
+ * Purpose:     Fletcher32 checksum filter.  Appends a checksum to the
+ *              data, and verifies and removes it in reverse.
+ *
+ * Return:      Success:        Size of output data
+ *              Failure:        0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5_daos_filter_fletcher32(unsigned flags, size_t H5VL_DAOS_UNUSED cd_nelmts,
+    const unsigned H5VL_DAOS_UNUSED cd_values[], size_t nbytes,
+    size_t *buf_size, void **buf)
+{
+    uint8_t *p;
+    uint32_t fletcher;
+    uint32_t stored_fletcher;
+
+    if(flags & H5Z_FLAG_REVERSE) {
+        if(nbytes < H5_DAOS_FILTER_FLETCHER32_SIZE)
+            return 0;
+        nbytes -= H5_DAOS_FILTER_FLETCHER32_SIZE;
+
+        /* Verify checksum unless error detection is disabled */
+        if(!(flags & H5Z_FLAG_SKIP_EDC)) {
+            fletcher = H5_daos_filter_fletcher32_checksum((const uint8_t *)*buf, nbytes);
+            p = (uint8_t *)*buf + nbytes;
+            UINT32DECODE(p, stored_fletcher);
+            if(fletcher != stored_fletcher)
+                return 0;
+        } /* end if */
+    } /* end if */
+    else {
+        /* Make room for checksum */
+        if(*buf_size < nbytes + H5_DAOS_FILTER_FLETCHER32_SIZE) {
+            void *tmp_realloc;
+
+            if(NULL == (tmp_realloc = H5resize_memory(*buf, nbytes + H5_DAOS_FILTER_FLETCHER32_SIZE)))
+                return 0;
+            *buf = tmp_realloc;
+            *buf_size = nbytes + H5_DAOS_FILTER_FLETCHER32_SIZE;
+        } /* end if */
+
+        fletcher = H5_daos_filter_fletcher32_checksum((const uint8_t *)*buf, nbytes);
+        p = (uint8_t *)*buf + nbytes;
+        UINT32ENCODE(p, fletcher);
+        nbytes += H5_DAOS_FILTER_FLETCHER32_SIZE;
+    } /* end else */
+
+    return nbytes;
+} /* end H5_daos_filter_fletcher32() */
+
+#ifdef DV_HAVE_ZLIB
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_deflate
+ *
+ * Purpose:     Deflate (zlib) compression filter.  cd_values[0] holds the
+ *              compression level.
+ *
+ * Return:      Success:        Size of output data
+ *              Failure:        0
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5_daos_filter_deflate(unsigned flags, size_t cd_nelmts,
+    const unsigned cd_values[], size_t nbytes, size_t *buf_size, void **buf)
+{
+    void *outbuf = NULL;
+    size_t outbuf_size;
+    size_t ret_value = 0;
+
+    if(flags & H5Z_FLAG_REVERSE) {
+        z_stream z_strm;
+        int status;
+
+        /* Start with an output buffer the size of the allocated input buffer
+         * and double it as necessary */
+        outbuf_size = *buf_size;
+        if(NULL == (outbuf = H5allocate_memory(outbuf_size, FALSE)))
+            D_GOTO_DONE(0);
+
+        memset(&z_strm, 0, sizeof(z_strm));
+        z_strm.next_in = (Bytef *)*buf;
+        z_strm.avail_in = (uInt)nbytes;
+        z_strm.next_out = (Bytef *)outbuf;
+        z_strm.avail_out = (uInt)outbuf_size;
+        if(Z_OK != inflateInit(&z_strm))
+            D_GOTO_DONE(0);
+
+        do {
+            status = inflate(&z_strm, Z_SYNC_FLUSH);
+            if(Z_STREAM_END == status)
+                break;
+            if(Z_OK != status) {
+                (void)inflateEnd(&z_strm);
+                D_GOTO_DONE(0);
+            } /* end if */
+            if(0 == z_strm.avail_out) {
+                void *tmp_realloc;
+
+                if(NULL == (tmp_realloc = H5resize_memory(outbuf, 2 * outbuf_size))) {
+                    (void)inflateEnd(&z_strm);
+                    D_GOTO_DONE(0);
+                } /* end if */
+                outbuf = tmp_realloc;
+                z_strm.next_out = (Bytef *)outbuf + z_strm.total_out;
+                z_strm.avail_out = (uInt)outbuf_size;
+                outbuf_size *= 2;
+            } /* end if */
+        } while(1);
+
+        ret_value = (size_t)z_strm.total_out;
+        (void)inflateEnd(&z_strm);
+    } /* end if */
+    else {
+        uLongf z_dst_nbytes;
+        int aggression = cd_nelmts > 0 ? (int)cd_values[0] : Z_DEFAULT_COMPRESSION;
+
+        outbuf_size = (size_t)compressBound((uLong)nbytes);
+        if(NULL == (outbuf = H5allocate_memory(outbuf_size, FALSE)))
+            D_GOTO_DONE(0);
+
+        z_dst_nbytes = (uLongf)outbuf_size;
+        if(Z_OK != compress2((Bytef *)outbuf, &z_dst_nbytes, (const Bytef *)*buf,
+                (uLong)nbytes, aggression))
+            D_GOTO_DONE(0);
+
+        ret_value = (size_t)z_dst_nbytes;
+    } /* end else */
+
+    /* Replace input buffer with output */
+    H5free_memory(*buf);
+    *buf = outbuf;
+    *buf_size = outbuf_size;
+    outbuf = NULL;
+
+done:
+    if(outbuf)
+        H5free_memory(outbuf);
+
+    return ret_value;
+} /* end H5_daos_filter_deflate() */
+
+#endif /* DV_HAVE_ZLIB */
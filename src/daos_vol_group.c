@@ -45,10 +45,35 @@ typedef struct H5_daos_group_gmco_ud_t {
     uint64_t *max_corder;
 } H5_daos_group_gmco_ud_t;
 
+/* User data struct for adding a traversed path to a file's path cache */
+typedef struct H5_daos_path_cache_add_ud_t {
+    H5_daos_req_t *req;
+    H5_daos_group_t *grp;
+    H5_daos_path_cache_ent_t *ent;
+    uint64_t epoch;
+} H5_daos_path_cache_add_ud_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
 
+static hbool_t H5_daos_group_traverse_more(const char *path);
+static H5_daos_obj_t *H5_daos_group_traverse_open(H5_daos_file_t *file,
+    hbool_t link_only, H5_daos_req_t *req, tse_task_t **first_task,
+    tse_task_t **dep_task);
+static H5_daos_group_t *H5_daos_group_open_link_only(H5_daos_file_t *file,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+static uint64_t H5_daos_path_cache_hash(dv_hash_table_key_t key);
+static int H5_daos_path_cache_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2);
+static void H5_daos_path_cache_ent_free(dv_hash_table_value_t value);
+static hbool_t H5_daos_path_cache_lookup(H5_daos_file_t *file,
+    const daos_obj_id_t *start_oid, const char *path, size_t *prefix_len,
+    daos_obj_id_t *oid);
+static herr_t H5_daos_path_cache_add(H5_daos_file_t *file,
+    const daos_obj_id_t *start_oid, const char *path, size_t path_len,
+    uint64_t epoch, H5_daos_obj_t *grp, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static int H5_daos_path_cache_add_task(tse_task_t *task);
 static herr_t H5_daos_group_fill_gcpl_cache(H5_daos_group_t *grp);
 static int H5_daos_group_open_end(H5_daos_group_t *grp, uint8_t *p, uint64_t gcpl_buf_len);
 static int H5_daos_group_open_bcast_comp_cb(tse_task_t *task, void *args);
@@ -69,6 +94,17 @@ static int H5_daos_group_gmco_comp_cb(tse_task_t *task, void *args);
  *              in the path and the object name.  obj_name points into the
  *              buffer given by path, so it does not need to be freed.
  *              The group must be closed with H5_daos_group_close_real().
+ *              If the file's path cache is enabled, traversal starts at
+ *              the group for the longest cached prefix of the path, and
+ *              the groups opened while traversing are added to the
+ *              cache.  Groups before the final group are only opened
+ *              to follow links from (see
+ *              H5_daos_group_open_link_only()), unless intermediate
+ *              groups are to be created.  If final_link_only is TRUE,
+ *              the final group is opened the same way, so callers that
+ *              only follow or read a link in it do not fetch its
+ *              metadata.  Callers that create links in the final group,
+ *              or need its GCPL, must pass FALSE.
  *
  * Return:      Success:        group object. 
  *              Failure:        NULL
@@ -80,14 +116,13 @@ static int H5_daos_group_gmco_comp_cb(tse_task_t *task, void *args);
  */
 H5_daos_obj_t *
 H5_daos_group_traverse(H5_daos_item_t *item, const char *path,
-    hid_t lcpl_id, H5_daos_req_t *req, hbool_t collective, char **path_buf,
+    hid_t lcpl_id, H5_daos_req_t *req, hbool_t collective,
+    hbool_t final_link_only, char **path_buf,
     const char **obj_name, size_t *obj_name_len, tse_task_t **first_task,
     tse_task_t **dep_task)
 {
     H5_daos_obj_t *obj = NULL;
     char *tmp_path_buf = NULL;
-    H5_daos_req_t *int_int_req = NULL;
-    int ret;
     H5_daos_obj_t *ret_value = NULL;
 
     assert(item);
@@ -136,6 +171,9 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path,
     if((!collective || (item->file->my_rank == 0)) && (*obj_name_len > 0)) {
         const char *next_obj;
         unsigned crt_intermed_grp = 0;
+        hbool_t use_path_cache = FALSE;
+        daos_obj_id_t start_oid = {0, 0};
+        uint64_t path_cache_epoch = 0;
 
         /* Make sure obj is a group */
         if(obj->item.type != H5I_GROUP)
@@ -155,6 +193,36 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path,
         tmp_path_buf[*obj_name_len] = '\0';
         *obj_name = tmp_path_buf;
 
+        /* Use the path cache if it is enabled and the starting group's oid is
+         * known (its open or create has completed) */
+        if(item->file->fapl_cache.path_cache_nents > 0 && obj->item.open_req
+                && obj->item.open_req->status == 0) {
+            daos_obj_id_t cached_oid;
+            size_t prefix_len;
+
+            use_path_cache = TRUE;
+            start_oid = obj->oid;
+            path_cache_epoch = item->file->path_cache.epoch;
+
+            /* If a prefix of the path to the final group is cached, open the
+             * group it resolves to directly and continue from there */
+            if(H5_daos_path_cache_lookup(item->file, &start_oid, tmp_path_buf, &prefix_len, &cached_oid)) {
+                if(H5_daos_group_close_real((H5_daos_group_t *)obj) < 0)
+                    D_GOTO_ERROR(H5E_SYM, H5E_CLOSEERROR, NULL, "can't close group");
+                obj = NULL;
+
+                if(NULL == (obj = H5_daos_group_traverse_open(item->file,
+                        !crt_intermed_grp && (final_link_only
+                        || H5_daos_group_traverse_more(tmp_path_buf + prefix_len + 1)),
+                        req, first_task, dep_task)))
+                    D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group");
+                obj->oid = cached_oid;
+
+                *obj_name = tmp_path_buf + prefix_len + 1;
+                *obj_name_len -= prefix_len + 1;
+            } /* end if */
+        } /* end if */
+
         /* Search for '/' */
         next_obj = strchr(*obj_name, '/');
 
@@ -183,37 +251,23 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path,
                     D_GOTO_ERROR(H5E_SYM, H5E_CLOSEERROR, NULL, "can't close group");
                 obj = NULL;
 
-                /* Start internal H5 operation for group open.  This will
-                 * not be visible to the API, will not be added to an operation
-                 * pool, and will be integrated into this function's task chain. */
-                if(NULL == (int_int_req = H5_daos_req_create(item->file, "group open within group traversal",
-                        NULL, NULL, req, H5I_INVALID_HID)))
-                    D_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, NULL, "can't create DAOS request");
-
-                /* Open next group in path */
-                if(NULL == (obj = (H5_daos_obj_t *)H5_daos_group_open_helper(item->file,
-                        H5P_GROUP_ACCESS_DEFAULT, FALSE, int_int_req, first_task, dep_task)))
+                /* Open next group in path.  If only links will be followed
+                 * from it and no groups will be created in it, only open it
+                 * to follow links. */
+                if(NULL == (obj = H5_daos_group_traverse_open(item->file,
+                        !crt_intermed_grp && (final_link_only || H5_daos_group_traverse_more(next_obj + 1)),
+                        req, first_task, dep_task)))
                     D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group");
 
-                /* Create task to finalize internal operation */
-                if(H5_daos_create_task(H5_daos_h5op_finalize, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                        NULL, NULL, int_int_req, &int_int_req->finalize_task) < 0)
-                    D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL, "can't create task to finalize internal operation");
-
-                /* Schedule finalize task (or save it to be scheduled later),
-                 * give it ownership of int_int_req, and update task pointers */
-                if(*first_task) {
-                    if(0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
-                        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL, "can't schedule task to finalize H5 operation: %s", H5_daos_err_to_string(ret));
-                } /* end if */
-                else
-                    *first_task = int_int_req->finalize_task;
-                *dep_task = int_int_req->finalize_task;
-                int_int_req = NULL;
-
                 /* Retarget oid_ptr to grp->obj.oid so H5_daos_link_follow fills in
                  * the group's oid */
                 *oid_ptr = &obj->oid;
+
+                /* Add the path to this group to the path cache once it has
+                 * been resolved */
+                if(use_path_cache && H5_daos_path_cache_add(item->file, &start_oid, tmp_path_buf,
+                        (size_t)(next_obj - tmp_path_buf), path_cache_epoch, obj, req, first_task, dep_task) < 0)
+                    D_GOTO_ERROR(H5E_SYM, H5E_CANTINSERT, NULL, "can't add path to path cache");
             } /* end if */
 
             /* Advance to next path element */
@@ -239,21 +293,534 @@ done:
         if(obj && H5_daos_object_close(&obj->item) < 0)
             D_DONE_ERROR(H5E_FILE, H5E_CLOSEERROR, NULL, "can't close object");
 
+        /* Free memory */
+        tmp_path_buf = DV_free(tmp_path_buf);
+    } /* end if */
+
+    /* Make sure we cleaned up */
+    assert(!tmp_path_buf);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_group_traverse() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_group_traverse_more
+ *
+ * Purpose:     Determines if any links remain to be followed to groups
+ *              in the rest of a path being traversed, i.e. if path
+ *              contains a '/' after a component other than ".".
+ *
+ * Return:      TRUE if a link remains to be followed to a group, FALSE
+ *              otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_group_traverse_more(const char *path)
+{
+    const char *next_obj;
+
+    assert(path);
+
+    while(NULL != (next_obj = strchr(path, '/'))) {
+        if(!(next_obj - path == 1 && path[0] == '.'))
+            return TRUE;
+        path = next_obj + 1;
+    } /* end while */
+
+    return FALSE;
+} /* end H5_daos_group_traverse_more() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_group_traverse_open
+ *
+ * Purpose:     Opens a group within H5_daos_group_traverse as an internal
+ *              operation integrated into the traversal's task chain.  If
+ *              link_only is TRUE the group is opened with
+ *              H5_daos_group_open_link_only(), otherwise it is opened
+ *              fully.  The caller must fill in the group's oid before the
+ *              scheduled tasks are allowed to run.
+ *
+ * Return:      Success:        group object.
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_daos_obj_t *
+H5_daos_group_traverse_open(H5_daos_file_t *file, hbool_t link_only,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_req_t *int_int_req = NULL;
+    H5_daos_obj_t *obj = NULL;
+    int ret;
+    H5_daos_obj_t *ret_value = NULL;
+
+    assert(file);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Start internal H5 operation for group open.  This will
+     * not be visible to the API, will not be added to an operation
+     * pool, and will be integrated into this function's task chain. */
+    if(NULL == (int_int_req = H5_daos_req_create(file, "group open within group traversal",
+            NULL, NULL, req, H5I_INVALID_HID)))
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTALLOC, NULL, "can't create DAOS request");
+
+    /* Open group */
+    if(link_only) {
+        if(NULL == (obj = (H5_daos_obj_t *)H5_daos_group_open_link_only(file,
+                int_int_req, first_task, dep_task)))
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group");
+    } /* end if */
+    else if(NULL == (obj = (H5_daos_obj_t *)H5_daos_group_open_helper(file,
+            H5P_GROUP_ACCESS_DEFAULT, FALSE, int_int_req, first_task, dep_task)))
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group");
+
+    /* Create task to finalize internal operation */
+    if(H5_daos_create_task(H5_daos_h5op_finalize, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            NULL, NULL, int_int_req, &int_int_req->finalize_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL, "can't create task to finalize internal operation");
+
+    /* Schedule finalize task (or save it to be scheduled later),
+     * give it ownership of int_int_req, and update task pointers */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL, "can't schedule task to finalize H5 operation: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = int_int_req->finalize_task;
+    *dep_task = int_int_req->finalize_task;
+    int_int_req = NULL;
+
+    /* Set return value */
+    ret_value = obj;
+
+done:
+    /* Cleanup on failure */
+    if(NULL == ret_value) {
+        /* Close group */
+        if(obj && H5_daos_group_close_real((H5_daos_group_t *)obj) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, NULL, "can't close group");
+
         /* Close internal request */
         if(int_int_req && H5_daos_req_free_int(int_int_req) < 0)
             D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, NULL, "can't free request");
         int_int_req = NULL;
-
-        /* Free memory */
-        tmp_path_buf = DV_free(tmp_path_buf);
     } /* end if */
 
     /* Make sure we cleaned up */
-    assert(!tmp_path_buf);
     assert(!int_int_req);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_group_traverse() */
+} /* end H5_daos_group_traverse_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_group_open_link_only
+ *
+ * Purpose:     Opens a group only so links can be read from it, for groups
+ *              passed through during path traversal.  Only the group's
+ *              DAOS object is opened, the group's metadata (GCPL) is not
+ *              read and the group's gcpl_id and gcpl_cache are left at
+ *              their defaults, so the group must not be returned to the
+ *              user or have links created in it.  It is the
+ *              responsibility of the calling function to make sure that
+ *              the group's oid field is filled in before scheduled tasks
+ *              are allowed to run.
+ *
+ * Return:      Success:        group object.
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_daos_group_t *
+H5_daos_group_open_link_only(H5_daos_file_t *file, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_group_t *grp = NULL;
+    H5_daos_group_t *ret_value = NULL;
+
+    assert(file);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate the group object */
+    if(NULL == (grp = H5FL_CALLOC(H5_daos_group_t)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate DAOS group struct");
+    grp->obj.item.type = H5I_GROUP;
+    grp->obj.item.open_req = req;
+    req->rc++;
+    grp->obj.item.file = file;
+    grp->obj.item.rc = 1;
+    grp->obj.obj_oh = DAOS_HDL_INVAL;
+    grp->gcpl_id = H5P_GROUP_CREATE_DEFAULT;
+    grp->gapl_id = H5P_GROUP_ACCESS_DEFAULT;
+    grp->link_only = TRUE;
+
+    /* Open group object */
+    if(H5_daos_obj_open(file, req, &grp->obj.oid, file->flags & H5F_ACC_RDWR ? DAOS_COO_RW : DAOS_COO_RO,
+            &grp->obj.obj_oh, "group object open", first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group object");
+
+    ret_value = grp;
+
+done:
+    /* Cleanup on failure */
+    if(NULL == ret_value)
+        /* Close group */
+        if(grp && H5_daos_group_close_real(grp) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, NULL, "can't close group");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_group_open_link_only() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_hash
+ *
+ * Purpose:     Hash function for the path cache hash table.  Hashes the
+ *              starting group's oid and the path of a cache entry.
+ *
+ * Return:      Hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_path_cache_hash(dv_hash_table_key_t key)
+{
+    H5_daos_path_cache_ent_t *ent = (H5_daos_path_cache_ent_t *)key;
+    uint64_t hash = UINT64_C(14695981039346656037);
+    size_t i;
+
+    assert(ent);
+
+    /* FNV-1a */
+    hash ^= ent->start_oid.lo;
+    hash *= UINT64_C(1099511628211);
+    hash ^= ent->start_oid.hi;
+    hash *= UINT64_C(1099511628211);
+    for(i = 0; i < ent->path_len; i++) {
+        hash ^= (uint64_t)(unsigned char)ent->path[i];
+        hash *= UINT64_C(1099511628211);
+    } /* end for */
+
+    return hash;
+} /* end H5_daos_path_cache_hash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_equal
+ *
+ * Purpose:     Comparison function for the path cache hash table.
+ *
+ * Return:      Non-zero if the two entries are for the same path from the
+ *              same starting group, zero otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_path_cache_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2)
+{
+    H5_daos_path_cache_ent_t *ent1 = (H5_daos_path_cache_ent_t *)key1;
+    H5_daos_path_cache_ent_t *ent2 = (H5_daos_path_cache_ent_t *)key2;
+
+    assert(ent1);
+    assert(ent2);
+
+    return (ent1->start_oid.lo == ent2->start_oid.lo)
+            && (ent1->start_oid.hi == ent2->start_oid.hi)
+            && (ent1->path_len == ent2->path_len)
+            && !memcmp(ent1->path, ent2->path, ent1->path_len);
+} /* end H5_daos_path_cache_equal() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_ent_free
+ *
+ * Purpose:     Frees a path cache entry.  Registered as the value free
+ *              function for the path cache hash table.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_path_cache_ent_free(dv_hash_table_value_t value)
+{
+    assert(value);
+
+    (void)DV_free(value);
+
+    return;
+} /* end H5_daos_path_cache_ent_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_invalidate
+ *
+ * Purpose:     Removes all entries from a file's path cache and prevents
+ *              traversals already in progress from adding entries.  Must
+ *              be called whenever a link may be removed or changed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_path_cache_invalidate(H5_daos_file_t *file)
+{
+    assert(file);
+
+    if(file->path_cache.table) {
+        dv_hash_table_free(file->path_cache.table);
+        file->path_cache.table = NULL;
+    } /* end if */
+    file->path_cache.epoch++;
+
+    return;
+} /* end H5_daos_path_cache_invalidate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_lookup
+ *
+ * Purpose:     Looks up the longest prefix of path that ends before a '/'
+ *              in a file's path cache, with paths relative to the group
+ *              with oid start_oid.  Expired entries are removed.  Because
+ *              only prefixes ending before a '/' are looked up, the final
+ *              component of path is never resolved from the cache.
+ *
+ * Return:      TRUE if a prefix was found, in which case prefix_len and
+ *              oid are set to its length and the oid of the group it
+ *              resolves to.  FALSE otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_path_cache_lookup(H5_daos_file_t *file, const daos_obj_id_t *start_oid,
+    const char *path, size_t *prefix_len, daos_obj_id_t *oid)
+{
+    H5_daos_path_cache_ent_t key_ent;
+    H5_daos_path_cache_ent_t *ent;
+    double ttl;
+    double now = 0.0;
+    size_t len;
+
+    assert(file);
+    assert(start_oid);
+    assert(path);
+    assert(prefix_len);
+    assert(oid);
+
+    if(!file->path_cache.table)
+        return FALSE;
+
+    ttl = file->fapl_cache.path_cache_ttl;
+    if(ttl > 0.0)
+        now = MPI_Wtime();
+
+    key_ent.start_oid = *start_oid;
+    key_ent.path = path;
+
+    /* Try each prefix, longest first */
+    len = strlen(path);
+    while(len > 0) {
+        /* Find the end of the next shorter prefix */
+        do
+            len--;
+        while(len > 0 && path[len] != '/');
+        if(len == 0)
+            break;
+
+        /* Look up prefix */
+        key_ent.path_len = len;
+        if(DV_HASH_TABLE_NULL != (ent = (H5_daos_path_cache_ent_t *)dv_hash_table_lookup(file->path_cache.table, &key_ent))) {
+            /* Check if the entry has expired */
+            if(ttl > 0.0 && now - ent->insert_time > ttl)
+                (void)dv_hash_table_remove(file->path_cache.table, &key_ent);
+            else {
+                *prefix_len = len;
+                *oid = ent->oid;
+                return TRUE;
+            } /* end else */
+        } /* end if */
+    } /* end while */
+
+    return FALSE;
+} /* end H5_daos_path_cache_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_add
+ *
+ * Purpose:     Creates a task to add the first path_len characters of
+ *              path, relative to the group with oid start_oid, to a
+ *              file's path cache once the oid of grp, the group the path
+ *              resolves to, has been filled in.  The entry is only added
+ *              if the traversal succeeded and the cache has not been
+ *              invalidated since epoch was read from it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_path_cache_add(H5_daos_file_t *file, const daos_obj_id_t *start_oid,
+    const char *path, size_t path_len, uint64_t epoch, H5_daos_obj_t *grp,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_path_cache_add_ud_t *add_udata = NULL;
+    tse_task_t *add_task;
+    char *ent_path;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+    assert(start_oid);
+    assert(path);
+    assert(path_len > 0);
+    assert(grp);
+    assert(grp->item.type == H5I_GROUP);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate task udata struct */
+    if(NULL == (add_udata = (H5_daos_path_cache_add_ud_t *)DV_calloc(sizeof(H5_daos_path_cache_add_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate path cache add user data");
+    add_udata->req = req;
+    add_udata->epoch = epoch;
+
+    /* Allocate entry, with the path stored right after it */
+    if(NULL == (add_udata->ent = (H5_daos_path_cache_ent_t *)DV_malloc(sizeof(H5_daos_path_cache_ent_t) + path_len)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate path cache entry");
+    ent_path = (char *)(add_udata->ent + 1);
+    (void)memcpy(ent_path, path, path_len);
+    add_udata->ent->start_oid = *start_oid;
+    add_udata->ent->path = ent_path;
+    add_udata->ent->path_len = path_len;
+
+    /* Create task to add entry */
+    if(H5_daos_create_task(H5_daos_path_cache_add_task, *dep_task ? 1 : 0,
+            *dep_task ? dep_task : NULL, NULL, NULL, add_udata, &add_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't create task to add path to path cache");
+
+    /* Schedule task (or save it to be scheduled later) and give it a
+     * reference to req and grp */
+    add_udata->grp = (H5_daos_group_t *)grp;
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(add_task, false)))
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't schedule task to add path to path cache: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = add_task;
+    req->rc++;
+    grp->item.rc++;
+    add_udata = NULL;
+
+    /* Update dep_task */
+    *dep_task = add_task;
+
+done:
+    /* Cleanup on failure */
+    if(add_udata) {
+        assert(ret_value < 0);
+        add_udata->ent = DV_free(add_udata->ent);
+        add_udata = DV_free(add_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_path_cache_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_add_task
+ *
+ * Purpose:     Asynchronous task for H5_daos_path_cache_add().  If the
+ *              cache is full, all entries are removed before adding the
+ *              new one.  Failure to add an entry is not an error.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_path_cache_add_task(tse_task_t *task)
+{
+    H5_daos_path_cache_add_ud_t *udata = NULL;
+    H5_daos_file_t *file;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for path cache add task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    file = udata->grp->obj.item.file;
+
+    /* Do not add the entry if the cache was invalidated after the traversal
+     * started */
+    if(udata->epoch != file->path_cache.epoch)
+        D_GOTO_DONE(0);
+
+    /* Create the hash table if necessary, or empty it if it is full */
+    if(file->path_cache.table && dv_hash_table_num_entries(file->path_cache.table)
+            >= (uint64_t)file->fapl_cache.path_cache_nents) {
+        dv_hash_table_free(file->path_cache.table);
+        file->path_cache.table = NULL;
+    } /* end if */
+    if(!file->path_cache.table) {
+        if(NULL == (file->path_cache.table = dv_hash_table_new(H5_daos_path_cache_hash, H5_daos_path_cache_equal)))
+            D_GOTO_DONE(0);
+        dv_hash_table_register_free_functions(file->path_cache.table, NULL, H5_daos_path_cache_ent_free);
+    } /* end if */
+
+    /* Add entry.  On success the hash table owns the entry. */
+    udata->ent->oid = udata->grp->obj.oid;
+    udata->ent->insert_time = file->fapl_cache.path_cache_ttl > 0.0 ? MPI_Wtime() : 0.0;
+    if(dv_hash_table_insert(file->path_cache.table, udata->ent, udata->ent))
+        udata->ent = NULL;
+
+done:
+    /* Clean up */
+    if(udata) {
+        /* Close group */
+        if(udata->grp && H5_daos_group_close_real(udata->grp) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status = ret_value;
+            udata->req->failed_task = "path cache add task";
+        } /* end if */
+
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free entry if it was not added and udata */
+        udata->ent = DV_free(udata->ent);
+        udata = DV_free(udata);
+    } /* end if */
+
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_path_cache_add_task() */
 
 
 /*-------------------------------------------------------------------------
@@ -608,7 +1175,7 @@ H5_daos_group_create(void *_item,
     if(name) {
         /* Queue traverse tasks */
         if(NULL == (target_obj = H5_daos_group_traverse(item, name, lcpl_id, int_req,
-                collective, &path_buf, &target_name, &target_name_len, &first_task,
+                collective, FALSE, &path_buf, &target_name, &target_name_len, &first_task,
                 &dep_task)))
             D_GOTO_ERROR(H5E_SYM, H5E_BADITER, NULL, "can't traverse path");
 
@@ -1097,7 +1664,7 @@ H5_daos_ginfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             udata->md_rw_cb_ud.req->status = task->dt_result;
             udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
         } /* end if */
-        else if(task->dt_result == 0) {
+        else if(task->dt_result == 0 || udata->omd_cache_hit) {
             assert(udata->md_rw_cb_ud.req->file);
             assert(udata->md_rw_cb_ud.obj);
             assert(udata->md_rw_cb_ud.obj->item.type == H5I_GROUP);
@@ -1123,6 +1690,15 @@ H5_daos_ginfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             if(0 != (ret = H5_daos_group_open_end((H5_daos_group_t *)udata->md_rw_cb_ud.obj,
                     udata->md_rw_cb_ud.sg_iov[0].iov_buf, (uint64_t)udata->md_rw_cb_ud.iod[0].iod_size)))
                 D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, ret, "can't finish opening group");
+
+            /* Add fetched GCPL to the object metadata cache */
+            if(!udata->omd_cache_hit) {
+                const uint8_t *field_buf = udata->md_rw_cb_ud.sg_iov[0].iov_buf;
+                size_t field_len = (size_t)udata->md_rw_cb_ud.iod[0].iod_size;
+
+                if(0 != (ret = H5_daos_omd_cache_insert(udata->md_rw_cb_ud.obj, 1, &field_buf, &field_len)))
+                    D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, ret, "can't add group metadata to object metadata cache");
+            } /* end if */
         } /* end else */
     } /* end else */
 
@@ -1294,7 +1870,7 @@ H5_daos_group_open_helper(H5_daos_file_t *file, hid_t gapl_id,
 
         /* Create task for group metadata read */
         assert(*dep_task);
-        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_md_rw_prep_cb,
+        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_omd_fetch_prep_cb,
                 H5_daos_ginfo_read_comp_cb, fetch_udata, &fetch_task) < 0)
             D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL, "can't create task to read group metadata");
 
@@ -1404,7 +1980,7 @@ H5_daos_group_open_int(H5_daos_item_t *item,
 
         /* Traverse the path */
         if(NULL == (target_obj = H5_daos_group_traverse(item, name, H5P_LINK_CREATE_DEFAULT,
-                req, collective, &path_buf, &target_name, &target_name_len, first_task, dep_task)))
+                req, collective, TRUE, &path_buf, &target_name, &target_name_len, first_task, dep_task)))
             D_GOTO_ERROR(H5E_SYM, H5E_BADITER, NULL, "can't traverse path");
 
         /* Check type of target_obj */
@@ -1877,6 +2453,7 @@ H5_daos_group_close_real(H5_daos_group_t *grp)
                           && grp->gcpl_id != H5P_FILE_CREATE_DEFAULT;
 
         /* Free group data structures */
+        H5_daos_omd_cache_release(&grp->obj);
         if(grp->obj.item.cur_op_pool)
             H5_daos_op_pool_free(grp->obj.item.cur_op_pool);
         if(grp->obj.item.open_req)
@@ -234,6 +234,7 @@ typedef struct H5_daos_link_ibco_ud_t {
     H5L_info2_t         linfo;
     hbool_t             base_iter;
     char                *null_replace_loc;
+    H5_daos_corder_walk_t corder_walk;
     tse_task_t          *ibco_metatask;
 } H5_daos_link_ibco_ud_t;
 
@@ -318,6 +319,7 @@ typedef struct H5_daos_link_gnbi_alloc_ud_t {
     H5_index_t index_type;
     H5_iter_order_t iter_order;
     uint64_t idx;
+    H5_daos_corder_walk_t *corder_walk;
     const char **link_name;
     size_t *link_name_size;
     char **link_name_buf;
@@ -331,8 +333,7 @@ typedef struct H5_daos_link_gnbc_ud_t {
     uint8_t idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     tse_task_t *gnbc_task;
     hsize_t grp_nlinks;
-    H5_iter_order_t iter_order;
-    uint64_t index;
+    uint64_t idx_key;
     size_t *link_name_size;
     char *link_name_out;
     size_t link_name_out_size;
@@ -425,6 +426,9 @@ static herr_t H5_daos_link_delete(H5_daos_item_t *item, const H5VL_loc_params_t
     tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_link_delete_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_link_delete_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_link_path_cache_invalidate_async(H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static int H5_daos_link_path_cache_invalidate_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_link_delete_corder_pretask(tse_task_t *task);
 static herr_t H5_daos_link_delete_corder(H5_daos_group_t *target_grp,
     const H5VL_loc_params_t *loc_params, const char *target_link_name,
@@ -445,9 +449,9 @@ static int H5_daos_link_gnbi_alloc_task(tse_task_t *task);
 static int H5_daos_link_gnbc_task(tse_task_t *task);
 static int H5_daos_link_gnbc_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp,
-    H5_iter_order_t iter_order, uint64_t index, size_t *link_name_size,
-    char *link_name_out, size_t link_name_out_size, H5_daos_req_t *req,
-    tse_task_t **first_task, tse_task_t **dep_task);
+    H5_iter_order_t iter_order, uint64_t index, H5_daos_corder_walk_t *corder_walk,
+    size_t *link_name_size, char *link_name_out, size_t link_name_out_size,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_link_gnbn_task(tse_task_t *task);
 static int H5_daos_link_gnbn_end_task(tse_task_t *task);
 static herr_t H5_daos_link_get_name_by_name_order(H5_daos_group_t *target_grp,
@@ -1214,6 +1218,7 @@ H5_daos_link_write(H5_daos_group_t *target_grp, const char *name,
     int ret_value = 0;
 
     assert(target_grp);
+    assert(!target_grp->link_only);
     assert(name);
     assert(link_val);
 
@@ -1538,9 +1543,13 @@ H5_daos_link_wr_corder_info_task(tse_task_t *task)
     /* Add new link to count */
     uint_nlinks++;
 
-    /* Encode remaining buffers */
+    /* Encode remaining buffers.  Sparse creation order indices are keyed
+     * by the link's permanent creation order value instead of its position
+     * in the index. */
     p = udata->nlinks_new_buf;
     UINT64ENCODE(p, uint_nlinks);
+    if(H5_DAOS_OBJ_SPARSE_CORDER(udata->md_rw_cb_ud.obj))
+        memcpy(udata->nlinks_old_buf, udata->link_write_ud->prev_max_corder_buf, H5_DAOS_ENCODED_CRT_ORDER_SIZE);
     memcpy(udata->corder_target_buf, udata->nlinks_old_buf, 8);
     udata->corder_target_buf[8] = 0;
 
@@ -2091,7 +2100,7 @@ H5_daos_link_create(H5VL_link_create_type_t create_type, void *_item,
 
     /* Find target group */
     if(NULL == (link_obj = H5_daos_group_traverse(item, loc_params->loc_data.loc_by_name.name,
-            lcpl_id, int_req, collective, &path_buf, &link_name, &link_name_len, &first_task, &dep_tasks[0])))
+            lcpl_id, int_req, collective, FALSE, &path_buf, &link_name, &link_name_len, &first_task, &dep_tasks[0])))
         D_GOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't traverse path");
     if(dep_tasks[0])
         ndeps++;
@@ -2638,6 +2647,10 @@ H5_daos_link_copy_move_int(H5_daos_item_t *src_item, const H5VL_loc_params_t *lo
     assert(loc_params2);
     assert(loc_params2->type == H5VL_OBJECT_BY_NAME);
 
+    /* Paths through the moved link may no longer resolve to the same group */
+    if(move)
+        H5_daos_path_cache_invalidate(req->file);
+
     if(!collective || (req->file->my_rank == 0)) {
         /* Allocate task udata struct */
          if(NULL == (cm_udata = (H5_daos_link_copy_move_ud_t *)DV_calloc(sizeof(H5_daos_link_copy_move_ud_t))))
@@ -2664,7 +2677,7 @@ H5_daos_link_copy_move_int(H5_daos_item_t *src_item, const H5VL_loc_params_t *lo
         /* Make this work for copying across multiple files DSINC */
         if(NULL == (src_obj = H5_daos_group_traverse(src_item ? src_item : dst_item, /* Accounting for H5L_SAME_LOC usage */
                 loc_params1->loc_data.loc_by_name.name, H5P_LINK_CREATE_DEFAULT,
-                req, FALSE, &cm_udata->src_path_buf, &src_link_name, &src_link_name_len,
+                req, FALSE, FALSE, &cm_udata->src_path_buf, &src_link_name, &src_link_name_len,
                 first_task, &dep_tasks[0])))
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get source group and source link name");
 
@@ -2674,7 +2687,7 @@ H5_daos_link_copy_move_int(H5_daos_item_t *src_item, const H5VL_loc_params_t *lo
 
         /* Determine the target group for the new link + the new link's name */
         if(NULL == (cm_udata->target_obj = H5_daos_group_traverse(dst_item ? dst_item : src_item, /* Accounting for H5L_SAME_LOC usage */
-                loc_params2->loc_data.loc_by_name.name, lcpl_id, req, FALSE,
+                loc_params2->loc_data.loc_by_name.name, lcpl_id, req, FALSE, FALSE,
                 &cm_udata->dst_path_buf, &cm_udata->new_link_name, &cm_udata->new_link_name_len,
                 first_task, &dep_tasks[1])))
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get destination group and destination link name");
@@ -2748,6 +2761,11 @@ done:
         if(H5_daos_collective_error_check(NULL, req, first_task, dep_task) < 0)
             D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't perform collective error check");
 
+    /* Invalidate the path cache again once the move is done, in case a
+     * traversal issued since setup cached a path through the old link */
+    if(move && ret_value >= 0 && H5_daos_link_path_cache_invalidate_async(req, first_task, dep_task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to invalidate path cache");
+
     /* Close source object */
     if(src_obj && H5_daos_object_close(&src_obj->item) < 0)
         D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close source object");
@@ -3171,7 +3189,7 @@ H5_daos_link_get(void *_item, const H5VL_loc_params_t *loc_params,
              */
             if(H5_daos_link_get_name_by_idx((H5_daos_group_t *)target_obj, loc_params->loc_data.loc_by_idx.idx_type,
                     loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
-                    (size_t *)ret_size, name_out, name_out_size, int_req, &first_task, &dep_task) < 0)
+                    NULL, (size_t *)ret_size, name_out, name_out_size, int_req, &first_task, &dep_task) < 0)
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't retrieve link's name");
 
             break;
@@ -3679,7 +3697,7 @@ H5_daos_link_follow_task(tse_task_t *task)
 
                     /* Traverse the path */
                     if(NULL == (target_grp = (H5_daos_group_t *)H5_daos_group_traverse(&udata->grp->obj.item,
-                            udata->link_val.target.soft, H5P_LINK_CREATE_DEFAULT, req, FALSE,
+                            udata->link_val.target.soft, H5P_LINK_CREATE_DEFAULT, req, FALSE, TRUE,
                             &udata->path_buf, &target_name, &target_name_len, &first_task,
                             &dep_task)))
                         D_GOTO_ERROR(H5E_LINK, H5E_TRAVERSE, -H5_DAOS_TRAVERSE_ERROR, "can't traverse path");
@@ -4135,7 +4153,7 @@ H5_daos_link_get_info(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
         {
             /* Traverse the path */
             if(NULL == (task_udata->target_obj = H5_daos_group_traverse(item, loc_params->loc_data.loc_by_name.name,
-                    H5P_LINK_CREATE_DEFAULT, req, FALSE, &task_udata->path_buf, &task_udata->target_name,
+                    H5P_LINK_CREATE_DEFAULT, req, FALSE, FALSE, &task_udata->path_buf, &task_udata->target_name,
                     &task_udata->target_name_len, first_task, dep_task)))
                 D_GOTO_ERROR(H5E_SYM, H5E_TRAVERSE, -H5_DAOS_TRAVERSE_ERROR, "failed to traverse path");
 
@@ -4182,7 +4200,7 @@ H5_daos_link_get_info(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
             assert(task_udata->target_obj->item.type == H5I_GROUP);
             if(H5_daos_link_get_name_by_idx_alloc((H5_daos_group_t *)task_udata->target_obj, loc_params->loc_data.loc_by_idx.idx_type,
                     loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
-                    &task_udata->target_name, &task_udata->target_name_len, &task_udata->path_buf,
+                    NULL, &task_udata->target_name, &task_udata->target_name_len, &task_udata->path_buf,
                     NULL, req, first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name");
 
@@ -4366,7 +4384,7 @@ H5_daos_link_get_val(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
         {
             /* Traverse the path */
             if(NULL == (task_udata->target_obj = H5_daos_group_traverse(item, loc_params->loc_data.loc_by_name.name,
-                    H5P_LINK_CREATE_DEFAULT, req, FALSE, &task_udata->path_buf, &task_udata->target_name,
+                    H5P_LINK_CREATE_DEFAULT, req, FALSE, TRUE, &task_udata->path_buf, &task_udata->target_name,
                     &task_udata->target_name_len, first_task, dep_task)))
                 D_GOTO_ERROR(H5E_SYM, H5E_TRAVERSE, FAIL, "failed to traverse path");
 
@@ -4415,7 +4433,7 @@ H5_daos_link_get_val(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
             assert(task_udata->target_obj->item.type == H5I_GROUP);
             if(H5_daos_link_get_name_by_idx_alloc((H5_daos_group_t *)task_udata->target_obj, loc_params->loc_data.loc_by_idx.idx_type,
                     loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
-                    &task_udata->target_name, &task_udata->target_name_len, &task_udata->path_buf,
+                    NULL, &task_udata->target_name, &task_udata->target_name_len, &task_udata->path_buf,
                     NULL, req, first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name");
 
@@ -4635,7 +4653,7 @@ H5_daos_link_exists(H5_daos_item_t *item, const char *link_path,
 
     /* Traverse the path */
     if(NULL == (fetch_udata->target_obj = H5_daos_group_traverse(item, link_path, H5P_LINK_CREATE_DEFAULT,
-            req, FALSE, &fetch_udata->path_buf, &target_name, &target_name_len, first_task, dep_task)))
+            req, FALSE, TRUE, &fetch_udata->path_buf, &target_name, &target_name_len, first_task, dep_task)))
         D_GOTO_ERROR(H5E_LINK, H5E_TRAVERSE, FAIL, "can't traverse path");
 
     /* Check type of target_obj */
@@ -5960,7 +5978,7 @@ H5_daos_link_ibco_task(tse_task_t *task)
 
         /* Get link name */
         if(H5_daos_link_get_name_by_idx_alloc(udata->target_grp, H5_INDEX_CRT_ORDER,
-                udata->iter_data->iter_order, (uint64_t)udata->crt_idx,
+                udata->iter_data->iter_order, (uint64_t)udata->crt_idx, &udata->corder_walk,
                 &udata->link_name, &udata->link_name_len, &udata->name_buf,
                 &udata->name_buf_size, udata->iter_data->req, &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name");
@@ -6255,6 +6273,10 @@ H5_daos_link_delete(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
     assert(dep_task);
     assert(H5VL_OBJECT_BY_NAME == loc_params->type || H5VL_OBJECT_BY_IDX == loc_params->type);
 
+    /* Paths through the deleted link may no longer resolve to the same
+     * group */
+    H5_daos_path_cache_invalidate(item->file);
+
     if(!collective || (item->file->my_rank == 0)) {
         /* Allocate argument struct for deletion task */
         if(NULL == (delete_udata = (H5_daos_link_delete_ud_t *)DV_calloc(sizeof(H5_daos_link_delete_ud_t))))
@@ -6273,7 +6295,7 @@ H5_daos_link_delete(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
 
             /* Traverse the path */
             if(NULL == (delete_udata->target_obj = H5_daos_group_traverse(item, loc_params->loc_data.loc_by_name.name,
-                    H5P_LINK_CREATE_DEFAULT, req, collective, &delete_udata->path_buf, &delete_udata->target_link_name,
+                    H5P_LINK_CREATE_DEFAULT, req, collective, FALSE, &delete_udata->path_buf, &delete_udata->target_link_name,
                     &delete_udata->target_link_name_len, first_task, dep_task)))
                 D_GOTO_ERROR(H5E_SYM, H5E_TRAVERSE, FAIL, "can't traverse path");
         }
@@ -6321,7 +6343,7 @@ H5_daos_link_delete(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
             assert(delete_udata->target_obj->item.type == H5I_GROUP);
             if(H5_daos_link_get_name_by_idx_alloc((H5_daos_group_t *)delete_udata->target_obj,
                     loc_params->loc_data.loc_by_idx.idx_type, loc_params->loc_data.loc_by_idx.order,
-                    (uint64_t)loc_params->loc_data.loc_by_idx.n, &delete_udata->target_link_name,
+                    (uint64_t)loc_params->loc_data.loc_by_idx.n, NULL, &delete_udata->target_link_name,
                     &delete_udata->target_link_name_len, &delete_udata->path_buf, NULL,
                     req, first_task, dep_task) < 0)
                 D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link name");
@@ -6410,6 +6432,11 @@ done:
         if(H5_daos_collective_error_check(NULL, req, first_task, dep_task) < 0)
             D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't perform collective error check");
 
+    /* Invalidate the path cache again once the link is gone, in case a
+     * traversal issued since setup cached a path through it */
+    if(ret_value >= 0 && H5_daos_link_path_cache_invalidate_async(req, first_task, dep_task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to invalidate path cache");
+
     if(ret_value < 0) {
         /* Close internal request for target object open */
         if(int_int_req && H5_daos_req_free_int(int_int_req) < 0)
@@ -6636,6 +6663,109 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_link_delete_comp_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_path_cache_invalidate_async
+ *
+ * Purpose:     Creates a task, after *dep_task, that invalidates the
+ *              file's path cache.  Used by operations that remove or
+ *              change links, which also invalidate the cache at setup:
+ *              invalidating again when they finish drops any entries
+ *              added by traversals that ran while the link was still
+ *              present.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_link_path_cache_invalidate_async(H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    tse_task_t *invalidate_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Create empty task (comp_cb will invalidate the path cache) */
+    if(H5_daos_create_task(H5_daos_metatask_autocomplete, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            NULL, H5_daos_link_path_cache_invalidate_comp_cb, req, &invalidate_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to invalidate path cache");
+
+    /* Schedule task (or save it to be scheduled later) and give it a
+     * reference to req */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(invalidate_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't schedule task to invalidate path cache: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = invalidate_task;
+    req->rc++;
+    *dep_task = invalidate_task;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_path_cache_invalidate_async() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_path_cache_invalidate_comp_cb
+ *
+ * Purpose:     Complete callback for the task created by
+ *              H5_daos_link_path_cache_invalidate_async().  Invalidates
+ *              the path cache whether or not the operation succeeded,
+ *              since the link may have been changed either way.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_path_cache_invalidate_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_req_t *req;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (req = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for path cache invalidation task");
+
+    assert(req->file);
+
+    /* Drop entries cached while the link was changing */
+    H5_daos_path_cache_invalidate(req->file);
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if(req) {
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            req->status = ret_value;
+            req->failed_task = "path cache invalidation task completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(req) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_path_cache_invalidate_comp_cb() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_delete_corder
@@ -6699,11 +6829,20 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
 
     *dep_task = update_task;
 
+    /* If the group's creation order index is sparse, it is keyed by the
+     * link's permanent creation order value, which can be looked up directly
+     * from the link name whether the link was specified by name or by index.
+     */
+    if(H5_DAOS_OBJ_SPARSE_CORDER(&target_grp->obj)) {
+        if(H5_daos_link_get_crt_order_by_name(target_grp, corder_delete_ud->target_link_name,
+                &corder_delete_ud->delete_idx, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link creation order value");
+    } /* end if */
     /* If originally iterating by name order, create a task to iterate over links
      * by creation order and match the target link name to a creation order index
      * value.
      */
-    if(H5VL_OBJECT_BY_NAME == loc_params->type) {
+    else if(H5VL_OBJECT_BY_NAME == loc_params->type) {
         H5_daos_iter_data_t iter_data;
 
         /* Register ID for group for link iteration */
@@ -6729,7 +6868,8 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
          *       value of the link using the 'link name -> creation order' mapping and then
          *       using that value as the starting point for iteration. In this case, the
          *       iteration order MUST be switched to H5_ITER_DEC or the key will not be
-         *       found by the iteration.
+         *       found by the iteration.  Groups with sparse creation order indices
+         *       (see H5daos_set_sparse_crt_order_index()) avoid this entirely.
          */
         if(H5_daos_link_iterate(target_grp, &iter_data, first_task, dep_task) < 0)
             D_GOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "link iteration failed");
@@ -6757,23 +6897,32 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
     target_grp->obj.item.rc++;
     *dep_task = delete_task;
 
-    /* Create task to perform bookkeeping on group's link creation
-     * order index if necessary.
-     */
-    if(H5_daos_create_task(H5_daos_link_delete_corder_bookkeep_task, *dep_task ? 1 : 0,
-            *dep_task ? dep_task : NULL, NULL, NULL, corder_delete_ud, &bookkeep_task) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to update group's link creation order index");
-
-    /* Schedule group link creation order index update task */
-    if(*first_task) {
-        if(0 != (ret = tse_task_schedule(bookkeep_task, false)))
-            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't schedule task to update group's link creation order index: %s", H5_daos_err_to_string(ret));
+    /* Sparse creation order indices leave a hole for the deleted link, so
+     * only the index's hole count tree needs to be updated */
+    if(H5_DAOS_OBJ_SPARSE_CORDER(&target_grp->obj)) {
+        if(H5_daos_corder_idx_remove(&target_grp->obj, H5_DAOS_CORDER_IDX_LINK, &corder_delete_ud->delete_idx,
+                req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't update group's link creation order index");
     } /* end if */
-    else
-        *first_task = bookkeep_task;
-    req->rc++;
-    target_grp->obj.item.rc++;
-    *dep_task = bookkeep_task;
+    else {
+        /* Create task to perform bookkeeping on group's link creation
+         * order index if necessary.
+         */
+        if(H5_daos_create_task(H5_daos_link_delete_corder_bookkeep_task, *dep_task ? 1 : 0,
+                *dep_task ? dep_task : NULL, NULL, NULL, corder_delete_ud, &bookkeep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to update group's link creation order index");
+
+        /* Schedule group link creation order index update task */
+        if(*first_task) {
+            if(0 != (ret = tse_task_schedule(bookkeep_task, false)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't schedule task to update group's link creation order index: %s", H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            *first_task = bookkeep_task;
+        req->rc++;
+        target_grp->obj.item.rc++;
+        *dep_task = bookkeep_task;
+    } /* end else */
 
     /* Create final task to free udata */
     if(H5_daos_create_task(H5_daos_link_delete_corder_finish, *dep_task ? 1 : 0,
@@ -6956,9 +7105,9 @@ H5_daos_link_delete_corder_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args
 
     /* If iteration was done by creation order, determine the
      * index of the link to delete creation order info for now.
-     * If iteration was done by name order, the index will have
-     * been setup by a previous task. */
-    if(H5VL_OBJECT_BY_IDX == udata->loc_params->type) {
+     * If iteration was done by name order, or the group's index is
+     * sparse, the index will have been setup by a previous task. */
+    if(H5VL_OBJECT_BY_IDX == udata->loc_params->type && !H5_DAOS_OBJ_SPARSE_CORDER(&udata->target_grp->obj)) {
         /* DSINC - no check for safe cast here */
         udata->delete_idx = (H5_ITER_DEC == udata->loc_params->loc_data.loc_by_idx.order) ?
                 (uint64_t)udata->grp_nlinks - (uint64_t)udata->loc_params->loc_data.loc_by_idx.n :
@@ -7837,7 +7986,7 @@ H5_daos_link_gnbi_alloc_task(tse_task_t *task)
 
         /* Reissue call with larger buffer and transfer ownership of udata */
         if(H5_daos_link_get_name_by_idx(udata->target_grp, udata->index_type,
-                udata->iter_order, udata->idx, udata->link_name_size,
+                udata->iter_order, udata->idx, udata->corder_walk, udata->link_name_size,
                 *udata->link_name_buf, udata->cur_link_name_size, udata->req,
                 &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name by index");
@@ -7908,7 +8057,8 @@ done:
 herr_t
 H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp,
     H5_index_t index_type, H5_iter_order_t iter_order, uint64_t idx,
-    const char **link_name, size_t *link_name_size, char **link_name_buf,
+    H5_daos_corder_walk_t *corder_walk, const char **link_name,
+    size_t *link_name_size, char **link_name_buf,
     size_t *link_name_buf_size, H5_daos_req_t *req, tse_task_t **first_task,
     tse_task_t **dep_task)
 {
@@ -7924,6 +8074,7 @@ H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp,
     gnbi_udata->index_type = index_type;
     gnbi_udata->iter_order = iter_order;
     gnbi_udata->idx = idx;
+    gnbi_udata->corder_walk = corder_walk;
     gnbi_udata->link_name = link_name;
     gnbi_udata->link_name_size = link_name_size;
     gnbi_udata->link_name_buf = link_name_buf;
@@ -7944,7 +8095,7 @@ H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp,
 
     /* Call underlying function */
     if(H5_daos_link_get_name_by_idx(target_grp, index_type, iter_order, idx,
-            gnbi_udata->link_name_size, *gnbi_udata->link_name_buf,
+            corder_walk, gnbi_udata->link_name_size, *gnbi_udata->link_name_buf,
             gnbi_udata->cur_link_name_size, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link name by index");
 
@@ -7990,6 +8141,12 @@ done:
  *              length of the link's name is simply returned. If non-NULL,
  *              the link's name is stored in link_name_out.
  *
+ *              corder_walk may be NULL.  When retrieving the names of
+ *              consecutive links in the creation order index, pass the
+ *              same zeroed walk to each call (see
+ *              H5_daos_corder_idx_lookup()).  It is ignored for the name
+ *              index.
+ *
  * Return:      Success:        SUCCEED (0)
  *              Failure:        FAIL (Negative)
  *
@@ -7997,7 +8154,8 @@ done:
  */
 herr_t
 H5_daos_link_get_name_by_idx(H5_daos_group_t *target_grp, H5_index_t index_type,
-    H5_iter_order_t iter_order, uint64_t idx, size_t *link_name_size,
+    H5_iter_order_t iter_order, uint64_t idx, H5_daos_corder_walk_t *corder_walk,
+    size_t *link_name_size,
     char *link_name_out, size_t link_name_out_size, H5_daos_req_t *req,
     tse_task_t **first_task, tse_task_t **dep_task)
 {
@@ -8007,7 +8165,7 @@ H5_daos_link_get_name_by_idx(H5_daos_group_t *target_grp, H5_index_t index_type,
 
     if(H5_INDEX_CRT_ORDER == index_type) {
         if(H5_daos_link_get_name_by_crt_order(target_grp, iter_order, idx,
-                link_name_size, link_name_out, link_name_out_size, req,
+                corder_walk, link_name_size, link_name_out, link_name_out_size, req,
                 first_task, dep_task) < 0)
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't retrieve link name from creation order index");
     } /* end if */
@@ -8041,7 +8199,6 @@ static int
 H5_daos_link_gnbc_task(tse_task_t *task)
 {
     H5_daos_link_gnbc_ud_t *udata = NULL;
-    uint64_t fetch_idx = 0;
     tse_task_t *fetch_task = NULL;
     tse_task_t *first_task = NULL;
     uint8_t *p;
@@ -8061,18 +8218,10 @@ H5_daos_link_gnbc_task(tse_task_t *task)
     if(!((H5_daos_group_t *)(udata->md_rw_cb_ud.obj))->gcpl_cache.track_corder)
         D_GOTO_ERROR(H5E_SYM, H5E_BADVALUE, (-1), "creation order is not tracked for group");
 
-    /* Ensure the index is within range */
-    if(udata->index >= (uint64_t)udata->grp_nlinks)
-        D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
-
-    /* Calculate the correct index of the link, based upon the iteration order */
-    if(H5_ITER_DEC == udata->iter_order)
-        fetch_idx = (uint64_t)udata->grp_nlinks - udata->index - 1;
-    else
-        fetch_idx = udata->index;
-
+    /* Encode the key of the link in the creation order index, found by
+     * H5_daos_corder_idx_lookup() */
     p = udata->idx_buf;
-    UINT64ENCODE(p, fetch_idx);
+    UINT64ENCODE(p, udata->idx_key);
 
     /* Set up dkey */
     daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.dkey, H5_daos_link_corder_key_g, H5_daos_link_corder_key_size_g);
@@ -8257,8 +8406,9 @@ done:
  */
 static herr_t
 H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t iter_order,
-    uint64_t index, size_t *link_name_size, char *link_name_out, size_t link_name_out_size,
-    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+    uint64_t index, H5_daos_corder_walk_t *corder_walk, size_t *link_name_size,
+    char *link_name_out, size_t link_name_out_size, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_link_gnbc_ud_t *gnbc_udata = NULL;
     int ret;
@@ -8272,8 +8422,6 @@ H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate get name by creation order user data");
     gnbc_udata->md_rw_cb_ud.req = req;
     gnbc_udata->md_rw_cb_ud.obj = &target_grp->obj;
-    gnbc_udata->iter_order = iter_order;
-    gnbc_udata->index = index;
     gnbc_udata->link_name_size = link_name_size;
     gnbc_udata->link_name_out = link_name_out;
     gnbc_udata->link_name_out_size = link_name_out_size;
@@ -8282,6 +8430,11 @@ H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t
     if(H5_daos_group_get_num_links(target_grp, &gnbc_udata->grp_nlinks, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, (-1), "can't get number of links in group");
 
+    /* Find the key of the link in the group's creation order index */
+    if(H5_daos_corder_idx_lookup(&target_grp->obj, H5_DAOS_CORDER_IDX_LINK, &gnbc_udata->grp_nlinks,
+            iter_order, index, corder_walk, &gnbc_udata->idx_key, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, (-1), "can't look up link in creation order index");
+
     /* Create task to finish this operation */
     if(H5_daos_create_task(H5_daos_link_gnbc_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
             NULL, NULL, gnbc_udata, &gnbc_udata->gnbc_task) < 0)
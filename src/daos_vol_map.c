@@ -24,7 +24,14 @@
 
 #define H5_DAOS_MINFO_BCAST_BUF_SIZE (                                 \
         (2 * H5_DAOS_TYPE_BUF_SIZE) + H5_DAOS_MCPL_BUF_SIZE            \
-      + H5_DAOS_ENCODED_OID_SIZE + (3 * H5_DAOS_ENCODED_UINT64_T_SIZE))
+      + H5_DAOS_ENCODED_OID_SIZE + (7 * H5_DAOS_ENCODED_UINT64_T_SIZE))
+
+/* Bloom filter sizing.  10 bits per key and 7 hashes gives a false positive
+ * rate of about 1% when the map holds the expected number of keys. */
+#define H5_DAOS_MAP_BLOOM_BITS_PER_KEY 10
+#define H5_DAOS_MAP_BLOOM_NHASHES 7
+#define H5_DAOS_MAP_BLOOM_MIN_BITS 64
+#define H5_DAOS_MAP_BLOOM_MAX_NHASHES 16
 
 /************************************/
 /* Local Type and Struct Definition */
@@ -57,6 +64,7 @@ typedef struct H5_daos_map_exists_ud_t {
     void *key_buf_alloc;
     size_t key_size;
     hbool_t *exists_ret;
+    hbool_t bloom_absent;
 } H5_daos_map_exists_ud_t;
 
 /* A struct used to operate on a single key-value
@@ -79,8 +87,31 @@ typedef struct H5_daos_map_iter_op_ud_t {
     hbool_t shared_dkey;
     daos_key_t dkey;
     daos_iod_t iod;
+    /* Fields for fetching the value when iterating with prefetched
+     * values.  value is set once the batch's values are converted, it
+     * is NULL if the dkey has no map record. */
+    daos_sg_list_t sgl;
+    daos_iov_t sg_iov;
+    const void *value;
 } H5_daos_map_iter_op_ud_t;
 
+/* Values fetched for a batch of keys listed during map iteration with
+ * prefetched values.  All values are fetched concurrently into buf, then
+ * converted together before the operator is called on each key. */
+typedef struct H5_daos_map_iter_vals_t {
+    H5_daos_req_t *req;
+    H5_daos_map_t *map;
+    hid_t val_mem_type_id;
+    htri_t need_tconv;
+    size_t val_file_type_size;
+    size_t val_mem_type_size;
+    void *buf;
+    void *bkg_buf;
+    size_t nconv;
+    size_t nr;
+    H5_daos_map_iter_op_ud_t **op_udata;
+} H5_daos_map_iter_vals_t;
+
 /* Task user data for deleting a key-value pair from a map */
 typedef struct H5_daos_map_delete_key_ud_t {
     H5_daos_req_t *req;
@@ -93,6 +124,71 @@ typedef struct H5_daos_map_delete_key_ud_t {
     size_t key_size;
 } H5_daos_map_delete_key_ud_t;
 
+/* Task user data for writing or deleting a key in a map that counts its
+ * keys, in a transaction with the count update.  md_rw_cb_ud is used to read
+ * and write the count, key_dkey and key_iod to check if the key exists and
+ * key_ud (for writes) or key_akey (for deletes of a shared dkey) to write or
+ * punch the key.  tx_status holds the first failure in the current attempt
+ * at the transaction. */
+typedef struct H5_daos_map_key_count_ud_t {
+    H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
+    tse_task_t *tx_task;
+    daos_handle_t th;
+    hbool_t th_open;
+    int tx_status;
+    H5_daos_md_rw_cb_ud_t *key_ud;
+    daos_key_t key_dkey;
+    daos_key_t key_akey;
+    hbool_t punch_akey;
+    daos_iod_t key_iod;
+    uint8_t nkeys_buf[H5_DAOS_ENCODED_NUM_KEYS_SIZE];
+} H5_daos_map_key_count_ud_t;
+
+/* Task user data for reading the key count of a map */
+typedef struct H5_daos_map_read_key_count_ud_t {
+    H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
+    hsize_t *count;
+    uint8_t nkeys_buf[H5_DAOS_ENCODED_NUM_KEYS_SIZE];
+} H5_daos_map_read_key_count_ud_t;
+
+/* Task user data for reading and writing a map's bloom filter.  recx
+ * describes the records of the filter bitmap. */
+typedef struct H5_daos_map_bloom_ud_t {
+    H5_daos_md_rw_cb_ud_t md_rw_cb_ud; /* Must be first */
+    daos_recx_t recx;
+} H5_daos_map_bloom_ud_t;
+
+/* User data for rebuilding a map's bloom filter.  bits holds the new
+ * filter. */
+typedef struct H5_daos_map_bloom_rebuild_ud_t {
+    H5_daos_map_t *map;
+    uint8_t *bits;
+    hid_t dxpl_id;
+} H5_daos_map_bloom_rebuild_ud_t;
+
+/* Task user data for multi-key map I/O.  Keys are set up and issued one
+ * window at a time by the window task, which runs again once all keys in
+ * the window are done, so only one window's task udata and key conversion
+ * buffers exist at a time.  window_tasks holds the last task for each key
+ * in the current window.  end_task is completed once the last window
+ * finishes. */
+typedef struct H5_daos_map_io_multi_ud_t {
+    H5_daos_req_t *req;
+    H5_daos_map_t *map;
+    H5_daos_io_type_t io_type;
+    size_t count;
+    size_t next_key;
+    hid_t key_mem_type_id;
+    size_t key_mem_type_size;
+    const uint8_t *keys;
+    hid_t val_mem_type_id;
+    size_t val_mem_type_size;
+    uint8_t *values;
+    hid_t dxpl_id;
+    tse_task_t **window_tasks;
+    tse_task_t *end_task;
+} H5_daos_map_io_multi_ud_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -101,7 +197,8 @@ static int H5_daos_minfo_read_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_map_open_bcast_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_map_open_recv_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_map_open_end(H5_daos_map_t *map, uint8_t *p,
-    uint64_t ktype_buf_len, uint64_t vtype_buf_len, uint64_t mcpl_buf_len, hid_t dxpl_id);
+    uint64_t ktype_buf_len, uint64_t vtype_buf_len, uint64_t mcpl_buf_len,
+    hbool_t track_key_count, const H5_daos_map_bloom_t *bloom, hid_t dxpl_id);
 
 static herr_t H5_daos_map_key_conv(hid_t src_type_id, hid_t dst_type_id,
     const void *key, const void **key_buf, size_t *key_size,
@@ -109,20 +206,74 @@ static herr_t H5_daos_map_key_conv(hid_t src_type_id, hid_t dst_type_id,
 static herr_t H5_daos_map_key_conv_reverse(hid_t src_type_id, hid_t dst_type_id,
     void *key, size_t key_size, void **key_buf, void **key_buf_alloc,
     H5_daos_vl_union_t *vl_union, hid_t dxpl_id);
+static herr_t H5_daos_map_get_val_task(H5_daos_map_t *map, hid_t key_mem_type_id,
+    const void *key, hid_t val_mem_type_id, void *value, hid_t dxpl_id,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_map_get_val_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_map_put_task(H5_daos_map_t *map, hid_t key_mem_type_id,
+    const void *key, hid_t val_mem_type_id, const void *value, hid_t dxpl_id,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_map_put_fill_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_map_put_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_map_key_count_update(H5_daos_map_t *map,
+    const daos_key_t *key_dkey, const daos_key_t *key_akey,
+    H5_daos_md_rw_cb_ud_t *key_ud, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static int H5_daos_map_key_count_tx_task(tse_task_t *task);
+static herr_t H5_daos_map_key_count_tx_attempt(H5_daos_map_key_count_ud_t *udata,
+    hbool_t restart);
+static int H5_daos_map_key_count_exists_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_map_key_count_fetch_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_map_key_count_key_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_map_key_count_update_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_map_key_count_tx_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_map_key_count_tx_end_task(tse_task_t *task);
+static int H5_daos_map_key_count_tx_commit_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_map_key_count_tx_finish(H5_daos_map_key_count_ud_t *udata);
+static herr_t H5_daos_map_io_multi(hid_t map_id, size_t count,
+    hid_t key_mem_type_id, const void *keys, hid_t val_mem_type_id,
+    const void *values, hid_t dxpl_id, H5_daos_io_type_t io_type);
+static int H5_daos_map_io_multi_window_task(tse_task_t *task);
 
 static int H5_daos_map_exists_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_map_exists_comp_cb(tse_task_t *task, void *args);
 
+static void H5_daos_map_bloom_size(hsize_t expected_keys, uint64_t *nbits,
+    uint64_t *nhashes);
+static void H5_daos_map_bloom_hash(const void *key, size_t key_size,
+    uint64_t *h1, uint64_t *h2);
+static hbool_t H5_daos_map_bloom_test(const H5_daos_map_bloom_t *bloom,
+    const void *key, size_t key_size);
+static herr_t H5_daos_map_bloom_add(H5_daos_map_t *map, const void *key,
+    size_t key_size);
+static herr_t H5_daos_map_bloom_load(H5_daos_map_t *map, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static int H5_daos_map_bloom_load_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_map_bloom_load_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_map_bloom_sync(H5_daos_map_t *map, hid_t dxpl_id);
+static herr_t H5_daos_map_bloom_rebuild(H5_daos_map_t *map, hid_t dxpl_id);
+static herr_t H5_daos_map_bloom_rw(H5_daos_map_t *map, daos_opc_t opc,
+    uint8_t *info_buf, uint8_t *bits, daos_handle_t th, hbool_t commit,
+    hid_t dxpl_id, int *status);
+static herr_t H5_daos_map_bloom_rebuild_cb(hid_t map_id, const void *key,
+    void *_udata);
+
+static herr_t H5_daos_map_read_key_count(H5_daos_map_t *map, hsize_t *count,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+static int H5_daos_map_read_key_count_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_map_get_count_cb(hid_t map_id, const void *key,
     void *_int_count);
 static herr_t H5_daos_map_iterate(H5_daos_map_t *map, H5_daos_iter_data_t *iter_data,
     tse_task_t **first_task, tse_task_t **dep_task);
 static int H5_daos_map_iterate_list_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_map_iterate_query_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_map_iterate_kv_batch(H5_daos_iter_ud_t *udata,
+    tse_task_t **first_task, tse_task_t **dep_task);
+static int H5_daos_map_iter_vals_convert_task(tse_task_t *task);
+static int H5_daos_map_iter_vals_end_task(tse_task_t *task);
 static int H5_daos_map_iterate_op_task(tse_task_t *task);
+static hbool_t H5_daos_map_key_in_range(const H5_daos_iter_data_t *iter_data,
+    const char *key, size_t key_len, hbool_t *past_range);
 static int H5_daos_map_iter_op_end(tse_task_t *task);
 
 static herr_t H5_daos_map_delete_key(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
@@ -164,6 +315,7 @@ H5_daos_map_create(void *_item,
     tse_task_t *first_task = NULL;
     tse_task_t *dep_task = NULL;
     hbool_t default_mcpl = (mcpl_id == H5P_MAP_CREATE_DEFAULT);
+    hsize_t bloom_expected_keys = 0;
     int ret;
     void *ret_value = NULL;
 
@@ -232,6 +384,34 @@ H5_daos_map_create(void *_item,
     map->mcpl_id = H5P_MAP_CREATE_DEFAULT;
     map->mapl_id = H5P_MAP_ACCESS_DEFAULT;
 
+    /* Check if the map should keep a count of its keys */
+    if(!default_mcpl && H5_daos_get_map_key_count_prop(mcpl_id, &map->track_key_count) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get map key count property");
+
+    /* Check if the map should store its keys in order.  Ordered keys must be
+     * unsigned 64 bit integers.  They are always stored big endian so their
+     * byte order (used to order the map's lexical dkeys) matches their
+     * numeric order, conversion to and from the memory type handles the byte
+     * swapping. */
+    if(!default_mcpl && H5_daos_get_map_ordered_keys_prop(mcpl_id, &map->ordered_keys) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get map ordered keys property");
+    if(map->ordered_keys) {
+        if(ktype_class != H5T_INTEGER || H5Tget_size(ktype_id) != sizeof(uint64_t)
+                || H5Tget_sign(ktype_id) != H5T_SGN_NONE)
+            D_GOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, NULL, "key type of a map with ordered keys must be an unsigned 64 bit integer");
+        ktype_id = H5T_STD_U64BE;
+    } /* end if */
+
+    /* Check if the map should have a bloom filter.  The filter starts out
+     * empty, so allocate the local copy of its bits now. */
+    if(!default_mcpl && H5_daos_get_map_bloom_filter_prop(mcpl_id, &bloom_expected_keys) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, NULL, "can't get map bloom filter property");
+    if(bloom_expected_keys > 0) {
+        H5_daos_map_bloom_size(bloom_expected_keys, &map->bloom.nbits, &map->bloom.nhashes);
+        if(NULL == (map->bloom.bits = (uint8_t *)DV_calloc(map->bloom.nbits / 8)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate bloom filter");
+    } /* end if */
+
 #ifdef H5_DAOS_USE_TRANSACTIONS
     /* Start transaction */
     if(0 != (ret = daos_tx_open(item->file->coh, &int_req->th, 0, NULL /*event*/)))
@@ -245,7 +425,7 @@ H5_daos_map_create(void *_item,
      * rank. */
     if(name) {
         if(NULL == (target_obj = H5_daos_group_traverse(item, name, lcpl_id, int_req,
-                collective, &path_buf, &target_name, &target_name_len, &first_task,
+                collective, FALSE, &path_buf, &target_name, &target_name_len, &first_task,
                 &dep_task)))
             D_GOTO_ERROR(H5E_MAP, H5E_BADITER, NULL, "can't traverse path");
 
@@ -275,9 +455,13 @@ H5_daos_map_create(void *_item,
         size_t mcpl_size = 0;
         size_t ktype_size = 0;
         size_t vtype_size = 0;
+        size_t nkeys_size = map->track_key_count ? H5_DAOS_ENCODED_NUM_KEYS_SIZE : 0;
+        size_t bloom_info_size = map->bloom.nbits > 0 ? H5_DAOS_ENCODED_BLOOM_INFO_SIZE : 0;
         void *ktype_buf = NULL;
         void *vtype_buf = NULL;
         void *mcpl_buf = NULL;
+        void *nkeys_buf = NULL;
+        uint8_t *bloom_info_buf = NULL;
         tse_task_t *update_task;
 
         /* Determine serialized datatype sizes */
@@ -293,9 +477,14 @@ H5_daos_map_create(void *_item,
 
         /* Create map */
         /* Allocate argument struct */
-        if(NULL == (update_cb_ud = (H5_daos_md_rw_cb_ud_flex_t *)DV_calloc(sizeof(H5_daos_md_rw_cb_ud_flex_t) + ktype_size + vtype_size + mcpl_size)))
+        if(NULL == (update_cb_ud = (H5_daos_md_rw_cb_ud_flex_t *)DV_calloc(sizeof(H5_daos_md_rw_cb_ud_flex_t) + ktype_size + vtype_size + mcpl_size + nkeys_size + bloom_info_size)))
             D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate buffer for update callback arguments");
 
+        /* The key count starts at 0, which is already encoded in the calloc'd
+         * buffer */
+        nkeys_buf = update_cb_ud->flex_buf + ktype_size + vtype_size + mcpl_size;
+        bloom_info_buf = update_cb_ud->flex_buf + ktype_size + vtype_size + mcpl_size + nkeys_size;
+
         /* Encode datatypes */
         ktype_buf = update_cb_ud->flex_buf;
         if(H5Tencode(ktype_id, ktype_buf, &ktype_size) < 0)
@@ -349,6 +538,47 @@ H5_daos_map_create(void *_item,
         update_cb_ud->md_rw_cb_ud.iod[2].iod_size = (uint64_t)mcpl_size;
         update_cb_ud->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
 
+        /* Key count */
+        if(map->track_key_count) {
+            daos_const_iov_set((d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.iod[3].iod_name, H5_daos_nkeys_key_g, H5_daos_nkeys_key_size_g);
+            update_cb_ud->md_rw_cb_ud.iod[3].iod_nr = 1u;
+            update_cb_ud->md_rw_cb_ud.iod[3].iod_size = (uint64_t)nkeys_size;
+            update_cb_ud->md_rw_cb_ud.iod[3].iod_type = DAOS_IOD_SINGLE;
+
+            daos_iov_set(&update_cb_ud->md_rw_cb_ud.sg_iov[3], nkeys_buf, (daos_size_t)nkeys_size);
+            update_cb_ud->md_rw_cb_ud.sgl[3].sg_nr = 1;
+            update_cb_ud->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
+            update_cb_ud->md_rw_cb_ud.sgl[3].sg_iovs = &update_cb_ud->md_rw_cb_ud.sg_iov[3];
+            update_cb_ud->md_rw_cb_ud.free_sg_iov[3] = FALSE;
+
+            update_cb_ud->md_rw_cb_ud.nr++;
+        } /* end if */
+
+        /* Bloom filter info, at generation 0.  The filter's bits are only
+         * written when keys put through a handle are written back, unwritten
+         * bits read back as 0. */
+        if(map->bloom.nbits > 0) {
+            unsigned bloom_idx = update_cb_ud->md_rw_cb_ud.nr;
+            uint8_t *p = bloom_info_buf;
+
+            UINT64ENCODE(p, map->bloom.nbits)
+            UINT64ENCODE(p, map->bloom.nhashes)
+            UINT64ENCODE(p, (uint64_t)0)
+
+            daos_const_iov_set((d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.iod[bloom_idx].iod_name, H5_daos_bloom_info_key_g, H5_daos_bloom_info_key_size_g);
+            update_cb_ud->md_rw_cb_ud.iod[bloom_idx].iod_nr = 1u;
+            update_cb_ud->md_rw_cb_ud.iod[bloom_idx].iod_size = (uint64_t)bloom_info_size;
+            update_cb_ud->md_rw_cb_ud.iod[bloom_idx].iod_type = DAOS_IOD_SINGLE;
+
+            daos_iov_set(&update_cb_ud->md_rw_cb_ud.sg_iov[bloom_idx], bloom_info_buf, (daos_size_t)bloom_info_size);
+            update_cb_ud->md_rw_cb_ud.sgl[bloom_idx].sg_nr = 1;
+            update_cb_ud->md_rw_cb_ud.sgl[bloom_idx].sg_nr_out = 0;
+            update_cb_ud->md_rw_cb_ud.sgl[bloom_idx].sg_iovs = &update_cb_ud->md_rw_cb_ud.sg_iov[bloom_idx];
+            update_cb_ud->md_rw_cb_ud.free_sg_iov[bloom_idx] = FALSE;
+
+            update_cb_ud->md_rw_cb_ud.nr++;
+        } /* end if */
+
         /* Do not free global akey buffers */
         update_cb_ud->md_rw_cb_ud.free_akeys = FALSE;
 
@@ -764,12 +994,16 @@ H5_daos_map_open_helper(H5_daos_file_t *file, hid_t mapl_id, hbool_t collective,
                 &map->obj.obj_oh, "map object open", first_task, dep_task) < 0)
             D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "can't open map object");
 
-        /* Allocate argument struct for fetch task */
+        /* Allocate argument struct for fetch task.  The key count (if any) is
+         * always read into the start of flex_buf, followed by the bloom filter
+         * info (if any).  Neither is broadcast as read. */
         if(NULL == (fetch_udata = (H5_daos_omd_fetch_ud_t *)DV_calloc(sizeof(H5_daos_omd_fetch_ud_t)
+                + H5_DAOS_ENCODED_NUM_KEYS_SIZE + H5_DAOS_ENCODED_BLOOM_INFO_SIZE
                 + (bcast_udata ? 0 : minfo_buf_size))))
             D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate buffer for fetch callback arguments");
 
-        /* Set up operation to read key/memory datatypes and MCPL sizes from map */
+        /* Set up operation to read key/memory datatypes and MCPL sizes from
+         * map, and check for a key count and bloom filter */
 
         /* Set up ud struct */
         fetch_udata->md_rw_cb_ud.req = req;
@@ -785,24 +1019,40 @@ H5_daos_map_open_helper(H5_daos_file_t *file, hid_t mapl_id, hbool_t collective,
         fetch_udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
         fetch_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
         fetch_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+        fetch_udata->md_rw_cb_ud.iod[0].iod_flags = DAOS_COND_AKEY_FETCH;
 
         daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[1].iod_name, H5_daos_vtype_g, H5_daos_vtype_size_g);
         fetch_udata->md_rw_cb_ud.iod[1].iod_nr = 1u;
         fetch_udata->md_rw_cb_ud.iod[1].iod_size = DAOS_REC_ANY;
         fetch_udata->md_rw_cb_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
+        fetch_udata->md_rw_cb_ud.iod[1].iod_flags = DAOS_COND_AKEY_FETCH;
 
         daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[2].iod_name, H5_daos_cpl_key_g, H5_daos_cpl_key_size_g);
         fetch_udata->md_rw_cb_ud.iod[2].iod_nr = 1u;
         fetch_udata->md_rw_cb_ud.iod[2].iod_size = DAOS_REC_ANY;
         fetch_udata->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
+        fetch_udata->md_rw_cb_ud.iod[2].iod_flags = DAOS_COND_AKEY_FETCH;
+
+        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[3].iod_name, H5_daos_nkeys_key_g, H5_daos_nkeys_key_size_g);
+        fetch_udata->md_rw_cb_ud.iod[3].iod_nr = 1u;
+        fetch_udata->md_rw_cb_ud.iod[3].iod_size = DAOS_REC_ANY;
+        fetch_udata->md_rw_cb_ud.iod[3].iod_type = DAOS_IOD_SINGLE;
+        fetch_udata->md_rw_cb_ud.iod[3].iod_flags = 0;
+
+        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[4].iod_name, H5_daos_bloom_info_key_g, H5_daos_bloom_info_key_size_g);
+        fetch_udata->md_rw_cb_ud.iod[4].iod_nr = 1u;
+        fetch_udata->md_rw_cb_ud.iod[4].iod_size = DAOS_REC_ANY;
+        fetch_udata->md_rw_cb_ud.iod[4].iod_type = DAOS_IOD_SINGLE;
+        fetch_udata->md_rw_cb_ud.iod[4].iod_flags = 0;
 
         fetch_udata->md_rw_cb_ud.free_akeys = FALSE;
 
         /* Set up buffer */
         if(bcast_udata)
-            p = bcast_udata->flex_buf + (5 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+            p = bcast_udata->flex_buf + (9 * H5_DAOS_ENCODED_UINT64_T_SIZE);
         else
-            p = fetch_udata->flex_buf;
+            p = fetch_udata->flex_buf + H5_DAOS_ENCODED_NUM_KEYS_SIZE
+                    + H5_DAOS_ENCODED_BLOOM_INFO_SIZE;
 
         /* Set up sgl */
         daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0], p, (daos_size_t)H5_DAOS_TYPE_BUF_SIZE);
@@ -823,12 +1073,23 @@ H5_daos_map_open_helper(H5_daos_file_t *file, hid_t mapl_id, hbool_t collective,
         fetch_udata->md_rw_cb_ud.sgl[2].sg_iovs = &fetch_udata->md_rw_cb_ud.sg_iov[2];
         fetch_udata->md_rw_cb_ud.free_sg_iov[2] = FALSE;
         p += H5_DAOS_MCPL_BUF_SIZE;
-
-        /* Set conditional akey fetch for map metadata read operation */
-        fetch_udata->md_rw_cb_ud.flags = DAOS_COND_AKEY_FETCH;
+        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[3], fetch_udata->flex_buf, (daos_size_t)H5_DAOS_ENCODED_NUM_KEYS_SIZE);
+        fetch_udata->md_rw_cb_ud.sgl[3].sg_nr = 1;
+        fetch_udata->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
+        fetch_udata->md_rw_cb_ud.sgl[3].sg_iovs = &fetch_udata->md_rw_cb_ud.sg_iov[3];
+        fetch_udata->md_rw_cb_ud.free_sg_iov[3] = FALSE;
+        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[4], fetch_udata->flex_buf + H5_DAOS_ENCODED_NUM_KEYS_SIZE, (daos_size_t)H5_DAOS_ENCODED_BLOOM_INFO_SIZE);
+        fetch_udata->md_rw_cb_ud.sgl[4].sg_nr = 1;
+        fetch_udata->md_rw_cb_ud.sgl[4].sg_nr_out = 0;
+        fetch_udata->md_rw_cb_ud.sgl[4].sg_iovs = &fetch_udata->md_rw_cb_ud.sg_iov[4];
+        fetch_udata->md_rw_cb_ud.free_sg_iov[4] = FALSE;
+
+        /* Set conditional per-akey fetch for map metadata read operation.  The
+         * key count and bloom filter info are optional. */
+        fetch_udata->md_rw_cb_ud.flags = DAOS_COND_PER_AKEY;
 
         /* Set nr */
-        fetch_udata->md_rw_cb_ud.nr = 3u;
+        fetch_udata->md_rw_cb_ud.nr = 5u;
 
         /* Set task name */
         fetch_udata->md_rw_cb_ud.task_name = "map metadata read";
@@ -880,6 +1141,11 @@ done:
         bcast_udata = NULL;
     } /* end if */
 
+    /* Load the map's bloom filter, if it has one.  Every process reads the
+     * filter itself since it can be much larger than the map info. */
+    if(ret_value && H5_daos_map_bloom_load(map, req, first_task, dep_task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "can't create task to load map bloom filter");
+
     /* Cleanup on failure */
     if(NULL == ret_value) {
         /* Close map */
@@ -953,7 +1219,7 @@ H5_daos_map_open_int(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params,
 
         /* Traverse the path */
         if(NULL == (target_obj = H5_daos_group_traverse(item, name, H5P_LINK_CREATE_DEFAULT,
-                req, collective, &path_buf, &target_name, &target_name_len, first_task, dep_task)))
+                req, collective, TRUE, &path_buf, &target_name, &target_name_len, first_task, dep_task)))
             D_GOTO_ERROR(H5E_SYM, H5E_BADITER, NULL, "can't traverse path");
 
         /* Check for no target_name, in this case just return target_obj */
@@ -1171,6 +1437,8 @@ H5_daos_map_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         uint64_t ktype_buf_len = 0;
         uint64_t vtype_buf_len = 0;
         uint64_t mcpl_buf_len = 0;
+        uint64_t track_key_count = 0;
+        H5_daos_map_bloom_t bloom = {0, 0, 0, NULL, NULL};
         size_t minfo_len;
         uint8_t *p = udata->bcast_udata.buffer;
 
@@ -1188,12 +1456,20 @@ H5_daos_map_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         UINT64DECODE(p, vtype_buf_len)
         UINT64DECODE(p, mcpl_buf_len)
 
+        /* Decode whether the map has a key count */
+        UINT64DECODE(p, track_key_count)
+
+        /* Decode bloom filter info */
+        UINT64DECODE(p, bloom.nbits)
+        UINT64DECODE(p, bloom.nhashes)
+        UINT64DECODE(p, bloom.gen)
+
         /* Check for ktype_buf_len set to 0 - indicates failure */
         if(ktype_buf_len == 0)
             D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_REMOTE_ERROR, "lead process failed to open map");
 
         /* Calculate data length */
-        minfo_len = (size_t)ktype_buf_len + (size_t)vtype_buf_len + (size_t)mcpl_buf_len + H5_DAOS_ENCODED_OID_SIZE + 3 * sizeof(uint64_t);
+        minfo_len = (size_t)ktype_buf_len + (size_t)vtype_buf_len + (size_t)mcpl_buf_len + H5_DAOS_ENCODED_OID_SIZE + 7 * sizeof(uint64_t);
 
         /* Reissue bcast if necesary */
         if(minfo_len > (size_t)udata->bcast_udata.count) {
@@ -1228,7 +1504,8 @@ H5_daos_map_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
             /* Finish building map object */
             if(0 != (ret = H5_daos_map_open_end((H5_daos_map_t *)udata->bcast_udata.obj,
-                    p, ktype_buf_len, vtype_buf_len, mcpl_buf_len, udata->bcast_udata.req->dxpl_id)))
+                    p, ktype_buf_len, vtype_buf_len, mcpl_buf_len, (hbool_t)track_key_count,
+                    &bloom, udata->bcast_udata.req->dxpl_id)))
                 D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't finish opening map");
         } /* end else */
     } /* end else */
@@ -1287,6 +1564,7 @@ done:
 static int
 H5_daos_map_open_end(H5_daos_map_t *map, uint8_t *p,
     uint64_t ktype_buf_len, uint64_t vtype_buf_len, uint64_t mcpl_buf_len,
+    hbool_t track_key_count, const H5_daos_map_bloom_t *bloom,
     hid_t H5VL_DAOS_UNUSED dxpl_id)
 {
     H5T_class_t ktype_class;
@@ -1296,6 +1574,7 @@ H5_daos_map_open_end(H5_daos_map_t *map, uint8_t *p,
 
     assert(map);
     assert(p);
+    assert(bloom);
     assert(ktype_buf_len > 0);
     assert(vtype_buf_len > 0);
 
@@ -1355,6 +1634,23 @@ H5_daos_map_open_end(H5_daos_map_t *map, uint8_t *p,
     if(H5_daos_fill_ocpl_cache(&map->obj, map->mcpl_id) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_CPL_CACHE_ERROR, "failed to fill OCPL cache");
 
+    /* Record whether the map keeps a key count.  This is not stored in the
+     * encoded MCPL, it is determined by the presence of the key count. */
+    map->track_key_count = track_key_count;
+
+    /* Maps with ordered keys are the only maps with lexical dkeys, so this is
+     * determined from the object's feature flags */
+    map->ordered_keys = (daos_obj_id2feat(map->obj.oid) & DAOS_OF_DKEY_LEXICAL) != 0;
+
+    /* Record the size of the map's bloom filter (if any).  The filter itself
+     * is loaded by a separate task. */
+    if(bloom->nbits > 0 && (bloom->nbits % 8 != 0 || bloom->nhashes == 0
+            || bloom->nhashes > H5_DAOS_MAP_BLOOM_MAX_NHASHES))
+        D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "invalid bloom filter info");
+    map->bloom.nbits = bloom->nbits;
+    map->bloom.nhashes = bloom->nhashes;
+    map->bloom.gen = bloom->gen;
+
 done:
     /* Close key type parent type */
     if(ktype_parent_id >= 0 && H5Tclose(ktype_parent_id) < 0)
@@ -1414,16 +1710,17 @@ H5_daos_minfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
             /* Reallocate map info buffer if necessary */
             if(daos_info_len > (2 * H5_DAOS_TYPE_BUF_SIZE) + H5_DAOS_MCPL_BUF_SIZE) {
-                if(NULL == (udata->bcast_udata->bcast_udata.buffer = DV_malloc(daos_info_len + H5_DAOS_ENCODED_OID_SIZE + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE)))
+                if(NULL == (udata->bcast_udata->bcast_udata.buffer = DV_malloc(daos_info_len + H5_DAOS_ENCODED_OID_SIZE + 7 * H5_DAOS_ENCODED_UINT64_T_SIZE)))
                     D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for serialized map info");
-                udata->bcast_udata->bcast_udata.buffer_len = (int)(daos_info_len + H5_DAOS_ENCODED_OID_SIZE + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+                udata->bcast_udata->bcast_udata.buffer_len = (int)(daos_info_len + H5_DAOS_ENCODED_OID_SIZE + 7 * H5_DAOS_ENCODED_UINT64_T_SIZE);
             } /* end if */
 
             /* Set starting point for fetch sg_iovs */
-            p = (uint8_t *)udata->bcast_udata->bcast_udata.buffer + H5_DAOS_ENCODED_OID_SIZE + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE;
+            p = (uint8_t *)udata->bcast_udata->bcast_udata.buffer + H5_DAOS_ENCODED_OID_SIZE + 7 * H5_DAOS_ENCODED_UINT64_T_SIZE;
         } /* end if */
         else {
-            assert(udata->md_rw_cb_ud.sg_iov[0].iov_buf == udata->flex_buf);
+            assert(udata->md_rw_cb_ud.sg_iov[0].iov_buf == udata->flex_buf
+                    + H5_DAOS_ENCODED_NUM_KEYS_SIZE + H5_DAOS_ENCODED_BLOOM_INFO_SIZE);
 
             /* Reallocate map info buffer if necessary */
             if(daos_info_len > (2 * H5_DAOS_TYPE_BUF_SIZE) + H5_DAOS_MCPL_BUF_SIZE) {
@@ -1445,6 +1742,8 @@ H5_daos_minfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         p += udata->md_rw_cb_ud.iod[1].iod_size;
         daos_iov_set(&udata->md_rw_cb_ud.sg_iov[2], p, udata->md_rw_cb_ud.iod[2].iod_size);
         udata->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
+        udata->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
+        udata->md_rw_cb_ud.sgl[4].sg_nr_out = 0;
 
         /* Create task for reissued map metadata read */
         if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
@@ -1472,6 +1771,8 @@ H5_daos_minfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             uint64_t vtype_buf_len = (uint64_t)((char *)udata->md_rw_cb_ud.sg_iov[2].iov_buf
                     - (char *)udata->md_rw_cb_ud.sg_iov[1].iov_buf);
             uint64_t mcpl_buf_len = (uint64_t)(udata->md_rw_cb_ud.iod[2].iod_size);
+            hbool_t track_key_count = udata->md_rw_cb_ud.iod[3].iod_size != 0;
+            H5_daos_map_bloom_t bloom = {0, 0, 0, NULL, NULL};
 
             assert(udata->md_rw_cb_ud.req->file);
             assert(udata->md_rw_cb_ud.obj);
@@ -1483,6 +1784,16 @@ H5_daos_minfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             || udata->md_rw_cb_ud.iod[2].iod_size == 0)
                 D_GOTO_ERROR(H5E_MAP, H5E_NOTFOUND, -H5_DAOS_DAOS_GET_ERROR, "internal metadata not found");
 
+            /* Decode bloom filter info if present */
+            if(udata->md_rw_cb_ud.iod[4].iod_size != 0) {
+                if(udata->md_rw_cb_ud.iod[4].iod_size != H5_DAOS_ENCODED_BLOOM_INFO_SIZE)
+                    D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "invalid bloom filter info size");
+                p = (uint8_t *)udata->md_rw_cb_ud.sg_iov[4].iov_buf;
+                UINT64DECODE(p, bloom.nbits)
+                UINT64DECODE(p, bloom.nhashes)
+                UINT64DECODE(p, bloom.gen)
+            } /* end if */
+
             if(udata->bcast_udata) {
                 /* Encode oid */
                 p = udata->bcast_udata->bcast_udata.buffer;
@@ -1493,13 +1804,22 @@ H5_daos_minfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                 UINT64ENCODE(p, ktype_buf_len)
                 UINT64ENCODE(p, vtype_buf_len)
                 UINT64ENCODE(p, mcpl_buf_len)
+
+                /* Encode whether the map has a key count */
+                UINT64ENCODE(p, (uint64_t)track_key_count)
+
+                /* Encode bloom filter info */
+                UINT64ENCODE(p, bloom.nbits)
+                UINT64ENCODE(p, bloom.nhashes)
+                UINT64ENCODE(p, bloom.gen)
                 assert(p == udata->md_rw_cb_ud.sg_iov[0].iov_buf);
             } /* end if */
 
             /* Finish building map object */
             if(0 != (ret = H5_daos_map_open_end((H5_daos_map_t *)udata->md_rw_cb_ud.obj,
                     udata->md_rw_cb_ud.sg_iov[0].iov_buf, ktype_buf_len,
-                    vtype_buf_len, mcpl_buf_len, udata->md_rw_cb_ud.req->dxpl_id)))
+                    vtype_buf_len, mcpl_buf_len, track_key_count, &bloom,
+                    udata->md_rw_cb_ud.req->dxpl_id)))
                 D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't finish opening map");
         } /* end else */
     } /* end else */
@@ -1576,8 +1896,9 @@ done:
  *                  pointed to by *key_buf will be placed here.
  *              void **key_buf_alloc: OUT: A pointer to a buffer allocated
  *                  by this function to hold the key, if any, will be
- *                  placed here.  This must be freed by the caller when
- *                  key_buf is no longer needed.
+ *                  placed here.  This must be freed by the caller with
+ *                  H5_daos_bufpool_free() when key_buf is no longer
+ *                  needed.
  *              hid_t dxpl_id: IN: Dataset transfer property list ID.
  *
  * Return:      Success:        0
@@ -1692,7 +2013,7 @@ H5_daos_map_key_conv(hid_t src_type_id, hid_t dst_type_id, const void *key,
                 else {
                     /* If NULL was passed as the key, set the key to be the
                      * magic value of {'\0', '\0'} */
-                    if(NULL == (*key_buf_alloc = DV_calloc(2)))
+                    if(NULL == (*key_buf_alloc = H5_daos_bufpool_malloc(2, TRUE)))
                         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate space for NULL key");
                     *key_buf = (const void *)*key_buf_alloc;
                     *key_size = 2;
@@ -1738,8 +2059,8 @@ done:
         D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close source type parent type");
     if(dst_parent_type_id > 0 && H5Tclose(dst_parent_type_id) < 0)
         D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close destination type parent type");
-    tconv_buf = DV_free(tconv_buf);
-    bkg_buf = DV_free(bkg_buf);
+    tconv_buf = H5_daos_bufpool_free(tconv_buf);
+    bkg_buf = H5_daos_bufpool_free(bkg_buf);
 
     D_FUNC_LEAVE;
 } /* end H5_daos_map_key_conv() */
@@ -1766,8 +2087,9 @@ done:
  *              void **key_buf_alloc: IN/OUT: On entry, optionally
  *                  contains a buffer of size *key_size.  On exit, will
  *                  contain either this buffer or another one that must
- *                  eventually be freed by the caller when key_buf is no
- *                  longer needed.
+ *                  eventually be freed by the caller with
+ *                  H5_daos_bufpool_free() when key_buf is no longer
+ *                  needed.
  *              H5_daos_vl_union_t *vl_union: IN: A pointer to a buffer
  *                  large enough to hold an H5_daos_vl_union_t.  Must not
  *                  be freed or go out of scope until key_buf is no longer
@@ -1947,75 +2269,52 @@ done:
     if(dst_parent_type_id > 0 && H5Tclose(dst_parent_type_id) < 0)
         D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close destination type parent type");
     if(tconv_buf && (tconv_buf != key))
-        DV_free(tconv_buf);
+        H5_daos_bufpool_free(tconv_buf);
     if(bkg_buf && (bkg_buf != key))
-        DV_free(bkg_buf);
+        H5_daos_bufpool_free(bkg_buf);
 
     D_FUNC_LEAVE;
 } /* end H5_daos_map_key_conv_reverse() */
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_get_val
+ * Function:    H5_daos_map_get_val_task
  *
- * Purpose:     Retrieves, from the Map specified by map_id, the value
- *              associated with the provided key.  key_mem_type_id and
- *              val_mem_type_id specify the datatypes for the provided key
- *              and value buffers. If key_mem_type_id is different from
- *              that used to create the Map object the key will be
- *              internally converted to the datatype for the map object
- *              for the query, and if val_mem_type_id is different from
- *              that used to create the Map object the returned value will
- *              be converted to val_mem_type_id before the function
- *              returns. Any further options can be specified through the
- *              property list dxpl_id.
+ * Purpose:     Sets up and creates the task to read the value associated
+ *              with a single key in the map, as part of the operation
+ *              req.  If *dep_task is set the new task depends on it.  If
+ *              *first_task is set the new task is scheduled, otherwise
+ *              it is returned in *first_task to be scheduled later.  On
+ *              success *dep_task is set to the new task.
  *
  * Return:      Success:        0
- *              Failure:        -1, value not retrieved.
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-herr_t 
-H5_daos_map_get_val(void *_map, hid_t key_mem_type_id, const void *key,
-    hid_t val_mem_type_id, void *value, hid_t dxpl_id, void **req)
+static herr_t
+H5_daos_map_get_val_task(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
+    hid_t val_mem_type_id, void *value, hid_t dxpl_id, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_map_rw_ud_t *get_val_udata = NULL;
     H5_daos_tconv_reuse_t reuse = H5_DAOS_TCONV_REUSE_NONE;
-    H5_daos_map_t *map = (H5_daos_map_t *)_map;
-    H5_daos_req_t *int_req = NULL;
-    tse_task_t *first_task = NULL;
-    tse_task_t *dep_task = NULL;
     tse_task_t *get_val_task = NULL;
     hbool_t fill_bkg = FALSE;
     int ret;
     herr_t ret_value = SUCCEED;
 
-    if(!_map)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
-    if(!key)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
-    if(!value)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value is NULL");
-
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
-
-    /* Start H5 operation */
-    if(NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map get value",
-            map->obj.item.open_req, NULL, NULL, dxpl_id)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
-
-    /* Wait for the map to open if necessary */
-    if(!map->obj.item.created && map->obj.item.open_req->status != 0) {
-        if(H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        if(map->obj.item.open_req->status != 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
-    } /* end if */
+    assert(map);
+    assert(key);
+    assert(value);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
     /* Allocate argument struct for key value retrieval task */
     if(NULL == (get_val_udata = (H5_daos_map_rw_ud_t *)DV_calloc(sizeof(H5_daos_map_rw_ud_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map key value retrieval task arguments");
-    get_val_udata->md_rw_cb_ud.req = int_req;
+    get_val_udata->md_rw_cb_ud.req = req;
     get_val_udata->md_rw_cb_ud.obj = &map->obj;
     get_val_udata->val_mem_type_id = val_mem_type_id;
     get_val_udata->value_buf = value;
@@ -2083,21 +2382,103 @@ H5_daos_map_get_val(void *_map, hid_t key_mem_type_id, const void *key,
     get_val_udata->md_rw_cb_ud.task_name = "map key value retrieval";
 
     /* Create task to read map key value */
-    assert(!dep_task);
-    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
-            H5_daos_map_get_val_comp_cb, get_val_udata, &get_val_task) < 0)
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            H5_daos_md_rw_prep_cb, H5_daos_map_get_val_comp_cb, get_val_udata, &get_val_task) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map key value");
 
-    /* Save map key value read task to be scheduled later and give
-     * it a reference to req and the map object */
-    assert(!first_task);
-    first_task = get_val_task;
-    dep_task = get_val_task;
-    int_req->rc++;
+    /* Schedule map key value read task (or save it to be scheduled later)
+     * and give it a reference to req and the map object */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(get_val_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to read map key value: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = get_val_task;
+    *dep_task = get_val_task;
+    req->rc++;
     map->obj.item.rc++;
 
     get_val_udata = NULL;
 
+done:
+    /* Cleanup on failure */
+    if(ret_value < 0) {
+        if(get_val_udata) {
+            if(get_val_udata->tconv_buf && (get_val_udata->tconv_buf != value)) {
+                H5_daos_bufpool_free(get_val_udata->tconv_buf);
+                get_val_udata->tconv_buf = NULL;
+            }
+            if(get_val_udata->bkg_buf && (get_val_udata->bkg_buf != value)) {
+                H5_daos_bufpool_free(get_val_udata->bkg_buf);
+                get_val_udata->bkg_buf = NULL;
+            }
+            get_val_udata->key_buf_alloc = H5_daos_bufpool_free(get_val_udata->key_buf_alloc);
+        }
+        get_val_udata = DV_free(get_val_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_get_val_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_get_val
+ *
+ * Purpose:     Retrieves, from the Map specified by map_id, the value
+ *              associated with the provided key.  key_mem_type_id and
+ *              val_mem_type_id specify the datatypes for the provided key
+ *              and value buffers. If key_mem_type_id is different from
+ *              that used to create the Map object the key will be
+ *              internally converted to the datatype for the map object
+ *              for the query, and if val_mem_type_id is different from
+ *              that used to create the Map object the returned value will
+ *              be converted to val_mem_type_id before the function
+ *              returns. Any further options can be specified through the
+ *              property list dxpl_id.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, value not retrieved.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t 
+H5_daos_map_get_val(void *_map, hid_t key_mem_type_id, const void *key,
+    hid_t val_mem_type_id, void *value, hid_t dxpl_id, void **req)
+{
+    H5_daos_map_t *map = (H5_daos_map_t *)_map;
+    H5_daos_req_t *int_req = NULL;
+    tse_task_t *first_task = NULL;
+    tse_task_t *dep_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    if(!_map)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
+    if(!key)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
+    if(!value)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value is NULL");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Start H5 operation */
+    if(NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map get value",
+            map->obj.item.open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Wait for the map to open if necessary */
+    if(!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if(H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if(map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+
+    /* Create task to read map key value */
+    if(H5_daos_map_get_val_task(map, key_mem_type_id, key, val_mem_type_id, value, dxpl_id,
+            int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map key value");
+
 done:
     if(int_req) {
         /* Create task to finalize H5 operation */
@@ -2146,22 +2527,6 @@ done:
         } /* end else */
     } /* end if */
 
-    /* Cleanup on failure */
-    if(ret_value < 0) {
-        if(get_val_udata) {
-            if(get_val_udata->tconv_buf && (get_val_udata->tconv_buf != value)) {
-                DV_free(get_val_udata->tconv_buf);
-                get_val_udata->tconv_buf = NULL;
-            }
-            if(get_val_udata->bkg_buf && (get_val_udata->bkg_buf != value)) {
-                DV_free(get_val_udata->bkg_buf);
-                get_val_udata->bkg_buf = NULL;
-            }
-            get_val_udata->key_buf_alloc = DV_free(get_val_udata->key_buf_alloc);
-        }
-        get_val_udata = DV_free(get_val_udata);
-    } /* end if */
-
     D_FUNC_LEAVE;
 } /* end H5_daos_map_get_val() */
 
@@ -2249,11 +2614,11 @@ done:
 
         /* Free private data */
         if(udata->tconv_buf && (udata->tconv_buf != udata->value_buf))
-            DV_free(udata->tconv_buf);
+            H5_daos_bufpool_free(udata->tconv_buf);
         if(udata->bkg_buf && (udata->bkg_buf != udata->value_buf))
-            DV_free(udata->bkg_buf);
+            H5_daos_bufpool_free(udata->bkg_buf);
         if(udata->key_buf_alloc)
-            DV_free(udata->key_buf_alloc);
+            H5_daos_bufpool_free(udata->key_buf_alloc);
         udata = DV_free(udata);
     } /* end if */
     else
@@ -2264,72 +2629,47 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_put
+ * Function:    H5_daos_map_put_task
  *
- * Purpose:     Adds a key-value pair to the Map specified by map_id, or
- *              updates the value for the specified key if one was set
- *              previously. key_mem_type_id and val_mem_type_id specify
- *              the datatypes for the provided key and value buffers, and
- *              if different from those used to create the Map object, the
- *              key and value will be internally converted to the
- *              datatypes for the map object. Any further options can be
- *              specified through the property list dxpl_id.
+ * Purpose:     Sets up and creates the task(s) to write a single
+ *              key-value pair to the map, as part of the operation req.
+ *              If *dep_task is set the first new task depends on it.  If
+ *              *first_task is set the new tasks are scheduled, otherwise
+ *              the first is returned in *first_task to be scheduled
+ *              later.  On success *dep_task is set to the last new task.
  *
  * Return:      Success:        0
- *              Failure:        -1, value not set.
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-herr_t 
-H5_daos_map_put(void *_map, hid_t key_mem_type_id, const void *key,
-    hid_t val_mem_type_id, const void *value, hid_t dxpl_id,
-    void H5VL_DAOS_UNUSED **req)
+static herr_t
+H5_daos_map_put_task(H5_daos_map_t *map, hid_t key_mem_type_id, const void *key,
+    hid_t val_mem_type_id, const void *value, hid_t dxpl_id, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_map_rw_ud_t *write_udata = NULL;
-    H5_daos_map_t *map = (H5_daos_map_t *)_map;
     union {
         const void *const_buf;
         void *buf;
     } safe_value = {.const_buf = value};
-    H5_daos_req_t *int_req = NULL;
-    tse_task_t *first_task = NULL;
-    tse_task_t *dep_task = NULL;
     tse_task_t *bkg_buf_fill_task = NULL;
     tse_task_t *write_task = NULL;
     hbool_t fill_bkg = FALSE;
     int ret;
     herr_t ret_value = SUCCEED;
 
-    if(!_map)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
-    if(!key)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
-    if(!value)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value is NULL");
-
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
-
-    /* Check for write access */
-    if(!(map->obj.item.file->flags & H5F_ACC_RDWR))
-        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
-
-    /* Start H5 operation */
-    if(NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map put value",
-            map->obj.item.open_req, NULL, NULL, dxpl_id)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
-
-    /* Wait for the map to open if necessary */
-    if(!map->obj.item.created && map->obj.item.open_req->status != 0) {
-        if(H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        if(map->obj.item.open_req->status != 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
-    } /* end if */
+    assert(map);
+    assert(key);
+    assert(value);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
     /* Allocate argument struct for key-value pair write task */
     if(NULL == (write_udata = (H5_daos_map_rw_ud_t *)DV_calloc(sizeof(H5_daos_map_rw_ud_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map key-value write task arguments");
-    write_udata->md_rw_cb_ud.req = int_req;
+    write_udata->md_rw_cb_ud.req = req;
     write_udata->md_rw_cb_ud.obj = &map->obj;
     write_udata->val_mem_type_id = val_mem_type_id;
     write_udata->value_buf = safe_value.buf;
@@ -2339,6 +2679,11 @@ H5_daos_map_put(void *_map, hid_t key_mem_type_id, const void *key,
             &write_udata->key_size, &write_udata->key_buf_alloc, dxpl_id) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
 
+    /* Add the key to our copy of the bloom filter */
+    if(map->bloom.nbits > 0)
+        if(H5_daos_map_bloom_add(map, write_udata->key_buf, write_udata->key_size) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add key to map bloom filter");
+
     /* Set up dkey */
     daos_const_iov_set((d_const_iov_t *)&write_udata->md_rw_cb_ud.dkey, write_udata->key_buf, (daos_size_t)write_udata->key_size);
     write_udata->md_rw_cb_ud.free_dkey = FALSE;
@@ -2385,16 +2730,21 @@ H5_daos_map_put(void *_map, hid_t key_mem_type_id, const void *key,
             daos_iov_set(&write_udata->md_rw_cb_ud.sg_iov[0], write_udata->bkg_buf, (daos_size_t)write_udata->val_file_type_size);
 
             /* Create task to read data from map to background buffer */
-            assert(!dep_task);
-            if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
-                    H5_daos_map_put_fill_comp_cb, write_udata, &bkg_buf_fill_task) < 0)
+            if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                    H5_daos_md_rw_prep_cb, H5_daos_map_put_fill_comp_cb, write_udata, &bkg_buf_fill_task) < 0)
                 D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read data from map to background buffer");
 
-            /* Save background buffer data read task to be scheduled later and give
-             * it a reference to req and the map object */
-            first_task = bkg_buf_fill_task;
-            dep_task = bkg_buf_fill_task;
-            int_req->rc++;
+            /* Schedule background buffer data read task (or save it to be
+             * scheduled later) and give it a reference to req and the map
+             * object */
+            if(*first_task) {
+                if(0 != (ret = tse_task_schedule(bkg_buf_fill_task, false)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to read data from map to background buffer: %s", H5_daos_err_to_string(ret));
+            } /* end if */
+            else
+                *first_task = bkg_buf_fill_task;
+            *dep_task = bkg_buf_fill_task;
+            req->rc++;
             map->obj.item.rc++;
         } /* end if */
         else {
@@ -2402,7 +2752,8 @@ H5_daos_map_put(void *_map, hid_t key_mem_type_id, const void *key,
             (void)memcpy(write_udata->tconv_buf, value, (size_t)write_udata->val_mem_type_size);
 
             /* Perform type conversion */
-            if(H5Tconvert(val_mem_type_id, map->val_file_type_id, 1, write_udata->tconv_buf, write_udata->bkg_buf, dxpl_id) < 0)
+            if(H5_daos_tconv_convert_to_file(map->obj.item.file, val_mem_type_id, map->val_file_type_id, 1,
+                    write_udata->tconv_buf, write_udata->bkg_buf, dxpl_id) < 0)
                 D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
 
             /* Set sgl to write from tconv_buf */
@@ -2418,30 +2769,2573 @@ H5_daos_map_put(void *_map, hid_t key_mem_type_id, const void *key,
     /* Set task name */
     write_udata->md_rw_cb_ud.task_name = "map key-value write";
 
-    /* Create task to write key-value pair to map */
-    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
-            H5_daos_md_rw_prep_cb, H5_daos_map_put_comp_cb, write_udata, &write_task) < 0)
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write key-value pair to map");
+    if(map->track_key_count) {
+        /* Write the key-value pair and count the key (if it is new) in one
+         * transaction */
+        if(H5_daos_map_key_count_update(map, &write_udata->md_rw_cb_ud.dkey, NULL,
+                &write_udata->md_rw_cb_ud, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write key-value pair to map");
+
+        /* Create task to free the write buffers once the transaction is
+         * done */
+        if(H5_daos_create_task(H5_daos_metatask_autocomplete, 1, dep_task,
+                NULL, H5_daos_map_put_comp_cb, write_udata, &write_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finish map key-value write");
+    } /* end if */
+    else
+        /* Create task to write key-value pair to map */
+        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                H5_daos_md_rw_prep_cb, H5_daos_map_put_comp_cb, write_udata, &write_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write key-value pair to map");
 
     /* Save map key-value write task to be scheduled later and give
      * it a reference to req and the map object */
-    if(first_task) {
+    if(*first_task) {
         if(0 != (ret = tse_task_schedule(write_task, false)))
             D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to write key-value pair to map: %s", H5_daos_err_to_string(ret));
     }
     else
-        first_task = write_task;
-    dep_task = write_task;
-    int_req->rc++;
+        *first_task = write_task;
+    *dep_task = write_task;
+    req->rc++;
     map->obj.item.rc++;
-
     write_udata = NULL;
 
 done:
-    if(int_req) {
-        /* Create task to finalize H5 operation */
-        if(H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
-                NULL, NULL, int_req, &int_req->finalize_task) < 0)
+    /* Cleanup on failure */
+    if(ret_value < 0) {
+        if(write_udata) {
+            if(write_udata->tconv_buf && (write_udata->tconv_buf != value)) {
+                H5_daos_bufpool_free(write_udata->tconv_buf);
+                write_udata->tconv_buf = NULL;
+            }
+            if(write_udata->bkg_buf && (write_udata->bkg_buf != value)) {
+                H5_daos_bufpool_free(write_udata->bkg_buf);
+                write_udata->bkg_buf = NULL;
+            }
+            write_udata->key_buf_alloc = H5_daos_bufpool_free(write_udata->key_buf_alloc);
+        }
+        write_udata = DV_free(write_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put
+ *
+ * Purpose:     Adds a key-value pair to the Map specified by map_id, or
+ *              updates the value for the specified key if one was set
+ *              previously. key_mem_type_id and val_mem_type_id specify
+ *              the datatypes for the provided key and value buffers, and
+ *              if different from those used to create the Map object, the
+ *              key and value will be internally converted to the
+ *              datatypes for the map object. Any further options can be
+ *              specified through the property list dxpl_id.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, value not set.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t 
+H5_daos_map_put(void *_map, hid_t key_mem_type_id, const void *key,
+    hid_t val_mem_type_id, const void *value, hid_t dxpl_id,
+    void H5VL_DAOS_UNUSED **req)
+{
+    H5_daos_map_t *map = (H5_daos_map_t *)_map;
+    H5_daos_req_t *int_req = NULL;
+    tse_task_t *first_task = NULL;
+    tse_task_t *dep_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    if(!_map)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map object is NULL");
+    if(!key)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key is NULL");
+    if(!value)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value is NULL");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Check for write access */
+    if(!(map->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    /* Start H5 operation */
+    if(NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map put value",
+            map->obj.item.open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Wait for the map to open if necessary */
+    if(!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if(H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if(map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+
+    /* Create task(s) to write key-value pair to map */
+    if(H5_daos_map_put_task(map, key_mem_type_id, key, val_mem_type_id, value, dxpl_id,
+            int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write key-value pair to map");
+
+done:
+    if(int_req) {
+        /* Create task to finalize H5 operation */
+        if(H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                NULL, NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if(0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s", H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if(ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if(H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_WRITE,
+                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if(req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if(H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if(H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if(int_req->status < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "map key-value write operation failed in task \"%s\": %s",
+                        int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+            /* Close internal request */
+            if(H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_io_multi
+ *
+ * Purpose:     Internal routine for H5daos_map_put_multi() and
+ *              H5daos_map_get_multi().  Writes or reads count key-value
+ *              pairs in the map as a single operation: one request, one
+ *              entry in the map's operation pool and one finalize task.
+ *              Keys are processed in windows of at most
+ *              H5_DAOS_MAP_MULTI_MAX_IN_FLIGHT.  Each window is set up
+ *              and issued by H5_daos_map_io_multi_window_task() once the
+ *              previous one completes, so the task udata and key
+ *              conversion buffers for only one window exist at a time.
+ *              keys and values are packed arrays of elements of
+ *              key_mem_type_id and val_mem_type_id.  values is only
+ *              written to for reads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_io_multi(hid_t map_id, size_t count, hid_t key_mem_type_id,
+    const void *keys, hid_t val_mem_type_id, const void *values,
+    hid_t dxpl_id, H5_daos_io_type_t io_type)
+{
+    H5_daos_map_t *map = NULL;
+    H5_daos_map_io_multi_ud_t *multi_udata = NULL;
+    union {
+        const void *const_buf;
+        void *buf;
+    } safe_values = {.const_buf = values};
+    tse_task_t *first_task = NULL;
+    tse_task_t *dep_task = NULL;
+    H5_daos_req_t *int_req = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(count > 0);
+    assert(keys);
+    assert(values);
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Look up map */
+    if(NULL == (map = (H5_daos_map_t *)H5VLobject(map_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if(H5I_MAP != map->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a map");
+
+    /* Check for write access */
+    if(io_type == IO_WRITE && !(map->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    /* Start H5 operation */
+    if(NULL == (int_req = H5_daos_req_create(map->obj.item.file,
+            io_type == IO_READ ? "map get multiple values" : "map put multiple values",
+            map->obj.item.open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Wait for the map to open if necessary */
+    if(!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if(H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if(map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+
+    /* Allocate argument struct for window tasks.  keys, values and the
+     * memory datatypes are not copied since this routine waits for the
+     * operation to complete. */
+    if(NULL == (multi_udata = (H5_daos_map_io_multi_ud_t *)DV_calloc(sizeof(H5_daos_map_io_multi_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for multi-key map I/O arguments");
+    multi_udata->req = int_req;
+    multi_udata->map = map;
+    multi_udata->io_type = io_type;
+    multi_udata->count = count;
+    multi_udata->next_key = 0;
+    multi_udata->key_mem_type_id = key_mem_type_id;
+    multi_udata->keys = (const uint8_t *)keys;
+    multi_udata->val_mem_type_id = val_mem_type_id;
+    multi_udata->values = (uint8_t *)safe_values.buf;
+    multi_udata->dxpl_id = dxpl_id;
+
+    /* Get memory type sizes, used as the strides through keys and values */
+    if(0 == (multi_udata->key_mem_type_size = H5Tget_size(key_mem_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get key memory datatype size");
+    if(0 == (multi_udata->val_mem_type_size = H5Tget_size(val_mem_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get value memory datatype size");
+
+    /* Allocate array of the last task for each key in a window */
+    if(NULL == (multi_udata->window_tasks = (tse_task_t **)DV_malloc(
+            MIN(count, H5_DAOS_MAP_MULTI_MAX_IN_FLIGHT) * sizeof(tse_task_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate window task array");
+
+    /* Create metatask for the keys.  This empty task will be completed when
+     * the last window finishes. */
+    if(H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &multi_udata->end_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create metatask for multi-key map I/O");
+
+    /* Schedule metatask */
+    if(0 != (ret = tse_task_schedule(multi_udata->end_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule metatask for multi-key map I/O: %s", H5_daos_err_to_string(ret));
+
+    /* Create task to set up and issue the first window of keys */
+    if(H5_daos_create_task(H5_daos_map_io_multi_window_task, 0, NULL, NULL, NULL,
+            multi_udata, &first_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task for multi-key map I/O");
+
+    /* The window tasks hold a reference to req and the map, and now own
+     * multi_udata */
+    int_req->rc++;
+    map->obj.item.rc++;
+    dep_task = multi_udata->end_task;
+    multi_udata = NULL;
+
+done:
+    /* Clean up window task arguments if the first window task was not
+     * created, completing the metatask if it was scheduled */
+    if(multi_udata) {
+        assert(ret_value < 0);
+        if(multi_udata->end_task) {
+            if(H5_daos_task_list_put(H5_daos_task_list_g, multi_udata->end_task) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't return task to task list");
+            tse_task_complete(multi_udata->end_task, -H5_DAOS_SETUP_ERROR);
+        } /* end if */
+        DV_free(multi_udata->window_tasks);
+        multi_udata = DV_free(multi_udata);
+    } /* end if */
+
+    if(int_req) {
+        /* Create task to finalize H5 operation */
+        if(H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                NULL, NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if(0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s", H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if(ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if(H5_daos_req_enqueue(int_req, first_task, &map->obj.item,
+                io_type == IO_READ ? H5_DAOS_OP_TYPE_READ : H5_DAOS_OP_TYPE_WRITE,
+                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes */
+        if(H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if(int_req->status < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "multi-key map %s failed in task \"%s\": %s", io_type == IO_READ ? "get" : "put", int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+        /* Release our reference to the internal request */
+        if(H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_io_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_io_multi_window_task
+ *
+ * Purpose:     Asynchronous task for H5_daos_map_io_multi().  Sets up
+ *              and issues the tasks for the next window of keys, then
+ *              creates another window task that runs once they are all
+ *              done.  Finishes the operation, completing its metatask,
+ *              once there are no keys left or the request has failed.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_io_multi_window_task(tse_task_t *task)
+{
+    H5_daos_map_io_multi_ud_t *udata = NULL;
+    H5_daos_req_t *req = NULL;
+    tse_task_t *first_task = NULL;
+    tse_task_t *dep_task = NULL;
+    tse_task_t *window_task = NULL;
+    size_t nwindow_tasks = 0;
+    size_t window_end;
+    int ret;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for multi-key map I/O window task");
+
+    assert(udata->req);
+    assert(udata->map);
+
+    req = udata->req;
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_MAP);
+
+    /* Check if all keys are done */
+    if(udata->next_key == udata->count)
+        D_GOTO_DONE(0);
+
+    /* Create first task for this window.  The keys in the window depend on
+     * it so none of them start until they have all been set up. */
+    if(H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL,
+            NULL, &first_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create first metatask for multi-key map I/O window");
+
+    /* Set up I/O for each key in the window */
+    window_end = udata->next_key + MIN(H5_DAOS_MAP_MULTI_MAX_IN_FLIGHT, udata->count - udata->next_key);
+    for(; udata->next_key < window_end; udata->next_key++) {
+        const void *key = udata->keys + (udata->next_key * udata->key_mem_type_size);
+        void *value = udata->values + (udata->next_key * udata->val_mem_type_size);
+
+        dep_task = first_task;
+        if(udata->io_type == IO_READ) {
+            if(H5_daos_map_get_val_task(udata->map, udata->key_mem_type_id, key, udata->val_mem_type_id,
+                    value, udata->dxpl_id, udata->req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_READERROR, -H5_DAOS_SETUP_ERROR, "can't create task to read map key value");
+        } /* end if */
+        else
+            if(H5_daos_map_put_task(udata->map, udata->key_mem_type_id, key, udata->val_mem_type_id,
+                    value, udata->dxpl_id, udata->req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, -H5_DAOS_SETUP_ERROR, "can't create task to write key-value pair to map");
+        udata->window_tasks[nwindow_tasks++] = dep_task;
+    } /* end for */
+
+done:
+    if(udata) {
+        /* Continue with another window task once the keys issued by this
+         * one are done.  It issues the next window, or finishes the
+         * operation if there are no keys left or the request failed. */
+        if(nwindow_tasks > 0) {
+            if(H5_daos_create_task(H5_daos_map_io_multi_window_task, (unsigned)nwindow_tasks,
+                    udata->window_tasks, NULL, NULL, udata, &window_task) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task for next multi-key map I/O window");
+            else if(0 != (ret = tse_task_schedule(window_task, false)))
+                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task for next multi-key map I/O window: %s", H5_daos_err_to_string(ret));
+            else
+                /* The next window task now owns udata */
+                udata = NULL;
+        } /* end if */
+
+        /* Schedule first task for this window, the keys that were set up
+         * depend on it */
+        if(first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule first task for multi-key map I/O window: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+
+    /* Close map if there is no next window task */
+    if(udata && H5_daos_map_close_real(udata->map) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if(req && ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status = ret_value;
+        req->failed_task = "multi-key map I/O window task";
+    } /* end if */
+
+    /* Finish the operation if there is no next window task */
+    if(udata) {
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Return metatask to task list */
+        if(H5_daos_task_list_put(H5_daos_task_list_g, udata->end_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+        /* Complete metatask */
+        tse_task_complete(udata->end_task, ret_value);
+
+        /* Free udata */
+        DV_free(udata->window_tasks);
+        udata = DV_free(udata);
+    } /* end if */
+
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_io_multi_window_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_put_multi
+ *
+ * Purpose:     Adds or updates count key-value pairs in the map map_id as
+ *              a single operation.  keys and values are packed arrays of
+ *              count elements of key_mem_type_id and val_mem_type_id, and
+ *              are converted as with H5Mput().  The writes for all keys
+ *              are issued together, so this is much faster than calling
+ *              H5Mput() once per key.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_put_multi(hid_t map_id, size_t count, hid_t key_mem_type_id,
+    const void *keys, hid_t val_mem_type_id, const void *values, hid_t dxpl_id)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(count == 0)
+        D_GOTO_DONE(SUCCEED);
+    if(!keys)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key array is NULL");
+    if(!values)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value array is NULL");
+
+    if(H5_daos_map_io_multi(map_id, count, key_mem_type_id, keys,
+            val_mem_type_id, values, dxpl_id, IO_WRITE) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, FAIL, "can't write key-value pairs to map");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_map_put_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_get_multi
+ *
+ * Purpose:     Retrieves the values associated with count keys in the map
+ *              map_id as a single operation.  keys and values are packed
+ *              arrays of count elements of key_mem_type_id and
+ *              val_mem_type_id, and are converted as with H5Mget().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_get_multi(hid_t map_id, size_t count, hid_t key_mem_type_id,
+    const void *keys, hid_t val_mem_type_id, void *values, hid_t dxpl_id)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(count == 0)
+        D_GOTO_DONE(SUCCEED);
+    if(!keys)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map key array is NULL");
+    if(!values)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "map value array is NULL");
+
+    if(H5_daos_map_io_multi(map_id, count, key_mem_type_id, keys,
+            val_mem_type_id, values, dxpl_id, IO_READ) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read values from map");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_map_get_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iterate_sync
+ *
+ * Purpose:     Runs map iteration for the connector-specific map iterate
+ *              routines and waits for it to complete.  iter_data must be
+ *              filled in except for req and op_ret_p, which are set
+ *              here.  The map must be open.
+ *
+ * Return:      Success:        Last value returned by the operator
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_iterate_sync(H5_daos_map_t *map, H5_daos_iter_data_t *iter_data,
+    const char *op_name, hid_t dxpl_id)
+{
+    H5_daos_req_t *int_req = NULL;
+    tse_task_t *first_task = NULL;
+    tse_task_t *dep_task = NULL;
+    herr_t iter_ret = 0;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+    assert(iter_data);
+    assert(op_name);
+
+    /* Start H5 operation */
+    if(NULL == (int_req = H5_daos_req_create(map->obj.item.file, op_name,
+            map->obj.item.open_req, NULL, NULL, dxpl_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    iter_data->req = int_req;
+    iter_data->op_ret_p = &iter_ret;
+
+    /* Perform map iteration */
+    if(H5_daos_map_iterate(map, iter_data, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed");
+
+done:
+    if(int_req) {
+        /* Create task to finalize H5 operation */
+        if(H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                NULL, NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if(0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s", H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if(ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the map's request queue.  This will add the
+         * dependency on the map open if necessary. */
+        if(H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_READ,
+                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes */
+        if(H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if(int_req->status < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "map iteration failed in task \"%s\": %s",
+                    int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+        /* Close internal request */
+        if(H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
+
+        /* Set return value for map iteration, unless this function failed but
+         * the iteration did not */
+        if(!(ret_value < 0 && iter_ret >= 0))
+            ret_value = iter_ret;
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate_sync() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iterate_get_map
+ *
+ * Purpose:     Looks up the map for the connector-specific map routines
+ *              and waits for it to open if necessary.
+ *
+ * Return:      Success:        The map
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_daos_map_t *
+H5_daos_map_iterate_get_map(hid_t map_id)
+{
+    H5_daos_map_t *map = NULL;
+    H5_daos_map_t *ret_value = NULL;
+
+    /* Look up map */
+    if(NULL == (map = (H5_daos_map_t *)H5VLobject(map_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "VOL object is NULL");
+    if(H5I_MAP != map->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "object is not a map");
+
+    /* Wait for the map to open if necessary */
+    if(!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if(H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, NULL, "can't progress scheduler");
+        if(map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, NULL, "map open failed");
+    } /* end if */
+
+    ret_value = map;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate_get_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_iterate_kv
+ *
+ * Purpose:     Iterates over all key-value pairs in the map map_id, like
+ *              H5Miterate(), but passes op each value along with its key.
+ *              Values are converted to val_mem_type_id.  For each batch
+ *              of keys listed from the map, the values are all fetched
+ *              at once and converted together before op is called on the
+ *              keys in the batch, so this is much faster than calling
+ *              H5Mget() from an H5Miterate() callback.  As with
+ *              H5Miterate(), idx must be NULL or point to 0.
+ *
+ * Return:      Success:        Last value returned by op
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_iterate_kv(hid_t map_id, hsize_t *idx, hid_t key_mem_type_id,
+    hid_t val_mem_type_id, H5daos_map_iterate_kv_t op, void *op_data,
+    hid_t dxpl_id)
+{
+    H5_daos_map_t *map = NULL;
+    H5_daos_iter_data_t iter_data;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!op)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "operator is NULL");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    if(NULL == (map = H5_daos_map_iterate_get_map(map_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't get map");
+
+    /* Initialize iteration data */
+    H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC,
+            FALSE, idx, map_id, op_data, NULL, NULL);
+    iter_data.u.map_iter_data.key_mem_type_id = key_mem_type_id;
+    iter_data.u.map_iter_data.val_mem_type_id = val_mem_type_id;
+    iter_data.u.map_iter_data.prefetch_vals = TRUE;
+    iter_data.u.map_iter_data.u.map_iter_kv_op = op;
+
+    /* Perform map iteration */
+    if((ret_value = H5_daos_map_iterate_sync(map, &iter_data, "map iterate with values", dxpl_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_map_iterate_kv() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_iterate_range
+ *
+ * Purpose:     Iterates over the keys in the map map_id that are between
+ *              lo and hi (inclusive), making the callback op for each as
+ *              with H5Miterate().  Keys are passed to op as
+ *              H5T_NATIVE_UINT64.  The map must have been created with
+ *              H5daos_set_map_ordered_keys().  Keys are listed in
+ *              ascending order, so keys below lo are skipped without
+ *              calling op and listing stops at the first key after hi.
+ *              If the map's object class has more than one redundancy
+ *              group the keys are only in order within each group, so
+ *              all keys are listed and op is not called in key order.
+ *
+ * Return:      Success:        Last value returned by op
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_iterate_range(hid_t map_id, uint64_t lo, uint64_t hi,
+    H5M_iterate_t op, void *op_data, hid_t dxpl_id)
+{
+    H5_daos_map_t *map = NULL;
+    H5_daos_iter_data_t iter_data;
+    struct daos_obj_layout *layout = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!op)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "operator is NULL");
+    if(lo > hi)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "key range lower bound is greater than upper bound");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    if(NULL == (map = H5_daos_map_iterate_get_map(map_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't get map");
+
+    /* Range iteration relies on the key encoding of maps with ordered keys */
+    if(!map->ordered_keys)
+        D_GOTO_ERROR(H5E_MAP, H5E_UNSUPPORTED, FAIL, "map was not created with ordered keys");
+
+    /* Initialize iteration data */
+    H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC,
+            FALSE, NULL, map_id, op_data, NULL, NULL);
+    iter_data.u.map_iter_data.key_mem_type_id = H5T_NATIVE_UINT64;
+    iter_data.u.map_iter_data.u.map_iter_op = op;
+    iter_data.u.map_iter_data.key_range = TRUE;
+    iter_data.u.map_iter_data.key_lo = lo;
+    iter_data.u.map_iter_data.key_hi = hi;
+
+    /* Keys are only listed in order if the map object has a single
+     * redundancy group, otherwise each group is listed in turn */
+    if(0 != (ret = daos_obj_layout_get(map->obj.item.file->coh, map->obj.oid, &layout)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't get map object layout: %s", H5_daos_err_to_string(ret));
+    iter_data.u.map_iter_data.key_range_sorted = (layout->ol_nr == 1);
+
+    /* Perform map iteration */
+    if((ret_value = H5_daos_map_iterate_sync(map, &iter_data, "map iterate over key range", dxpl_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed");
+
+done:
+    if(layout && 0 != (ret = daos_obj_layout_free(layout)))
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free map object layout: %s", H5_daos_err_to_string(ret));
+
+    D_FUNC_LEAVE_API;
+} /* end H5daos_map_iterate_range() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_iterate_part
+ *
+ * Purpose:     Iterates over the map map_id in parallel.  Must be called
+ *              by all processes in the file's communicator.  The map's
+ *              dkeys are split into parts with daos_obj_anchor_split()
+ *              (one per redundancy group of the map's object class), and
+ *              the parts are dealt out round robin to the processes, so
+ *              each process lists and calls op on a disjoint subset of
+ *              the keys.  A process that is assigned no part returns 0
+ *              without calling op.  op returning nonzero stops
+ *              iteration on the calling process only.
+ *
+ *              If reduce_ret is TRUE, the return values are combined
+ *              across all processes: all processes fail if any process
+ *              failed, otherwise all return the largest value returned
+ *              on any process.  Every process takes part in the
+ *              reduction, including one that failed, as long as map_id
+ *              refers to a map.
+ *
+ *              Since the parts follow the object's layout, a map must
+ *              be created with a multi-group object class (e.g. "SX")
+ *              for iteration to be spread across processes.
+ *
+ * Return:      Success:        Last value returned by op (possibly
+ *                              reduced across processes)
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_iterate_part(hid_t map_id, hid_t key_mem_type_id, H5M_iterate_t op,
+    void *op_data, hbool_t reduce_ret, hid_t dxpl_id)
+{
+    H5_daos_map_t *map = NULL;
+    H5_daos_file_t *file = NULL;
+    H5_daos_iter_data_t iter_data;
+    daos_anchor_t start_anchor;
+    uint32_t nparts = 0;
+    uint32_t part;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    /* Get the map's file first, so every process can take part in the
+     * reduction of the return values even if a later step fails */
+    if(NULL != (map = (H5_daos_map_t *)H5VLobject(map_id)) && H5I_MAP == map->obj.item.type)
+        file = map->obj.item.file;
+    map = NULL;
+
+    if(!op)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "operator is NULL");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    if(NULL == (map = H5_daos_map_iterate_get_map(map_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't get map");
+
+    /* Get number of parts the map's dkeys can be split into */
+    if(0 != (ret = daos_obj_anchor_split(map->obj.obj_oh, &nparts, NULL)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't split map dkey anchor: %s", H5_daos_err_to_string(ret));
+
+    /* Iterate over each part assigned to this process in turn, stopping if
+     * the operator returns nonzero */
+    for(part = (uint32_t)map->obj.item.file->my_rank; part < nparts && ret_value == 0;
+            part += (uint32_t)map->obj.item.file->num_procs) {
+        /* Set up anchor to list only this part */
+        memset(&start_anchor, 0, sizeof(start_anchor));
+        if(0 != (ret = daos_obj_anchor_set(map->obj.obj_oh, part, &start_anchor)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTSET, FAIL, "can't set map dkey anchor: %s", H5_daos_err_to_string(ret));
+
+        /* Initialize iteration data */
+        H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC,
+                FALSE, NULL, map_id, op_data, NULL, NULL);
+        iter_data.u.map_iter_data.key_mem_type_id = key_mem_type_id;
+        iter_data.u.map_iter_data.u.map_iter_op = op;
+        iter_data.start_anchor = &start_anchor;
+
+        /* Perform map iteration */
+        if((ret_value = H5_daos_map_iterate_sync(map, &iter_data, "map partitioned iterate", dxpl_id)) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed");
+    } /* end for */
+
+done:
+    /* Combine return values across processes.  This is done whenever the
+     * file is known, even on failure, so no process is left waiting in
+     * MPI_Allreduce. */
+    if(reduce_ret && file && file->num_procs > 1) {
+        int local_rets[2];
+        int global_rets[2];
+
+        /* Whether this process failed, and its (non-negative) return value */
+        local_rets[0] = ret_value < 0 ? 1 : 0;
+        local_rets[1] = ret_value < 0 ? 0 : (int)ret_value;
+
+        if(MPI_SUCCESS != MPI_Allreduce(local_rets, global_rets, 2, MPI_INT, MPI_MAX, file->comm))
+            D_DONE_ERROR(H5E_MAP, H5E_MPI, FAIL, "MPI_Allreduce failed");
+        else if(global_rets[0])
+            D_DONE_ERROR(H5E_MAP, H5E_BADITER, FAIL, "map iteration failed on another process");
+        else
+            ret_value = (herr_t)global_rets[1];
+    } /* end if */
+
+    D_FUNC_LEAVE_API;
+} /* end H5daos_map_iterate_part() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_fill_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to fill
+ *              a type conversion background buffer when performing a map
+ *              "put" operation that requires type conversion. Currently
+ *              checks for a failed task and then performs type conversion.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_put_fill_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rw_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.req->file);
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "map put background buffer fill task";
+    } /* end if */
+    else if(task->dt_result == 0) {
+        H5_daos_map_t *map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+
+        assert(map);
+
+        /* Reset iod_size; if the key was not created then it could have
+         * been overwritten by daos_obj_fetch */
+        udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)udata->val_file_type_size;
+
+        /* Copy data to type conversion buffer */
+        (void)memcpy(udata->tconv_buf, udata->value_buf, (size_t)udata->val_mem_type_size);
+
+        /* Perform type conversion */
+        if(H5_daos_tconv_convert_to_file(map->obj.item.file, udata->val_mem_type_id, map->val_file_type_id, 1,
+                udata->tconv_buf, udata->bkg_buf, udata->md_rw_cb_ud.req->dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+
+        /* Set sgl to write from tconv_buf */
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->tconv_buf, (daos_size_t)udata->val_file_type_size);
+    } /* end else */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Clean up */
+    if(udata) {
+        /* Close map */
+        if(udata->md_rw_cb_ud.obj &&
+                H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map put background buffer fill completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+    } /* end if */
+    else
+        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put_fill_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_put_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update to add
+ *              a new key-value pair to a map object or to update an
+ *              existing key-value pair in a map object. Currently checks
+ *              for a failed task then frees private data.  For maps that
+ *              count their keys this is the completion callback of a
+ *              metatask that runs after the write transaction.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_put_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_rw_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.req->file);
+
+    /* Close map */
+    if(udata->md_rw_cb_ud.obj &&
+            H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "map key-value write";
+    } /* end if */
+
+    /* Release our reference to req */
+    if(H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    if(udata->tconv_buf && (udata->tconv_buf != udata->value_buf))
+        H5_daos_bufpool_free(udata->tconv_buf);
+    if(udata->bkg_buf && (udata->bkg_buf != udata->value_buf))
+        H5_daos_bufpool_free(udata->bkg_buf);
+    if(udata->key_buf_alloc)
+        H5_daos_bufpool_free(udata->key_buf_alloc);
+    udata = DV_free(udata);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_put_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_update
+ *
+ * Purpose:     Creates a task to write (if key_ud is not NULL) or delete
+ *              (if key_ud is NULL) the key key_dkey in a map that counts
+ *              its keys and update the count, as part of the operation
+ *              req.  key_ud holds the iods and sgls to write the key with.
+ *              On delete only key_akey is punched if it is not NULL,
+ *              otherwise the whole dkey is punched.
+ *
+ *              The existence check, the key write or punch and the count
+ *              update are done in a single DAOS transaction, which is
+ *              restarted if it conflicts with another update of the map,
+ *              so the count stays exact with any number of writers.
+ *              Puts only increment the count if the key is new.  Deletes
+ *              fail with -DER_NONEXIST if the key does not exist.
+ *              key_dkey, key_akey and key_ud must stay valid until the
+ *              task completes.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_key_count_update(H5_daos_map_t *map, const daos_key_t *key_dkey,
+    const daos_key_t *key_akey, H5_daos_md_rw_cb_ud_t *key_ud,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_map_key_count_ud_t *count_udata = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+    assert(map->track_key_count);
+    assert(key_dkey);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct for key count tasks */
+    if(NULL == (count_udata = (H5_daos_map_key_count_ud_t *)DV_calloc(sizeof(H5_daos_map_key_count_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map key count task arguments");
+    count_udata->md_rw_cb_ud.req = req;
+    count_udata->md_rw_cb_ud.obj = &map->obj;
+    count_udata->th = DAOS_TX_NONE;
+    count_udata->key_ud = key_ud;
+    count_udata->key_dkey = *key_dkey;
+    if(key_akey) {
+        assert(!key_ud);
+        count_udata->key_akey = *key_akey;
+        count_udata->punch_akey = TRUE;
+    } /* end if */
+
+    /* Set up key existence check */
+    daos_const_iov_set((d_const_iov_t *)&count_udata->key_iod.iod_name, H5_daos_map_key_g, H5_daos_map_key_size_g);
+    count_udata->key_iod.iod_nr = 1u;
+    count_udata->key_iod.iod_type = DAOS_IOD_SINGLE;
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&count_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g);
+    count_udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Set up iod */
+    daos_const_iov_set((d_const_iov_t *)&count_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_nkeys_key_g, H5_daos_nkeys_key_size_g);
+    count_udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
+    count_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+    count_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set up sgl */
+    daos_iov_set(&count_udata->md_rw_cb_ud.sg_iov[0], count_udata->nkeys_buf, (daos_size_t)H5_DAOS_ENCODED_NUM_KEYS_SIZE);
+    count_udata->md_rw_cb_ud.sgl[0].sg_nr = 1;
+    count_udata->md_rw_cb_ud.sgl[0].sg_iovs = &count_udata->md_rw_cb_ud.sg_iov[0];
+    count_udata->md_rw_cb_ud.free_sg_iov[0] = FALSE;
+
+    /* Set nr */
+    count_udata->md_rw_cb_ud.nr = 1u;
+
+    /* Set task name */
+    count_udata->md_rw_cb_ud.task_name = "map key count update";
+
+    /* Create task to run the transaction.  This task does not complete until
+     * the transaction has been committed or aborted. */
+    if(H5_daos_create_task(H5_daos_map_key_count_tx_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            NULL, NULL, count_udata, &count_udata->tx_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to update map key count");
+
+    /* Schedule map key count task (or save it to be scheduled later) and
+     * give it a reference to req and the map */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(count_udata->tx_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to update map key count: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = count_udata->tx_task;
+    *dep_task = count_udata->tx_task;
+    req->rc++;
+    map->obj.item.rc++;
+    count_udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if(ret_value < 0)
+        count_udata = DV_free(count_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_update() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_tx_task
+ *
+ * Purpose:     Body function for the task created by
+ *              H5_daos_map_key_count_update().  Opens the transaction and
+ *              starts the first attempt at it.  This task is completed by
+ *              H5_daos_map_key_count_tx_finish().
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_tx_task(tse_task_t *task)
+{
+    H5_daos_map_key_count_ud_t *udata = NULL;
+    hbool_t started = FALSE;
+    int ret;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key count task");
+
+    assert(task == udata->tx_task);
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_MAP);
+
+    /* Open transaction */
+    if(0 != (ret = daos_tx_open(udata->md_rw_cb_ud.req->file->coh, &udata->th, 0, NULL /*event*/)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't open transaction to update map key count: %s", H5_daos_err_to_string(ret));
+    udata->th_open = TRUE;
+
+    /* Start the first attempt.  From here on the attempt is responsible for
+     * finishing the transaction, even if it fails. */
+    started = TRUE;
+    if(H5_daos_map_key_count_tx_attempt(udata, FALSE) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't start map key count transaction");
+
+done:
+    if(udata) {
+        /* Finish now if the transaction was not started */
+        if(!started) {
+            udata->tx_status = ret_value;
+            if(H5_daos_map_key_count_tx_finish(udata) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't finish map key count transaction");
+        } /* end if */
+    } /* end if */
+    else {
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+        tse_task_complete(task, ret_value);
+    } /* end else */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_tx_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_tx_attempt
+ *
+ * Purpose:     Creates the tasks for one attempt at a map key count
+ *              transaction: fetches of the key and the count, then the
+ *              key write or punch and the count update, then a task to
+ *              commit, abort or restart the transaction.  If restart is
+ *              TRUE the transaction is restarted first.  On failure the
+ *              transaction is aborted and finished once any tasks that
+ *              were already created have completed.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_key_count_tx_attempt(H5_daos_map_key_count_ud_t *udata,
+    hbool_t restart)
+{
+    tse_task_t *fetch_tasks[2] = {NULL, NULL};
+    tse_task_t *update_task = NULL;
+    tse_task_t *end_task = NULL;
+    daos_opc_t key_opc;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(udata);
+    assert(udata->th_open);
+
+    /* Restart transaction, discarding the previous attempt */
+    if(restart && 0 != (ret = daos_tx_restart(udata->th, NULL /*event*/)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't restart map key count transaction: %s", H5_daos_err_to_string(ret));
+    udata->tx_status = 0;
+
+    /* Create task to end this attempt.  It depends on every other task
+     * created here. */
+    if(H5_daos_create_task(H5_daos_map_key_count_tx_end_task, 0, NULL, NULL, NULL,
+            udata, &end_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to end map key count transaction");
+
+    /* Create task to check if the key exists */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_key_count_exists_prep_cb,
+            H5_daos_map_key_count_tx_comp_cb, udata, &fetch_tasks[0]) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to check if map key exists");
+    if(0 != (ret = tse_task_register_deps(end_task, 1, &fetch_tasks[0])))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create dependencies for map key count transaction end task: %s", H5_daos_err_to_string(ret));
+    if(0 != (ret = tse_task_schedule(fetch_tasks[0], false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to check if map key exists: %s", H5_daos_err_to_string(ret));
+
+    /* Create task to read key count */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_key_count_fetch_prep_cb,
+            H5_daos_map_key_count_tx_comp_cb, udata, &fetch_tasks[1]) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map key count");
+    if(0 != (ret = tse_task_register_deps(end_task, 1, &fetch_tasks[1])))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create dependencies for map key count transaction end task: %s", H5_daos_err_to_string(ret));
+    if(0 != (ret = tse_task_schedule(fetch_tasks[1], false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to read map key count: %s", H5_daos_err_to_string(ret));
+
+    /* Create task to write or punch the key */
+    if(udata->key_ud)
+        key_opc = DAOS_OPC_OBJ_UPDATE;
+    else
+        key_opc = udata->punch_akey ? DAOS_OPC_OBJ_PUNCH_AKEYS : DAOS_OPC_OBJ_PUNCH_DKEYS;
+    if(H5_daos_create_daos_task(key_opc, 2, fetch_tasks, H5_daos_map_key_count_key_prep_cb,
+            H5_daos_map_key_count_tx_comp_cb, udata, &update_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write or delete map key");
+    if(0 != (ret = tse_task_register_deps(end_task, 1, &update_task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create dependencies for map key count transaction end task: %s", H5_daos_err_to_string(ret));
+    if(0 != (ret = tse_task_schedule(update_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to write or delete map key: %s", H5_daos_err_to_string(ret));
+
+    /* Create task to write key count */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 2, fetch_tasks, H5_daos_map_key_count_update_prep_cb,
+            H5_daos_map_key_count_tx_comp_cb, udata, &update_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to write map key count");
+    if(0 != (ret = tse_task_register_deps(end_task, 1, &update_task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create dependencies for map key count transaction end task: %s", H5_daos_err_to_string(ret));
+    if(0 != (ret = tse_task_schedule(update_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to write map key count: %s", H5_daos_err_to_string(ret));
+
+done:
+    if(ret_value < 0) {
+        /* Make the tasks that were created skip their I/O so the end task
+         * aborts the transaction */
+        if(udata->tx_status == 0)
+            udata->tx_status = -H5_DAOS_SETUP_ERROR;
+
+        /* If there is no end task finish the transaction now */
+        if(!end_task && H5_daos_map_key_count_tx_finish(udata) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't finish map key count transaction");
+    } /* end if */
+
+    /* Schedule end task */
+    if(end_task && 0 != (ret = tse_task_schedule(end_task, false)))
+        D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to end map key count transaction: %s", H5_daos_err_to_string(ret));
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_tx_attempt() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_exists_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to check
+ *              if a key exists in a map key count transaction.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_exists_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_key_count_ud_t *udata;
+    daos_obj_rw_t *rw_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key existence check task");
+
+    assert(udata->md_rw_cb_ud.obj);
+
+    /* Skip if the attempt already failed */
+    if(udata->tx_status != 0)
+        D_GOTO_DONE(-H5_DAOS_PRE_ERROR);
+
+    /* Reset iod size, it is set to 0 by the fetch if the key does not
+     * exist */
+    udata->key_iod.iod_size = DAOS_REC_ANY;
+
+    /* Set fetch task arguments */
+    if(NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for map key existence check task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh = udata->md_rw_cb_ud.obj->obj_oh;
+    rw_args->th = udata->th;
+    rw_args->dkey = &udata->key_dkey;
+    rw_args->nr = 1u;
+    rw_args->iods = &udata->key_iod;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_exists_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_fetch_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to read a
+ *              map's key count in a map key count transaction.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_fetch_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_key_count_ud_t *udata;
+    daos_obj_rw_t *fetch_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key count fetch task");
+
+    assert(udata->md_rw_cb_ud.obj);
+
+    /* Skip if the attempt already failed */
+    if(udata->tx_status != 0)
+        D_GOTO_DONE(-H5_DAOS_PRE_ERROR);
+
+    /* Reset iod size and sgl, they are updated by the fetch */
+    udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)H5_DAOS_ENCODED_NUM_KEYS_SIZE;
+    udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+
+    /* Set fetch task arguments */
+    if(NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for map key count fetch task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh = udata->md_rw_cb_ud.obj->obj_oh;
+    fetch_args->th = udata->th;
+    fetch_args->dkey = &udata->md_rw_cb_ud.dkey;
+    fetch_args->nr = udata->md_rw_cb_ud.nr;
+    fetch_args->iods = udata->md_rw_cb_ud.iod;
+    fetch_args->sgls = udata->md_rw_cb_ud.sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_fetch_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_key_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update/
+ *              daos_obj_punch_akeys/daos_obj_punch_dkeys to write or
+ *              delete the key in a map key count transaction.  Deletes
+ *              fail with -DER_NONEXIST if the key does not exist.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_key_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_key_count_ud_t *udata;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key write task");
+
+    assert(udata->md_rw_cb_ud.obj);
+
+    /* Skip if the attempt already failed */
+    if(udata->tx_status != 0)
+        D_GOTO_DONE(-H5_DAOS_PRE_ERROR);
+
+    if(udata->key_ud) {
+        daos_obj_rw_t *update_args;
+
+        /* Set update task arguments */
+        if(NULL == (update_args = daos_task_get_args(task)))
+            D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for map key write task");
+        memset(update_args, 0, sizeof(*update_args));
+        update_args->oh = udata->md_rw_cb_ud.obj->obj_oh;
+        update_args->th = udata->th;
+        update_args->dkey = &udata->key_dkey;
+        update_args->nr = udata->key_ud->nr;
+        update_args->iods = udata->key_ud->iod;
+        update_args->sgls = udata->key_ud->sgl;
+    } /* end if */
+    else {
+        daos_obj_punch_t *punch_args;
+
+        /* Fail if the key does not exist, like the conditional punch used
+         * for maps that do not count their keys */
+        if(udata->key_iod.iod_size == 0)
+            D_GOTO_DONE(-DER_NONEXIST);
+
+        /* Set punch task arguments */
+        if(NULL == (punch_args = daos_task_get_args(task)))
+            D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for map key deletion task");
+        memset(punch_args, 0, sizeof(*punch_args));
+        punch_args->oh = udata->md_rw_cb_ud.obj->obj_oh;
+        punch_args->th = udata->th;
+        punch_args->dkey = &udata->key_dkey;
+        punch_args->akeys = udata->punch_akey ? &udata->key_akey : NULL;
+        punch_args->akey_nr = udata->punch_akey ? 1 : 0;
+    } /* end else */
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_key_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_update_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update to write
+ *              a map's key count in a map key count transaction.
+ *              Increments the count that was just read if a new key is
+ *              being written or decrements it if an existing key is being
+ *              deleted, then sets up the write.  The count never goes
+ *              below 0.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_update_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_key_count_ud_t *udata;
+    daos_obj_rw_t *update_args;
+    hbool_t key_exists;
+    uint64_t nkeys = 0;
+    uint8_t *p;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key count update task");
+
+    assert(udata->md_rw_cb_ud.obj);
+
+    /* Skip if the attempt already failed */
+    if(udata->tx_status != 0)
+        D_GOTO_DONE(-H5_DAOS_PRE_ERROR);
+
+    /* Decode the current count.  If the count akey was not found treat the
+     * count as 0. */
+    if(udata->md_rw_cb_ud.iod[0].iod_size != 0) {
+        p = udata->nkeys_buf;
+        UINT64DECODE(p, nkeys)
+    } /* end if */
+
+    /* Apply change */
+    key_exists = udata->key_iod.iod_size != 0;
+    if(udata->key_ud) {
+        if(!key_exists)
+            nkeys++;
+    } /* end if */
+    else if(key_exists && nkeys > 0)
+        nkeys--;
+
+    /* Encode new count.  The count is written even if it did not change so
+     * concurrent transactions on the map always conflict with each other. */
+    p = udata->nkeys_buf;
+    UINT64ENCODE(p, nkeys)
+    udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)H5_DAOS_ENCODED_NUM_KEYS_SIZE;
+    udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+
+    /* Set update task arguments */
+    if(NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for map key count update task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh = udata->md_rw_cb_ud.obj->obj_oh;
+    update_args->th = udata->th;
+    update_args->dkey = &udata->md_rw_cb_ud.dkey;
+    update_args->nr = udata->md_rw_cb_ud.nr;
+    update_args->iods = udata->md_rw_cb_ud.iod;
+    update_args->sgls = udata->md_rw_cb_ud.sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_update_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_tx_comp_cb
+ *
+ * Purpose:     Complete callback for the asynchronous DAOS operations in
+ *              a map key count transaction.  Records the first failure in
+ *              the transaction's status.  Private data is freed by
+ *              H5_daos_map_key_count_tx_finish().
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_tx_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_key_count_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key count transaction task");
+
+    /* Record the first failure in this attempt.  -DER_TX_RESTART is handled
+     * by the end task. */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR && udata->tx_status == 0)
+        udata->tx_status = task->dt_result;
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in this function */
+    if(udata && ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->tx_status == 0)
+        udata->tx_status = ret_value;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_tx_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_tx_end_task
+ *
+ * Purpose:     Ends one attempt at a map key count transaction.  Restarts
+ *              the transaction if it conflicted with another one,
+ *              otherwise commits it if all operations succeeded or aborts
+ *              it if one failed.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_tx_end_task(tse_task_t *task)
+{
+    H5_daos_map_key_count_ud_t *udata;
+    tse_task_t *commit_task = NULL;
+    int ret;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key count transaction end task");
+
+    if(udata->tx_status == -DER_TX_RESTART) {
+        /* Start another attempt.  This finishes the transaction on failure,
+         * so udata must not be used after this. */
+        if(H5_daos_map_key_count_tx_attempt(udata, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't restart map key count transaction");
+        udata = NULL;
+    } /* end if */
+    else {
+        /* Create task to commit the transaction, or abort it on failure */
+        if(H5_daos_create_daos_task(udata->tx_status == 0 ? DAOS_OPC_TX_COMMIT : DAOS_OPC_TX_ABORT,
+                0, NULL, NULL, H5_daos_map_key_count_tx_commit_comp_cb, udata, &commit_task) < 0) {
+            commit_task = NULL;
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to commit map key count transaction");
+        } /* end if */
+
+        /* Set arguments */
+        if(udata->tx_status == 0) {
+            daos_tx_commit_t *commit_args;
+
+            if(NULL == (commit_args = daos_task_get_args(commit_task)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for transaction commit task");
+            commit_args->th = udata->th;
+            commit_args->flags = 0;
+        } /* end if */
+        else {
+            daos_tx_abort_t *abort_args;
+
+            if(NULL == (abort_args = daos_task_get_args(commit_task)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for transaction abort task");
+            abort_args->th = udata->th;
+        } /* end else */
+
+        /* Schedule commit task */
+        if(0 != (ret = tse_task_schedule(commit_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task to commit map key count transaction: %s", H5_daos_err_to_string(ret));
+        commit_task = NULL;
+    } /* end else */
+
+done:
+    /* Finish the transaction if the commit or abort task could not be
+     * started.  If it was created, completing it runs its completion
+     * callback, which finishes the transaction. */
+    if(udata && ret_value < 0) {
+        if(commit_task)
+            tse_task_complete(commit_task, ret_value);
+        else {
+            if(udata->tx_status == 0)
+                udata->tx_status = ret_value;
+            if(H5_daos_map_key_count_tx_finish(udata) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't finish map key count transaction");
+        } /* end else */
+    } /* end if */
+
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_tx_end_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_tx_commit_comp_cb
+ *
+ * Purpose:     Complete callback for the commit or abort of a map key
+ *              count transaction.  Restarts the transaction if the commit
+ *              conflicted with another one, otherwise finishes it.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_tx_commit_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_key_count_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key count transaction commit task");
+
+    if(udata->tx_status == 0 && task->dt_result == -DER_TX_RESTART) {
+        /* Start another attempt.  This finishes the transaction on failure. */
+        if(H5_daos_map_key_count_tx_attempt(udata, TRUE) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't restart map key count transaction");
+    } /* end if */
+    else {
+        /* Record commit failure, unless this is the abort after a failed
+         * attempt */
+        if(udata->tx_status == 0 && task->dt_result < -H5_DAOS_PRE_ERROR)
+            udata->tx_status = task->dt_result;
+
+        /* Finish the transaction */
+        if(H5_daos_map_key_count_tx_finish(udata) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't finish map key count transaction");
+    } /* end else */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_tx_commit_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_count_tx_finish
+ *
+ * Purpose:     Finishes a map key count transaction: closes the
+ *              transaction, passes any failure on to the request,
+ *              completes the task created by
+ *              H5_daos_map_key_count_update() and frees udata.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_key_count_tx_finish(H5_daos_map_key_count_ud_t *udata)
+{
+    H5_daos_req_t *req;
+    int ret;
+    int ret_value = 0;
+
+    assert(udata);
+    assert(udata->tx_task);
+
+    req = udata->md_rw_cb_ud.req;
+
+    /* Close transaction */
+    if(udata->th_open) {
+        if(0 != (ret = daos_tx_close(udata->th, NULL /*event*/)))
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, ret, "can't close map key count transaction: %s", H5_daos_err_to_string(ret));
+        udata->th_open = FALSE;
+    } /* end if */
+
+    /* Close map */
+    if(H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+    /* Return transaction task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, udata->tx_task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in the transaction.  Only record error in req->status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(udata->tx_status < -H5_DAOS_PRE_ERROR
+            && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status = udata->tx_status;
+        req->failed_task = udata->md_rw_cb_ud.task_name;
+    } /* end if */
+
+    /* Complete transaction task in engine */
+    tse_task_complete(udata->tx_task, udata->tx_status);
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if(ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status = ret_value;
+        req->failed_task = "map key count transaction finish";
+    } /* end if */
+
+    /* Release our reference to req */
+    if(H5_daos_req_free_int(req) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    udata = DV_free(udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_key_count_tx_finish() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_size
+ *
+ * Purpose:     Calculates the number of bits and hashes for a map bloom
+ *              filter sized for expected_keys keys.  The number of bits
+ *              is always a multiple of 8.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_map_bloom_size(hsize_t expected_keys, uint64_t *nbits,
+    uint64_t *nhashes)
+{
+    assert(expected_keys > 0);
+    assert(nbits);
+    assert(nhashes);
+
+    *nbits = (uint64_t)expected_keys * H5_DAOS_MAP_BLOOM_BITS_PER_KEY;
+    *nbits = (*nbits + 7) & ~(uint64_t)7;
+    if(*nbits < H5_DAOS_MAP_BLOOM_MIN_BITS)
+        *nbits = H5_DAOS_MAP_BLOOM_MIN_BITS;
+    *nhashes = H5_DAOS_MAP_BLOOM_NHASHES;
+
+    return;
+} /* end H5_daos_map_bloom_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_hash
+ *
+ * Purpose:     Hashes a key (in its file representation) for a map bloom
+ *              filter.  h1 is the FNV-1a hash of the key and h2 is h1 run
+ *              through the splitmix64 finalizer, forced odd.  The bits
+ *              for the key are h1 + i * h2 for i from 0 to the number of
+ *              hashes.  The hashes are part of the file format and must
+ *              not change.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_map_bloom_hash(const void *key, size_t key_size, uint64_t *h1,
+    uint64_t *h2)
+{
+    const uint8_t *p = (const uint8_t *)key;
+    uint64_t h = UINT64_C(14695981039346656037);
+    size_t i;
+
+    assert(key || key_size == 0);
+    assert(h1);
+    assert(h2);
+
+    for(i = 0; i < key_size; i++) {
+        h ^= (uint64_t)p[i];
+        h *= UINT64_C(1099511628211);
+    } /* end for */
+    *h1 = h;
+
+    h ^= h >> 30;
+    h *= UINT64_C(0xbf58476d1ce4e5b9);
+    h ^= h >> 27;
+    h *= UINT64_C(0x94d049bb133111eb);
+    h ^= h >> 31;
+    *h2 = h | 1;
+
+    return;
+} /* end H5_daos_map_bloom_hash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_test
+ *
+ * Purpose:     Checks a key (in its file representation) against a
+ *              loaded map bloom filter.
+ *
+ * Return:      TRUE if the key may be in the map, FALSE if it is not
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_map_bloom_test(const H5_daos_map_bloom_t *bloom, const void *key,
+    size_t key_size)
+{
+    uint64_t h1, h2;
+    uint64_t bit;
+    uint64_t i;
+
+    assert(bloom);
+    assert(bloom->nbits > 0);
+    assert(bloom->bits);
+
+    H5_daos_map_bloom_hash(key, key_size, &h1, &h2);
+    for(i = 0; i < bloom->nhashes; i++) {
+        bit = (h1 + i * h2) % bloom->nbits;
+        if(!(bloom->bits[bit / 8] & (uint8_t)(1 << (bit % 8))))
+            return FALSE;
+    } /* end for */
+
+    return TRUE;
+} /* end H5_daos_map_bloom_test() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_add
+ *
+ * Purpose:     Adds a key (in its file representation) to this handle's
+ *              copy of a map's bloom filter.  The key's bits are also
+ *              recorded as pending, they are written to the stored filter
+ *              when the handle is closed or the filter is refreshed (see
+ *              H5_daos_map_bloom_sync), so puts do no extra I/O.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_bloom_add(H5_daos_map_t *map, const void *key, size_t key_size)
+{
+    uint64_t h1, h2;
+    uint64_t bit;
+    uint64_t i;
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+    assert(map->bloom.nbits > 0);
+
+    /* Allocate the pending bits if necessary */
+    if(!map->bloom.pending)
+        if(NULL == (map->bloom.pending = (uint8_t *)DV_calloc((size_t)(map->bloom.nbits / 8))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate pending map bloom filter bits");
+
+    /* Set the key's bits.  The filter may not be loaded yet if the map is
+     * still being opened, in that case the pending bits are merged into it
+     * when it is loaded. */
+    H5_daos_map_bloom_hash(key, key_size, &h1, &h2);
+    for(i = 0; i < map->bloom.nhashes; i++) {
+        bit = (h1 + i * h2) % map->bloom.nbits;
+        map->bloom.pending[bit / 8] |= (uint8_t)(1 << (bit % 8));
+        if(map->bloom.bits)
+            map->bloom.bits[bit / 8] |= (uint8_t)(1 << (bit % 8));
+    } /* end for */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_load
+ *
+ * Purpose:     Creates a task to read a map's bloom filter into the map's
+ *              local copy, as part of the operation req.  The task does
+ *              nothing if the map turns out not to have a bloom filter,
+ *              which is only known once the map info has been read.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_bloom_load(H5_daos_map_t *map, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_map_bloom_ud_t *fetch_udata = NULL;
+    tse_task_t *fetch_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct for fetch task.  The rest is set up by the
+     * prep callback. */
+    if(NULL == (fetch_udata = (H5_daos_map_bloom_ud_t *)DV_calloc(sizeof(H5_daos_map_bloom_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map bloom filter load task arguments");
+    fetch_udata->md_rw_cb_ud.req = req;
+    fetch_udata->md_rw_cb_ud.obj = &map->obj;
+    fetch_udata->md_rw_cb_ud.task_name = "map bloom filter load";
+
+    /* Create task to read the filter */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            H5_daos_map_bloom_load_prep_cb, H5_daos_map_bloom_load_comp_cb, fetch_udata, &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to load map bloom filter");
+
+    /* Schedule fetch task (or save it to be scheduled later) and give it a
+     * reference to req and the map */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to load map bloom filter: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = fetch_task;
+    *dep_task = fetch_task;
+    req->rc++;
+    map->obj.item.rc++;
+    fetch_udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if(ret_value < 0)
+        fetch_udata = DV_free(fetch_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_load() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_load_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to read a
+ *              map's bloom filter.  Skips the fetch if the map does not
+ *              have a bloom filter, otherwise allocates a bitmap and reads
+ *              the whole filter into it.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_bloom_load_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_bloom_ud_t *udata;
+    H5_daos_map_t *map;
+    daos_obj_rw_t *fetch_args;
+    void *bits = NULL;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map bloom filter load task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.obj);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_MAP);
+
+    map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+
+    /* Nothing to do if the map does not have a bloom filter */
+    if(map->bloom.nbits == 0)
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+
+    /* Allocate bitmap for the filter.  Records that were never written read
+     * back as 0. */
+    if(NULL == (bits = DV_calloc((size_t)(map->bloom.nbits / 8))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for map bloom filter");
+
+    /* Set up dkey.  Point to global name buffer, do not free. */
+    daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g);
+    udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Set up iod */
+    udata->recx.rx_idx = 0;
+    udata->recx.rx_nr = map->bloom.nbits / 8;
+    daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_bloom_key_g, H5_daos_bloom_key_size_g);
+    udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
+    udata->md_rw_cb_ud.iod[0].iod_size = 1;
+    udata->md_rw_cb_ud.iod[0].iod_recxs = &udata->recx;
+    udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_ARRAY;
+    udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], bits, (daos_size_t)(map->bloom.nbits / 8));
+    udata->md_rw_cb_ud.sgl[0].sg_nr = 1;
+    udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+    udata->md_rw_cb_ud.sgl[0].sg_iovs = &udata->md_rw_cb_ud.sg_iov[0];
+    udata->md_rw_cb_ud.free_sg_iov[0] = TRUE;
+    bits = NULL;
+
+    /* Set nr */
+    udata->md_rw_cb_ud.nr = 1u;
+
+    /* Set fetch task arguments */
+    if(NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for map bloom filter load task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh = udata->md_rw_cb_ud.obj->obj_oh;
+    fetch_args->th = udata->md_rw_cb_ud.req->th;
+    fetch_args->dkey = &udata->md_rw_cb_ud.dkey;
+    fetch_args->nr = udata->md_rw_cb_ud.nr;
+    fetch_args->iods = udata->md_rw_cb_ud.iod;
+    fetch_args->sgls = udata->md_rw_cb_ud.sgl;
+
+done:
+    if(ret_value < 0) {
+        DV_free(bits);
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_load_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_load_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
+ *              a map's bloom filter.  Merges any bits that were added
+ *              through this handle before the filter was loaded and makes
+ *              the bitmap that was read the map's local copy of the
+ *              filter, then checks for a failed task and frees private
+ *              data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_bloom_load_comp_cb(tse_task_t *task, void *args)
+{
+    H5_daos_map_bloom_ud_t *udata;
+    H5_daos_map_t *map;
+    uint8_t *bits;
+    uint64_t i;
+    int ret;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map bloom filter load task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.obj);
+
+    /* Take ownership of the filter if it was read */
+    if(task->dt_result == 0) {
+        map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+        bits = (uint8_t *)udata->md_rw_cb_ud.sg_iov[0].iov_buf;
+        assert(bits);
+
+        if(map->bloom.pending)
+            for(i = 0; i < map->bloom.nbits / 8; i++)
+                bits[i] |= map->bloom.pending[i];
+
+        DV_free(map->bloom.bits);
+        map->bloom.bits = bits;
+        udata->md_rw_cb_ud.free_sg_iov[0] = FALSE;
+    } /* end if */
+
+done:
+    if(udata) {
+        /* Handle errors in this function */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map bloom filter load completion callback";
+        } /* end if */
+
+        /* Check for a failed fetch, release references and free private
+         * data */
+        if(0 != (ret = H5_daos_md_update_comp_cb(task, args)))
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, ret, "can't finish map bloom filter load");
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_load_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_sync
+ *
+ * Purpose:     Synchronizes this handle's copy of a map's bloom filter
+ *              with the stored filter and waits for it to complete.
+ *
+ *              If no keys were put through this handle since the last
+ *              synchronization only the filter info is read, and the
+ *              filter itself is only read if its generation changed,
+ *              i.e. if another handle wrote keys to it since.
+ *
+ *              Otherwise the stored filter is read in a transaction, the
+ *              pending bits are merged into it and it is written back
+ *              with the next generation in the same transaction.  If
+ *              another process wrote the filter in the meantime the
+ *              transaction fails to commit and is retried.
+ *
+ *              Either way our copy ends up with the keys in the stored
+ *              filter as well as those put through this handle.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_bloom_sync(H5_daos_map_t *map, hid_t dxpl_id)
+{
+    uint8_t info_buf[H5_DAOS_ENCODED_BLOOM_INFO_SIZE];
+    daos_handle_t th = DAOS_TX_NONE;
+    hbool_t th_open = FALSE;
+    uint8_t *bits = NULL;
+    uint64_t gen = 0;
+    uint8_t *p;
+    uint64_t i;
+    int status;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+    assert(map->bloom.nbits > 0);
+
+    /* Wait for the map to open if necessary, so our copy is loaded */
+    if(!map->obj.item.created && map->obj.item.open_req->status != 0) {
+        if(H5_daos_progress(map->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if(map->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "map open failed");
+    } /* end if */
+    assert(map->bloom.bits);
+
+    if(!map->bloom.pending) {
+        /* Check the generation of the stored filter */
+        if(H5_daos_map_bloom_rw(map, DAOS_OPC_OBJ_FETCH, info_buf, NULL, DAOS_TX_NONE,
+                FALSE, dxpl_id, &status) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read map bloom filter info");
+        if(status < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read map bloom filter info: %s", H5_daos_err_to_string(status));
+        p = info_buf + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+        UINT64DECODE(p, gen)
+
+        /* Nothing to do if our copy is current */
+        if(gen == map->bloom.gen)
+            D_GOTO_DONE(SUCCEED);
+
+        /* Read the stored filter.  It may be newer than gen, in which case
+         * the next sync reads it again. */
+        if(NULL == (bits = (uint8_t *)DV_calloc((size_t)(map->bloom.nbits / 8))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map bloom filter");
+        if(H5_daos_map_bloom_rw(map, DAOS_OPC_OBJ_FETCH, NULL, bits, DAOS_TX_NONE,
+                FALSE, dxpl_id, &status) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read map bloom filter");
+        if(status < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read map bloom filter: %s", H5_daos_err_to_string(status));
+    } /* end if */
+    else {
+        /* Allocate bitmap for the stored filter */
+        if(NULL == (bits = (uint8_t *)DV_malloc((size_t)(map->bloom.nbits / 8))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map bloom filter");
+
+        do {
+            /* Start transaction */
+            if(0 != (ret = daos_tx_open(map->obj.item.file->coh, &th, 0, NULL /*event*/)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't start transaction: %s", H5_daos_err_to_string(ret));
+            th_open = TRUE;
+
+            /* Read the stored filter and its info in the transaction */
+            memset(bits, 0, (size_t)(map->bloom.nbits / 8));
+            if(H5_daos_map_bloom_rw(map, DAOS_OPC_OBJ_FETCH, info_buf, bits, th,
+                    FALSE, dxpl_id, &status) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read map bloom filter");
+            if(status == -DER_TX_RESTART) {
+                th_open = FALSE;
+                if(0 != (ret = daos_tx_close(th, NULL /*event*/)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close transaction: %s", H5_daos_err_to_string(ret));
+                continue;
+            } /* end if */
+            if(status < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read map bloom filter: %s", H5_daos_err_to_string(status));
+
+            /* Merge our pending bits and write the filter back with the next
+             * generation, then commit the transaction.  The transaction is
+             * closed even if this fails. */
+            for(i = 0; i < map->bloom.nbits / 8; i++)
+                bits[i] |= map->bloom.pending[i];
+            p = info_buf + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+            UINT64DECODE(p, gen)
+            gen++;
+            p = info_buf + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+            UINT64ENCODE(p, gen)
+            th_open = FALSE;
+            if(H5_daos_map_bloom_rw(map, DAOS_OPC_OBJ_UPDATE, info_buf, bits, th,
+                    TRUE, dxpl_id, &status) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, FAIL, "can't write map bloom filter");
+            if(status < 0 && status != -DER_TX_RESTART)
+                D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, FAIL, "can't write map bloom filter: %s", H5_daos_err_to_string(status));
+        } while(status == -DER_TX_RESTART);
+
+        /* The pending bits are now stored */
+        map->bloom.pending = DV_free(map->bloom.pending);
+    } /* end else */
+
+    /* Switch to the stored filter */
+    DV_free(map->bloom.bits);
+    map->bloom.bits = bits;
+    bits = NULL;
+    map->bloom.gen = gen;
+
+done:
+    /* Close transaction if it was not handed off to be committed */
+    if(th_open)
+        if(0 != (ret = daos_tx_close(th, NULL /*event*/)))
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close transaction: %s", H5_daos_err_to_string(ret));
+
+    bits = DV_free(bits);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_sync() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_rebuild
+ *
+ * Purpose:     Rebuilds a map's bloom filter from the keys in the map,
+ *              clearing the bits of deleted keys, and waits for the new
+ *              filter to be written.
+ *
+ *              The rebuild runs in a transaction that first reads the
+ *              filter info, then adds every key in the map to a new
+ *              filter, which overwrites the stored filter with the next
+ *              generation in the same transaction.  A concurrent rebuild
+ *              or write back of another handle's pending bits writes the
+ *              info, so the transaction fails to commit and is retried.
+ *              Keys put through other handles are not in the stored
+ *              filter until those handles write their pending bits back,
+ *              which merges them into the rebuilt filter.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_bloom_rebuild(H5_daos_map_t *map, hid_t dxpl_id)
+{
+    H5_daos_map_bloom_rebuild_ud_t rebuild_udata = {NULL, NULL, H5I_INVALID_HID};
+    H5_daos_iter_data_t iter_data;
+    uint8_t info_buf[H5_DAOS_ENCODED_BLOOM_INFO_SIZE];
+    daos_handle_t th;
+    hbool_t th_open = FALSE;
+    hid_t map_id = H5I_INVALID_HID;
+    uint64_t gen = 0;
+    uint8_t *p;
+    int status;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+    assert(map->bloom.nbits > 0);
+
+    /* Allocate bitmap for the new filter */
+    if(NULL == (rebuild_udata.bits = (uint8_t *)DV_malloc((size_t)(map->bloom.nbits / 8))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map bloom filter");
+    rebuild_udata.map = map;
+    rebuild_udata.dxpl_id = dxpl_id;
+
+    /* Register ID for map */
+    if((map_id = H5VLwrap_register(map, H5I_MAP)) < 0)
+        D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
+    map->obj.item.rc++;
+
+    do {
+        /* Start transaction */
+        if(0 != (ret = daos_tx_open(map->obj.item.file->coh, &th, 0, NULL /*event*/)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't start transaction: %s", H5_daos_err_to_string(ret));
+        th_open = TRUE;
+
+        /* Read the filter info in the transaction */
+        if(H5_daos_map_bloom_rw(map, DAOS_OPC_OBJ_FETCH, info_buf, NULL, th,
+                FALSE, dxpl_id, &status) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read map bloom filter info");
+        if(status == -DER_TX_RESTART) {
+            th_open = FALSE;
+            if(0 != (ret = daos_tx_close(th, NULL /*event*/)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close transaction: %s", H5_daos_err_to_string(ret));
+            continue;
+        } /* end if */
+        if(status < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_READERROR, FAIL, "can't read map bloom filter info: %s", H5_daos_err_to_string(status));
+
+        /* Add every key in the map to the new filter */
+        memset(rebuild_udata.bits, 0, (size_t)(map->bloom.nbits / 8));
+        H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_MAP, H5_INDEX_NAME, H5_ITER_INC,
+                FALSE, NULL, map_id, &rebuild_udata, NULL, NULL);
+        iter_data.u.map_iter_data.key_mem_type_id = map->key_type_id;
+        iter_data.u.map_iter_data.u.map_iter_op = H5_daos_map_bloom_rebuild_cb;
+        if(H5_daos_map_iterate_sync(map, &iter_data, "map bloom filter rebuild", dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_BADITER, FAIL, "can't iterate over map keys");
+
+        /* Write the new filter over the stored filter with the next
+         * generation and commit the transaction.  The transaction is closed
+         * even if this fails. */
+        p = info_buf + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+        UINT64DECODE(p, gen)
+        gen++;
+        p = info_buf + (2 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+        UINT64ENCODE(p, gen)
+        th_open = FALSE;
+        if(H5_daos_map_bloom_rw(map, DAOS_OPC_OBJ_UPDATE, info_buf, rebuild_udata.bits,
+                th, TRUE, dxpl_id, &status) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, FAIL, "can't write map bloom filter");
+        if(status < 0 && status != -DER_TX_RESTART)
+            D_GOTO_ERROR(H5E_MAP, H5E_WRITEERROR, FAIL, "can't write map bloom filter: %s", H5_daos_err_to_string(status));
+    } while(status == -DER_TX_RESTART);
+
+    /* Switch to the new filter.  Every key in the map is in it, so nothing
+     * is pending any more. */
+    DV_free(map->bloom.bits);
+    map->bloom.bits = rebuild_udata.bits;
+    rebuild_udata.bits = NULL;
+    map->bloom.pending = DV_free(map->bloom.pending);
+    map->bloom.gen = gen;
+
+done:
+    /* Close transaction if it was not handed off to be committed */
+    if(th_open)
+        if(0 != (ret = daos_tx_close(th, NULL /*event*/)))
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close transaction: %s", H5_daos_err_to_string(ret));
+
+    if(map_id >= 0) {
+        map->obj.item.nonblocking_close = TRUE;
+        if((ret = H5Idec_ref(map_id)) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close map ID");
+        if(ret)
+            map->obj.item.nonblocking_close = FALSE;
+        map_id = H5I_INVALID_HID;
+    } /* end if */
+
+    /* Cleanup */
+    rebuild_udata.bits = DV_free(rebuild_udata.bits);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_rebuild() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_bloom_rw
+ *
+ * Purpose:     Reads or writes (depending on opc) a map's bloom filter
+ *              info from/to info_buf and/or the filter bitmap from/to
+ *              bits, in the transaction th (which may be DAOS_TX_NONE),
+ *              and waits for it to complete.  Either info_buf or bits may
+ *              be NULL.  If commit is TRUE the transaction is then
+ *              committed (or aborted on failure) and closed, even if this
+ *              function fails.  The status of the operation is returned
+ *              in *status, so the caller can handle a conflict with
+ *              another transaction (-DER_TX_RESTART).
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_bloom_rw(H5_daos_map_t *map, daos_opc_t opc, uint8_t *info_buf,
+    uint8_t *bits, daos_handle_t th, hbool_t commit, hid_t dxpl_id, int *status)
+{
+    H5_daos_map_bloom_ud_t *rw_udata = NULL;
+    H5_daos_req_t *int_req = NULL;
+    tse_task_t *first_task = NULL;
+    tse_task_t *dep_task = NULL;
+    unsigned nr = 0;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+    assert(map->bloom.nbits > 0);
+    assert(opc == DAOS_OPC_OBJ_FETCH || opc == DAOS_OPC_OBJ_UPDATE);
+    assert(info_buf || bits);
+    assert(!commit || !daos_handle_is_inval(th));
+    assert(status);
+
+    /* Start H5 operation */
+    if(NULL == (int_req = H5_daos_req_create(map->obj.item.file, "map bloom filter I/O",
+            map->obj.item.open_req, NULL, NULL, dxpl_id))) {
+        if(commit && 0 != (ret = daos_tx_close(th, NULL /*event*/)))
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't close transaction: %s", H5_daos_err_to_string(ret));
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    } /* end if */
+
+    /* Use the transaction, h5op_finalize commits it if requested */
+    int_req->th = th;
+    int_req->th_open = commit;
+
+    /* Allocate argument struct for I/O task */
+    if(NULL == (rw_udata = (H5_daos_map_bloom_ud_t *)DV_calloc(sizeof(H5_daos_map_bloom_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map bloom filter I/O task arguments");
+    rw_udata->md_rw_cb_ud.req = int_req;
+    rw_udata->md_rw_cb_ud.obj = &map->obj;
+
+    /* Set up dkey.  Point to global name buffer, do not free. */
+    daos_const_iov_set((d_const_iov_t *)&rw_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g);
+    rw_udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Set up iods and sgls.  The buffers belong to the caller. */
+    if(info_buf) {
+        daos_const_iov_set((d_const_iov_t *)&rw_udata->md_rw_cb_ud.iod[nr].iod_name, H5_daos_bloom_info_key_g, H5_daos_bloom_info_key_size_g);
+        rw_udata->md_rw_cb_ud.iod[nr].iod_nr = 1u;
+        rw_udata->md_rw_cb_ud.iod[nr].iod_size = (daos_size_t)H5_DAOS_ENCODED_BLOOM_INFO_SIZE;
+        rw_udata->md_rw_cb_ud.iod[nr].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&rw_udata->md_rw_cb_ud.sg_iov[nr], info_buf, (daos_size_t)H5_DAOS_ENCODED_BLOOM_INFO_SIZE);
+        rw_udata->md_rw_cb_ud.sgl[nr].sg_nr = 1;
+        rw_udata->md_rw_cb_ud.sgl[nr].sg_nr_out = 0;
+        rw_udata->md_rw_cb_ud.sgl[nr].sg_iovs = &rw_udata->md_rw_cb_ud.sg_iov[nr];
+        rw_udata->md_rw_cb_ud.free_sg_iov[nr] = FALSE;
+        nr++;
+    } /* end if */
+    if(bits) {
+        rw_udata->recx.rx_idx = 0;
+        rw_udata->recx.rx_nr = map->bloom.nbits / 8;
+        daos_const_iov_set((d_const_iov_t *)&rw_udata->md_rw_cb_ud.iod[nr].iod_name, H5_daos_bloom_key_g, H5_daos_bloom_key_size_g);
+        rw_udata->md_rw_cb_ud.iod[nr].iod_nr = 1u;
+        rw_udata->md_rw_cb_ud.iod[nr].iod_size = 1;
+        rw_udata->md_rw_cb_ud.iod[nr].iod_recxs = &rw_udata->recx;
+        rw_udata->md_rw_cb_ud.iod[nr].iod_type = DAOS_IOD_ARRAY;
+
+        daos_iov_set(&rw_udata->md_rw_cb_ud.sg_iov[nr], bits, (daos_size_t)(map->bloom.nbits / 8));
+        rw_udata->md_rw_cb_ud.sgl[nr].sg_nr = 1;
+        rw_udata->md_rw_cb_ud.sgl[nr].sg_nr_out = 0;
+        rw_udata->md_rw_cb_ud.sgl[nr].sg_iovs = &rw_udata->md_rw_cb_ud.sg_iov[nr];
+        rw_udata->md_rw_cb_ud.free_sg_iov[nr] = FALSE;
+        nr++;
+    } /* end if */
+    rw_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set nr */
+    rw_udata->md_rw_cb_ud.nr = nr;
+
+    /* Set task name */
+    rw_udata->md_rw_cb_ud.task_name = opc == DAOS_OPC_OBJ_FETCH
+            ? "map bloom filter read" : "map bloom filter write";
+
+    /* Create task to read or write the filter */
+    if(H5_daos_create_daos_task(opc, 0, NULL, H5_daos_md_rw_prep_cb,
+            H5_daos_md_update_comp_cb, rw_udata, &first_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task for map bloom filter I/O");
+
+    /* Save the task to be scheduled later and give it a reference to req and
+     * the map */
+    dep_task = first_task;
+    int_req->rc++;
+    map->obj.item.rc++;
+    rw_udata = NULL;
+
+done:
+    if(int_req) {
+        /* Create task to finalize H5 operation */
+        if(H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                NULL, NULL, int_req, &int_req->finalize_task) < 0)
             D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
         /* Schedule finalize task */
         else if(0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
@@ -2454,209 +5348,222 @@ done:
         if(ret_value < 0)
             int_req->status = -H5_DAOS_SETUP_ERROR;
 
-        /* Add the request to the map's request queue.  This will add the
-         * dependency on the map open if necessary. */
-        if(H5_daos_req_enqueue(int_req, first_task, &map->obj.item, H5_DAOS_OP_TYPE_WRITE,
-                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+        /* Add the request to the map's request queue */
+        if(H5_daos_req_enqueue(int_req, first_task, &map->obj.item,
+                opc == DAOS_OPC_OBJ_FETCH ? H5_DAOS_OP_TYPE_READ : H5_DAOS_OP_TYPE_WRITE,
+                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
             D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't add request to request queue");
 
-        /* Check for external async */
-        if(req) {
-            /* Return int_req as req */
-            *req = int_req;
-
-            /* Kick task engine */
-            if(H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        } /* end if */
-        else {
-            /* Block until operation completes */
-            if(H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        /* Block until operation completes */
+        if(H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't progress scheduler");
 
-            /* Check for failure */
-            if(int_req->status < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CANTOPERATE, FAIL, "map key-value write operation failed in task \"%s\": %s",
-                        int_req->failed_task, H5_daos_err_to_string(int_req->status));
+        /* Return the status of the operation */
+        *status = int_req->status;
 
-            /* Close internal request */
-            if(H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* end else */
+        /* Close internal request */
+        if(H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, FAIL, "can't free request");
     } /* end if */
 
     /* Cleanup on failure */
-    if(ret_value < 0) {
-        if(write_udata) {
-            if(write_udata->tconv_buf && (write_udata->tconv_buf != value)) {
-                DV_free(write_udata->tconv_buf);
-                write_udata->tconv_buf = NULL;
-            }
-            if(write_udata->bkg_buf && (write_udata->bkg_buf != value)) {
-                DV_free(write_udata->bkg_buf);
-                write_udata->bkg_buf = NULL;
-            }
-            write_udata->key_buf_alloc = DV_free(write_udata->key_buf_alloc);
-        }
-        write_udata = DV_free(write_udata);
-    } /* end if */
+    if(ret_value < 0)
+        rw_udata = DV_free(rw_udata);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_map_put() */
+} /* end H5_daos_map_bloom_rw() */
+
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_put_fill_comp_cb
+ * Function:    H5_daos_map_bloom_rebuild_cb
  *
- * Purpose:     Complete callback for asynchronous daos_obj_fetch to fill
- *              a type conversion background buffer when performing a map
- *              "put" operation that requires type conversion. Currently
- *              checks for a failed task and then performs type conversion.
+ * Purpose:     Map iteration callback for rebuilding a map's bloom
+ *              filter.  Converts the key back to its file representation
+ *              and sets its bits.
  *
  * Return:      Success:        0
- *              Failure:        Error code
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_map_put_fill_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_map_bloom_rebuild_cb(hid_t H5VL_DAOS_UNUSED map_id, const void *key,
+    void *_udata)
 {
-    H5_daos_map_rw_ud_t *udata;
-    int ret_value = 0;
+    H5_daos_map_bloom_rebuild_ud_t *udata = (H5_daos_map_bloom_rebuild_ud_t *)_udata;
+    H5_daos_map_t *map;
+    const void *key_buf = NULL;
+    void *key_buf_alloc = NULL;
+    size_t key_size = 0;
+    uint64_t h1, h2;
+    uint64_t bit;
+    uint64_t i;
+    herr_t ret_value = SUCCEED;
 
-    assert(H5_daos_task_list_g);
+    assert(udata);
+    map = udata->map;
+    assert(map);
 
-    /* Get private data */
-    if(NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+    /* Convert key (if necessary) */
+    if(H5_daos_map_key_conv(map->key_type_id, map->key_file_type_id, key, &key_buf,
+            &key_size, &key_buf_alloc, udata->dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
 
-    assert(udata->md_rw_cb_ud.req);
-    assert(udata->md_rw_cb_ud.req->file);
+    /* Set the key's bits */
+    H5_daos_map_bloom_hash(key_buf, key_size, &h1, &h2);
+    for(i = 0; i < map->bloom.nhashes; i++) {
+        bit = (h1 + i * h2) % map->bloom.nbits;
+        udata->bits[bit / 8] |= (uint8_t)(1 << (bit % 8));
+    } /* end for */
 
-    /* Handle errors in fetch task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if(task->dt_result < -H5_DAOS_PRE_ERROR
-            && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->md_rw_cb_ud.req->status = task->dt_result;
-        udata->md_rw_cb_ud.req->failed_task = "map put background buffer fill task";
-    } /* end if */
-    else if(task->dt_result == 0) {
-        H5_daos_map_t *map = (H5_daos_map_t *)udata->md_rw_cb_ud.obj;
+done:
+    key_buf_alloc = H5_daos_bufpool_free(key_buf_alloc);
 
-        assert(map);
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_bloom_rebuild_cb() */
 
-        /* Reset iod_size; if the key was not created then it could have
-         * been overwritten by daos_obj_fetch */
-        udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)udata->val_file_type_size;
 
-        /* Copy data to type conversion buffer */
-        (void)memcpy(udata->tconv_buf, udata->value_buf, (size_t)udata->val_mem_type_size);
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_get_bloom_filter_fpr
+ *
+ * Purpose:     Estimates the false positive rate of the bloom filter of
+ *              the map map_id, that is the chance that H5Mexists() has to
+ *              read a key that is not in the map, from the fraction of
+ *              the filter's bits that are set.  Uses this process's copy
+ *              of the filter.  The map must have a bloom filter.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_get_bloom_filter_fpr(hid_t map_id, double *fpr)
+{
+    H5_daos_map_t *map = NULL;
+    uint64_t nset = 0;
+    uint64_t i;
+    double fill;
+    herr_t ret_value = SUCCEED;
 
-        /* Perform type conversion */
-        if(H5Tconvert(udata->val_mem_type_id, map->val_file_type_id, 1,
-                udata->tconv_buf, udata->bkg_buf, udata->md_rw_cb_ud.req->dxpl_id) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+    H5_daos_inc_api_cnt();
 
-        /* Set sgl to write from tconv_buf */
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], udata->tconv_buf, (daos_size_t)udata->val_file_type_size);
-    } /* end else */
+    if(!fpr)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "fpr is NULL");
 
-done:
-    /* Return task to task list */
-    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
-    /* Clean up */
-    if(udata) {
-        /* Close map */
-        if(udata->md_rw_cb_ud.obj &&
-                H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+    if(NULL == (map = H5_daos_map_iterate_get_map(map_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't get map");
 
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->md_rw_cb_ud.req->status = ret_value;
-            udata->md_rw_cb_ud.req->failed_task = "map put background buffer fill completion callback";
-        } /* end if */
+    if(map->bloom.nbits == 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "map does not have a bloom filter");
+    assert(map->bloom.bits);
 
-        /* Release our reference to req */
-        if(H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
-            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-    } /* end if */
-    else
-        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+    /* Count set bits */
+    for(i = 0; i < map->bloom.nbits / 8; i++) {
+        uint8_t byte = map->bloom.bits[i];
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_map_put_fill_comp_cb() */
+        while(byte) {
+            byte &= (uint8_t)(byte - 1);
+            nset++;
+        } /* end while */
+    } /* end for */
+
+    /* A key that is not in the map passes the filter if all of its bits are
+     * set */
+    fill = (double)nset / (double)map->bloom.nbits;
+    *fpr = 1.0;
+    for(i = 0; i < map->bloom.nhashes; i++)
+        *fpr *= fill;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_map_get_bloom_filter_fpr() */
 
-
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_map_put_comp_cb
+ * Function:    H5daos_map_refresh_bloom_filter
  *
- * Purpose:     Complete callback for asynchronous daos_obj_update to add
- *              a new key-value pair to a map object or to update an
- *              existing key-value pair in a map object. Currently checks
- *              for a failed task then frees private data.
+ * Purpose:     Writes the bits of keys put through the map handle map_id
+ *              to the map's stored bloom filter, and updates the handle's
+ *              copy of the filter with keys written by other handles.
+ *              H5Mexists() only uses the handle's copy, so keys put
+ *              through another handle (possibly on another process) are
+ *              only found once that handle is closed or refreshed and
+ *              this handle is refreshed.  If nothing was put through the
+ *              handle and no other handle wrote the filter, this only
+ *              reads the filter info.  The map must have a bloom filter.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_map_put_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+herr_t
+H5daos_map_refresh_bloom_filter(hid_t map_id, hid_t dxpl_id)
 {
-    H5_daos_map_rw_ud_t *udata;
-    int ret_value = 0;
+    H5_daos_map_t *map = NULL;
+    herr_t ret_value = SUCCEED;
 
-    assert(H5_daos_task_list_g);
+    H5_daos_inc_api_cnt();
 
-    /* Get private data */
-    if(NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for I/O task");
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
-    assert(udata->md_rw_cb_ud.req);
-    assert(udata->md_rw_cb_ud.req->file);
+    if(NULL == (map = H5_daos_map_iterate_get_map(map_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't get map");
 
-    /* Close map */
-    if(udata->md_rw_cb_ud.obj &&
-            H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+    if(map->bloom.nbits == 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "map does not have a bloom filter");
+    if(map->bloom.pending && !(map->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
 
-    /* Return task to task list */
-    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    if(H5_daos_map_bloom_sync(map, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't refresh map bloom filter");
 
-    /* Handle errors in update task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if(task->dt_result < -H5_DAOS_PRE_ERROR
-            && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->md_rw_cb_ud.req->status = task->dt_result;
-        udata->md_rw_cb_ud.req->failed_task = "map key-value write";
-    } /* end if */
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_map_refresh_bloom_filter() */
 
-    /* Release our reference to req */
-    if(H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
-        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-    /* Free private data */
-    if(udata->tconv_buf && (udata->tconv_buf != udata->value_buf))
-        DV_free(udata->tconv_buf);
-    if(udata->bkg_buf && (udata->bkg_buf != udata->value_buf))
-        DV_free(udata->bkg_buf);
-    if(udata->key_buf_alloc)
-        DV_free(udata->key_buf_alloc);
-    udata = DV_free(udata);
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_map_rebuild_bloom_filter
+ *
+ * Purpose:     Rebuilds the bloom filter of the map map_id from the keys
+ *              in the map.  Deleting a key does not clear its bits, so
+ *              after many deletes the filter reports more keys as
+ *              possibly present than necessary; a rebuild clears the bits
+ *              of deleted keys.  Reads every key in the map.  The map
+ *              must have a bloom filter and the file must be open for
+ *              writing.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_map_rebuild_bloom_filter(hid_t map_id, hid_t dxpl_id)
+{
+    H5_daos_map_t *map = NULL;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    if(NULL == (map = H5_daos_map_iterate_get_map(map_id)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTOPENOBJ, FAIL, "can't get map");
+
+    if(map->bloom.nbits == 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_BADVALUE, FAIL, "map does not have a bloom filter");
+    if(!(map->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    if(H5_daos_map_bloom_rebuild(map, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't rebuild map bloom filter");
 
 done:
-    D_FUNC_LEAVE;
-} /* end H5_daos_map_put_comp_cb() */
+    D_FUNC_LEAVE_API;
+} /* end H5daos_map_rebuild_bloom_filter() */
+
 
-
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_map_exists
  *
@@ -2715,6 +5622,15 @@ H5_daos_map_exists(void *_map, hid_t key_mem_type_id, const void *key,
             &exists_udata->key_size, &exists_udata->key_buf_alloc, dxpl_id) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't convert key");
 
+    /* Check our copy of the bloom filter.  If one of the key's bits is not
+     * set the key is not in the map and there is no need to read it.  Keys
+     * put through other handles are only in our copy once those handles
+     * wrote them back and our copy was refreshed (see
+     * H5daos_map_refresh_bloom_filter). */
+    if(map->bloom.bits && !H5_daos_map_bloom_test(&map->bloom, exists_udata->key_buf,
+            exists_udata->key_size))
+        exists_udata->bloom_absent = TRUE;
+
     /* Set up dkey */
     daos_const_iov_set((d_const_iov_t *)&exists_udata->md_rw_cb_ud.dkey, exists_udata->key_buf, (daos_size_t)exists_udata->key_size);
     exists_udata->md_rw_cb_ud.free_dkey = FALSE;
@@ -2735,14 +5651,18 @@ H5_daos_map_exists(void *_map, hid_t key_mem_type_id, const void *key,
     exists_udata->md_rw_cb_ud.task_name = "map key existence check";
 
     /* Create task to read map metadata size */
-    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_map_exists_prep_cb,
-            H5_daos_map_exists_comp_cb, exists_udata, &map_exists_task) < 0)
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+            H5_daos_map_exists_prep_cb, H5_daos_map_exists_comp_cb, exists_udata, &map_exists_task) < 0)
         D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map metadata size");
 
-    /* Save map metadata size read task to be scheduled later and give
-     * it a reference to req and the map object */
-    assert(!first_task);
-    first_task = map_exists_task;
+    /* Schedule map metadata size read task (or save it to be scheduled
+     * later) and give it a reference to req and the map object */
+    if(first_task) {
+        if(0 != (ret = tse_task_schedule(map_exists_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to read map metadata size: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        first_task = map_exists_task;
     dep_task = map_exists_task;
     int_req->rc++;
     map->obj.item.rc++;
@@ -2802,7 +5722,7 @@ done:
     /* Cleanup on failure */
     if(ret_value < 0) {
         if(exists_udata)
-            exists_udata->key_buf_alloc = DV_free(exists_udata->key_buf_alloc);
+            exists_udata->key_buf_alloc = H5_daos_bufpool_free(exists_udata->key_buf_alloc);
         exists_udata = DV_free(exists_udata);
     } /* end if */
 
@@ -2840,6 +5760,13 @@ H5_daos_map_exists_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
     assert(udata->md_rw_cb_ud.obj);
     assert(udata->md_rw_cb_ud.req->file);
 
+    /* No need to read the key if the bloom filter showed it is not in the
+     * map */
+    if(udata->bloom_absent) {
+        *udata->exists_ret = FALSE;
+        D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+    } /* end if */
+
     /* Set fetch task arguments */
     if(NULL == (rw_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for metadata I/O task");
@@ -2926,7 +5853,7 @@ done:
 
         /* Free private data */
         if(udata->key_buf_alloc)
-            DV_free(udata->key_buf_alloc);
+            H5_daos_bufpool_free(udata->key_buf_alloc);
         udata = DV_free(udata);
     } /* end if */
     else
@@ -2984,6 +5911,28 @@ H5_daos_map_get(void *_map, H5VL_map_get_t get_type,
                 if(H5_daos_set_oclass_from_oid(*plist_id, map->obj.oid) < 0)
                     D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object class property");
 
+                /* Set key count property on mcpl if the map counts its keys */
+                if(map->track_key_count && H5_daos_set_map_key_count_prop(*plist_id, TRUE) < 0)
+                    D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map key count property");
+
+                /* Set ordered keys property on mcpl if the map orders its keys */
+                if(map->ordered_keys && H5_daos_set_map_ordered_keys_prop(*plist_id, TRUE) < 0)
+                    D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map ordered keys property");
+
+                /* Set bloom filter property on mcpl if the map has a bloom
+                 * filter and the mcpl does not already have it (it is not
+                 * encoded with the mcpl).  The number of keys is derived from
+                 * the filter size. */
+                if(map->bloom.nbits > 0) {
+                    hsize_t bloom_expected_keys = 0;
+
+                    if(H5_daos_get_map_bloom_filter_prop(*plist_id, &bloom_expected_keys) < 0)
+                        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get map bloom filter property");
+                    if(bloom_expected_keys == 0 && H5_daos_set_map_bloom_filter_prop(*plist_id,
+                            (hsize_t)(map->bloom.nbits / H5_DAOS_MAP_BLOOM_BITS_PER_KEY)) < 0)
+                        D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set map bloom filter property");
+                } /* end if */
+
                 break;
             } /* end block */
         case H5VL_MAP_GET_MAPL:
@@ -3060,6 +6009,13 @@ H5_daos_map_get(void *_map, H5VL_map_get_t get_type,
                 /* Initialize counter */
                 *count = 0;
 
+                /* If the map counts its keys just read the count */
+                if(map->track_key_count) {
+                    if(H5_daos_map_read_key_count(map, count, int_req, &first_task, &dep_task) < 0)
+                        D_GOTO_ERROR(H5E_MAP, H5E_CANTGET, FAIL, "can't create task to read map key count");
+                    break;
+                } /* end if */
+
                 /* Register ID for map */
                 if((map_id = H5VLwrap_register(map, H5I_MAP)) < 0)
                     D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
@@ -3141,6 +6097,174 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_map_get() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_read_key_count
+ *
+ * Purpose:     Creates a task to read the key count of a map that tracks
+ *              it into *count, as part of the operation req.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_map_read_key_count(H5_daos_map_t *map, hsize_t *count,
+    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_map_read_key_count_ud_t *fetch_udata = NULL;
+    tse_task_t *fetch_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(map);
+    assert(map->track_key_count);
+    assert(count);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct for fetch task */
+    if(NULL == (fetch_udata = (H5_daos_map_read_key_count_ud_t *)DV_calloc(sizeof(H5_daos_map_read_key_count_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for map key count read task arguments");
+    fetch_udata->md_rw_cb_ud.req = req;
+    fetch_udata->md_rw_cb_ud.obj = &map->obj;
+    fetch_udata->count = count;
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g, H5_daos_int_md_key_size_g);
+    fetch_udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Set up iod */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_nkeys_key_g, H5_daos_nkeys_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[0].iod_nr = 1u;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_size = (daos_size_t)H5_DAOS_ENCODED_NUM_KEYS_SIZE;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+    fetch_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set up sgl */
+    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0], fetch_udata->nkeys_buf, (daos_size_t)H5_DAOS_ENCODED_NUM_KEYS_SIZE);
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr = 1;
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_iovs = &fetch_udata->md_rw_cb_ud.sg_iov[0];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[0] = FALSE;
+
+    /* Set nr */
+    fetch_udata->md_rw_cb_ud.nr = 1u;
+
+    /* Set task name */
+    fetch_udata->md_rw_cb_ud.task_name = "map key count read";
+
+    /* Create task to read key count */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            H5_daos_md_rw_prep_cb, H5_daos_map_read_key_count_comp_cb, fetch_udata, &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to read map key count");
+
+    /* Schedule map key count read task (or save it to be scheduled later)
+     * and give it a reference to req and the map object */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't schedule task to read map key count: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = fetch_task;
+    *dep_task = fetch_task;
+    req->rc++;
+    map->obj.item.rc++;
+
+    fetch_udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if(ret_value < 0)
+        fetch_udata = DV_free(fetch_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_read_key_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_read_key_count_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch to read
+ *              the key count of a map.  Decodes the count into the
+ *              caller's buffer then frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_read_key_count_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_map_read_key_count_ud_t *udata;
+    uint64_t nkeys = 0;
+    uint8_t *p;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map key count read task");
+
+    assert(udata->md_rw_cb_ud.req);
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+    } /* end if */
+    else if(task->dt_result == 0) {
+        /* Decode key count.  If the count akey was not found the count is
+         * 0. */
+        if(udata->md_rw_cb_ud.iod[0].iod_size != 0) {
+            p = udata->nkeys_buf;
+            UINT64DECODE(p, nkeys)
+        } /* end if */
+
+        /* Set output */
+        *udata->count = (hsize_t)nkeys;
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Clean up */
+    if(udata) {
+        /* Close map */
+        if(udata->md_rw_cb_ud.obj &&
+                H5_daos_map_close_real((H5_daos_map_t *)udata->md_rw_cb_ud.obj) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close map");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "map key count read completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value >= 0 || ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_read_key_count_comp_cb() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_map_get_count_cb
@@ -3454,6 +6578,7 @@ H5_daos_map_iterate(H5_daos_map_t *map, H5_daos_iter_data_t *iter_data,
 
     if(!iter_data->u.map_iter_data.u.map_iter_op)
         D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "operator is NULL");
+    assert(!(iter_data->u.map_iter_data.key_range && iter_data->u.map_iter_data.prefetch_vals));
 
     /* Iteration restart not supported */
     if(iter_data->idx_p && (*iter_data->idx_p != 0))
@@ -3545,8 +6670,23 @@ H5_daos_map_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             req->status = task->dt_result;
             req->failed_task = "map iterate key list completion callback";
         } /* end if */
+        else if(task->dt_result == 0 && udata->iter_data->u.map_iter_data.prefetch_vals) {
+            /* Fetch the values for this batch of dkeys and create the
+             * iteration ops */
+            if(0 != (ret = H5_daos_map_iterate_kv_batch(udata, &first_task, &dep_task)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't set up iteration ops for batch of map keys");
+
+            /* Continue iteration if we're not done */
+            if(!daos_anchor_is_eof(&udata->anchor) && (req->status == -H5_DAOS_INCOMPLETE)) {
+                if(0 != (ret = H5_daos_list_key_start(udata, DAOS_OPC_OBJ_LIST_DKEY,
+                        H5_daos_map_iterate_list_comp_cb, &first_task, &dep_task)))
+                    D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't start iteration");
+                udata = NULL;
+            } /* end if */
+        } /* end if */
         else if(task->dt_result == 0) {
             H5_daos_map_t *map = (H5_daos_map_t *)udata->target_obj;
+            hbool_t past_range = FALSE;
             uint32_t i;
             char *p = udata->sg_iov.iov_buf;
 
@@ -3554,6 +6694,17 @@ H5_daos_map_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
             /* Loop over returned dkeys */
             for(i = 0; i < udata->nr; i++) {
+                /* Skip keys outside the key range (if any).  If the keys are
+                 * listed in order stop once past the end of the range. */
+                if(udata->iter_data->u.map_iter_data.key_range
+                        && !H5_daos_map_key_in_range(udata->iter_data, p,
+                        (size_t)udata->kds[i].kd_key_len, &past_range)) {
+                    if(past_range)
+                        break;
+                    p += udata->kds[i].kd_key_len;
+                    continue;
+                } /* end if */
+
                 /* Allocate iter op udata */
                 if(NULL == (iter_op_udata = (H5_daos_map_iter_op_ud_t *)DV_calloc(sizeof(H5_daos_map_iter_op_ud_t))))
                     D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate iteration op user data");
@@ -3634,7 +6785,7 @@ H5_daos_map_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             } /* end for */
 
             /* Continue iteration if we're not done */
-            if(!daos_anchor_is_eof(&udata->anchor) && (req->status == -H5_DAOS_INCOMPLETE)) {
+            if(!past_range && !daos_anchor_is_eof(&udata->anchor) && (req->status == -H5_DAOS_INCOMPLETE)) {
                 if(0 != (ret = H5_daos_list_key_start(udata, DAOS_OPC_OBJ_LIST_DKEY,
                         H5_daos_map_iterate_list_comp_cb, &first_task, &dep_task)))
                     D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't start iteration");
@@ -3671,7 +6822,7 @@ done:
     if(ret_value < 0) {
         if(iter_op_udata) {
             if(iter_op_udata->key_buf_alloc)
-                iter_op_udata->key_buf_alloc = DV_free(iter_op_udata->key_buf_alloc);
+                iter_op_udata->key_buf_alloc = H5_daos_bufpool_free(iter_op_udata->key_buf_alloc);
             iter_op_udata = DV_free(iter_op_udata);
         } /* end if */
 
@@ -3692,6 +6843,368 @@ done:
 } /* end H5_daos_map_iterate_list_key_comp_cb() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_key_in_range
+ *
+ * Purpose:     Checks if the dkey key, listed from a map with ordered
+ *              keys, is a key within the key range of iter_data.  Keys
+ *              are stored as big endian unsigned 64 bit integers, other
+ *              dkeys (which hold other metadata) are never in range.  If
+ *              the keys are listed in order and key is past the end of
+ *              the range, *past_range is set to TRUE.
+ *
+ * Return:      TRUE if key is in range, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_map_key_in_range(const H5_daos_iter_data_t *iter_data,
+    const char *key, size_t key_len, hbool_t *past_range)
+{
+    const uint8_t *p = (const uint8_t *)key;
+    uint64_t key_val = 0;
+    size_t i;
+
+    assert(iter_data);
+    assert(iter_data->u.map_iter_data.key_range);
+    assert(key);
+    assert(past_range);
+
+    *past_range = FALSE;
+
+    if(key_len != sizeof(uint64_t))
+        return FALSE;
+
+    /* Decode big endian key */
+    for(i = 0; i < sizeof(uint64_t); i++)
+        key_val = (key_val << 8) | (uint64_t)p[i];
+
+    if(key_val < iter_data->u.map_iter_data.key_lo)
+        return FALSE;
+    if(key_val > iter_data->u.map_iter_data.key_hi) {
+        *past_range = iter_data->u.map_iter_data.key_range_sorted;
+        return FALSE;
+    } /* end if */
+
+    return TRUE;
+} /* end H5_daos_map_key_in_range() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iterate_kv_batch
+ *
+ * Purpose:     Sets up iteration with prefetched values over the batch of
+ *              dkeys just listed into udata.  Creates a task to fetch the
+ *              value of each dkey, all of which run concurrently, a task
+ *              to convert the fetched values to the memory type together,
+ *              then an iteration op for each key, run in order.  Keys
+ *              that share their dkey with other metadata and have no map
+ *              record are skipped by their op.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_iterate_kv_batch(H5_daos_iter_ud_t *udata, tse_task_t **first_task,
+    tse_task_t **dep_task)
+{
+    H5_daos_map_t *map = (H5_daos_map_t *)udata->target_obj;
+    H5_daos_req_t *req = udata->iter_data->req;
+    H5_daos_map_iter_vals_t *vals = NULL;
+    H5_daos_map_iter_op_ud_t *iter_op_udata = NULL;
+    tse_task_t **fetch_tasks = NULL;
+    tse_task_t *convert_task = NULL;
+    tse_task_t *end_task = NULL;
+    hbool_t fill_bkg = FALSE;
+    hbool_t vals_owned = FALSE;
+    char *p = udata->sg_iov.iov_buf;
+    size_t nfetch = 0;
+    size_t i;
+    int ret;
+    int ret_value = 0;
+
+    assert(map);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    if(udata->nr == 0)
+        D_GOTO_DONE(0);
+
+    /* Allocate batch struct */
+    if(NULL == (vals = (H5_daos_map_iter_vals_t *)DV_calloc(sizeof(H5_daos_map_iter_vals_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate map iteration value batch");
+    vals->req = req;
+    vals->map = map;
+    vals->val_mem_type_id = udata->iter_data->u.map_iter_data.val_mem_type_id;
+    vals->nr = (size_t)udata->nr;
+    if(NULL == (vals->op_udata = (H5_daos_map_iter_op_ud_t **)DV_calloc(vals->nr * sizeof(H5_daos_map_iter_op_ud_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate array of map iteration op user data");
+    if(NULL == (fetch_tasks = (tse_task_t **)DV_malloc(vals->nr * sizeof(tse_task_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate array of value fetch tasks");
+
+    /* Set up value buffer for the whole batch */
+    if((vals->need_tconv = H5_daos_need_tconv(map->val_file_type_id, vals->val_mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTCOMPARE, -H5_DAOS_H5_TCONV_ERROR, "can't check if type conversion is needed");
+    if(vals->need_tconv) {
+        if(H5_daos_tconv_init(map->val_file_type_id, &vals->val_file_type_size, vals->val_mem_type_id,
+                &vals->val_mem_type_size, vals->nr, FALSE, FALSE, &vals->buf, &vals->bkg_buf,
+                NULL, &fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_H5_TCONV_ERROR, "can't initialize type conversion");
+    } /* end if */
+    else {
+        vals->val_file_type_size = map->val_file_type_size;
+        vals->val_mem_type_size = map->val_file_type_size;
+        if(NULL == (vals->buf = H5_daos_bufpool_malloc(vals->nr * vals->val_file_type_size, FALSE)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate map iteration value buffer");
+    } /* end else */
+
+    /* Create a task to fetch each value */
+    for(i = 0; i < vals->nr; i++) {
+        daos_obj_rw_t *rw_args;
+
+        /* Allocate iter op udata */
+        if(NULL == (iter_op_udata = (H5_daos_map_iter_op_ud_t *)DV_calloc(sizeof(H5_daos_map_iter_op_ud_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate iteration op user data");
+        iter_op_udata->generic_ud.req = req;
+        iter_op_udata->generic_ud.task_name = "map iteration value fetch";
+        iter_op_udata->iter_ud = udata;
+        iter_op_udata->key_file_type_id = map->key_file_type_id;
+        iter_op_udata->key_mem_type_id = udata->iter_data->u.map_iter_data.key_mem_type_id;
+        iter_op_udata->key_buf = p;
+        iter_op_udata->key_len = udata->kds[i].kd_key_len;
+        vals->op_udata[i] = iter_op_udata;
+        iter_op_udata = NULL;
+
+        /* Set up dkey */
+        daos_iov_set(&vals->op_udata[i]->dkey, (void *)p, udata->kds[i].kd_key_len);
+
+        /* Set up iod.  If the dkey has no map record (it holds other
+         * metadata) iod_size will be set to 0 by the fetch. */
+        daos_const_iov_set((d_const_iov_t *)&vals->op_udata[i]->iod.iod_name,
+                H5_daos_map_key_g, H5_daos_map_key_size_g);
+        vals->op_udata[i]->iod.iod_nr = 1u;
+        vals->op_udata[i]->iod.iod_type = DAOS_IOD_SINGLE;
+        vals->op_udata[i]->iod.iod_size = (daos_size_t)vals->val_file_type_size;
+
+        /* Set up sgl to read into this key's slot in the batch buffer */
+        daos_iov_set(&vals->op_udata[i]->sg_iov,
+                (uint8_t *)vals->buf + (i * vals->val_file_type_size),
+                (daos_size_t)vals->val_file_type_size);
+        vals->op_udata[i]->sgl.sg_nr = 1;
+        vals->op_udata[i]->sgl.sg_nr_out = 0;
+        vals->op_udata[i]->sgl.sg_iovs = &vals->op_udata[i]->sg_iov;
+
+        /* Create task to fetch value */
+        if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                H5_daos_generic_prep_cb, H5_daos_map_iterate_query_comp_cb, vals->op_udata[i],
+                &fetch_tasks[nfetch]) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to fetch map value");
+        nfetch++;
+
+        /* Set fetch task arguments */
+        if(NULL == (rw_args = daos_task_get_args(fetch_tasks[nfetch - 1])))
+            D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for map value fetch task");
+        memset(rw_args, 0, sizeof(*rw_args));
+        rw_args->oh = map->obj.obj_oh;
+        rw_args->th = DAOS_TX_NONE;
+        rw_args->flags = 0;
+        rw_args->dkey = &vals->op_udata[i]->dkey;
+        rw_args->nr = 1u;
+        rw_args->iods = &vals->op_udata[i]->iod;
+        rw_args->sgls = &vals->op_udata[i]->sgl;
+
+        /* Advance to next dkey */
+        p += udata->kds[i].kd_key_len;
+    } /* end for */
+
+    /* Create task to convert all values once they have been fetched */
+    if(H5_daos_create_task(H5_daos_map_iter_vals_convert_task, (unsigned)nfetch, fetch_tasks,
+            NULL, NULL, vals, &convert_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to convert map values");
+
+    /* Schedule fetch tasks (the first may be saved to be scheduled later)
+     * and the conversion task.  From here on the tasks own their udata. */
+    for(i = 0; i < nfetch; i++) {
+        if(*first_task) {
+            if(0 != (ret = tse_task_schedule(fetch_tasks[i], false)))
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task to fetch map value: %s", H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            *first_task = fetch_tasks[i];
+    } /* end for */
+    vals_owned = TRUE;
+    if(0 != (ret = tse_task_schedule(convert_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task to convert map values: %s", H5_daos_err_to_string(ret));
+    *dep_task = convert_task;
+
+    /* Create the iteration op for each key, each depending on the last */
+    for(i = 0; i < vals->nr; i++) {
+        if(H5_daos_create_task(H5_daos_map_iterate_op_task, 1, dep_task,
+                NULL, NULL, vals->op_udata[i], &vals->op_udata[i]->op_task) < 0)
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task for iteration op");
+        if(0 != (ret = tse_task_schedule(vals->op_udata[i]->op_task, false)))
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task for iteration op: %s", H5_daos_err_to_string(ret));
+        *dep_task = vals->op_udata[i]->op_task;
+    } /* end for */
+
+    /* Create task to free the batch after the last op */
+    if(H5_daos_create_task(H5_daos_map_iter_vals_end_task, 1, dep_task,
+            NULL, NULL, vals, &end_task) < 0)
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to free map value batch");
+    if(0 != (ret = tse_task_schedule(end_task, false)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, ret, "can't schedule task to free map value batch: %s", H5_daos_err_to_string(ret));
+    *dep_task = end_task;
+    vals = NULL;
+
+done:
+    /* Clean up on error.  If the fetch tasks were not scheduled nothing
+     * else references vals. */
+    if(ret_value < 0 && vals && !vals_owned) {
+        if(vals->op_udata)
+            for(i = 0; i < vals->nr; i++)
+                DV_free(vals->op_udata[i]);
+        vals->buf = H5_daos_bufpool_free(vals->buf);
+        vals->bkg_buf = H5_daos_bufpool_free(vals->bkg_buf);
+        DV_free(vals->op_udata);
+        vals = DV_free(vals);
+    } /* end if */
+    DV_free(fetch_tasks);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iterate_kv_batch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iter_vals_convert_task
+ *
+ * Purpose:     Converts the values fetched for a batch of keys during map
+ *              iteration with prefetched values to the memory type, in a
+ *              single conversion, and points each key's op at its value.
+ *              Values of dkeys without a map record are left out of the
+ *              conversion.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_iter_vals_convert_task(tse_task_t *task)
+{
+    H5_daos_map_iter_vals_t *vals;
+    size_t i;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (vals = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map value conversion task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_PROG(vals->req);
+
+    /* Pack the values that were found to the front of the buffer, in key
+     * order */
+    for(i = 0; i < vals->nr; i++)
+        if(vals->op_udata[i]->iod.iod_size != 0) {
+            if(vals->nconv != i)
+                (void)memmove((uint8_t *)vals->buf + (vals->nconv * vals->val_file_type_size),
+                        (uint8_t *)vals->buf + (i * vals->val_file_type_size),
+                        vals->val_file_type_size);
+            vals->op_udata[i]->value = (uint8_t *)vals->buf + (vals->nconv * vals->val_mem_type_size);
+            vals->nconv++;
+        } /* end if */
+
+    /* Convert all values at once */
+    if(vals->need_tconv && vals->nconv > 0)
+        if(H5_daos_tconv_convert_from_file(vals->map->obj.item.file, vals->map->val_file_type_id,
+                vals->val_mem_type_id, vals->nconv, vals->buf, vals->bkg_buf, vals->req->dxpl_id) < 0) {
+            vals->nconv = 0;
+            D_GOTO_ERROR(H5E_MAP, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR, "can't perform type conversion");
+        } /* end if */
+
+done:
+    /* Handle errors in this function */
+    if(ret_value < -H5_DAOS_SHORT_CIRCUIT && vals && vals->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        vals->req->status = ret_value;
+        vals->req->failed_task = "map iteration value conversion";
+    } /* end if */
+
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iter_vals_convert_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_map_iter_vals_end_task
+ *
+ * Purpose:     Frees the values fetched for a batch of keys during map
+ *              iteration with prefetched values, including any variable
+ *              length data allocated by the conversion, after the
+ *              operator has been called on every key in the batch.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_map_iter_vals_end_task(tse_task_t *task)
+{
+    H5_daos_map_iter_vals_t *vals;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (vals = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for map value batch end task");
+
+    /* Reclaim variable length data in converted values */
+    if(vals->need_tconv && vals->nconv > 0) {
+        hsize_t dim = (hsize_t)vals->nconv;
+        hid_t space_id;
+
+        if((space_id = H5Screate_simple(1, &dim, NULL)) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, -H5_DAOS_H5_CREATE_ERROR, "can't create dataspace");
+        else {
+            if(H5Treclaim(vals->val_mem_type_id, space_id, vals->req->dxpl_id, vals->buf) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CANTGC, -H5_DAOS_FREE_ERROR, "can't reclaim memory from map values");
+            if(H5Sclose(space_id) < 0)
+                D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataspace");
+        } /* end else */
+    } /* end if */
+
+    /* Handle errors in this function */
+    if(ret_value < -H5_DAOS_SHORT_CIRCUIT && vals->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        vals->req->status = ret_value;
+        vals->req->failed_task = "map iteration value batch end task";
+    } /* end if */
+
+    /* Free batch.  The op udata was freed by the ops. */
+    H5_daos_bufpool_free(vals->buf);
+    H5_daos_bufpool_free(vals->bkg_buf);
+    DV_free(vals->op_udata);
+    DV_free(vals);
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_MAP, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_map_iter_vals_end_task() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_map_iterate_query_comp_cb
  *
@@ -3776,7 +7289,8 @@ H5_daos_map_iterate_op_task(tse_task_t *task)
 
     /* Check if this key's dkey was a dkey shared with other metadata.
      * If it was, skip processing of this key. */
-    if(udata->shared_dkey && udata->iod.iod_size == 0)
+    if((udata->shared_dkey || udata->iter_ud->iter_data->u.map_iter_data.prefetch_vals)
+            && udata->iod.iod_size == 0)
         D_GOTO_DONE(0);
 
     /* Add null terminator temporarily.  Only necessary for VL strings
@@ -3801,6 +7315,12 @@ H5_daos_map_iterate_op_task(tse_task_t *task)
                 &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_MAP, H5E_BADITER, -H5_DAOS_CALLBACK_ERROR, "operator function returned failure");
     } /* end if */
+    else if(udata->iter_ud->iter_data->u.map_iter_data.prefetch_vals) {
+        assert(udata->value);
+        udata->iter_ud->iter_data->op_ret = udata->iter_ud->iter_data->u.map_iter_data.u.map_iter_kv_op(
+                udata->iter_ud->iter_data->iter_root_obj, udata->key_buf, udata->value,
+                udata->iter_ud->iter_data->op_data);
+    } /* end if */
     else
         udata->iter_ud->iter_data->op_ret = udata->iter_ud->iter_data->u.map_iter_data.u.map_iter_op(
                 udata->iter_ud->iter_data->iter_root_obj, udata->key_buf, udata->iter_ud->iter_data->op_data);
@@ -3876,7 +7396,7 @@ done:
 
         /* Free private data */
         if(udata->key_buf_alloc)
-            DV_free(udata->key_buf_alloc);
+            H5_daos_bufpool_free(udata->key_buf_alloc);
         udata = DV_free(udata);
     } /* end if */
     else
@@ -3938,7 +7458,7 @@ H5_daos_map_iter_op_end(tse_task_t *task)
 
     /* Free udata */
     if(udata->key_buf_alloc)
-        DV_free(udata->key_buf_alloc);
+        H5_daos_bufpool_free(udata->key_buf_alloc);
     DV_free(udata);
 
 done:
@@ -4026,10 +7546,24 @@ H5_daos_map_delete_key(H5_daos_map_t *map, hid_t key_mem_type_id, const void *ke
             daos_op = DAOS_OPC_OBJ_PUNCH_DKEYS;
         } /* end else */
 
-        if(H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                H5_daos_map_delete_key_prep_cb, H5_daos_map_delete_key_comp_cb, delete_udata,
-                &delete_task) < 0)
-            D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to delete map key");
+        if(map->track_key_count) {
+            /* Delete the key and uncount it in one transaction */
+            if(H5_daos_map_key_count_update(map, &delete_udata->dkey,
+                    delete_udata->shared_dkey ? &delete_udata->akey : NULL, NULL,
+                    req, first_task, dep_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to delete map key");
+
+            /* Create task to free the key buffer once the transaction is
+             * done */
+            if(H5_daos_create_task(H5_daos_metatask_autocomplete, 1, dep_task,
+                    NULL, H5_daos_map_delete_key_comp_cb, delete_udata, &delete_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to finish map key deletion");
+        } /* end if */
+        else
+            if(H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                    H5_daos_map_delete_key_prep_cb, H5_daos_map_delete_key_comp_cb, delete_udata,
+                    &delete_task) < 0)
+                D_GOTO_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't create task to delete map key");
 
         /* Schedule task to delete map key (or save it to be scheduled later)
          * and give it a reference to req.
@@ -4050,7 +7584,7 @@ H5_daos_map_delete_key(H5_daos_map_t *map, hid_t key_mem_type_id, const void *ke
 done:
     if(ret_value < 0) {
         if(delete_udata)
-            delete_udata->key_buf_alloc = DV_free(delete_udata->key_buf_alloc);
+            delete_udata->key_buf_alloc = H5_daos_bufpool_free(delete_udata->key_buf_alloc);
         delete_udata = DV_free(delete_udata);
     } /* end if */
 
@@ -4114,7 +7648,9 @@ done:
  * Purpose:     Complete callback for asynchronous daos_obj_punch_akeys/
  *              daos_obj_punch_dkeys to delete a key-value pair from a map
  *              object. Currently checks for a failed task then frees
- *              private data.
+ *              private data.  For maps that count their keys this is the
+ *              completion callback of a metatask that runs after the
+ *              delete transaction.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -4166,7 +7702,7 @@ done:
 
         /* Free private data */
         if(udata->key_buf_alloc)
-            DV_free(udata->key_buf_alloc);
+            H5_daos_bufpool_free(udata->key_buf_alloc);
         DV_free(udata);
     }
     else
@@ -4224,6 +7760,8 @@ H5_daos_map_close_real(H5_daos_map_t *map)
         if(map->mapl_id != H5I_INVALID_HID && map->mapl_id != H5P_MAP_ACCESS_DEFAULT)
             if(H5Idec_ref(map->mapl_id) < 0)
                 D_DONE_ERROR(H5E_MAP, H5E_CANTDEC, FAIL, "failed to close mapl");
+        map->bloom.bits = DV_free(map->bloom.bits);
+        map->bloom.pending = DV_free(map->bloom.pending);
         map = H5FL_FREE(H5_daos_map_t, map);
     } /* end if */
 
@@ -4246,7 +7784,7 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_map_close(void *_map, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
+H5_daos_map_close(void *_map, hid_t dxpl_id, void **req)
 {
     H5_daos_map_t *map = (H5_daos_map_t *)_map;
     H5_daos_obj_close_task_ud_t *task_ud = NULL;
@@ -4261,6 +7799,15 @@ H5_daos_map_close(void *_map, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
 
     H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
+    /* Write the bloom filter bits of keys put through this handle back to
+     * the stored filter.  Internal closes (nonblocking_close) do not release
+     * the application's handle, so they leave the bits pending.  The map is
+     * closed even if this fails. */
+    if(map->bloom.pending && !map->obj.item.nonblocking_close
+            && (map->obj.item.file->flags & H5F_ACC_RDWR))
+        if(H5_daos_map_bloom_sync(map, dxpl_id) < 0)
+            D_DONE_ERROR(H5E_MAP, H5E_CANTINIT, FAIL, "can't write back map bloom filter");
+
     /* Check if the map's request queue is empty, if so we can close it
      * immediately.  Also close if the pool is empty and has no start task (and
      * hence does not depend on anything).  Also close if it is marked to close
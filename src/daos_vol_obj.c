@@ -18,6 +18,32 @@
 #include "util/daos_vol_err.h"  /* DAOS connector error handling           */
 #include "util/daos_vol_mem.h"  /* DAOS connector memory management        */
 
+/****************/
+/* Local Macros */
+/****************/
+
+/* Size of the akey for a node in a sparse creation order index's hole count
+ * tree: a null byte, 'H', then the encoded node number */
+#define H5_DAOS_CORDER_HOLE_KEY_SIZE (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 2)
+
+/* Maximum number of hole count tree nodes updated by a delete (one per bit
+ * in a creation order value) */
+#define H5_DAOS_CORDER_HOLE_PATH_MAX 64
+
+/* Number of hole count tree levels descended per fetch during a lookup, and
+ * the number of tree nodes fetched for those levels */
+#define H5_DAOS_CORDER_LOOKUP_LEVELS 4
+#define H5_DAOS_CORDER_LOOKUP_NODES ((1 << H5_DAOS_CORDER_LOOKUP_LEVELS) - 1)
+
+/* Number of iods in a lookup: enough for a batch of hole count tree nodes or
+ * a batch of entry akeys probed by a walk */
+#define H5_DAOS_CORDER_LOOKUP_NR MAX(H5_DAOS_CORDER_LOOKUP_NODES, H5_DAOS_CORDER_WALK_BATCH)
+
+/* Converts between a position in a walk's iteration order and the key at
+ * that position (the conversion is its own inverse) */
+#define H5_DAOS_CORDER_WALK_FLIP(walk, val) \
+    ((walk)->iter_order == H5_ITER_DEC ? (walk)->max_corder - 1 - (val) : (val))
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -186,6 +212,51 @@ typedef struct H5_daos_obj_rw_rc_ud_t {
     char *task_name;
 } H5_daos_obj_rw_rc_ud_t;
 
+/* Task user data for finding the creation order value of the entry at an
+ * index in a sparse creation order index */
+typedef struct H5_daos_corder_lookup_ud_t {
+    H5_daos_req_t *req;
+    H5_daos_obj_t *obj;
+    H5_daos_corder_idx_type_t idx_type;
+    const hsize_t *count;
+    H5_iter_order_t iter_order;
+    uint64_t index;
+    uint64_t *key_out;
+    H5_daos_corder_walk_t *walk;
+    hbool_t probing;
+    hbool_t max_corder_fetched;
+    uint64_t max_corder;
+    uint64_t pos;
+    uint64_t step;
+    uint64_t k;
+    uint64_t base;
+    uint64_t unit;
+    unsigned nlevels;
+    daos_key_t dkey;
+    unsigned nr;
+    daos_iod_t iod[H5_DAOS_CORDER_LOOKUP_NR];
+    daos_sg_list_t sgl[H5_DAOS_CORDER_LOOKUP_NR];
+    daos_iov_t sg_iov[H5_DAOS_CORDER_LOOKUP_NR];
+    uint8_t akey_buf[H5_DAOS_CORDER_LOOKUP_NR][H5_DAOS_CORDER_HOLE_KEY_SIZE];
+    uint8_t val_buf[H5_DAOS_CORDER_LOOKUP_NR][H5_DAOS_ENCODED_UINT64_T_SIZE];
+    tse_task_t *lookup_task;
+} H5_daos_corder_lookup_ud_t;
+
+/* Task user data for recording a hole in a sparse creation order index */
+typedef struct H5_daos_corder_remove_ud_t {
+    H5_daos_req_t *req;
+    H5_daos_obj_t *obj;
+    H5_daos_corder_idx_type_t idx_type;
+    const uint64_t *corder;
+    daos_key_t dkey;
+    unsigned nr;
+    daos_iod_t iod[H5_DAOS_CORDER_HOLE_PATH_MAX];
+    daos_sg_list_t sgl[H5_DAOS_CORDER_HOLE_PATH_MAX];
+    daos_iov_t sg_iov[H5_DAOS_CORDER_HOLE_PATH_MAX];
+    uint8_t akey_buf[H5_DAOS_CORDER_HOLE_PATH_MAX][H5_DAOS_CORDER_HOLE_KEY_SIZE];
+    uint8_t val_buf[H5_DAOS_CORDER_HOLE_PATH_MAX][H5_DAOS_ENCODED_UINT64_T_SIZE];
+} H5_daos_corder_remove_ud_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -271,6 +342,25 @@ static int H5_daos_obj_read_rc_prep_cb(tse_task_t *task, void *args);
 static int H5_daos_obj_read_rc_comp_cb(tse_task_t *task, void *args);
 static int H5_daos_obj_write_rc_task(tse_task_t *task);
 static int H5_daos_obj_write_rc_comp_cb(tse_task_t *task, void *args);
+static uint64_t H5_daos_omd_cache_hash(dv_hash_table_key_t key);
+static int H5_daos_omd_cache_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2);
+static void H5_daos_omd_cache_lru_remove(H5_daos_file_t *file, H5_daos_omd_cache_ent_t *ent);
+static void H5_daos_omd_cache_pin(H5_daos_file_t *file, H5_daos_omd_cache_ent_t *ent);
+static void H5_daos_corder_idx_set_dkey(daos_key_t *dkey, H5_daos_corder_idx_type_t idx_type);
+static void H5_daos_corder_idx_set_node(daos_iod_t *iod, daos_sg_list_t *sgl,
+    daos_iov_t *sg_iov, uint8_t *akey_buf, uint8_t *val_buf, uint64_t node);
+static int H5_daos_corder_idx_lookup_task(tse_task_t *task);
+static void H5_daos_corder_idx_lookup_found(H5_daos_corder_lookup_ud_t *udata, uint64_t key);
+static void H5_daos_corder_idx_lookup_setup_max(H5_daos_corder_lookup_ud_t *udata);
+static void H5_daos_corder_idx_lookup_setup(H5_daos_corder_lookup_ud_t *udata);
+static hbool_t H5_daos_corder_idx_walk_scan(H5_daos_corder_lookup_ud_t *udata);
+static void H5_daos_corder_idx_walk_setup(H5_daos_corder_lookup_ud_t *udata);
+static int H5_daos_corder_idx_lookup_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_corder_idx_lookup_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_corder_idx_remove_fetch_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_corder_idx_remove_fetch_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_corder_idx_remove_update_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_corder_idx_remove_update_comp_cb(tse_task_t *task, void *args);
 
 
 
@@ -804,7 +894,7 @@ H5_daos_object_get_oid_by_name(H5_daos_obj_t *loc_obj, const H5VL_loc_params_t *
 
         /* Traverse the path */
         if(NULL == (target_obj = H5_daos_group_traverse((H5_daos_item_t *)loc_obj, loc_params->loc_data.loc_by_name.name,
-                H5P_LINK_CREATE_DEFAULT, req, FALSE, &path_buf, &target_name, &target_name_len, first_task, dep_task)))
+                H5P_LINK_CREATE_DEFAULT, req, FALSE, TRUE, &path_buf, &target_name, &target_name_len, first_task, dep_task)))
             D_GOTO_ERROR(H5E_OBJECT, H5E_TRAVERSE, FAIL, "can't traverse path");
 
         /* Check for no target_name, in this case just reopen target_obj */
@@ -938,7 +1028,7 @@ H5_daos_object_get_oid_by_idx(H5_daos_obj_t *loc_obj, const H5VL_loc_params_t *l
     /* Retrieve the name of the link at the given index */
     if(H5_daos_link_get_name_by_idx_alloc(get_oid_udata->target_grp, loc_params->loc_data.loc_by_idx.idx_type,
             loc_params->loc_data.loc_by_idx.order, (uint64_t)loc_params->loc_data.loc_by_idx.n,
-            &get_oid_udata->link_name, &get_oid_udata->link_name_len, &get_oid_udata->path_buf,
+            NULL, &get_oid_udata->link_name, &get_oid_udata->link_name_len, &get_oid_udata->path_buf,
             NULL, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_OBJECT, H5E_CANTGET, FAIL, "can't get link name");
 
@@ -1631,7 +1721,7 @@ H5_daos_object_copy_helper(void *src_loc_obj, const H5VL_loc_params_t *src_loc_p
 
     /* Traverse path to destination group */
     if(NULL == (obj_copy_udata->dst_grp = (H5_daos_group_t *)H5_daos_group_traverse(dst_loc_obj, dst_name,
-            lcpl_id, req, FALSE, &obj_copy_udata->new_obj_name_path_buf, &obj_copy_udata->new_obj_name,
+            lcpl_id, req, FALSE, FALSE, &obj_copy_udata->new_obj_name_path_buf, &obj_copy_udata->new_obj_name,
             &obj_copy_udata->new_obj_name_len, first_task, dep_task)))
         D_GOTO_ERROR(H5E_OBJECT, H5E_TRAVERSE, FAIL, "can't traverse path");
 
@@ -3495,7 +3585,7 @@ H5_daos_object_specific(void *_item, const H5VL_loc_params_t *loc_params,
 
             /* Open group containing the link in question */
             if(NULL == (target_obj = H5_daos_group_traverse(item, loc_params->loc_data.loc_by_name.name,
-                    H5P_LINK_CREATE_DEFAULT, int_req, collective, &path_buf,
+                    H5P_LINK_CREATE_DEFAULT, int_req, collective, TRUE, &path_buf,
                     &oexists_obj_name, &oexists_obj_name_len, &first_task, &dep_task)))
                 D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "can't open group");
         } /* end if */
@@ -6053,3 +6143,1470 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_obj_write_rc() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_cache_hash
+ *
+ * Purpose:     Hash function for the object metadata cache hash table.
+ *              Hashes an oid.
+ *
+ * Return:      Hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_omd_cache_hash(dv_hash_table_key_t key)
+{
+    daos_obj_id_t *oid = (daos_obj_id_t *)key;
+    uint64_t hash = UINT64_C(14695981039346656037);
+
+    assert(oid);
+
+    /* FNV-1a */
+    hash ^= oid->lo;
+    hash *= UINT64_C(1099511628211);
+    hash ^= oid->hi;
+    hash *= UINT64_C(1099511628211);
+
+    return hash;
+} /* end H5_daos_omd_cache_hash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_cache_equal
+ *
+ * Purpose:     Comparison function for the object metadata cache hash
+ *              table.
+ *
+ * Return:      Non-zero if the two oids are equal, zero otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_omd_cache_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2)
+{
+    daos_obj_id_t *oid1 = (daos_obj_id_t *)key1;
+    daos_obj_id_t *oid2 = (daos_obj_id_t *)key2;
+
+    assert(oid1);
+    assert(oid2);
+
+    return (oid1->lo == oid2->lo) && (oid1->hi == oid2->hi);
+} /* end H5_daos_omd_cache_equal() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_cache_lru_remove
+ *
+ * Purpose:     Removes an unpinned entry from the object metadata cache's
+ *              list of closed objects.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_omd_cache_lru_remove(H5_daos_file_t *file, H5_daos_omd_cache_ent_t *ent)
+{
+    assert(file);
+    assert(ent);
+    assert(ent->nopen == 0);
+    assert(file->omd_cache.nclosed > 0);
+
+    if(ent->prev)
+        ent->prev->next = ent->next;
+    else {
+        assert(file->omd_cache.head == ent);
+        file->omd_cache.head = ent->next;
+    } /* end else */
+    if(ent->next)
+        ent->next->prev = ent->prev;
+    else {
+        assert(file->omd_cache.tail == ent);
+        file->omd_cache.tail = ent->prev;
+    } /* end else */
+    ent->prev = NULL;
+    ent->next = NULL;
+    file->omd_cache.nclosed--;
+
+    return;
+} /* end H5_daos_omd_cache_lru_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_cache_pin
+ *
+ * Purpose:     Marks an object metadata cache entry as used by one more
+ *              open object.  If the entry was for a closed object it is
+ *              removed from the list of closed objects.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_omd_cache_pin(H5_daos_file_t *file, H5_daos_omd_cache_ent_t *ent)
+{
+    assert(file);
+    assert(ent);
+    assert(!ent->evicted);
+
+    if(ent->nopen == 0)
+        H5_daos_omd_cache_lru_remove(file, ent);
+    ent->nopen++;
+
+    return;
+} /* end H5_daos_omd_cache_pin() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_fetch_prep_cb
+ *
+ * Purpose:     Prepare callback for the internal metadata fetch done when
+ *              opening a dataset or group.  If the object's metadata is
+ *              in the file's object metadata cache and fits in the fetch
+ *              buffers, copies it there, sets the iod sizes as the fetch
+ *              would have and completes the task without fetching.
+ *              Otherwise sets up the fetch like H5_daos_md_rw_prep_cb.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_omd_fetch_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_omd_fetch_ud_t *udata;
+    H5_daos_obj_t *obj;
+    H5_daos_file_t *file;
+    H5_daos_omd_cache_ent_t *ent;
+    daos_obj_rw_t *fetch_args;
+    uint8_t *p;
+    unsigned i;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for object metadata fetch task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->md_rw_cb_ud.obj);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_VOL);
+
+    obj = udata->md_rw_cb_ud.obj;
+    file = obj->item.file;
+    assert(file);
+
+    /* Check the object metadata cache */
+    if(file->omd_cache.table && !obj->omd_cache_ent
+            && DV_HASH_TABLE_NULL != (ent = (H5_daos_omd_cache_ent_t *)dv_hash_table_lookup(file->omd_cache.table, &obj->oid))) {
+        assert(ent->nfields == udata->md_rw_cb_ud.nr);
+
+        /* Make sure each field fits in its fetch buffer */
+        for(i = 0; i < ent->nfields; i++)
+            if(ent->field_len[i] > udata->md_rw_cb_ud.sg_iov[i].iov_buf_len)
+                break;
+
+        if(i == ent->nfields) {
+            /* Copy cached fields to fetch buffers */
+            p = ent->buf;
+            for(i = 0; i < ent->nfields; i++) {
+                if(ent->field_len[i] > 0)
+                    (void)memcpy(udata->md_rw_cb_ud.sg_iov[i].iov_buf, p, ent->field_len[i]);
+                udata->md_rw_cb_ud.iod[i].iod_size = (daos_size_t)ent->field_len[i];
+                p += ent->field_len[i];
+            } /* end for */
+
+            /* Pin entry for the object and skip the fetch */
+            H5_daos_omd_cache_pin(file, ent);
+            obj->omd_cache_ent = ent;
+            udata->omd_cache_hit = TRUE;
+            D_GOTO_DONE(-H5_DAOS_SHORT_CIRCUIT);
+        } /* end if */
+    } /* end if */
+
+    /* Set fetch task arguments */
+    if(NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for object metadata fetch task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh = obj->obj_oh;
+    fetch_args->th = udata->md_rw_cb_ud.req->th;
+    fetch_args->flags = udata->md_rw_cb_ud.flags;
+    fetch_args->dkey = &udata->md_rw_cb_ud.dkey;
+    fetch_args->nr = udata->md_rw_cb_ud.nr;
+    fetch_args->iods = udata->md_rw_cb_ud.iod;
+    fetch_args->sgls = udata->md_rw_cb_ud.sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_omd_fetch_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_cache_insert
+ *
+ * Purpose:     Adds the nfields serialized metadata fields in bufs, with
+ *              lengths lens, fetched for obj to its file's object metadata
+ *              cache, and pins the new entry for obj.  If another open of
+ *              the same object already added an entry, pins that entry
+ *              instead.  Does nothing if the cache is disabled.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+H5_daos_omd_cache_insert(H5_daos_obj_t *obj, unsigned nfields,
+    const uint8_t *bufs[], const size_t lens[])
+{
+    H5_daos_file_t *file;
+    H5_daos_omd_cache_ent_t *ent = NULL;
+    size_t total_len = 0;
+    uint8_t *p;
+    unsigned i;
+    int ret_value = 0;
+
+    assert(obj);
+    assert(!obj->omd_cache_ent);
+    assert(nfields <= H5_DAOS_OMD_CACHE_MAX_FIELDS);
+    assert(bufs);
+    assert(lens);
+
+    file = obj->item.file;
+    assert(file);
+
+    if(file->fapl_cache.obj_cache_nclosed == 0)
+        D_GOTO_DONE(0);
+
+    /* Create the hash table if necessary */
+    if(!file->omd_cache.table) {
+        if(NULL == (file->omd_cache.table = dv_hash_table_new(H5_daos_omd_cache_hash, H5_daos_omd_cache_equal)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate object metadata cache hash table");
+    } /* end if */
+    else if(DV_HASH_TABLE_NULL != (ent = (H5_daos_omd_cache_ent_t *)dv_hash_table_lookup(file->omd_cache.table, &obj->oid))) {
+        /* Another open of this object added an entry first, use it */
+        H5_daos_omd_cache_pin(file, ent);
+        obj->omd_cache_ent = ent;
+        ent = NULL;
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* Allocate entry, with the fields in the same allocation */
+    for(i = 0; i < nfields; i++)
+        total_len += lens[i];
+    if(NULL == (ent = (H5_daos_omd_cache_ent_t *)DV_calloc(sizeof(H5_daos_omd_cache_ent_t) + total_len)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate object metadata cache entry");
+    ent->oid = obj->oid;
+    ent->nfields = nfields;
+    ent->buf = (uint8_t *)(ent + 1);
+
+    /* Copy fields */
+    p = ent->buf;
+    for(i = 0; i < nfields; i++) {
+        ent->field_len[i] = lens[i];
+        if(lens[i] > 0) {
+            assert(bufs[i]);
+            (void)memcpy(p, bufs[i], lens[i]);
+        } /* end if */
+        p += lens[i];
+    } /* end for */
+
+    /* Add entry and pin it for obj */
+    if(!dv_hash_table_insert(file->omd_cache.table, &ent->oid, ent))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, -H5_DAOS_ALLOC_ERROR, "can't insert object metadata cache entry");
+    ent->nopen = 1;
+    obj->omd_cache_ent = ent;
+    ent = NULL;
+
+done:
+    /* Clean up */
+    if(ent) {
+        assert(ret_value < 0);
+        ent = DV_free(ent);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_omd_cache_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_cache_release
+ *
+ * Purpose:     Releases obj's pin on its object metadata cache entry, if
+ *              any.  Must be called when obj is freed.  When the last open
+ *              object using the entry is closed the entry is moved to the
+ *              front of the list of closed objects, or freed if it was
+ *              evicted.  The least recently closed objects are then
+ *              evicted until no more than fapl_cache.obj_cache_nclosed
+ *              closed objects are kept.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_omd_cache_release(H5_daos_obj_t *obj)
+{
+    H5_daos_file_t *file;
+    H5_daos_omd_cache_ent_t *ent;
+
+    assert(obj);
+
+    if(NULL == (ent = obj->omd_cache_ent))
+        return;
+    obj->omd_cache_ent = NULL;
+
+    file = obj->item.file;
+    assert(file);
+    assert(ent->nopen > 0);
+
+    if(--ent->nopen > 0)
+        return;
+
+    /* Free evicted entries, they are no longer in the table */
+    if(ent->evicted) {
+        (void)DV_free(ent);
+        return;
+    } /* end if */
+
+    /* Add to the front of the list of closed objects */
+    ent->prev = NULL;
+    ent->next = file->omd_cache.head;
+    if(file->omd_cache.head)
+        file->omd_cache.head->prev = ent;
+    else
+        file->omd_cache.tail = ent;
+    file->omd_cache.head = ent;
+    file->omd_cache.nclosed++;
+
+    /* Evict least recently closed objects */
+    while(file->omd_cache.nclosed > file->fapl_cache.obj_cache_nclosed) {
+        ent = file->omd_cache.tail;
+        H5_daos_omd_cache_lru_remove(file, ent);
+        (void)dv_hash_table_remove(file->omd_cache.table, &ent->oid);
+        (void)DV_free(ent);
+    } /* end while */
+
+    return;
+} /* end H5_daos_omd_cache_release() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_cache_evict
+ *
+ * Purpose:     Removes the entry for the object with OID oid from file's
+ *              object metadata cache, if present, so the next open of the
+ *              object fetches its metadata.  Must be called when this
+ *              process changes the object's internal metadata.  An entry
+ *              still used by open objects is freed when they are closed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_omd_cache_evict(H5_daos_file_t *file, const daos_obj_id_t *oid)
+{
+    H5_daos_omd_cache_ent_t *ent;
+
+    assert(file);
+    assert(oid);
+
+    if(!file->omd_cache.table)
+        return;
+    if(DV_HASH_TABLE_NULL == (ent = (H5_daos_omd_cache_ent_t *)dv_hash_table_lookup(file->omd_cache.table, (dv_hash_table_key_t)oid)))
+        return;
+
+    (void)dv_hash_table_remove(file->omd_cache.table, &ent->oid);
+    if(ent->nopen > 0)
+        ent->evicted = TRUE;
+    else {
+        H5_daos_omd_cache_lru_remove(file, ent);
+        (void)DV_free(ent);
+    } /* end else */
+
+    return;
+} /* end H5_daos_omd_cache_evict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_omd_cache_free
+ *
+ * Purpose:     Frees file's object metadata cache.  Must be called after
+ *              all objects in the file have been closed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_omd_cache_free(H5_daos_file_t *file)
+{
+    H5_daos_omd_cache_ent_t *ent;
+
+    assert(file);
+
+    /* All remaining entries are for closed objects */
+    while(NULL != (ent = file->omd_cache.head)) {
+        H5_daos_omd_cache_lru_remove(file, ent);
+        (void)DV_free(ent);
+    } /* end while */
+    assert(file->omd_cache.nclosed == 0);
+
+    if(file->omd_cache.table) {
+        dv_hash_table_free(file->omd_cache.table);
+        file->omd_cache.table = NULL;
+    } /* end if */
+
+    return;
+} /* end H5_daos_omd_cache_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_set_dkey
+ *
+ * Purpose:     Sets up the dkey holding the creation order index of the
+ *              specified type.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_corder_idx_set_dkey(daos_key_t *dkey, H5_daos_corder_idx_type_t idx_type)
+{
+    assert(dkey);
+
+    if(idx_type == H5_DAOS_CORDER_IDX_LINK)
+        daos_const_iov_set((d_const_iov_t *)dkey, H5_daos_link_corder_key_g, H5_daos_link_corder_key_size_g);
+    else {
+        assert(idx_type == H5_DAOS_CORDER_IDX_ATTR);
+        daos_const_iov_set((d_const_iov_t *)dkey, H5_daos_attr_key_g, H5_daos_attr_key_size_g);
+    } /* end else */
+
+    return;
+} /* end H5_daos_corder_idx_set_dkey() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_set_node
+ *
+ * Purpose:     Sets up the iod and sgl for reading or writing the hole
+ *              count stored in a node of a sparse creation order index's
+ *              hole count tree.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_corder_idx_set_node(daos_iod_t *iod, daos_sg_list_t *sgl,
+    daos_iov_t *sg_iov, uint8_t *akey_buf, uint8_t *val_buf, uint64_t node)
+{
+    uint8_t *p;
+
+    assert(iod);
+    assert(sgl);
+    assert(sg_iov);
+    assert(akey_buf);
+    assert(val_buf);
+    assert(node > 0);
+
+    /* Encode akey */
+    p = akey_buf;
+    *p++ = 0;
+    *p++ = (uint8_t)'H';
+    UINT64ENCODE(p, node);
+
+    /* Set up iod */
+    daos_iov_set(&iod->iod_name, (void *)akey_buf, (daos_size_t)H5_DAOS_CORDER_HOLE_KEY_SIZE);
+    iod->iod_nr = 1u;
+    iod->iod_size = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+    iod->iod_type = DAOS_IOD_SINGLE;
+
+    /* Set up sgl */
+    daos_iov_set(sg_iov, val_buf, (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+    sgl->sg_nr = 1;
+    sgl->sg_nr_out = 0;
+    sgl->sg_iovs = sg_iov;
+
+    return;
+} /* end H5_daos_corder_idx_set_node() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_lookup_task
+ *
+ * Purpose:     Asynchronous task for H5_daos_corder_idx_lookup().
+ *              Checks the index, then either converts it directly to a
+ *              key (dense index), continues the walk if the index follows
+ *              the walk's current entry, or starts fetching the hole
+ *              count tree (sparse index).
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_corder_idx_lookup_task(tse_task_t *task)
+{
+    H5_daos_corder_lookup_ud_t *udata = NULL;
+    tse_task_t *fetch_task = NULL;
+    int ret;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for creation order index lookup task");
+
+    assert(udata->req);
+    assert(udata->obj);
+    assert(udata->count);
+    assert(udata->key_out);
+    assert(task == udata->lookup_task);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_OBJECT);
+
+    /* Check index */
+    if(udata->index >= (uint64_t)*udata->count)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
+
+    /* Convert the index to a rank in increasing creation order and save it
+     * in k (the 1-based rank searched for in the hole count tree) */
+    udata->k = (udata->iter_order == H5_ITER_DEC)
+            ? (uint64_t)*udata->count - udata->index
+            : udata->index + 1;
+
+    /* Check for a repeated lookup of the walk's current entry */
+    if(udata->walk && udata->walk->valid && udata->walk->iter_order == udata->iter_order
+            && udata->walk->index == udata->index) {
+        *udata->key_out = udata->walk->key;
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* If the index is dense its keys are the ranks themselves */
+    if(!H5_DAOS_OBJ_SPARSE_CORDER(udata->obj)) {
+        H5_daos_corder_idx_lookup_found(udata, udata->k - 1);
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* Check if this lookup continues a walk with the entry after the walk's
+     * current entry */
+    if(udata->walk && udata->walk->valid && udata->walk->iter_order == udata->iter_order
+            && udata->index == udata->walk->index + 1) {
+        /* If there were no holes when the walk started and none were created
+         * since, the rank is the key */
+        if(udata->walk->max_corder == (uint64_t)*udata->count) {
+            H5_daos_corder_idx_lookup_found(udata, udata->k - 1);
+            D_GOTO_DONE(0);
+        } /* end if */
+
+        /* Check the entries already probed after the current entry */
+        udata->pos = H5_DAOS_CORDER_WALK_FLIP(udata->walk, udata->walk->key) + 1;
+        if(H5_daos_corder_idx_walk_scan(udata))
+            D_GOTO_DONE(0);
+
+        /* Probe the next batch of entries, or fall back to a full lookup if
+         * the walk ran past the max creation order value it started with */
+        if(udata->pos < udata->walk->max_corder)
+            H5_daos_corder_idx_walk_setup(udata);
+        else
+            H5_daos_corder_idx_lookup_setup_max(udata);
+    } /* end if */
+    else
+        /* Set up fetch of the max creation order value.  If no entries were
+         * deleted it is equal to the count and the rank is the key. */
+        H5_daos_corder_idx_lookup_setup_max(udata);
+
+    /* Create task to fetch max creation order and then the hole count tree
+     * (or the walk's next batch of entries) */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_corder_idx_lookup_prep_cb,
+            H5_daos_corder_idx_lookup_comp_cb, udata, &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to read creation order index");
+
+    /* Schedule fetch task and transfer ownership of udata */
+    if(0 != (ret = tse_task_schedule(fetch_task, false)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, ret, "can't schedule task to read creation order index: %s", H5_daos_err_to_string(ret));
+    udata = NULL;
+
+done:
+    /* Clean up if this task is complete */
+    if(udata) {
+        /* Close object */
+        if(H5_daos_object_close(&udata->obj->item) < 0)
+            D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status = ret_value;
+            udata->req->failed_task = "creation order index lookup task";
+        } /* end if */
+
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Return task to task list */
+        if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
+
+        /* Free udata */
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == 0);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_lookup_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_lookup_found
+ *
+ * Purpose:     Returns the key found by a creation order index lookup and
+ *              records it as the current entry of the lookup's walk, if
+ *              any.  A full lookup in a sparse index (one that fetched
+ *              the max creation order value) restarts the walk.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_corder_idx_lookup_found(H5_daos_corder_lookup_ud_t *udata, uint64_t key)
+{
+    H5_daos_corder_walk_t *walk;
+
+    assert(udata);
+
+    *udata->key_out = key;
+
+    if(NULL != (walk = udata->walk)) {
+        if(udata->max_corder_fetched) {
+            walk->max_corder = udata->max_corder;
+            walk->batch_n = 0;
+        } /* end if */
+        walk->valid = TRUE;
+        walk->iter_order = udata->iter_order;
+        walk->index = udata->index;
+        walk->key = key;
+    } /* end if */
+
+    return;
+} /* end H5_daos_corder_idx_lookup_found() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_lookup_setup_max
+ *
+ * Purpose:     Sets up the fetch of the max creation order value that
+ *              starts a full lookup in a sparse creation order index.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_corder_idx_lookup_setup_max(H5_daos_corder_lookup_ud_t *udata)
+{
+    assert(udata);
+
+    H5_daos_corder_idx_set_dkey(&udata->dkey, udata->idx_type);
+    if(udata->idx_type == H5_DAOS_CORDER_IDX_LINK)
+        daos_const_iov_set((d_const_iov_t *)&udata->iod[0].iod_name, H5_daos_max_link_corder_key_g, H5_daos_max_link_corder_key_size_g);
+    else
+        daos_const_iov_set((d_const_iov_t *)&udata->iod[0].iod_name, H5_daos_max_attr_corder_key_g, H5_daos_max_attr_corder_key_size_g);
+    udata->iod[0].iod_nr = 1u;
+    udata->iod[0].iod_size = (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+    udata->iod[0].iod_type = DAOS_IOD_SINGLE;
+    daos_iov_set(&udata->sg_iov[0], udata->val_buf[0], (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+    udata->sgl[0].sg_nr = 1;
+    udata->sgl[0].sg_nr_out = 0;
+    udata->sgl[0].sg_iovs = &udata->sg_iov[0];
+    udata->nr = 1;
+    udata->max_corder_fetched = FALSE;
+    udata->probing = FALSE;
+
+    return;
+} /* end H5_daos_corder_idx_lookup_setup_max() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_walk_scan
+ *
+ * Purpose:     Scans the entry sizes cached by a walk, starting at
+ *              position udata->pos in the walk's iteration order, for the
+ *              next entry that is not a hole.  If none is cached,
+ *              udata->pos is left at the first position not yet probed.
+ *
+ * Return:      TRUE if the entry was found, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_corder_idx_walk_scan(H5_daos_corder_lookup_ud_t *udata)
+{
+    H5_daos_corder_walk_t *walk;
+
+    assert(udata);
+    assert(udata->walk);
+
+    walk = udata->walk;
+    for(; udata->pos >= walk->batch_start
+            && udata->pos - walk->batch_start < (uint64_t)walk->batch_n; udata->pos++)
+        if(walk->batch_size[udata->pos - walk->batch_start] > 0) {
+            H5_daos_corder_idx_lookup_found(udata, H5_DAOS_CORDER_WALK_FLIP(walk, udata->pos));
+            return TRUE;
+        } /* end if */
+
+    return FALSE;
+} /* end H5_daos_corder_idx_walk_scan() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_walk_setup
+ *
+ * Purpose:     Sets up a size only fetch of the next
+ *              H5_DAOS_CORDER_WALK_BATCH entry akeys of a walk, starting
+ *              at position udata->pos in the walk's iteration order.
+ *              Holes have no entry akey and so are fetched with size 0.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_corder_idx_walk_setup(H5_daos_corder_lookup_ud_t *udata)
+{
+    H5_daos_corder_walk_t *walk;
+    uint8_t *p;
+    unsigned i;
+
+    assert(udata);
+    assert(udata->walk);
+    assert(udata->pos < udata->walk->max_corder);
+
+    walk = udata->walk;
+    walk->batch_start = udata->pos;
+    walk->batch_n = 0;
+    udata->nr = (unsigned)MIN((uint64_t)H5_DAOS_CORDER_WALK_BATCH, walk->max_corder - udata->pos);
+
+    /* Set up iods.  Link names are stored under the encoded key, attribute
+     * names under a null byte followed by the encoded key. */
+    H5_daos_corder_idx_set_dkey(&udata->dkey, udata->idx_type);
+    for(i = 0; i < udata->nr; i++) {
+        p = udata->akey_buf[i];
+        if(udata->idx_type == H5_DAOS_CORDER_IDX_ATTR)
+            *p++ = 0;
+        UINT64ENCODE(p, H5_DAOS_CORDER_WALK_FLIP(walk, udata->pos + (uint64_t)i));
+        daos_iov_set(&udata->iod[i].iod_name, (void *)udata->akey_buf[i], (daos_size_t)(p - udata->akey_buf[i]));
+        udata->iod[i].iod_nr = 1u;
+        udata->iod[i].iod_size = DAOS_REC_ANY;
+        udata->iod[i].iod_type = DAOS_IOD_SINGLE;
+    } /* end for */
+    udata->probing = TRUE;
+
+    return;
+} /* end H5_daos_corder_idx_walk_setup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_lookup_setup
+ *
+ * Purpose:     Sets up the fetch of the hole count tree nodes needed for
+ *              the next H5_DAOS_CORDER_LOOKUP_LEVELS levels of a lookup's
+ *              descent.  These are the nodes at udata->pos plus each
+ *              multiple of the smallest step in the batch, up to twice
+ *              the current step.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_corder_idx_lookup_setup(H5_daos_corder_lookup_ud_t *udata)
+{
+    uint64_t step;
+    unsigned i;
+
+    assert(udata);
+    assert(udata->step > 0);
+
+    /* Determine number of levels and node spacing for this batch */
+    udata->nlevels = 0;
+    for(step = udata->step; step > 0 && udata->nlevels < H5_DAOS_CORDER_LOOKUP_LEVELS; step >>= 1)
+        udata->nlevels++;
+    udata->unit = udata->step >> (udata->nlevels - 1);
+    udata->base = udata->pos;
+    udata->nr = (1u << udata->nlevels) - 1;
+    udata->probing = FALSE;
+
+    /* Set up iods and sgls.  Nodes past the max creation order are
+     * fetched but never used. */
+    for(i = 0; i < udata->nr; i++)
+        H5_daos_corder_idx_set_node(&udata->iod[i], &udata->sgl[i], &udata->sg_iov[i],
+                udata->akey_buf[i], udata->val_buf[i], udata->base + ((uint64_t)i + 1) * udata->unit);
+
+    return;
+} /* end H5_daos_corder_idx_lookup_setup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_lookup_prep_cb
+ *
+ * Purpose:     Prepare callback for the fetches issued by a creation
+ *              order index lookup.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_corder_idx_lookup_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_corder_lookup_ud_t *udata;
+    daos_obj_rw_t *rw_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for creation order index fetch task");
+
+    assert(udata->req);
+    assert(udata->obj);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_OBJECT);
+
+    /* Set fetch task arguments */
+    if(NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for creation order index fetch task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh = udata->obj->obj_oh;
+    rw_args->th = udata->req->th;
+    rw_args->flags = 0;
+    rw_args->dkey = &udata->dkey;
+    rw_args->nr = udata->nr;
+    rw_args->iods = udata->iod;
+    rw_args->sgls = udata->probing ? NULL : udata->sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_lookup_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_lookup_comp_cb
+ *
+ * Purpose:     Complete callback for the fetches issued by a creation
+ *              order index lookup.  Descends the hole count tree using
+ *              the fetched nodes, reissuing the fetch for the next batch
+ *              of levels until the key is found.  When continuing a walk,
+ *              instead scans the probed entries, reissuing the fetch for
+ *              the next batch of entries until one is found.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_corder_idx_lookup_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_corder_lookup_ud_t *udata;
+    hbool_t reissued = FALSE;
+    int ret;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for creation order index fetch task");
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "creation order index fetch";
+    } /* end if */
+    else if(task->dt_result == 0) {
+        uint8_t *p;
+
+        if(udata->probing) {
+            unsigned i;
+
+            /* Cache the probed entries' sizes, holes have size 0 */
+            for(i = 0; i < udata->nr; i++)
+                udata->walk->batch_size[i] = udata->iod[i].iod_size;
+            udata->walk->batch_n = udata->nr;
+
+            if(H5_daos_corder_idx_walk_scan(udata))
+                D_GOTO_DONE(0);
+
+            /* Probe the next batch of entries, or fall back to a full lookup
+             * if the walk ran past the max creation order value it started
+             * with */
+            if(udata->pos < udata->walk->max_corder)
+                H5_daos_corder_idx_walk_setup(udata);
+            else
+                H5_daos_corder_idx_lookup_setup_max(udata);
+        } /* end if */
+        else if(!udata->max_corder_fetched) {
+            /* Decode max creation order value */
+            if(udata->iod[0].iod_size == 0)
+                udata->max_corder = 0;
+            else {
+                p = udata->val_buf[0];
+                UINT64DECODE(p, udata->max_corder);
+            } /* end else */
+            udata->max_corder_fetched = TRUE;
+
+            if(udata->max_corder < (uint64_t)*udata->count)
+                D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "max creation order value is less than number of entries");
+
+            /* Check for no holes */
+            if(udata->max_corder == (uint64_t)*udata->count) {
+                H5_daos_corder_idx_lookup_found(udata, udata->k - 1);
+                D_GOTO_DONE(0);
+            } /* end if */
+
+            /* Start descent at the largest power of 2 not greater than the
+             * max creation order */
+            udata->pos = 0;
+            udata->step = 1;
+            while(udata->step <= udata->max_corder / 2)
+                udata->step <<= 1;
+
+            /* Set up fetch for first batch of levels */
+            H5_daos_corder_idx_lookup_setup(udata);
+        } /* end if */
+        else {
+            unsigned i;
+
+            /* Descend this batch's levels.  At each level, skip the node's
+             * range if it holds fewer than k live entries. */
+            for(i = 0; i < udata->nlevels; i++, udata->step >>= 1) {
+                uint64_t node = udata->pos + udata->step;
+                uint64_t nholes;
+                size_t node_idx;
+
+                if(node > udata->max_corder)
+                    continue;
+
+                /* Decode node's hole count, an absent node has no holes */
+                node_idx = (size_t)((node - udata->base) / udata->unit) - 1;
+                assert(node_idx < udata->nr);
+                if(udata->iod[node_idx].iod_size == 0)
+                    nholes = 0;
+                else {
+                    p = udata->val_buf[node_idx];
+                    UINT64DECODE(p, nholes);
+                } /* end else */
+                if(nholes > udata->step)
+                    D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "invalid creation order index hole count");
+
+                if(udata->step - nholes < udata->k) {
+                    udata->k -= udata->step - nholes;
+                    udata->pos = node;
+                } /* end if */
+            } /* end for */
+
+            /* Check if the descent is complete.  The entry is at 1-based
+             * position pos + 1, so its creation order value is pos. */
+            if(udata->step == 0) {
+                if(udata->pos >= udata->max_corder)
+                    D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "creation order index entry not found");
+                H5_daos_corder_idx_lookup_found(udata, udata->pos);
+                D_GOTO_DONE(0);
+            } /* end if */
+
+            /* Set up fetch for next batch of levels */
+            H5_daos_corder_idx_lookup_setup(udata);
+        } /* end else */
+
+        /* Re-register callback functions for re-initialized fetch task */
+        if(0 != (ret = tse_task_register_cbs(task, H5_daos_corder_idx_lookup_prep_cb, NULL, 0,
+                H5_daos_corder_idx_lookup_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, ret, "can't register callbacks for task to read creation order index: %s", H5_daos_err_to_string(ret));
+
+        if(0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, ret, "can't re-initialize task to read creation order index: %s", H5_daos_err_to_string(ret));
+        reissued = TRUE;
+    } /* end if */
+
+done:
+    if(!reissued) {
+        /* Return task to task list */
+        if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+        /* Clean up */
+        if(udata) {
+            /* Close object */
+            if(H5_daos_object_close(&udata->obj->item) < 0)
+                D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+            /* Handle errors in this function */
+            /* Do not place any code that can issue errors after this block, except for
+             * H5_daos_req_free_int, which updates req->status if it sees an error */
+            if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+                udata->req->status = ret_value;
+                udata->req->failed_task = "creation order index fetch completion callback";
+            } /* end if */
+
+            /* Release our reference to req */
+            if(H5_daos_req_free_int(udata->req) < 0)
+                D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+            /* Complete lookup task */
+            if(H5_daos_task_list_put(H5_daos_task_list_g, udata->lookup_task) < 0)
+                D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+            tse_task_complete(udata->lookup_task, ret_value);
+
+            /* Free udata */
+            udata = DV_free(udata);
+        } /* end if */
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_lookup_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_lookup
+ *
+ * Purpose:     Finds the key of the entry at index in obj's link or
+ *              attribute creation order index, traversed in iter_order.
+ *              *count is the number of entries in the index.  For dense
+ *              indices the key is the entry's position in the index.  For
+ *              sparse indices (see H5daos_set_sparse_crt_order_index())
+ *              the key is the entry's permanent creation order value,
+ *              found by descending the index's hole count tree, which
+ *              takes O(log n) tree nodes fetched in batches of
+ *              H5_DAOS_CORDER_LOOKUP_LEVELS levels.
+ *
+ *              walk may be NULL for a one-off lookup.  When looking up
+ *              consecutive indices (e.g. during iteration), pass the same
+ *              zeroed walk to each lookup: a lookup of the index after the
+ *              walk's current entry then probes the entry akeys following
+ *              that entry, H5_DAOS_CORDER_WALK_BATCH at a time, and skips
+ *              holes instead of descending the tree again, so iterating
+ *              over the whole index takes O(n) akeys.  Only the first
+ *              lookup of a walk (or one that does not follow the walk's
+ *              current entry) descends the tree.
+ *
+ *              *count and obj's oid do not need to be valid until after
+ *              dep_task (as passed to this function) completes, and
+ *              *key_out is not valid until after the new dep_task
+ *              completes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_corder_idx_lookup(H5_daos_obj_t *obj, H5_daos_corder_idx_type_t idx_type,
+    const hsize_t *count, H5_iter_order_t iter_order, uint64_t index,
+    H5_daos_corder_walk_t *walk, uint64_t *key_out, H5_daos_req_t *req,
+    tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_corder_lookup_ud_t *lookup_udata = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(obj);
+    assert(count);
+    assert(H5_ITER_NATIVE == iter_order || H5_ITER_INC == iter_order || H5_ITER_DEC == iter_order);
+    assert(key_out);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate task udata struct */
+    if(NULL == (lookup_udata = (H5_daos_corder_lookup_ud_t *)DV_calloc(sizeof(H5_daos_corder_lookup_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate creation order index lookup user data");
+    lookup_udata->req = req;
+    lookup_udata->obj = obj;
+    lookup_udata->idx_type = idx_type;
+    lookup_udata->count = count;
+    lookup_udata->iter_order = iter_order;
+    lookup_udata->index = index;
+    lookup_udata->walk = walk;
+    lookup_udata->key_out = key_out;
+
+    /* Create task for lookup */
+    if(H5_daos_create_task(H5_daos_corder_idx_lookup_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            NULL, NULL, lookup_udata, &lookup_udata->lookup_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't create task to look up creation order index");
+
+    /* Schedule lookup task (or save it to be scheduled later) and give it
+     * a reference to req and obj */
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(lookup_udata->lookup_task, false)))
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't schedule task to look up creation order index: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = lookup_udata->lookup_task;
+    *dep_task = lookup_udata->lookup_task;
+    req->rc++;
+    obj->item.rc++;
+    lookup_udata = NULL;
+
+done:
+    /* Clean up */
+    if(lookup_udata) {
+        assert(ret_value < 0);
+        lookup_udata = DV_free(lookup_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_remove_fetch_prep_cb
+ *
+ * Purpose:     Prepare callback for fetching the hole count tree nodes
+ *              covering a deleted entry's creation order value.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_corder_idx_remove_fetch_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_corder_remove_ud_t *udata;
+    daos_obj_rw_t *rw_args;
+    uint64_t node;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for creation order index fetch task");
+
+    assert(udata->req);
+    assert(udata->obj);
+    assert(udata->corder);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_OBJECT);
+
+    assert(H5_DAOS_OBJ_SPARSE_CORDER(udata->obj));
+    if(*udata->corder == UINT64_MAX)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "invalid creation order value");
+
+    /* Set up dkey */
+    H5_daos_corder_idx_set_dkey(&udata->dkey, udata->idx_type);
+
+    /* Set up iods and sgls for every tree node whose range covers the
+     * creation order value's 1-based position, up to the top of the tree */
+    for(udata->nr = 0, node = *udata->corder + 1; node != 0; node += node & (~node + 1)) {
+        assert(udata->nr < H5_DAOS_CORDER_HOLE_PATH_MAX);
+        H5_daos_corder_idx_set_node(&udata->iod[udata->nr], &udata->sgl[udata->nr], &udata->sg_iov[udata->nr],
+                udata->akey_buf[udata->nr], udata->val_buf[udata->nr], node);
+        udata->nr++;
+    } /* end for */
+
+    /* Set fetch task arguments */
+    if(NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for creation order index fetch task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh = udata->obj->obj_oh;
+    rw_args->th = udata->req->th;
+    rw_args->flags = 0;
+    rw_args->dkey = &udata->dkey;
+    rw_args->nr = udata->nr;
+    rw_args->iods = udata->iod;
+    rw_args->sgls = udata->sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_remove_fetch_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_remove_fetch_comp_cb
+ *
+ * Purpose:     Complete callback for fetching the hole count tree nodes
+ *              covering a deleted entry's creation order value.
+ *              Increments the fetched counts for the update task.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_corder_idx_remove_fetch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_corder_remove_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for creation order index fetch task");
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "creation order index hole count fetch";
+    } /* end if */
+    else if(task->dt_result == 0) {
+        uint64_t nholes;
+        uint8_t *p;
+        unsigned i;
+
+        /* Increment hole counts, an absent node has no holes */
+        for(i = 0; i < udata->nr; i++) {
+            if(udata->iod[i].iod_size == 0)
+                nholes = 0;
+            else {
+                p = udata->val_buf[i];
+                UINT64DECODE(p, nholes);
+            } /* end else */
+            nholes++;
+            p = udata->val_buf[i];
+            UINT64ENCODE(p, nholes);
+            udata->iod[i].iod_size = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+            udata->sgl[i].sg_nr_out = 0;
+        } /* end for */
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in this function */
+    if(udata && ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = ret_value;
+        udata->req->failed_task = "creation order index hole count fetch completion callback";
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_remove_fetch_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_remove_update_prep_cb
+ *
+ * Purpose:     Prepare callback for writing the incremented hole count
+ *              tree nodes covering a deleted entry's creation order
+ *              value.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_corder_idx_remove_update_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_corder_remove_ud_t *udata;
+    daos_obj_rw_t *rw_args;
+    int ret_value = 0;
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for creation order index update task");
+
+    assert(udata->req);
+    assert(udata->obj);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_OBJECT);
+
+    assert(udata->nr > 0);
+
+    /* Set update task arguments */
+    if(NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for creation order index update task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh = udata->obj->obj_oh;
+    rw_args->th = udata->req->th;
+    rw_args->flags = 0;
+    rw_args->dkey = &udata->dkey;
+    rw_args->nr = udata->nr;
+    rw_args->iods = udata->iod;
+    rw_args->sgls = udata->sgl;
+
+done:
+    if(ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_remove_update_prep_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_remove_update_comp_cb
+ *
+ * Purpose:     Complete callback for writing the incremented hole count
+ *              tree nodes covering a deleted entry's creation order
+ *              value.  Frees the udata.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_corder_idx_remove_update_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_corder_remove_ud_t *udata;
+    int ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if(NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for creation order index update task");
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if(task->dt_result < -H5_DAOS_PRE_ERROR
+            && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status = task->dt_result;
+        udata->req->failed_task = "creation order index hole count update";
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if(H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Clean up */
+    if(udata) {
+        /* Close object */
+        if(H5_daos_object_close(&udata->obj->item) < 0)
+            D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if(ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status = ret_value;
+            udata->req->failed_task = "creation order index hole count update completion callback";
+        } /* end if */
+
+        /* Release our reference to req */
+        if(H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free udata */
+        udata = DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_remove_update_comp_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_corder_idx_remove
+ *
+ * Purpose:     Records a hole at the creation order value *corder in
+ *              obj's sparse link or attribute creation order index, by
+ *              incrementing the O(log n) nodes of the index's hole count
+ *              tree that cover it with one fetch and one update.  The
+ *              index entry itself must be punched by the caller.  *corder
+ *              does not need to be valid until after dep_task (as passed
+ *              to this function) completes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_corder_idx_remove(H5_daos_obj_t *obj, H5_daos_corder_idx_type_t idx_type,
+    const uint64_t *corder, H5_daos_req_t *req, tse_task_t **first_task,
+    tse_task_t **dep_task)
+{
+    H5_daos_corder_remove_ud_t *remove_udata = NULL;
+    tse_task_t *fetch_task = NULL;
+    tse_task_t *update_task = NULL;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(obj);
+    assert(corder);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+    H5daos_compile_assert(H5_DAOS_ENCODED_CRT_ORDER_SIZE == H5_DAOS_ENCODED_UINT64_T_SIZE);
+
+    /* Allocate task udata struct */
+    if(NULL == (remove_udata = (H5_daos_corder_remove_ud_t *)DV_calloc(sizeof(H5_daos_corder_remove_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate creation order index remove user data");
+    remove_udata->req = req;
+    remove_udata->obj = obj;
+    remove_udata->idx_type = idx_type;
+    remove_udata->corder = corder;
+
+    /* Create task to fetch hole counts */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+            H5_daos_corder_idx_remove_fetch_prep_cb, H5_daos_corder_idx_remove_fetch_comp_cb,
+            remove_udata, &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't create task to read creation order index hole counts");
+
+    /* Create task to write incremented hole counts */
+    if(H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 1, &fetch_task,
+            H5_daos_corder_idx_remove_update_prep_cb, H5_daos_corder_idx_remove_update_comp_cb,
+            remove_udata, &update_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't create task to write creation order index hole counts");
+
+    /* Schedule update task, then fetch task (or save it to be scheduled
+     * later), and give them a reference to req and obj */
+    if(0 != (ret = tse_task_schedule(update_task, false)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't schedule task to write creation order index hole counts: %s", H5_daos_err_to_string(ret));
+    if(*first_task) {
+        if(0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't schedule task to read creation order index hole counts: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = fetch_task;
+    *dep_task = update_task;
+    req->rc++;
+    obj->item.rc++;
+    remove_udata = NULL;
+
+done:
+    /* Clean up */
+    if(remove_udata) {
+        assert(ret_value < 0);
+        remove_udata = DV_free(remove_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_corder_idx_remove() */
@@ -44,6 +44,13 @@
 
 typedef uint64_t H5_daos_snap_id_t;
 
+/* Callback for H5daos_map_iterate_kv().  value points to the value for key,
+ * converted to the memory type passed to H5daos_map_iterate_kv().  Both are
+ * only valid for the duration of the call.  Return values are as for
+ * H5M_iterate_t. */
+typedef herr_t (*H5daos_map_iterate_kv_t)(hid_t map_id, const void *key,
+    const void *value, void *op_data);
+
 /********************/
 /* Public Variables */
 /********************/
@@ -65,6 +72,55 @@ H5VL_DAOS_PUBLIC herr_t H5daos_set_root_open_object_class(hid_t fapl_id, char *o
 H5VL_DAOS_PUBLIC ssize_t H5daos_get_root_open_object_class(hid_t fapl_id, char *object_class, size_t size);
 H5VL_DAOS_PUBLIC herr_t H5daos_set_all_ind_metadata_ops(hid_t accpl_id, hbool_t is_independent);
 H5VL_DAOS_PUBLIC herr_t H5daos_get_all_ind_metadata_ops(hid_t accpl_id, hbool_t *is_independent);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_chunk_io_max_in_flight(hid_t dxpl_id, size_t max_in_flight);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_chunk_io_max_in_flight(hid_t dxpl_id, size_t *max_in_flight);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_chunk_cache(hid_t dapl_id, size_t nbytes);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_chunk_cache(hid_t dapl_id, size_t *nbytes);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_tconv_nthreads(hid_t fapl_id, unsigned nthreads);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_tconv_nthreads(hid_t fapl_id, unsigned *nthreads);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_inline_vl(hid_t fapl_id, hbool_t inline_vl);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_inline_vl(hid_t fapl_id, hbool_t *inline_vl);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_path_cache(hid_t fapl_id, size_t nents, double ttl);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_path_cache(hid_t fapl_id, size_t *nents, double *ttl);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_object_cache(hid_t fapl_id, size_t nclosed);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_object_cache(hid_t fapl_id, size_t *nclosed);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_map_key_count(hid_t mcpl_id, hbool_t track_key_count);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_map_key_count(hid_t mcpl_id, hbool_t *track_key_count);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_map_ordered_keys(hid_t mcpl_id, hbool_t ordered_keys);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_map_ordered_keys(hid_t mcpl_id, hbool_t *ordered_keys);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_map_bloom_filter(hid_t mcpl_id, hsize_t expected_keys);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_map_bloom_filter(hid_t mcpl_id, hsize_t *expected_keys);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_sparse_crt_order_index(hid_t ocpl_id, hbool_t sparse);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_sparse_crt_order_index(hid_t ocpl_id, hbool_t *sparse);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_packed_attr_layout(hid_t plist_id, hbool_t packed);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_packed_attr_layout(hid_t plist_id, hbool_t *packed);
+H5VL_DAOS_PUBLIC herr_t H5daos_register_filter(const H5Z_class2_t *cls);
+H5VL_DAOS_PUBLIC herr_t H5daos_dataset_read_multi(size_t count, hid_t dset_id[],
+    hid_t mem_type_id[], hid_t mem_space_id[], hid_t file_space_id[],
+    hid_t dxpl_id, void *buf[]);
+H5VL_DAOS_PUBLIC herr_t H5daos_dataset_write_multi(size_t count, hid_t dset_id[],
+    hid_t mem_type_id[], hid_t mem_space_id[], hid_t file_space_id[],
+    hid_t dxpl_id, const void *buf[]);
+H5VL_DAOS_PUBLIC herr_t H5daos_map_put_multi(hid_t map_id, size_t count,
+    hid_t key_mem_type_id, const void *keys, hid_t val_mem_type_id,
+    const void *values, hid_t dxpl_id);
+H5VL_DAOS_PUBLIC herr_t H5daos_map_get_multi(hid_t map_id, size_t count,
+    hid_t key_mem_type_id, const void *keys, hid_t val_mem_type_id,
+    void *values, hid_t dxpl_id);
+H5VL_DAOS_PUBLIC herr_t H5daos_map_iterate_kv(hid_t map_id, hsize_t *idx,
+    hid_t key_mem_type_id, hid_t val_mem_type_id, H5daos_map_iterate_kv_t op,
+    void *op_data, hid_t dxpl_id);
+H5VL_DAOS_PUBLIC herr_t H5daos_map_iterate_range(hid_t map_id, uint64_t lo,
+    uint64_t hi, H5M_iterate_t op, void *op_data, hid_t dxpl_id);
+H5VL_DAOS_PUBLIC herr_t H5daos_map_iterate_part(hid_t map_id,
+    hid_t key_mem_type_id, H5M_iterate_t op, void *op_data, hbool_t reduce_ret,
+    hid_t dxpl_id);
+H5VL_DAOS_PUBLIC herr_t H5daos_map_get_bloom_filter_fpr(hid_t map_id,
+    double *fpr);
+H5VL_DAOS_PUBLIC herr_t H5daos_map_refresh_bloom_filter(hid_t map_id,
+    hid_t dxpl_id);
+H5VL_DAOS_PUBLIC herr_t H5daos_map_rebuild_bloom_filter(hid_t map_id,
+    hid_t dxpl_id);
 #ifdef DSINC
 H5VL_DAOS_PUBLIC herr_t H5daos_snap_create(hid_t loc_id,
     H5_daos_snap_id_t *snap_id);
@@ -77,6 +133,16 @@ H5VL_DAOS_PUBLIC herr_t H5Pset_daos_snap_open(hid_t fapl_id,
 H5VL_DAOS_PUBLIC herr_t H5daos_get_poh(hid_t file_id, daos_handle_t *poh);
 H5VL_DAOS_PUBLIC herr_t H5daos_get_pool_uuid(hid_t file_id, uuid_t *pool_uuid);
 H5VL_DAOS_PUBLIC herr_t H5daos_get_global_svcl(d_rank_list_t *svcl);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_chunk_io_stats(hid_t dset_id, uint64_t *nchunks,
+    uint64_t *nbatches);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_sel_recx_list(hid_t space_id, hbool_t use_iter,
+    daos_recx_t *recxs, size_t nrecxs, size_t *nseq);
+H5VL_DAOS_PUBLIC herr_t H5daos_tconv_kernel_convert(hid_t src_type_id,
+    hid_t dst_type_id, size_t nelmts, void *buf, hbool_t *found);
+H5VL_DAOS_PUBLIC herr_t H5daos_get_tconv_buf_pool_stats(uint64_t *nhits,
+    uint64_t *nmisses, size_t *nbytes_cached);
+H5VL_DAOS_PUBLIC herr_t H5daos_set_legacy_chunk_format(hid_t dcpl_id,
+    hbool_t legacy);
 
 #ifdef __cplusplus
 }
@@ -112,3 +112,220 @@ H5daos_get_global_svcl(d_rank_list_t *svcl)
 done:
     D_FUNC_LEAVE_API;
 } /* end H5daos_get_svcl() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_chunk_io_stats
+ *
+ * Purpose:     Internal API function to return the number of chunks and
+ *              the number of chunk I/O batches issued for a dataset since
+ *              it was opened.  nchunks / nbatches is the achieved
+ *              batching factor.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_chunk_io_stats(hid_t dset_id, uint64_t *nchunks, uint64_t *nbatches)
+{
+    H5_daos_dset_t *dset = NULL;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(dset_id < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset ID is invalid");
+
+    if(NULL == (dset = (H5_daos_dset_t *)H5VLobject(dset_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if(H5I_DATASET != dset->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+
+    if(nchunks)
+        *nchunks = dset->io_stats.nchunks;
+    if(nbatches)
+        *nbatches = dset->io_stats.nbatches;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_chunk_io_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_sel_recx_list
+ *
+ * Purpose:     Internal API function to convert the selection in space_id
+ *              to a list of DAOS records, using either the selection
+ *              iterator (if use_iter is TRUE) or the closed form
+ *              generator for regular selections.  Up to nrecxs records
+ *              are copied to recxs, and the total number of records is
+ *              returned in *nseq.  Used to test and benchmark the two
+ *              paths against each other.
+ *
+ * Return:      Non-negative on success/Negative on failure (including
+ *              when use_iter is FALSE and the selection is not regular)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_sel_recx_list(hid_t space_id, hbool_t use_iter, daos_recx_t *recxs,
+    size_t nrecxs, size_t *nseq)
+{
+    daos_recx_t recx;
+    daos_recx_t *recx_list = &recx;
+    hid_t sel_iter_id = H5I_INVALID_HID;
+    htri_t is_regular;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(space_id < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataspace ID is invalid");
+    if(!recxs && nrecxs > 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "recxs is NULL");
+    if(!nseq)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nseq pointer is NULL");
+
+    if(use_iter) {
+        /* Create selection iterator in terms of elements, as the dataset
+         * code does */
+        if((sel_iter_id = H5Ssel_iter_create(space_id, 1, H5S_SEL_ITER_SHARE_WITH_DATASPACE)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to create selection iterator");
+        if(H5_daos_sel_iter_to_recx_iov(sel_iter_id, 1, NULL, &recx_list, NULL, nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't generate sequence list from selection iterator");
+    } /* end if */
+    else {
+        if((is_regular = H5_daos_sel_to_recx_iov_regular(space_id, 1, NULL, &recx_list, NULL, nseq)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't generate sequence list for regular selection");
+        if(!is_regular)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "selection is not regular");
+    } /* end else */
+
+    if(nrecxs > 0)
+        memcpy(recxs, recx_list, MIN(*nseq, nrecxs) * sizeof(daos_recx_t));
+
+done:
+    if(recx_list != &recx)
+        DV_free(recx_list);
+    if(sel_iter_id >= 0 && H5Ssel_iter_close(sel_iter_id) < 0)
+        D_DONE_ERROR(H5E_DATASPACE, H5E_CANTRELEASE, FAIL, "unable to close selection iterator");
+
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_sel_recx_list() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_tconv_kernel_convert
+ *
+ * Purpose:     Internal API function to convert nelmts elements in buf
+ *              from src_type_id to dst_type_id with the connector's
+ *              conversion kernel for the pair of types.  Sets *found to
+ *              FALSE and leaves buf untouched if there is no kernel.  Used
+ *              to test and benchmark the kernels against H5Tconvert.
+ *
+ * Return:      Success:    Non-negative.
+ *
+ *              Failure:    Negative.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_tconv_kernel_convert(hid_t src_type_id, hid_t dst_type_id,
+    size_t nelmts, void *buf, hbool_t *found)
+{
+    H5_daos_tconv_kernel_t kernel;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(!buf && nelmts > 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "buf is NULL");
+    if(!found)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "found pointer is NULL");
+
+    if(H5_daos_tconv_get_kernel(src_type_id, dst_type_id, &kernel) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't look up type conversion kernel");
+
+    if((*found = (kernel.func != NULL)))
+        kernel.func(&kernel, buf, nelmts);
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_tconv_kernel_convert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_tconv_buf_pool_stats
+ *
+ * Purpose:     Internal API function to retrieve the number of type
+ *              conversion buffer allocations that were served from the
+ *              buffer pool (hits) and that required a new allocation
+ *              (misses), and the number of bytes currently cached by the
+ *              pool.  Any of the output pointers may be NULL.
+ *
+ * Return:      Success:    Non-negative.
+ *
+ *              Failure:    Negative.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_tconv_buf_pool_stats(uint64_t *nhits, uint64_t *nmisses,
+    size_t *nbytes_cached)
+{
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    H5_daos_bufpool_get_stats(nhits, nmisses, nbytes_cached);
+
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_tconv_buf_pool_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_legacy_chunk_format
+ *
+ * Purpose:     Internal API function to make datasets created with the
+ *              DCPL dcpl_id ignore the filters in the DCPL and store
+ *              their chunks as arrays, as datasets created before filters
+ *              were supported do.  Used to test that such datasets can
+ *              still be read.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_legacy_chunk_format(hid_t dcpl_id, hbool_t legacy)
+{
+    htri_t is_dcpl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if(dcpl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if((is_dcpl = H5Pisa_class(dcpl_id, H5P_DATASET_CREATE)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if(!is_dcpl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset creation property list");
+
+    /* Set the property, or insert it if it does not exist */
+    if((prop_exists = H5Pexist(dcpl_id, H5_DAOS_LEGACY_CHUNK_FORMAT_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for legacy chunk format property");
+    if(prop_exists) {
+        if(H5Pset(dcpl_id, H5_DAOS_LEGACY_CHUNK_FORMAT_PROP_NAME, &legacy) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set legacy chunk format property");
+    } /* end if */
+    else
+        if(H5Pinsert2(dcpl_id, H5_DAOS_LEGACY_CHUNK_FORMAT_PROP_NAME, sizeof(hbool_t),
+                &legacy, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_legacy_chunk_format() */
@@ -18,6 +18,10 @@
 #include "util/daos_vol_err.h"  /* DAOS connector error handling           */
 #include "util/daos_vol_mem.h"  /* DAOS connector memory management        */
 
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+
 /****************/
 /* Local Macros */
 /****************/
@@ -26,6 +30,12 @@
         H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_TCPL_BUF_SIZE                \
       + H5_DAOS_ENCODED_OID_SIZE + 2 * H5_DAOS_ENCODED_UINT64_T_SIZE)
 
+/* Number of elements converted at a time by the conversion kernels, and
+ * size of the blocks of elements converted at a time by the compound subset
+ * kernel */
+#define H5_DAOS_TCONV_BLOCK_NELMTS 256
+#define H5_DAOS_TCONV_CMPD_BLOCK_SIZE (4 * H5_DAOS_TCONV_KERNEL_MAX_ELEM_SIZE)
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -38,6 +48,10 @@ static int H5_daos_datatype_open_end(H5_daos_dtype_t *dtype, uint8_t *p,
 
 static htri_t H5_daos_need_bkg(hid_t src_type_id, hid_t dst_type_id,
     hbool_t dst_file, size_t *dst_type_size, hbool_t *fill_bkg);
+static void H5_daos_tconv_compound_subset(const H5_daos_tconv_kernel_t *kernel,
+    void *buf, size_t nelmts);
+static htri_t H5_daos_tconv_get_compound_kernel(hid_t src_type_id,
+    hid_t dst_type_id, H5_daos_tconv_kernel_t *kernel);
 
 
 /*-------------------------------------------------------------------------
@@ -390,7 +404,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_tconv_init
  *
- * Purpose:     DSINC
+ * Purpose:     DSINC.  The type conversion and background buffers are
+ *              allocated from the buffer pool and must be released with
+ *              H5_daos_bufpool_free().
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -446,29 +462,22 @@ H5_daos_tconv_init(hid_t src_type_id, size_t *src_type_size,
     } /* end if */
 
     /* Allocate conversion buffer if it is not being reused */
-    if(!reuse || (*reuse != H5_DAOS_TCONV_REUSE_TCONV)) {
-        if(clear_tconv_buf) {
-            if(NULL == (*tconv_buf = DV_calloc(num_elem * (*src_type_size
-                    > *dst_type_size ? *src_type_size : *dst_type_size))))
-                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate type conversion buffer");
-        } /* end if */
-        else
-            if(NULL == (*tconv_buf = DV_malloc(num_elem * (*src_type_size
-                    > *dst_type_size ? *src_type_size : *dst_type_size))))
-                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate type conversion buffer");
-    } /* end if */
+    if(!reuse || (*reuse != H5_DAOS_TCONV_REUSE_TCONV))
+        if(NULL == (*tconv_buf = H5_daos_bufpool_malloc(num_elem * (*src_type_size
+                > *dst_type_size ? *src_type_size : *dst_type_size), clear_tconv_buf)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate type conversion buffer");
 
     /* Allocate background buffer if one is needed and it is not being
      * reused */
     if(need_bkg && (!reuse || (*reuse != H5_DAOS_TCONV_REUSE_BKG)))
-        if(NULL == (*bkg_buf = DV_calloc(num_elem * *dst_type_size)))
+        if(NULL == (*bkg_buf = H5_daos_bufpool_malloc(num_elem * *dst_type_size, TRUE)))
             D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate background buffer");
 
 done:
     /* Cleanup on failure */
     if(ret_value < 0) {
-        *tconv_buf = DV_free(*tconv_buf);
-        *bkg_buf = DV_free(*bkg_buf);
+        *tconv_buf = H5_daos_bufpool_free(*tconv_buf);
+        *bkg_buf = H5_daos_bufpool_free(*bkg_buf);
         if(reuse)
             *reuse = H5_DAOS_TCONV_REUSE_NONE;
     } /* end if */
@@ -476,6 +485,592 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_tconv_init() */
 
+
+/*
+ * Datatype conversion kernels.  The integer and floating point kernels
+ * convert in place, working in blocks of H5_DAOS_TCONV_BLOCK_NELMTS elements
+ * that are copied to a local array of the source type, converted with a
+ * simple loop the compiler can vectorize, then copied back as the destination
+ * type.  When the destination type is no larger than the source type blocks
+ * are processed front to back, otherwise back to front, so a block is always
+ * copied out before it could be overwritten.
+ */
+
+/* Defines a kernel converting STYPE to DTYPE, where DTYPE is no larger than
+ * STYPE.  CONV(s) evaluates to the converted value of s. */
+#define H5_DAOS_TCONV_KERNEL_FWD(NAME, STYPE, DTYPE, CONV)                     \
+static void                                                                    \
+NAME(const H5_daos_tconv_kernel_t H5VL_DAOS_UNUSED *kernel, void *buf,         \
+    size_t nelmts)                                                             \
+{                                                                              \
+    uint8_t *p = (uint8_t *)buf;                                               \
+    STYPE s[H5_DAOS_TCONV_BLOCK_NELMTS];                                       \
+    DTYPE d[H5_DAOS_TCONV_BLOCK_NELMTS];                                       \
+    size_t nblock;                                                             \
+    size_t i, j;                                                               \
+                                                                               \
+    for(i = 0; i < nelmts; i += nblock) {                                      \
+        nblock = MIN(nelmts - i, H5_DAOS_TCONV_BLOCK_NELMTS);                  \
+        (void)memcpy(s, p + i * sizeof(STYPE), nblock * sizeof(STYPE));        \
+        for(j = 0; j < nblock; j++)                                            \
+            d[j] = CONV(s[j]);                                                 \
+        (void)memcpy(p + i * sizeof(DTYPE), d, nblock * sizeof(DTYPE));        \
+    } /* end for */                                                            \
+                                                                               \
+    return;                                                                    \
+}
+
+/* Defines a kernel converting STYPE to the larger DTYPE */
+#define H5_DAOS_TCONV_KERNEL_BWD(NAME, STYPE, DTYPE, CONV)                     \
+static void                                                                    \
+NAME(const H5_daos_tconv_kernel_t H5VL_DAOS_UNUSED *kernel, void *buf,         \
+    size_t nelmts)                                                             \
+{                                                                              \
+    uint8_t *p = (uint8_t *)buf;                                               \
+    STYPE s[H5_DAOS_TCONV_BLOCK_NELMTS];                                       \
+    DTYPE d[H5_DAOS_TCONV_BLOCK_NELMTS];                                       \
+    size_t nblock;                                                             \
+    size_t i, j;                                                               \
+                                                                               \
+    for(i = nelmts; i > 0; i -= nblock) {                                      \
+        nblock = MIN(i, H5_DAOS_TCONV_BLOCK_NELMTS);                           \
+        (void)memcpy(s, p + (i - nblock) * sizeof(STYPE),                      \
+                nblock * sizeof(STYPE));                                       \
+        for(j = 0; j < nblock; j++)                                            \
+            d[j] = CONV(s[j]);                                                 \
+        (void)memcpy(p + (i - nblock) * sizeof(DTYPE), d,                      \
+                nblock * sizeof(DTYPE));                                       \
+    } /* end for */                                                            \
+                                                                               \
+    return;                                                                    \
+}
+
+/* Conversions.  Out of range integers are clipped, as with HDF5's hard
+ * conversions. */
+#define H5_DAOS_TCONV_CAST(S, DTYPE) ((DTYPE)(S))
+#define H5_DAOS_TCONV_FLOAT_DOUBLE(S) H5_DAOS_TCONV_CAST(S, double)
+#define H5_DAOS_TCONV_INT64_INT32(S)                                           \
+    ((S) > INT32_MAX ? INT32_MAX : (S) < INT32_MIN ? INT32_MIN : (int32_t)(S))
+#define H5_DAOS_TCONV_INT32_INT64(S) H5_DAOS_TCONV_CAST(S, int64_t)
+#define H5_DAOS_TCONV_UINT64_UINT32(S)                                         \
+    ((S) > UINT32_MAX ? UINT32_MAX : (uint32_t)(S))
+#define H5_DAOS_TCONV_UINT32_UINT64(S) H5_DAOS_TCONV_CAST(S, uint64_t)
+#define H5_DAOS_TCONV_BSWAP16(S) ((uint16_t)(((S) << 8) | ((S) >> 8)))
+#define H5_DAOS_TCONV_BSWAP32(S)                                               \
+    ((((S) & 0x000000ffu) << 24) | (((S) & 0x0000ff00u) << 8)                  \
+   | (((S) & 0x00ff0000u) >> 8) | (((S) & 0xff000000u) >> 24))
+#define H5_DAOS_TCONV_BSWAP64(S)                                               \
+    (((uint64_t)H5_DAOS_TCONV_BSWAP32((uint32_t)(S)) << 32)                    \
+   | (uint64_t)H5_DAOS_TCONV_BSWAP32((uint32_t)((S) >> 32)))
+
+H5_DAOS_TCONV_KERNEL_BWD(H5_daos_tconv_float_double, float, double, H5_DAOS_TCONV_FLOAT_DOUBLE)
+H5_DAOS_TCONV_KERNEL_FWD(H5_daos_tconv_int64_int32, int64_t, int32_t, H5_DAOS_TCONV_INT64_INT32)
+H5_DAOS_TCONV_KERNEL_BWD(H5_daos_tconv_int32_int64, int32_t, int64_t, H5_DAOS_TCONV_INT32_INT64)
+H5_DAOS_TCONV_KERNEL_FWD(H5_daos_tconv_uint64_uint32, uint64_t, uint32_t, H5_DAOS_TCONV_UINT64_UINT32)
+H5_DAOS_TCONV_KERNEL_BWD(H5_daos_tconv_uint32_uint64, uint32_t, uint64_t, H5_DAOS_TCONV_UINT32_UINT64)
+H5_DAOS_TCONV_KERNEL_FWD(H5_daos_tconv_bswap16, uint16_t, uint16_t, H5_DAOS_TCONV_BSWAP16)
+H5_DAOS_TCONV_KERNEL_FWD(H5_daos_tconv_bswap32, uint32_t, uint32_t, H5_DAOS_TCONV_BSWAP32)
+H5_DAOS_TCONV_KERNEL_FWD(H5_daos_tconv_bswap64, uint64_t, uint64_t, H5_DAOS_TCONV_BSWAP64)
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_double_float
+ *
+ * Purpose:     Converts nelmts native doubles in buf to native floats, in
+ *              place.  Out of range values are detected by comparing the
+ *              magnitude bits of the doubles as integers, since
+ *              floating point comparisons that may trap keep the compiler
+ *              from vectorizing the loop.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_tconv_double_float(const H5_daos_tconv_kernel_t H5VL_DAOS_UNUSED *kernel,
+    void *buf, size_t nelmts)
+{
+    uint8_t *p = (uint8_t *)buf;
+    uint64_t s[H5_DAOS_TCONV_BLOCK_NELMTS];
+    float d[H5_DAOS_TCONV_BLOCK_NELMTS];
+    const uint64_t abs_mask = ~((uint64_t)1 << 63);
+    const double flt_max = FLT_MAX;
+    const double inf = HUGE_VAL;
+    uint64_t flt_max_bits;
+    uint64_t inf_bits;
+    size_t nblock;
+    size_t i, j;
+
+    (void)memcpy(&flt_max_bits, &flt_max, sizeof(flt_max_bits));
+    (void)memcpy(&inf_bits, &inf, sizeof(inf_bits));
+
+    for(i = 0; i < nelmts; i += nblock) {
+        nblock = MIN(nelmts - i, H5_DAOS_TCONV_BLOCK_NELMTS);
+        (void)memcpy(s, p + i * sizeof(double), nblock * sizeof(double));
+        for(j = 0; j < nblock; j++) {
+            uint64_t mag = s[j] & abs_mask;
+            double v;
+            float f;
+
+            (void)memcpy(&v, &s[j], sizeof(v));
+            f = (float)v;
+
+            /* Finite values larger than FLT_MAX (some of which round to
+             * FLT_MAX) become infinity */
+            d[j] = (mag > flt_max_bits && mag <= inf_bits) ? copysignf(HUGE_VALF, f) : f;
+        } /* end for */
+        (void)memcpy(p + i * sizeof(float), d, nblock * sizeof(float));
+    } /* end for */
+
+    return;
+} /* end H5_daos_tconv_double_float() */
+
+
+/* Copies one run of members for nelmts elements, from the source elements in
+ * S to the destination elements in D.  LEN is the run length, so the copies
+ * of common member sizes become single loads and stores. */
+#define H5_DAOS_TCONV_COPY_RUN(D, S, RUN, SRC_SIZE, DST_SIZE, NELMTS, LEN)     \
+do {                                                                           \
+    size_t _k;                                                                 \
+                                                                               \
+    for(_k = 0; _k < (NELMTS); _k++)                                           \
+        (void)memcpy((D) + _k * (DST_SIZE) + (RUN)->dst_off,                   \
+                (S) + _k * (SRC_SIZE) + (RUN)->src_off, LEN);                  \
+} while(0)
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_compound_subset
+ *
+ * Purpose:     Converts nelmts elements of a compound type to a compound
+ *              type whose members are all present, with the same types,
+ *              in the source type, in place.  Works in blocks of elements
+ *              like the other kernels: each block is copied out to a local
+ *              buffer, then each run of members recorded in kernel is
+ *              copied from there to all destination elements in the
+ *              block.  Padding in the destination type is zeroed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_tconv_compound_subset(const H5_daos_tconv_kernel_t *kernel, void *buf,
+    size_t nelmts)
+{
+    uint8_t *p = (uint8_t *)buf;
+    uint8_t s[H5_DAOS_TCONV_CMPD_BLOCK_SIZE];
+    uint8_t *d;
+    size_t src_size = kernel->src_size;
+    size_t dst_size = kernel->dst_size;
+    size_t block_nelmts;
+    size_t nblock;
+    size_t packed_size = 0;
+    size_t i, j;
+
+    assert(src_size <= sizeof(s));
+
+    block_nelmts = sizeof(s) / src_size;
+    for(j = 0; j < kernel->nruns; j++)
+        packed_size += kernel->runs[j].len;
+
+    i = dst_size <= src_size ? 0 : nelmts;
+    while(dst_size <= src_size ? i < nelmts : i > 0) {
+        /* Find the next block, front to back if the destination type is no
+         * larger than the source type, otherwise back to front */
+        if(dst_size <= src_size)
+            nblock = MIN(nelmts - i, block_nelmts);
+        else {
+            nblock = MIN(i, block_nelmts);
+            i -= nblock;
+        } /* end else */
+
+        /* Copy out source elements */
+        (void)memcpy(s, p + i * src_size, nblock * src_size);
+
+        /* Clear destination elements if they have padding */
+        d = p + i * dst_size;
+        if(packed_size < dst_size)
+            (void)memset(d, 0, nblock * dst_size);
+
+        /* Copy runs */
+        for(j = 0; j < kernel->nruns; j++)
+            switch(kernel->runs[j].len) {
+                case 1:
+                    H5_DAOS_TCONV_COPY_RUN(d, s, &kernel->runs[j], src_size, dst_size, nblock, 1);
+                    break;
+                case 2:
+                    H5_DAOS_TCONV_COPY_RUN(d, s, &kernel->runs[j], src_size, dst_size, nblock, 2);
+                    break;
+                case 4:
+                    H5_DAOS_TCONV_COPY_RUN(d, s, &kernel->runs[j], src_size, dst_size, nblock, 4);
+                    break;
+                case 8:
+                    H5_DAOS_TCONV_COPY_RUN(d, s, &kernel->runs[j], src_size, dst_size, nblock, 8);
+                    break;
+                case 16:
+                    H5_DAOS_TCONV_COPY_RUN(d, s, &kernel->runs[j], src_size, dst_size, nblock, 16);
+                    break;
+                default:
+                    H5_DAOS_TCONV_COPY_RUN(d, s, &kernel->runs[j], src_size, dst_size, nblock, kernel->runs[j].len);
+            } /* end switch */
+
+        if(dst_size <= src_size)
+            i += nblock;
+    } /* end while */
+
+    return;
+} /* end H5_daos_tconv_compound_subset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_get_compound_kernel
+ *
+ * Purpose:     Checks if conversion between two compound types only
+ *              selects and moves members, i.e. every member of the
+ *              destination type is present in the source type with an
+ *              identical type that needs no conversion, and if so sets up
+ *              kernel to do so.  Adjacent members are merged into a single
+ *              run.
+ *
+ * Return:      Success:        TRUE if kernel was set up, FALSE otherwise
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5_daos_tconv_get_compound_kernel(hid_t src_type_id, hid_t dst_type_id,
+    H5_daos_tconv_kernel_t *kernel)
+{
+    hid_t src_memb_type_id = -1;
+    hid_t dst_memb_type_id = -1;
+    char *memb_name = NULL;
+    int nmembs;
+    int src_idx;
+    size_t src_off;
+    size_t dst_off;
+    size_t len;
+    htri_t is_equal;
+    htri_t is_vl;
+    int i;
+    htri_t ret_value = TRUE;
+
+    assert(kernel);
+
+    if((kernel->src_size = H5Tget_size(src_type_id)) == 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get source type size");
+    if((kernel->dst_size = H5Tget_size(dst_type_id)) == 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get destination type size");
+    if(kernel->src_size > H5_DAOS_TCONV_KERNEL_MAX_ELEM_SIZE)
+        D_GOTO_DONE(FALSE);
+    if((nmembs = H5Tget_nmembers(dst_type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get number of destination type members");
+    kernel->nruns = 0;
+
+    for(i = 0; i < nmembs; i++) {
+        /* Find member in source type */
+        if(NULL == (memb_name = H5Tget_member_name(dst_type_id, (unsigned)i)))
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get compound member name");
+        H5E_BEGIN_TRY {
+            src_idx = H5Tget_member_index(src_type_id, memb_name);
+        } H5E_END_TRY
+        if(H5free_memory(memb_name) < 0)
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't free member name");
+        memb_name = NULL;
+        if(src_idx < 0)
+            D_GOTO_DONE(FALSE);
+
+        /* Check that the member types are identical and need no conversion */
+        if((src_memb_type_id = H5Tget_member_type(src_type_id, (unsigned)src_idx)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get source member type");
+        if((dst_memb_type_id = H5Tget_member_type(dst_type_id, (unsigned)i)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get destination member type");
+        if((is_equal = H5Tequal(src_memb_type_id, dst_memb_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOMPARE, FAIL, "can't compare datatypes");
+        if(!is_equal)
+            D_GOTO_DONE(FALSE);
+        if((is_vl = H5_daos_detect_vl_vlstr_ref(dst_memb_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't check for vl or reference type");
+        if(is_vl)
+            D_GOTO_DONE(FALSE);
+        if((len = H5Tget_size(dst_memb_type_id)) == 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get member type size");
+        if(H5Tclose(src_memb_type_id) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close source member type");
+        src_memb_type_id = -1;
+        if(H5Tclose(dst_memb_type_id) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close destination member type");
+        dst_memb_type_id = -1;
+
+        src_off = H5Tget_member_offset(src_type_id, (unsigned)src_idx);
+        dst_off = H5Tget_member_offset(dst_type_id, (unsigned)i);
+
+        /* Extend the previous run if this member follows it in both types,
+         * otherwise add a new run */
+        if(kernel->nruns > 0
+                && kernel->runs[kernel->nruns - 1].src_off + kernel->runs[kernel->nruns - 1].len == src_off
+                && kernel->runs[kernel->nruns - 1].dst_off + kernel->runs[kernel->nruns - 1].len == dst_off)
+            kernel->runs[kernel->nruns - 1].len += len;
+        else {
+            if(kernel->nruns == H5_DAOS_TCONV_KERNEL_MAX_RUNS)
+                D_GOTO_DONE(FALSE);
+            kernel->runs[kernel->nruns].src_off = src_off;
+            kernel->runs[kernel->nruns].dst_off = dst_off;
+            kernel->runs[kernel->nruns].len = len;
+            kernel->nruns++;
+        } /* end else */
+    } /* end for */
+
+    kernel->func = H5_daos_tconv_compound_subset;
+
+done:
+    if(memb_name && H5free_memory(memb_name) < 0)
+        D_DONE_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't free member name");
+    if(src_memb_type_id >= 0 && H5Tclose(src_memb_type_id) < 0)
+        D_DONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close source member type");
+    if(dst_memb_type_id >= 0 && H5Tclose(dst_memb_type_id) < 0)
+        D_DONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close destination member type");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_get_compound_kernel() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_get_kernel
+ *
+ * Purpose:     Looks for a conversion kernel from src_type_id to
+ *              dst_type_id.  Kernels exist for:
+ *
+ *              - float <-> double, int32 <-> int64 and uint32 <-> uint64
+ *                in native byte order
+ *              - byte order swaps of otherwise identical 2, 4 and 8 byte
+ *                integer and floating point types
+ *              - compound types where the destination members are a
+ *                subset of the source members with identical types
+ *
+ *              Sets kernel->func to NULL if there is none.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tconv_get_kernel(hid_t src_type_id, hid_t dst_type_id,
+    H5_daos_tconv_kernel_t *kernel)
+{
+    struct {
+        hid_t src_type_id;
+        hid_t dst_type_id;
+        void (*func)(const H5_daos_tconv_kernel_t *kernel, void *buf, size_t nelmts);
+    } kernels[6];
+    hid_t tmp_type_id = -1;
+    H5T_class_t src_class;
+    H5T_class_t dst_class;
+    H5T_order_t src_order;
+    H5T_order_t dst_order;
+    size_t size;
+    htri_t is_equal;
+    size_t i;
+    herr_t ret_value = SUCCEED;
+
+    assert(kernel);
+
+    kernel->func = NULL;
+
+    if(H5T_NO_CLASS == (src_class = H5Tget_class(src_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype class");
+    if(H5T_NO_CLASS == (dst_class = H5Tget_class(dst_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype class");
+
+    /* Compound member subsetting */
+    if(src_class == H5T_COMPOUND && dst_class == H5T_COMPOUND) {
+        if(H5_daos_tconv_get_compound_kernel(src_type_id, dst_type_id, kernel) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't check compound conversion");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Everything else is integer and floating point types */
+    if((src_class != H5T_INTEGER && src_class != H5T_FLOAT) || dst_class != src_class)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Byte order swaps */
+    if(H5T_ORDER_ERROR == (src_order = H5Tget_order(src_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get source type byte order");
+    if(H5T_ORDER_ERROR == (dst_order = H5Tget_order(dst_type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get destination type byte order");
+    if((src_order == H5T_ORDER_LE && dst_order == H5T_ORDER_BE)
+            || (src_order == H5T_ORDER_BE && dst_order == H5T_ORDER_LE)) {
+        if((size = H5Tget_size(src_type_id)) == 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get source type size");
+        if(size != 2 && size != 4 && size != 8)
+            D_GOTO_DONE(SUCCEED);
+
+        /* Check that the types are otherwise identical */
+        if((tmp_type_id = H5Tcopy(dst_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "can't copy destination type");
+        if(H5Tset_order(tmp_type_id, src_order) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "can't set byte order");
+        if((is_equal = H5Tequal(src_type_id, tmp_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOMPARE, FAIL, "can't compare datatypes");
+        if(is_equal)
+            kernel->func = size == 2 ? H5_daos_tconv_bswap16
+                    : size == 4 ? H5_daos_tconv_bswap32 : H5_daos_tconv_bswap64;
+
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Widening and narrowing of native types */
+    kernels[0].src_type_id = H5T_NATIVE_DOUBLE;
+    kernels[0].dst_type_id = H5T_NATIVE_FLOAT;
+    kernels[0].func = H5_daos_tconv_double_float;
+    kernels[1].src_type_id = H5T_NATIVE_FLOAT;
+    kernels[1].dst_type_id = H5T_NATIVE_DOUBLE;
+    kernels[1].func = H5_daos_tconv_float_double;
+    kernels[2].src_type_id = H5T_NATIVE_INT64;
+    kernels[2].dst_type_id = H5T_NATIVE_INT32;
+    kernels[2].func = H5_daos_tconv_int64_int32;
+    kernels[3].src_type_id = H5T_NATIVE_INT32;
+    kernels[3].dst_type_id = H5T_NATIVE_INT64;
+    kernels[3].func = H5_daos_tconv_int32_int64;
+    kernels[4].src_type_id = H5T_NATIVE_UINT64;
+    kernels[4].dst_type_id = H5T_NATIVE_UINT32;
+    kernels[4].func = H5_daos_tconv_uint64_uint32;
+    kernels[5].src_type_id = H5T_NATIVE_UINT32;
+    kernels[5].dst_type_id = H5T_NATIVE_UINT64;
+    kernels[5].func = H5_daos_tconv_uint32_uint64;
+
+    for(i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+        if((is_equal = H5Tequal(src_type_id, kernels[i].src_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOMPARE, FAIL, "can't compare datatypes");
+        if(!is_equal)
+            continue;
+        if((is_equal = H5Tequal(dst_type_id, kernels[i].dst_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOMPARE, FAIL, "can't compare datatypes");
+        if(is_equal) {
+            kernel->func = kernels[i].func;
+            break;
+        } /* end if */
+    } /* end for */
+
+done:
+    if(tmp_type_id >= 0 && H5Tclose(tmp_type_id) < 0)
+        D_DONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "can't close datatype");
+
+    if(ret_value < 0)
+        kernel->func = NULL;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_get_kernel() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_convert
+ *
+ * Purpose:     Converts nelmts elements in buf from src_type_id to
+ *              dst_type_id, using a conversion kernel if there is one and
+ *              dxpl_id does not set a conversion exception callback, and
+ *              H5Tconvert otherwise.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tconv_convert(hid_t src_type_id, hid_t dst_type_id, size_t nelmts,
+    void *buf, void *bkg, hid_t dxpl_id)
+{
+    H5_daos_tconv_kernel_t kernel;
+    H5T_conv_except_func_t conv_cb = NULL;
+    void *conv_cb_data = NULL;
+    herr_t ret_value = SUCCEED;
+
+    kernel.func = NULL;
+
+    /* Kernels cannot call a conversion exception callback */
+    if(dxpl_id != H5P_DEFAULT && H5Pget_type_conv_cb(dxpl_id, &conv_cb, &conv_cb_data) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get conversion exception callback");
+    if(!conv_cb && H5_daos_tconv_get_kernel(src_type_id, dst_type_id, &kernel) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't look up type conversion kernel");
+
+    if(kernel.func)
+        kernel.func(&kernel, buf, nelmts);
+    else if(H5Tconvert(src_type_id, dst_type_id, nelmts, buf, bkg, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_convert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_convert_to_file
+ *
+ * Purpose:     Like H5_daos_tconv_convert, for conversions from a memory
+ *              type to a file type.  Any blobs written by the conversion
+ *              (for variable length and reference data) are issued
+ *              asynchronously as a batch, and waited on before returning,
+ *              instead of one at a time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tconv_convert_to_file(H5_daos_file_t *file, hid_t src_type_id,
+    hid_t dst_type_id, size_t nelmts, void *buf, void *bkg, hid_t dxpl_id)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+
+    H5_daos_blob_batch_begin(file);
+
+    if(H5_daos_tconv_convert(src_type_id, dst_type_id, nelmts, buf, bkg, dxpl_id) < 0)
+        D_DONE_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+
+    /* Always end the batch so it is flushed even if conversion failed */
+    if(H5_daos_blob_batch_end(file) < 0)
+        D_DONE_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write blobs");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_convert_to_file() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_convert_from_file
+ *
+ * Purpose:     Like H5_daos_tconv_convert, for conversions from a file
+ *              type to a memory type.  For variable length data the blobs
+ *              the conversion will read are prefetched as a batch first
+ *              instead of being read one at a time.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tconv_convert_from_file(H5_daos_file_t *file, hid_t src_type_id,
+    hid_t dst_type_id, size_t nelmts, void *buf, void *bkg, hid_t dxpl_id)
+{
+    hbool_t prefetched = FALSE;
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+
+    if(H5_daos_blob_prefetch(file, src_type_id, nelmts, buf, &prefetched) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't prefetch blobs");
+
+    if(H5_daos_tconv_convert(src_type_id, dst_type_id, nelmts, buf, bkg, dxpl_id) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+
+done:
+    if(prefetched)
+        H5_daos_blob_prefetch_release(file);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_convert_from_file() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_datatype_commit
@@ -546,7 +1141,7 @@ H5_daos_datatype_commit(void *_item,
      * rank. */
     if(name) {
         if(NULL == (target_obj = H5_daos_group_traverse(item, name, lcpl_id, int_req,
-                collective, &path_buf, &target_name, &target_name_len, &first_task,
+                collective, FALSE, &path_buf, &target_name, &target_name_len, &first_task,
                 &dep_task)))
             D_GOTO_ERROR(H5E_DATATYPE, H5E_BADITER, NULL, "can't traverse path");
 
@@ -986,7 +1581,7 @@ H5_daos_datatype_open(void *_item,
 
         /* Traverse the path */
         if(NULL == (target_obj = H5_daos_group_traverse(item, name, H5P_LINK_CREATE_DEFAULT,
-                int_req, collective, &path_buf, &target_name, &target_name_len, &first_task, &dep_task)))
+                int_req, collective, TRUE, &path_buf, &target_name, &target_name_len, &first_task, &dep_task)))
             D_GOTO_ERROR(H5E_DATATYPE, H5E_BADITER, NULL, "can't traverse path");
 
         /* Check for no target_name, in this case just return target_obj */
@@ -0,0 +1,243 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Implements a pool of reusable buffers, used for datatype
+ *          conversion and background buffers so that converted I/O does
+ *          not allocate and free large buffers for every chunk.  Typical
+ *          usage would be as follows:
+ *
+ *          1. Allocate a buffer with H5_daos_bufpool_malloc.  The request
+ *             is rounded up to a power of two size class and served from
+ *             the cached buffers of that class if there are any
+ *          2. Release the buffer with H5_daos_bufpool_free.  It is cached
+ *             for reuse unless that would take the total number of cached
+ *             bytes over the pool's limit, in which case it is freed
+ *          3. Free all cached buffers with H5_daos_bufpool_term when the
+ *             connector is terminated
+ *
+ *          Each buffer is preceded by a small header recording its size
+ *          class, so buffers from the pool must only be released with
+ *          H5_daos_bufpool_free, and H5_daos_bufpool_free must only be
+ *          passed buffers from the pool.  Requests larger than the largest
+ *          size class are allocated and freed directly.  The pool is
+ *          global and not thread safe.  It must only be used from the
+ *          thread that makes HDF5 API calls and progresses the task
+ *          scheduler, not from type conversion thread pool workers.
+ */
+
+#include "daos_vol.h"
+#include "daos_vol_err.h"
+#include "daos_vol_mem.h"
+#include "daos_vol_bufpool.h"
+
+/* Smallest size class is 2^H5_DAOS_BUFPOOL_MIN_CLASS bytes */
+#define H5_DAOS_BUFPOOL_MIN_CLASS 6
+
+/* Number of size classes.  The largest is 2^(MIN_CLASS + NCLASSES - 1)
+ * (1 GiB) bytes. */
+#define H5_DAOS_BUFPOOL_NCLASSES 25
+
+/* Size class for buffers that are not cached */
+#define H5_DAOS_BUFPOOL_NO_CLASS H5_DAOS_BUFPOOL_NCLASSES
+
+/* Header in front of each buffer.  The union keeps the buffer that follows
+ * it aligned for any type. */
+typedef union H5_daos_bufpool_hdr_t {
+    struct {
+        unsigned size_class;
+        union H5_daos_bufpool_hdr_t *next;
+    } s;
+    long double align_ld;
+    uint64_t align_u64;
+    void *align_p;
+} H5_daos_bufpool_hdr_t;
+
+/* Cached buffers of each size class, linked through their headers */
+static H5_daos_bufpool_hdr_t *H5_daos_bufpool_free_g[H5_DAOS_BUFPOOL_NCLASSES];
+
+/* Limit on and current number of bytes cached */
+static size_t H5_daos_bufpool_nbytes_max_g = H5_DAOS_BUFPOOL_SIZE_DEF;
+static size_t H5_daos_bufpool_nbytes_g = 0;
+
+/* Hit and miss counters */
+static uint64_t H5_daos_bufpool_nhits_g = 0;
+static uint64_t H5_daos_bufpool_nmisses_g = 0;
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bufpool_malloc
+ *
+ * Purpose:     Allocates a buffer of at least size bytes from the pool.
+ *              If clear is TRUE the buffer is zeroed.
+ *
+ * Return:      Success:        Pointer to the buffer
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5_daos_bufpool_malloc(size_t size, hbool_t clear)
+{
+    H5_daos_bufpool_hdr_t *hdr = NULL;
+    unsigned size_class = H5_DAOS_BUFPOOL_MIN_CLASS;
+    size_t alloc_size;
+
+    /* Find size class */
+    while(size_class < H5_DAOS_BUFPOOL_MIN_CLASS + H5_DAOS_BUFPOOL_NCLASSES
+            && ((size_t)1 << size_class) < size)
+        size_class++;
+    size_class -= H5_DAOS_BUFPOOL_MIN_CLASS;
+
+    if(size_class < H5_DAOS_BUFPOOL_NCLASSES) {
+        alloc_size = (size_t)1 << (size_class + H5_DAOS_BUFPOOL_MIN_CLASS);
+
+        /* Take a cached buffer if possible */
+        if(NULL != (hdr = H5_daos_bufpool_free_g[size_class])) {
+            H5_daos_bufpool_free_g[size_class] = hdr->s.next;
+            assert(H5_daos_bufpool_nbytes_g >= alloc_size);
+            H5_daos_bufpool_nbytes_g -= alloc_size;
+            H5_daos_bufpool_nhits_g++;
+            if(clear)
+                (void)memset(hdr + 1, 0, size);
+        } /* end if */
+    } /* end if */
+    else {
+        size_class = H5_DAOS_BUFPOOL_NO_CLASS;
+        alloc_size = size;
+    } /* end else */
+
+    /* Allocate a new buffer if necessary */
+    if(!hdr) {
+        H5_daos_bufpool_nmisses_g++;
+        if(NULL == (hdr = clear ? DV_calloc(sizeof(H5_daos_bufpool_hdr_t) + alloc_size)
+                : DV_malloc(sizeof(H5_daos_bufpool_hdr_t) + alloc_size)))
+            return NULL;
+    } /* end if */
+
+    hdr->s.size_class = size_class;
+    hdr->s.next = NULL;
+
+    return (void *)(hdr + 1);
+} /* end H5_daos_bufpool_malloc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bufpool_free
+ *
+ * Purpose:     Returns a buffer allocated by H5_daos_bufpool_malloc to
+ *              the pool, freeing it instead if the pool is full.  buf may
+ *              be NULL.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+void *
+H5_daos_bufpool_free(void *buf)
+{
+    H5_daos_bufpool_hdr_t *hdr;
+    size_t class_size;
+
+    if(!buf)
+        return NULL;
+
+    hdr = (H5_daos_bufpool_hdr_t *)buf - 1;
+
+    /* Free buffers that are too large to cache or that would take the pool
+     * over its limit, otherwise cache buffer */
+    if(hdr->s.size_class >= H5_DAOS_BUFPOOL_NCLASSES)
+        (void)DV_free(hdr);
+    else {
+        class_size = (size_t)1 << (hdr->s.size_class + H5_DAOS_BUFPOOL_MIN_CLASS);
+        if(H5_daos_bufpool_nbytes_g + class_size > H5_daos_bufpool_nbytes_max_g)
+            (void)DV_free(hdr);
+        else {
+            hdr->s.next = H5_daos_bufpool_free_g[hdr->s.size_class];
+            H5_daos_bufpool_free_g[hdr->s.size_class] = hdr;
+            H5_daos_bufpool_nbytes_g += class_size;
+        } /* end else */
+    } /* end else */
+
+    return NULL;
+} /* end H5_daos_bufpool_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bufpool_set_max
+ *
+ * Purpose:     Sets the maximum number of bytes the pool may cache.  Does
+ *              not free buffers already cached, those are released as
+ *              they are reused.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_bufpool_set_max(size_t nbytes_max)
+{
+    H5_daos_bufpool_nbytes_max_g = nbytes_max;
+
+    return;
+} /* end H5_daos_bufpool_set_max() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bufpool_get_stats
+ *
+ * Purpose:     Retrieves the number of allocations served from cached
+ *              buffers (hits), the number that required a new buffer
+ *              (misses) and the number of bytes currently cached.  Any
+ *              of the output pointers may be NULL.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_bufpool_get_stats(uint64_t *nhits, uint64_t *nmisses,
+    size_t *nbytes_cached)
+{
+    if(nhits)
+        *nhits = H5_daos_bufpool_nhits_g;
+    if(nmisses)
+        *nmisses = H5_daos_bufpool_nmisses_g;
+    if(nbytes_cached)
+        *nbytes_cached = H5_daos_bufpool_nbytes_g;
+
+    return;
+} /* end H5_daos_bufpool_get_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_bufpool_term
+ *
+ * Purpose:     Frees all buffers cached by the pool.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_bufpool_term(void)
+{
+    H5_daos_bufpool_hdr_t *hdr;
+    unsigned i;
+
+    for(i = 0; i < H5_DAOS_BUFPOOL_NCLASSES; i++)
+        while(NULL != (hdr = H5_daos_bufpool_free_g[i])) {
+            H5_daos_bufpool_free_g[i] = hdr->s.next;
+            (void)DV_free(hdr);
+        } /* end while */
+    H5_daos_bufpool_nbytes_g = 0;
+
+    return;
+} /* end H5_daos_bufpool_term() */
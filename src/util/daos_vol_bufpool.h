@@ -0,0 +1,46 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef DAOS_VOL_BUFPOOL_H_
+#define DAOS_VOL_BUFPOOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Allocates a buffer of at least size bytes, reusing a cached buffer if one
+ * is available.  If clear is TRUE the buffer is zeroed. */
+void *
+H5_daos_bufpool_malloc(size_t size, hbool_t clear);
+
+/* Returns a buffer allocated by H5_daos_bufpool_malloc to the pool, or
+ * frees it if the pool is full.  Always returns NULL. */
+void *
+H5_daos_bufpool_free(void *buf);
+
+/* Sets the maximum number of bytes the pool may cache */
+void
+H5_daos_bufpool_set_max(size_t nbytes_max);
+
+/* Retrieves the pool's hit and miss counters and the number of bytes
+ * currently cached */
+void
+H5_daos_bufpool_get_stats(uint64_t *nhits, uint64_t *nmisses,
+    size_t *nbytes_cached);
+
+/* Frees all buffers cached by the pool */
+void
+H5_daos_bufpool_term(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DAOS_VOL_BUFPOOL_H_ */
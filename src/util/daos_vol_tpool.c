@@ -0,0 +1,304 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Implements a pool of worker threads used to run CPU bound work
+ *          (such as datatype conversion) while the task scheduler keeps
+ *          DAOS busy.  Typical usage would be as follows:
+ *
+ *          1. Create a thread pool with H5_daos_tpool_create
+ *          2. From a task callback, fill in an H5_daos_tpool_job_t and
+ *             pass it to H5_daos_tpool_submit.  The job's func is run on
+ *             a worker thread, so it must not call into HDF5, DAOS or the
+ *             task scheduler, and must only touch memory owned by the job
+ *          3. H5_daos_progress calls H5_daos_tpool_progress, which runs
+ *             the comp callback of each finished job on the progressing
+ *             thread.  The comp callback may complete tasks, release
+ *             references and report errors as a task completion callback
+ *             would
+ *          4. Free the thread pool with H5_daos_tpool_free once all of its
+ *             jobs have completed
+ *
+ *          Finished jobs from all thread pools are kept on a single global
+ *          list so the progress function does not need to know about
+ *          individual pools.
+ */
+
+#include "daos_vol.h"
+#include "daos_vol_err.h"
+#include "daos_vol_mem.h"
+#include "daos_vol_tpool.h"
+
+/* Finished jobs, waiting for their completion callbacks to be run */
+static pthread_mutex_t H5_daos_tpool_done_mutex_g = PTHREAD_MUTEX_INITIALIZER;
+static H5_daos_tpool_job_t *H5_daos_tpool_done_head_g = NULL;
+static H5_daos_tpool_job_t *H5_daos_tpool_done_tail_g = NULL;
+
+/* Number of jobs submitted whose completion callbacks have not been run.
+ * Only accessed by the progressing thread. */
+static size_t H5_daos_tpool_njobs_g = 0;
+
+static void *H5_daos_tpool_worker(void *_tpool);
+static void H5_daos_tpool_shutdown(H5_daos_tpool_t *tpool, unsigned nthreads);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tpool_worker
+ *
+ * Purpose:     Main routine for thread pool worker threads.  Runs queued
+ *              jobs and moves them to the finished job list until the
+ *              pool is shut down and its queue is empty.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5_daos_tpool_worker(void *_tpool)
+{
+    H5_daos_tpool_t *tpool = (H5_daos_tpool_t *)_tpool;
+    H5_daos_tpool_job_t *job;
+
+    assert(tpool);
+
+    (void)pthread_mutex_lock(&tpool->mutex);
+    while(1) {
+        /* Wait for a job */
+        while(!tpool->head && !tpool->shutdown)
+            (void)pthread_cond_wait(&tpool->cond, &tpool->mutex);
+        if(!tpool->head)
+            break;
+
+        /* Take job from head of queue */
+        job = tpool->head;
+        if(NULL == (tpool->head = job->next))
+            tpool->tail = NULL;
+        (void)pthread_mutex_unlock(&tpool->mutex);
+
+        /* Run job */
+        job->ret = job->func(job->arg);
+        job->next = NULL;
+
+        /* Add job to tail of finished list */
+        (void)pthread_mutex_lock(&H5_daos_tpool_done_mutex_g);
+        if(H5_daos_tpool_done_tail_g)
+            H5_daos_tpool_done_tail_g->next = job;
+        else
+            H5_daos_tpool_done_head_g = job;
+        H5_daos_tpool_done_tail_g = job;
+        (void)pthread_mutex_unlock(&H5_daos_tpool_done_mutex_g);
+
+        (void)pthread_mutex_lock(&tpool->mutex);
+    } /* end while */
+    (void)pthread_mutex_unlock(&tpool->mutex);
+
+    return NULL;
+} /* end H5_daos_tpool_worker() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tpool_shutdown
+ *
+ * Purpose:     Tells the first nthreads worker threads of a thread pool
+ *              to exit once the queue is empty and waits for them.
+ *
+ * Return:      Nothing
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_tpool_shutdown(H5_daos_tpool_t *tpool, unsigned nthreads)
+{
+    unsigned i;
+
+    assert(tpool);
+
+    (void)pthread_mutex_lock(&tpool->mutex);
+    tpool->shutdown = TRUE;
+    (void)pthread_cond_broadcast(&tpool->cond);
+    (void)pthread_mutex_unlock(&tpool->mutex);
+
+    for(i = 0; i < nthreads; i++)
+        (void)pthread_join(tpool->threads[i], NULL);
+
+    return;
+} /* end H5_daos_tpool_shutdown() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tpool_create
+ *
+ * Purpose:     Creates a pool of nthreads worker threads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tpool_create(unsigned nthreads, H5_daos_tpool_t **tpool)
+{
+    H5_daos_tpool_t *pool = NULL;
+    hbool_t mutex_init = FALSE;
+    hbool_t cond_init = FALSE;
+    unsigned i = 0;
+    int ret;
+    herr_t ret_value = SUCCEED;
+
+    assert(nthreads > 0);
+    assert(tpool);
+
+    if(NULL == (pool = DV_calloc(sizeof(H5_daos_tpool_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread pool");
+    if(NULL == (pool->threads = DV_malloc(nthreads * sizeof(pthread_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate thread pool threads");
+
+    if(0 != (ret = pthread_mutex_init(&pool->mutex, NULL)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize thread pool mutex: %d", ret);
+    mutex_init = TRUE;
+    if(0 != (ret = pthread_cond_init(&pool->cond, NULL)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't initialize thread pool condition variable: %d", ret);
+    cond_init = TRUE;
+
+    /* Start worker threads */
+    for(i = 0; i < nthreads; i++)
+        if(0 != (ret = pthread_create(&pool->threads[i], NULL, H5_daos_tpool_worker, pool)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTCREATE, FAIL, "can't create thread pool worker thread: %d", ret);
+    pool->nthreads = nthreads;
+
+    *tpool = pool;
+
+done:
+    if(ret_value < 0 && pool) {
+        /* Stop the threads that were started */
+        if(i > 0)
+            H5_daos_tpool_shutdown(pool, i);
+        if(cond_init)
+            (void)pthread_cond_destroy(&pool->cond);
+        if(mutex_init)
+            (void)pthread_mutex_destroy(&pool->mutex);
+        DV_free(pool->threads);
+        DV_free(pool);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tpool_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tpool_free
+ *
+ * Purpose:     Waits for the worker threads to finish all queued jobs,
+ *              then frees the thread pool.  The completion callbacks of
+ *              the jobs are run by the next call to
+ *              H5_daos_tpool_progress.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tpool_free(H5_daos_tpool_t *tpool)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(tpool);
+
+    H5_daos_tpool_shutdown(tpool, tpool->nthreads);
+    assert(!tpool->head);
+
+    (void)pthread_cond_destroy(&tpool->cond);
+    (void)pthread_mutex_destroy(&tpool->mutex);
+    DV_free(tpool->threads);
+    DV_free(tpool);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tpool_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tpool_submit
+ *
+ * Purpose:     Adds a job to the tail of a thread pool's queue.  The job
+ *              must remain valid until its completion callback is run.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tpool_submit(H5_daos_tpool_t *tpool, H5_daos_tpool_job_t *job)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(tpool);
+    assert(job);
+    assert(job->func);
+    assert(job->comp);
+
+    job->next = NULL;
+
+    (void)pthread_mutex_lock(&tpool->mutex);
+    assert(!tpool->shutdown);
+    if(tpool->tail)
+        tpool->tail->next = job;
+    else
+        tpool->head = job;
+    tpool->tail = job;
+    (void)pthread_cond_signal(&tpool->cond);
+    (void)pthread_mutex_unlock(&tpool->mutex);
+
+    H5_daos_tpool_njobs_g++;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tpool_submit() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tpool_progress
+ *
+ * Purpose:     Runs the completion callbacks of all jobs that have
+ *              finished, in the order they finished.  Must only be called
+ *              from the thread that progresses the task scheduler.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tpool_progress(void)
+{
+    H5_daos_tpool_job_t *job;
+    H5_daos_tpool_job_t *next;
+    herr_t ret_value = SUCCEED;
+
+    /* Quick check for nothing in flight */
+    if(H5_daos_tpool_njobs_g == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Take the whole finished list */
+    (void)pthread_mutex_lock(&H5_daos_tpool_done_mutex_g);
+    job = H5_daos_tpool_done_head_g;
+    H5_daos_tpool_done_head_g = H5_daos_tpool_done_tail_g = NULL;
+    (void)pthread_mutex_unlock(&H5_daos_tpool_done_mutex_g);
+
+    /* Run completion callbacks.  Save next first since the callback may
+     * free the job. */
+    while(job) {
+        next = job->next;
+        assert(H5_daos_tpool_njobs_g > 0);
+        H5_daos_tpool_njobs_g--;
+        if(job->comp(job->arg, job->ret) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTOPERATE, FAIL, "thread pool job completion callback failed");
+        job = next;
+    } /* end while */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_tpool_progress() */
@@ -0,0 +1,65 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef DAOS_VOL_TPOOL_H_
+#define DAOS_VOL_TPOOL_H_
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Thread pool job.  func is run on a worker thread and must not call into
+ * HDF5 or DAOS.  comp is then run with func's return value by
+ * H5_daos_tpool_progress(), on the thread that progresses the task
+ * scheduler. */
+typedef struct H5_daos_tpool_job_t {
+    int (*func)(void *arg);
+    int (*comp)(void *arg, int ret);
+    void *arg;
+    int ret;
+    struct H5_daos_tpool_job_t *next;
+} H5_daos_tpool_job_t;
+
+/* Thread pool structure */
+typedef struct H5_daos_tpool_t {
+    pthread_t *threads;
+    unsigned nthreads;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    H5_daos_tpool_job_t *head;
+    H5_daos_tpool_job_t *tail;
+    hbool_t shutdown;
+} H5_daos_tpool_t;
+
+/* Creates a thread pool with nthreads worker threads */
+herr_t
+H5_daos_tpool_create(unsigned nthreads, H5_daos_tpool_t **tpool);
+
+/* Waits for the worker threads to finish all queued jobs then frees the
+ * thread pool */
+herr_t
+H5_daos_tpool_free(H5_daos_tpool_t *tpool);
+
+/* Queues a job to be run by the thread pool */
+herr_t
+H5_daos_tpool_submit(H5_daos_tpool_t *tpool, H5_daos_tpool_job_t *job);
+
+/* Runs the completion callbacks of all jobs that have finished, in any
+ * thread pool */
+herr_t
+H5_daos_tpool_progress(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DAOS_VOL_TPOOL_H_ */
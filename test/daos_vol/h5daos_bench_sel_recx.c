@@ -0,0 +1,187 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Microbenchmark comparing the selection iterator and the closed
+ *          form generator for converting regular hyperslab selections to
+ *          DAOS record lists.  Also checks that both produce the same
+ *          records.  Does not access DAOS.
+ *
+ *          Usage: h5daos_bench_sel_recx [niter]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define DEF_NITER               100
+#define MAX_NSEQ                (1024 * 1024)
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+typedef struct bench_case_t {
+    const char *name;
+    int rank;
+    hsize_t dims[3];
+    hsize_t start[3];
+    hsize_t stride[3];
+    hsize_t count[3];
+    hsize_t block[3];
+} bench_case_t;
+
+static const bench_case_t bench_cases[] = {
+    /* Every 4th row of a 3-D field */
+    {"every 4th row of 3-D field", 3, {64, 256, 256}, {0, 0, 0}, {1, 4, 1}, {64, 64, 1}, {1, 1, 256}},
+    /* Every other element of a 2-D field */
+    {"every other element of 2-D field", 2, {256, 1024, 0}, {0, 1, 0}, {1, 2, 0}, {256, 512, 0}, {1, 1, 0}},
+    /* 8x8 tiles separated by 8 elements */
+    {"8x8 tiles of 2-D field", 2, {1024, 1024, 0}, {0, 0, 0}, {16, 16, 0}, {64, 64, 0}, {8, 8, 0}},
+    /* Block of full planes, merged into a single sequence */
+    {"contiguous planes of 3-D field", 3, {64, 256, 256}, {8, 0, 0}, {1, 1, 1}, {1, 1, 1}, {32, 256, 256}},
+};
+
+int bench_sel_recx(const bench_case_t *bc, int niter, daos_recx_t *iter_recxs,
+    daos_recx_t *reg_recxs);
+
+/*
+ * Benchmark function
+ */
+int
+bench_sel_recx(const bench_case_t *bc, int niter, daos_recx_t *iter_recxs,
+    daos_recx_t *reg_recxs)
+{
+    hid_t space_id = -1;
+    size_t iter_nseq = 0;
+    size_t reg_nseq = 0;
+    double t_start;
+    double iter_time;
+    double reg_time;
+    int i;
+
+    TESTING(bc->name);
+
+    if((space_id = H5Screate_simple(bc->rank, bc->dims, NULL)) < 0)
+        TEST_ERROR
+    if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, bc->start, bc->stride, bc->count, bc->block) < 0)
+        TEST_ERROR
+
+    /* Check that both paths generate the same records */
+    if(H5daos_get_sel_recx_list(space_id, TRUE, iter_recxs, MAX_NSEQ, &iter_nseq) < 0)
+        TEST_ERROR
+    if(H5daos_get_sel_recx_list(space_id, FALSE, reg_recxs, MAX_NSEQ, &reg_nseq) < 0)
+        TEST_ERROR
+    if(iter_nseq != reg_nseq) {
+        H5_FAILED() AT()
+        printf("    number of sequences from iterator (%zu) does not match closed form (%zu)\n", iter_nseq, reg_nseq);
+        goto error;
+    } /* end if */
+    if(iter_nseq > MAX_NSEQ) {
+        H5_FAILED() AT()
+        printf("    too many sequences to compare\n");
+        goto error;
+    } /* end if */
+    if(memcmp(iter_recxs, reg_recxs, iter_nseq * sizeof(daos_recx_t))) {
+        H5_FAILED() AT()
+        printf("    records from iterator do not match closed form\n");
+        goto error;
+    } /* end if */
+
+    /* Time iterator path */
+    t_start = MPI_Wtime();
+    for(i = 0; i < niter; i++)
+        if(H5daos_get_sel_recx_list(space_id, TRUE, NULL, 0, &iter_nseq) < 0)
+            TEST_ERROR
+    iter_time = MPI_Wtime() - t_start;
+
+    /* Time closed form path */
+    t_start = MPI_Wtime();
+    for(i = 0; i < niter; i++)
+        if(H5daos_get_sel_recx_list(space_id, FALSE, NULL, 0, &reg_nseq) < 0)
+            TEST_ERROR
+    reg_time = MPI_Wtime() - t_start;
+
+    PASSED();
+    printf("    %zu sequences: iterator %.3f us, closed form %.3f us, speedup %.2fx\n",
+            iter_nseq, 1.0e6 * iter_time / niter, 1.0e6 * reg_time / niter,
+            reg_time > 0.0 ? iter_time / reg_time : 0.0);
+
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(space_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end bench_sel_recx() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    daos_recx_t *iter_recxs = NULL;
+    daos_recx_t *reg_recxs = NULL;
+    int     niter = DEF_NITER;
+    size_t  i;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    if(argc > 1 && (niter = atoi(argv[1])) <= 0) {
+        printf("usage: %s [niter]\n", argv[0]);
+        nerrors++;
+        goto error;
+    }
+
+    if(NULL == (iter_recxs = (daos_recx_t *)malloc(MAX_NSEQ * sizeof(daos_recx_t)))) {
+        nerrors++;
+        goto error;
+    }
+    if(NULL == (reg_recxs = (daos_recx_t *)malloc(MAX_NSEQ * sizeof(daos_recx_t)))) {
+        nerrors++;
+        goto error;
+    }
+
+    for(i = 0; i < sizeof(bench_cases) / sizeof(bench_cases[0]); i++)
+        nerrors += bench_sel_recx(&bench_cases[i], niter, iter_recxs, reg_recxs);
+
+error:
+    free(iter_recxs);
+    free(reg_recxs);
+
+    if (nerrors) goto done;
+
+    if (MAINPROCESS) puts("All selection conversion benchmarks passed");
+
+done:
+    MPI_Finalize();
+
+    return nerrors;
+} /* end main() */
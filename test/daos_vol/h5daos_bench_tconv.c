@@ -0,0 +1,343 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Microbenchmark comparing the throughput of the connector's
+ *          datatype conversion kernels with H5Tconvert.  Also checks that
+ *          both produce the same data.  Does not access DAOS.
+ *
+ *          Usage: h5daos_bench_tconv [niter]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define DEF_NITER               20
+#define NELMTS                  (1024 * 1024)
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+typedef struct bench_cmpd_t {
+    int a;
+    double b;
+    float c;
+    long long d;
+} bench_cmpd_t;
+
+typedef struct bench_cmpd_sub_t {
+    float c;
+    int a;
+} bench_cmpd_sub_t;
+
+typedef enum bench_type_t {
+    BENCH_DOUBLE,
+    BENCH_FLOAT,
+    BENCH_INT64,
+    BENCH_INT32,
+    BENCH_UINT64,
+    BENCH_UINT32,
+    BENCH_INT16,
+    BENCH_CMPD,
+    BENCH_CMPD_SUB
+} bench_type_t;
+
+typedef struct bench_case_t {
+    const char *name;
+    bench_type_t src_type;
+    bench_type_t dst_type;
+    hbool_t dst_swap;
+} bench_case_t;
+
+static const bench_case_t bench_cases[] = {
+    {"double -> float", BENCH_DOUBLE, BENCH_FLOAT, FALSE},
+    {"float -> double", BENCH_FLOAT, BENCH_DOUBLE, FALSE},
+    {"int64 -> int32", BENCH_INT64, BENCH_INT32, FALSE},
+    {"int32 -> int64", BENCH_INT32, BENCH_INT64, FALSE},
+    {"uint64 -> uint32", BENCH_UINT64, BENCH_UINT32, FALSE},
+    {"uint32 -> uint64", BENCH_UINT32, BENCH_UINT64, FALSE},
+    {"int16 byte swap", BENCH_INT16, BENCH_INT16, TRUE},
+    {"int32 byte swap", BENCH_INT32, BENCH_INT32, TRUE},
+    {"double byte swap", BENCH_DOUBLE, BENCH_DOUBLE, TRUE},
+    {"compound member subset", BENCH_CMPD, BENCH_CMPD_SUB, FALSE},
+};
+
+hid_t bench_create_type(bench_type_t type, hbool_t swap);
+void bench_fill(bench_type_t type, void *buf, size_t nelmts);
+int bench_tconv(const bench_case_t *bc, int niter, void *src_buf,
+    void *h5_buf, void *kernel_buf, void *bkg_buf, size_t buf_size);
+
+/*
+ * Creates the datatype for a benchmark type, in the opposite byte order to
+ * native if swap is TRUE
+ */
+hid_t
+bench_create_type(bench_type_t type, hbool_t swap)
+{
+    hid_t type_id = -1;
+
+    switch(type) {
+        case BENCH_DOUBLE:
+            type_id = H5Tcopy(H5T_NATIVE_DOUBLE);
+            break;
+        case BENCH_FLOAT:
+            type_id = H5Tcopy(H5T_NATIVE_FLOAT);
+            break;
+        case BENCH_INT64:
+            type_id = H5Tcopy(H5T_NATIVE_INT64);
+            break;
+        case BENCH_INT32:
+            type_id = H5Tcopy(H5T_NATIVE_INT32);
+            break;
+        case BENCH_UINT64:
+            type_id = H5Tcopy(H5T_NATIVE_UINT64);
+            break;
+        case BENCH_UINT32:
+            type_id = H5Tcopy(H5T_NATIVE_UINT32);
+            break;
+        case BENCH_INT16:
+            type_id = H5Tcopy(H5T_NATIVE_INT16);
+            break;
+        case BENCH_CMPD:
+            if((type_id = H5Tcreate(H5T_COMPOUND, sizeof(bench_cmpd_t))) < 0)
+                return -1;
+            if(H5Tinsert(type_id, "a", HOFFSET(bench_cmpd_t, a), H5T_NATIVE_INT) < 0
+                    || H5Tinsert(type_id, "b", HOFFSET(bench_cmpd_t, b), H5T_NATIVE_DOUBLE) < 0
+                    || H5Tinsert(type_id, "c", HOFFSET(bench_cmpd_t, c), H5T_NATIVE_FLOAT) < 0
+                    || H5Tinsert(type_id, "d", HOFFSET(bench_cmpd_t, d), H5T_NATIVE_LLONG) < 0) {
+                H5Tclose(type_id);
+                return -1;
+            }
+            break;
+        case BENCH_CMPD_SUB:
+            if((type_id = H5Tcreate(H5T_COMPOUND, sizeof(bench_cmpd_sub_t))) < 0)
+                return -1;
+            if(H5Tinsert(type_id, "c", HOFFSET(bench_cmpd_sub_t, c), H5T_NATIVE_FLOAT) < 0
+                    || H5Tinsert(type_id, "a", HOFFSET(bench_cmpd_sub_t, a), H5T_NATIVE_INT) < 0) {
+                H5Tclose(type_id);
+                return -1;
+            }
+            break;
+        default:
+            return -1;
+    }
+
+    if(type_id >= 0 && swap)
+        if(H5Tset_order(type_id, H5Tget_order(type_id) == H5T_ORDER_LE ? H5T_ORDER_BE : H5T_ORDER_LE) < 0) {
+            H5Tclose(type_id);
+            return -1;
+        }
+
+    return type_id;
+} /* end bench_create_type() */
+
+/*
+ * Fills a buffer with values of a benchmark type, including values out of
+ * range of the smaller types
+ */
+void
+bench_fill(bench_type_t type, void *buf, size_t nelmts)
+{
+    unsigned long long r = 0x9e3779b97f4a7c15ULL;
+    size_t i;
+
+    for(i = 0; i < nelmts; i++) {
+        r = r * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        switch(type) {
+            case BENCH_DOUBLE:
+                ((double *)buf)[i] = (double)(long long)r * 1.0e20;
+                break;
+            case BENCH_FLOAT:
+                ((float *)buf)[i] = (float)(long long)r * 1.0e-10f;
+                break;
+            case BENCH_INT64:
+                ((int64_t *)buf)[i] = (i % 2) ? (int64_t)r : (int64_t)(r >> 36) - (INT64_C(1) << 27);
+                break;
+            case BENCH_INT32:
+                ((int32_t *)buf)[i] = (int32_t)(r >> 32);
+                break;
+            case BENCH_UINT64:
+                ((uint64_t *)buf)[i] = (i % 2) ? (uint64_t)r : (uint64_t)(r >> 35);
+                break;
+            case BENCH_UINT32:
+                ((uint32_t *)buf)[i] = (uint32_t)(r >> 32);
+                break;
+            case BENCH_INT16:
+                ((int16_t *)buf)[i] = (int16_t)(r >> 48);
+                break;
+            case BENCH_CMPD:
+                memset(&((bench_cmpd_t *)buf)[i], 0, sizeof(bench_cmpd_t));
+                ((bench_cmpd_t *)buf)[i].a = (int)(r >> 33);
+                ((bench_cmpd_t *)buf)[i].b = (double)r;
+                ((bench_cmpd_t *)buf)[i].c = (float)(r >> 40);
+                ((bench_cmpd_t *)buf)[i].d = (long long)r;
+                break;
+            case BENCH_CMPD_SUB:
+            default:
+                break;
+        }
+    }
+
+    return;
+} /* end bench_fill() */
+
+/*
+ * Benchmark function
+ */
+int
+bench_tconv(const bench_case_t *bc, int niter, void *src_buf, void *h5_buf,
+    void *kernel_buf, void *bkg_buf, size_t buf_size)
+{
+    hid_t src_type_id = -1;
+    hid_t dst_type_id = -1;
+    size_t src_size;
+    size_t dst_size;
+    hbool_t found = FALSE;
+    double t_start;
+    double h5_time = 0.0;
+    double kernel_time = 0.0;
+    int i;
+
+    TESTING(bc->name);
+
+    if((src_type_id = bench_create_type(bc->src_type, FALSE)) < 0)
+        TEST_ERROR
+    if((dst_type_id = bench_create_type(bc->dst_type, bc->dst_swap)) < 0)
+        TEST_ERROR
+    if((src_size = H5Tget_size(src_type_id)) == 0)
+        TEST_ERROR
+    if((dst_size = H5Tget_size(dst_type_id)) == 0)
+        TEST_ERROR
+    if(NELMTS * (src_size > dst_size ? src_size : dst_size) > buf_size)
+        TEST_ERROR
+
+    bench_fill(bc->src_type, src_buf, NELMTS);
+
+    /* Check that a kernel exists and produces the same data as HDF5 */
+    memcpy(h5_buf, src_buf, NELMTS * src_size);
+    memset(bkg_buf, 0, NELMTS * dst_size);
+    if(H5Tconvert(src_type_id, dst_type_id, NELMTS, h5_buf, bkg_buf, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    memcpy(kernel_buf, src_buf, NELMTS * src_size);
+    if(H5daos_tconv_kernel_convert(src_type_id, dst_type_id, NELMTS, kernel_buf, &found) < 0)
+        TEST_ERROR
+    if(!found) {
+        H5_FAILED() AT()
+        printf("    no conversion kernel found\n");
+        goto error;
+    }
+    if(memcmp(h5_buf, kernel_buf, NELMTS * dst_size)) {
+        H5_FAILED() AT()
+        printf("    data converted by kernel does not match H5Tconvert\n");
+        goto error;
+    }
+
+    /* Time both paths.  Restoring the source data is not timed. */
+    for(i = 0; i < niter; i++) {
+        memcpy(h5_buf, src_buf, NELMTS * src_size);
+        t_start = MPI_Wtime();
+        if(H5Tconvert(src_type_id, dst_type_id, NELMTS, h5_buf, bkg_buf, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        h5_time += MPI_Wtime() - t_start;
+
+        memcpy(kernel_buf, src_buf, NELMTS * src_size);
+        t_start = MPI_Wtime();
+        if(H5daos_tconv_kernel_convert(src_type_id, dst_type_id, NELMTS, kernel_buf, &found) < 0)
+            TEST_ERROR
+        kernel_time += MPI_Wtime() - t_start;
+    }
+
+    PASSED();
+    printf("    %d elements: H5Tconvert %.1f MB/s, kernel %.1f MB/s, speedup %.2fx\n",
+            NELMTS, h5_time > 0.0 ? (double)niter * NELMTS * src_size / h5_time / 1.0e6 : 0.0,
+            kernel_time > 0.0 ? (double)niter * NELMTS * src_size / kernel_time / 1.0e6 : 0.0,
+            kernel_time > 0.0 ? h5_time / kernel_time : 0.0);
+
+    if(H5Tclose(src_type_id) < 0)
+        TEST_ERROR
+    if(H5Tclose(dst_type_id) < 0)
+        TEST_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(src_type_id);
+        H5Tclose(dst_type_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end bench_tconv() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    void   *src_buf = NULL;
+    void   *h5_buf = NULL;
+    void   *kernel_buf = NULL;
+    void   *bkg_buf = NULL;
+    size_t  buf_size = NELMTS * sizeof(bench_cmpd_t);
+    int     niter = DEF_NITER;
+    size_t  i;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    if(argc > 1 && (niter = atoi(argv[1])) <= 0) {
+        printf("usage: %s [niter]\n", argv[0]);
+        nerrors++;
+        goto error;
+    }
+
+    if(NULL == (src_buf = malloc(buf_size))
+            || NULL == (h5_buf = malloc(buf_size))
+            || NULL == (kernel_buf = malloc(buf_size))
+            || NULL == (bkg_buf = malloc(buf_size))) {
+        nerrors++;
+        goto error;
+    }
+
+    for(i = 0; i < sizeof(bench_cases) / sizeof(bench_cases[0]); i++)
+        nerrors += bench_tconv(&bench_cases[i], niter, src_buf, h5_buf, kernel_buf, bkg_buf, buf_size);
+
+error:
+    free(src_buf);
+    free(h5_buf);
+    free(kernel_buf);
+    free(bkg_buf);
+
+    if (nerrors) goto done;
+
+    if (MAINPROCESS) puts("All datatype conversion benchmarks passed");
+
+done:
+    MPI_Finalize();
+
+    return nerrors;
+} /* end main() */
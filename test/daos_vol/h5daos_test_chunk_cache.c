@@ -0,0 +1,297 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests the dataset chunk cache in the DAOS VOL connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_chunk_cache.h5"
+
+#define DSET_NAME               "cached_dset"
+#define NROWS                   40
+#define NCOLS                   30
+#define CHUNK_NROWS             8
+#define CHUNK_NCOLS             8
+#define FILL_VALUE              -7
+
+/* Room for one row of chunks */
+#define CACHE_NBYTES            (((NCOLS + CHUNK_NCOLS - 1) / CHUNK_NCOLS) * CHUNK_NROWS * CHUNK_NCOLS * sizeof(int))
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_chunk_cache(hid_t fapl_id);
+
+/*
+ * Test function.  Writes every other row of the dataset one row at a time
+ * through the chunk cache, so chunks are partially written and evicted, and
+ * checks the data read back through the cache (with and without type
+ * conversion and bypassing the cache), through a second handle without a
+ * cache after flushing the file, and after reopening without a cache.
+ */
+int
+test_chunk_cache(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t dset_id = -1;
+    hid_t dset2_id = -1;
+    hid_t dcpl_id = -1;
+    hid_t dapl_id = -1;
+    hid_t space_id = -1;
+    hid_t mem_space_id = -1;
+    hsize_t dims[2] = {NROWS, NCOLS};
+    hsize_t chunk_dims[2] = {CHUNK_NROWS, CHUNK_NCOLS};
+    hsize_t start[2] = {0, 0};
+    hsize_t count[2] = {1, NCOLS};
+    size_t cache_nbytes = 0;
+    int fill_value = FILL_VALUE;
+    int wbuf[NROWS][NCOLS];
+    int exp_buf[NROWS][NCOLS];
+    int rbuf[NROWS][NCOLS];
+    long long rbuf_ll[NCOLS];
+    int i, j;
+
+    /* Initialize write buffer and expected data */
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++) {
+            wbuf[i][j] = i * NCOLS + j;
+            exp_buf[i][j] = (i % 2) ? FILL_VALUE : wbuf[i][j];
+        } /* end for */
+
+    /* Create dataspaces */
+    if((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if((mem_space_id = H5Screate_simple(1, &count[1], NULL)) < 0)
+        TEST_ERROR
+
+    /* Create DCPL */
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR
+    if(H5Pset_fill_value(dcpl_id, H5T_NATIVE_INT, &fill_value) < 0)
+        TEST_ERROR
+
+    /* Create DAPL with chunk cache */
+    if((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR
+    if(H5daos_set_chunk_cache(dapl_id, CACHE_NBYTES) < 0)
+        TEST_ERROR
+    if(H5daos_get_chunk_cache(dapl_id, &cache_nbytes) < 0)
+        TEST_ERROR
+    if(cache_nbytes != CACHE_NBYTES) {
+        H5_FAILED() AT()
+        printf("    chunk cache size (%zu) does not match size set (%zu)\n", cache_nbytes, (size_t)CACHE_NBYTES);
+        goto error;
+    } /* end if */
+
+    /* Create file and dataset */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, dapl_id)) < 0)
+        TEST_ERROR
+
+    /* Write every other row, one at a time */
+    for(i = 0; i < NROWS; i += 2) {
+        start[0] = (hsize_t)i;
+        if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if(H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, space_id, H5P_DEFAULT, wbuf[i]) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    /* Read each row back through the cache, with type conversion */
+    for(i = 0; i < NROWS; i++) {
+        start[0] = (hsize_t)i;
+        if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        memset(rbuf_ll, 0, sizeof(rbuf_ll));
+        if(H5Dread(dset_id, H5T_NATIVE_LLONG, mem_space_id, space_id, H5P_DEFAULT, rbuf_ll) < 0)
+            TEST_ERROR
+        for(j = 0; j < NCOLS; j++)
+            if(rbuf_ll[j] != (long long)exp_buf[i][j]) {
+                H5_FAILED() AT()
+                printf("    cached data read (%lld) at [%d][%d] does not match expected (%d)\n", rbuf_ll[j], i, j, exp_buf[i][j]);
+                goto error;
+            } /* end if */
+    } /* end for */
+
+    /* Write the last row again, then read the whole dataset, which is too
+     * large for the cache, so the cache is written back and bypassed */
+    start[0] = NROWS - 1;
+    if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, space_id, H5P_DEFAULT, wbuf[NROWS - 1]) < 0)
+        TEST_ERROR
+    for(j = 0; j < NCOLS; j++)
+        exp_buf[NROWS - 1][j] = wbuf[NROWS - 1][j];
+    if(H5Sselect_all(space_id) < 0)
+        TEST_ERROR
+    memset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++)
+            if(rbuf[i][j] != exp_buf[i][j]) {
+                H5_FAILED() AT()
+                printf("    data read bypassing cache (%d) at [%d][%d] does not match expected (%d)\n", rbuf[i][j], i, j, exp_buf[i][j]);
+                goto error;
+            } /* end if */
+
+    /* Write a row and flush the dataset */
+    start[0] = 1;
+    if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, space_id, H5P_DEFAULT, wbuf[1]) < 0)
+        TEST_ERROR
+    for(j = 0; j < NCOLS; j++)
+        exp_buf[1][j] = wbuf[1][j];
+    if(H5Dflush(dset_id) < 0)
+        TEST_ERROR
+
+    /* Write a row and flush the file, then read the row through a second
+     * dataset handle without a cache while the first is still open */
+    start[0] = 5;
+    if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, space_id, H5P_DEFAULT, wbuf[5]) < 0)
+        TEST_ERROR
+    for(j = 0; j < NCOLS; j++)
+        exp_buf[5][j] = wbuf[5][j];
+    if(H5Fflush(file_id, H5F_SCOPE_LOCAL) < 0)
+        TEST_ERROR
+    if((dset2_id = H5Dopen2(file_id, DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    memset(rbuf_ll, 0, sizeof(rbuf_ll));
+    if(H5Dread(dset2_id, H5T_NATIVE_LLONG, mem_space_id, space_id, H5P_DEFAULT, rbuf_ll) < 0)
+        TEST_ERROR
+    for(j = 0; j < NCOLS; j++)
+        if(rbuf_ll[j] != (long long)exp_buf[5][j]) {
+            H5_FAILED() AT()
+            printf("    data read after file flush (%lld) at [5][%d] does not match expected (%d)\n", rbuf_ll[j], j, exp_buf[5][j]);
+            goto error;
+        } /* end if */
+    if(H5Dclose(dset2_id) < 0)
+        TEST_ERROR
+    dset2_id = -1;
+
+    /* Write another row, then close and reopen dataset without a cache */
+    start[0] = 3;
+    if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, space_id, H5P_DEFAULT, wbuf[3]) < 0)
+        TEST_ERROR
+    for(j = 0; j < NCOLS; j++)
+        exp_buf[3][j] = wbuf[3][j];
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dopen2(file_id, DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Read data and verify */
+    memset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++)
+            if(rbuf[i][j] != exp_buf[i][j]) {
+                H5_FAILED() AT()
+                printf("    data read (%d) at [%d][%d] does not match expected (%d)\n", rbuf[i][j], i, j, exp_buf[i][j]);
+                goto error;
+            } /* end if */
+
+    /* Close */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dapl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(mem_space_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+        H5Dclose(dset2_id);
+        H5Fclose(file_id);
+        H5Pclose(dapl_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mem_space_id);
+        H5Sclose(space_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_chunk_cache() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("dataset chunk cache");
+    nerrors += test_chunk_cache(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS chunk cache tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
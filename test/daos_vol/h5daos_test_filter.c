@@ -0,0 +1,390 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests filtered (compressed) chunked datasets in the DAOS VOL
+ *          connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_filter.h5"
+
+#define DSET_NAME               "filtered_dset"
+#define NROWS                   40
+#define NCOLS                   30
+#define CHUNK_NROWS             16
+#define CHUNK_NCOLS             16
+#define FILL_VALUE              -7
+#define DEFLATE_LEVEL           6
+#define LEGACY_DSET_NAME        "legacy_dset"
+#define LEGACY_VL_DSET_NAME     "legacy_vl_dset"
+#define LEGACY_VL_NELMTS        4
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_filter(hid_t fapl_id, hbool_t write_all);
+int test_legacy_filter(hid_t fapl_id);
+
+/*
+ * Test function.  Writes the whole dataset (write_all) or a hyperslab of it
+ * (which requires read-modify-write of partially written chunks), then checks
+ * the data in the file with and without type conversion, after reopening.
+ */
+int
+test_filter(hid_t fapl_id, hbool_t write_all)
+{
+    hid_t file_id = -1;
+    hid_t dset_id = -1;
+    hid_t dcpl_id = -1;
+    hid_t space_id = -1;
+    hid_t mem_space_id = -1;
+    hsize_t dims[2] = {NROWS, NCOLS};
+    hsize_t chunk_dims[2] = {CHUNK_NROWS, CHUNK_NCOLS};
+    hsize_t start[2] = {3, 5};
+    hsize_t count[2] = {NROWS - 10, NCOLS - 12};
+    hsize_t mem_dims[2];
+    unsigned deflate_cd[1] = {DEFLATE_LEVEL};
+    int fill_value = FILL_VALUE;
+    int wbuf[NROWS][NCOLS];
+    int exp_buf[NROWS][NCOLS];
+    int rbuf[NROWS][NCOLS];
+    long long rbuf_ll[NROWS][NCOLS];
+    int i, j;
+
+    /* Initialize write buffer with compressible data, and expected data */
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++) {
+            wbuf[i][j] = (i * NCOLS + j) / 5;
+            if(write_all || ((hsize_t)i >= start[0] && (hsize_t)i < start[0] + count[0]
+                    && (hsize_t)j >= start[1] && (hsize_t)j < start[1] + count[1]))
+                exp_buf[i][j] = wbuf[i][j];
+            else
+                exp_buf[i][j] = FILL_VALUE;
+        } /* end for */
+
+    /* Create dataspace */
+    if((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+
+    /* Create DCPL with shuffle, optional deflate (available if the connector
+     * was built with zlib), and fletcher32 */
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR
+    if(H5Pset_fill_value(dcpl_id, H5T_NATIVE_INT, &fill_value) < 0)
+        TEST_ERROR
+    if(H5Pset_shuffle(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Pset_filter(dcpl_id, H5Z_FILTER_DEFLATE, H5Z_FLAG_OPTIONAL, 1, deflate_cd) < 0)
+        TEST_ERROR
+    if(H5Pset_fletcher32(dcpl_id) < 0)
+        TEST_ERROR
+
+    /* Create file and dataset */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write data */
+    if(write_all) {
+        if(H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR
+    } /* end if */
+    else {
+        /* Write the same hyperslab from the memory buffer, in two parts so
+         * the second write modifies chunks written by the first */
+        mem_dims[0] = NROWS;
+        mem_dims[1] = NCOLS;
+        if((mem_space_id = H5Screate_simple(2, mem_dims, NULL)) < 0)
+            TEST_ERROR
+        count[1] /= 2;
+        if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if(H5Sselect_hyperslab(mem_space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if(H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, space_id, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR
+        start[1] += count[1];
+        count[1] = (NCOLS - 12) - count[1];
+        if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if(H5Sselect_hyperslab(mem_space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        if(H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, space_id, H5P_DEFAULT, wbuf) < 0)
+            TEST_ERROR
+        if(H5Sclose(mem_space_id) < 0)
+            TEST_ERROR
+        mem_space_id = -1;
+        if(H5Sselect_all(space_id) < 0)
+            TEST_ERROR
+    } /* end else */
+
+    /* Close and reopen dataset */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dopen2(file_id, DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Read data and verify */
+    memset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++)
+            if(rbuf[i][j] != exp_buf[i][j]) {
+                H5_FAILED() AT()
+                printf("    data read (%d) at [%d][%d] does not match expected (%d)\n", rbuf[i][j], i, j, exp_buf[i][j]);
+                goto error;
+            } /* end if */
+
+    /* Read data with type conversion and verify */
+    memset(rbuf_ll, 0, sizeof(rbuf_ll));
+    if(H5Dread(dset_id, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf_ll) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++)
+            if(rbuf_ll[i][j] != (long long)exp_buf[i][j]) {
+                H5_FAILED() AT()
+                printf("    converted data read (%lld) at [%d][%d] does not match expected (%d)\n", rbuf_ll[i][j], i, j, exp_buf[i][j]);
+                goto error;
+            } /* end if */
+
+    /* Close */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+        H5Sclose(mem_space_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_filter() */
+
+/*
+ * Test function.  Creates datasets in the chunk format used before filters
+ * were supported, where the filters in the DCPL are ignored and chunks are
+ * stored as arrays, including one with a variable-length type.  Checks that
+ * the data can be read after reopening the file.
+ */
+int
+test_legacy_filter(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t dset_id = -1;
+    hid_t dcpl_id = -1;
+    hid_t space_id = -1;
+    hid_t vl_space_id = -1;
+    hid_t str_type_id = -1;
+    hsize_t dims[2] = {NROWS, NCOLS};
+    hsize_t chunk_dims[2] = {CHUNK_NROWS, CHUNK_NCOLS};
+    hsize_t vl_dims[1] = {LEGACY_VL_NELMTS};
+    hsize_t vl_chunk_dims[1] = {LEGACY_VL_NELMTS / 2};
+    const char *vl_wbuf[LEGACY_VL_NELMTS] = {"alpha", "beta", "", "delta"};
+    char *vl_rbuf[LEGACY_VL_NELMTS] = {NULL, NULL, NULL, NULL};
+    int wbuf[NROWS][NCOLS];
+    int rbuf[NROWS][NCOLS];
+    int i, j;
+
+    /* Initialize write buffer */
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++)
+            wbuf[i][j] = i * NCOLS + j;
+
+    /* Create dataspaces and string type */
+    if((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if((vl_space_id = H5Screate_simple(1, vl_dims, NULL)) < 0)
+        TEST_ERROR
+    if((str_type_id = H5Tcopy(H5T_C_S1)) < 0)
+        TEST_ERROR
+    if(H5Tset_size(str_type_id, H5T_VARIABLE) < 0)
+        TEST_ERROR
+
+    /* Create DCPL with filters in the legacy chunk format */
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR
+    if(H5Pset_shuffle(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Pset_fletcher32(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5daos_set_legacy_chunk_format(dcpl_id, TRUE) < 0)
+        TEST_ERROR
+
+    /* Create file and datasets and write data */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, LEGACY_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = -1;
+
+    if(H5Pset_chunk(dcpl_id, 1, vl_chunk_dims) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, LEGACY_VL_DSET_NAME, str_type_id, vl_space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, str_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, vl_wbuf) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = -1;
+
+    /* Close and reopen file */
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if((file_id = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+
+    /* Read data and verify */
+    if((dset_id = H5Dopen2(file_id, LEGACY_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    memset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++)
+            if(rbuf[i][j] != wbuf[i][j]) {
+                H5_FAILED() AT()
+                printf("    data read (%d) at [%d][%d] does not match expected (%d)\n", rbuf[i][j], i, j, wbuf[i][j]);
+                goto error;
+            } /* end if */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = -1;
+
+    if((dset_id = H5Dopen2(file_id, LEGACY_VL_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dread(dset_id, str_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, vl_rbuf) < 0)
+        TEST_ERROR
+    for(i = 0; i < LEGACY_VL_NELMTS; i++)
+        if(!vl_rbuf[i] || strcmp(vl_rbuf[i], vl_wbuf[i])) {
+            H5_FAILED() AT()
+            printf("    string read (%s) at [%d] does not match expected (%s)\n", vl_rbuf[i] ? vl_rbuf[i] : "NULL", i, vl_wbuf[i]);
+            goto error;
+        } /* end if */
+    if(H5Dvlen_reclaim(str_type_id, vl_space_id, H5P_DEFAULT, vl_rbuf) < 0)
+        TEST_ERROR
+    memset(vl_rbuf, 0, sizeof(vl_rbuf));
+
+    /* Close */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Tclose(str_type_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(vl_space_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dvlen_reclaim(str_type_id, vl_space_id, H5P_DEFAULT, vl_rbuf);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Tclose(str_type_id);
+        H5Sclose(vl_space_id);
+        H5Sclose(space_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_legacy_filter() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("filtered dataset, full write");
+    nerrors += test_filter(fapl_id, TRUE);
+
+    TESTING("filtered dataset, partial chunk writes");
+    nerrors += test_filter(fapl_id, FALSE);
+
+    TESTING("filtered DCPL, legacy chunk format");
+    nerrors += test_legacy_filter(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS filter tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
@@ -32,6 +32,8 @@
 #define NUMB_KEYS               4       /* Don't set this too high because this test uses linear search */
 #define LARGE_NUMB_KEYS         1024
 #define LARGE_NUMB_MAPS         128
+#define MULTI_NUMB_KEYS         2500
+#define ORDERED_NUMB_KEYS       200
 
 #define MAP_INT_INT_NAME        "map_int_int"
 #define MAP_ENUM_ENUM_NAME      "map_enum_enum"
@@ -44,6 +46,13 @@
 #define MAP_VL_TCONV1_NAME      "map_vl_tconv1"
 #define MAP_VL_TCONV2_NAME      "map_vl_tconv2"
 #define MAP_MANY_ENTRIES_NAME   "map_many_entries"
+#define MAP_MULTI_KEY_NAME      "map_multi_key"
+#define MAP_KEY_COUNT_NAME      "map_key_count"
+#define MAP_ITERATE_KV_NAME     "map_iterate_kv"
+#define MAP_ORDERED_KEYS_NAME   "map_ordered_keys"
+#define MAP_BLOOM_NAME          "map_bloom"
+#define MAP_BLOOM_NKEYS         50
+#define MAP_BLOOM_HANDLES_NAME  "map_bloom_handles"
 #define MAP_NONEXISTENT_MAP     "map_nonexistent"
 
 #define CPTR(VAR,CONST) ((VAR)=(CONST),&(VAR))
@@ -3933,6 +3942,755 @@ error:
     return ++nerrors;
 } /* end test_many_maps() */
 
+/*
+ * Tests writing and reading many entries with H5daos_map_put_multi() and
+ * H5daos_map_get_multi().  Uses more keys than are in flight at once so
+ * the I/O is split over several windows.
+ */
+static int
+test_multi_key(hid_t file_id)
+{
+    hid_t map_id = -1;
+    int *keys = NULL;
+    int *vals = NULL;
+    long long *ll_vals = NULL;
+    int val;
+    int i;
+
+    TESTING("multi-key map put and get")
+
+    if(NULL == (keys = (int *)malloc(MULTI_NUMB_KEYS * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (vals = (int *)malloc(MULTI_NUMB_KEYS * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (ll_vals = (long long *)malloc(MULTI_NUMB_KEYS * sizeof(long long))))
+        TEST_ERROR
+
+    for(i = 0; i < MULTI_NUMB_KEYS; i++) {
+        keys[i] = i * 7 - MULTI_NUMB_KEYS;
+        vals[i] = rand();
+    } /* end for */
+
+    if((map_id = H5Mcreate(file_id, MAP_MULTI_KEY_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT,
+            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write all entries in one call */
+    if(H5daos_map_put_multi(map_id, MULTI_NUMB_KEYS, H5T_NATIVE_INT, keys,
+            H5T_NATIVE_INT, vals, H5P_DEFAULT) < 0) {
+        H5_FAILED(); AT();
+        printf("     failed to put multiple keys\n");
+        goto error;
+    } /* end if */
+
+    /* Spot check with H5Mget() */
+    for(i = 0; i < MULTI_NUMB_KEYS; i += 97) {
+        if(H5Mget(map_id, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &val, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if(val != vals[i]) {
+            H5_FAILED(); AT();
+            printf("     incorrect value returned for key %d: %d expected: %d\n", keys[i], val, vals[i]);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Read all entries back in one call, with type conversion */
+    if(H5daos_map_get_multi(map_id, MULTI_NUMB_KEYS, H5T_NATIVE_INT, keys,
+            H5T_NATIVE_LLONG, ll_vals, H5P_DEFAULT) < 0) {
+        H5_FAILED(); AT();
+        printf("     failed to get multiple keys\n");
+        goto error;
+    } /* end if */
+    for(i = 0; i < MULTI_NUMB_KEYS; i++)
+        if(ll_vals[i] != (long long)vals[i]) {
+            H5_FAILED(); AT();
+            printf("     incorrect value returned for key %d: %lld expected: %d\n", keys[i], ll_vals[i], vals[i]);
+            goto error;
+        } /* end if */
+
+    if(H5Mclose(map_id) < 0)
+        TEST_ERROR
+
+    free(keys);
+    free(vals);
+    free(ll_vals);
+
+    PASSED(); fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Mclose(map_id);
+    } H5E_END_TRY;
+    free(keys);
+    free(vals);
+    free(ll_vals);
+
+    return 1;
+} /* end test_multi_key() */
+
+/*
+ * Tests a map that keeps a persistent count of its keys
+ */
+static int
+test_key_count(hid_t file_id)
+{
+    hid_t mcpl_id = -1, mcpl_id2 = -1;
+    hid_t map_id = -1;
+    int keys[NUMB_KEYS + 1];
+    int vals[NUMB_KEYS + 1];
+    hsize_t count;
+    hbool_t track_key_count;
+    int i;
+
+    TESTING("map with persistent key count")
+
+    /* The last key repeats the first so it must only be counted once */
+    for(i = 0; i < NUMB_KEYS; i++) {
+        keys[i] = random_base + i;
+        vals[i] = rand();
+    } /* end for */
+    keys[NUMB_KEYS] = keys[0];
+    vals[NUMB_KEYS] = rand();
+
+    if((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0)
+        TEST_ERROR
+    if(H5daos_get_map_key_count(mcpl_id, &track_key_count) < 0)
+        TEST_ERROR
+    if(track_key_count) {
+        H5_FAILED(); AT();
+        printf("     key count enabled by default\n");
+        goto error;
+    } /* end if */
+    if(H5daos_set_map_key_count(mcpl_id, TRUE) < 0)
+        TEST_ERROR
+
+    if((map_id = H5Mcreate(file_id, MAP_KEY_COUNT_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT,
+            H5P_DEFAULT, mcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write all keys, including the repeated one */
+    if(H5daos_map_put_multi(map_id, NUMB_KEYS + 1, H5T_NATIVE_INT, keys,
+            H5T_NATIVE_INT, vals, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5Mget_count(map_id, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(count != NUMB_KEYS) {
+        H5_FAILED(); AT();
+        printf("     incorrect key count after put: %llu expected: %d\n", (unsigned long long)count, NUMB_KEYS);
+        goto error;
+    } /* end if */
+
+    /* Overwriting a key must not change the count */
+    if(H5Mput(map_id, H5T_NATIVE_INT, &keys[1], H5T_NATIVE_INT, &vals[0], H5P_DEFAULT) < 0)
+        TEST_ERROR
+
+    /* Delete a key */
+    if(H5Mdelete(map_id, H5T_NATIVE_INT, &keys[0], H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5Mget_count(map_id, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(count != NUMB_KEYS - 1) {
+        H5_FAILED(); AT();
+        printf("     incorrect key count after delete: %llu expected: %d\n", (unsigned long long)count, NUMB_KEYS - 1);
+        goto error;
+    } /* end if */
+
+    if(H5Mclose(map_id) < 0)
+        TEST_ERROR
+
+    /* Reopen the map and check that the count and setting persisted */
+    if((map_id = H5Mopen(file_id, MAP_KEY_COUNT_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Mget_count(map_id, &count, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(count != NUMB_KEYS - 1) {
+        H5_FAILED(); AT();
+        printf("     incorrect key count after reopen: %llu expected: %d\n", (unsigned long long)count, NUMB_KEYS - 1);
+        goto error;
+    } /* end if */
+    if((mcpl_id2 = H5Mget_create_plist(map_id)) < 0)
+        TEST_ERROR
+    if(H5daos_get_map_key_count(mcpl_id2, &track_key_count) < 0)
+        TEST_ERROR
+    if(!track_key_count) {
+        H5_FAILED(); AT();
+        printf("     key count not set on map creation property list after reopen\n");
+        goto error;
+    } /* end if */
+
+    if(H5Pclose(mcpl_id2) < 0)
+        TEST_ERROR
+    if(H5Mclose(map_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(mcpl_id) < 0)
+        TEST_ERROR
+
+    PASSED(); fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(mcpl_id2);
+        H5Mclose(map_id);
+        H5Pclose(mcpl_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_key_count() */
+
+/*
+ * Iterate callback for test_map_iterate_kv()
+ */
+typedef struct {
+    int ncalled;
+    int nerrors;
+    int stop_at;
+} iterate_kv_ud_t;
+
+static herr_t
+map_iterate_kv_cb(hid_t map_id, const void *_key, const void *_value, void *_iterate_ud)
+{
+    iterate_kv_ud_t *iterate_ud = (iterate_kv_ud_t *)_iterate_ud;
+    int key = *(const int *)_key;
+    long long value = *(const long long *)_value;
+
+    /* Values are derived from keys so they can be checked without a lookup */
+    if(value != 3 * (long long)key + 1) {
+        printf("     incorrect value passed for key %d: %lld expected: %lld\n", key, value, 3 * (long long)key + 1);
+        iterate_ud->nerrors++;
+    } /* end if */
+
+    iterate_ud->ncalled++;
+
+    return iterate_ud->ncalled == iterate_ud->stop_at;
+} /* end map_iterate_kv_cb() */
+
+/*
+ * Tests iterating over a map with values
+ */
+static int
+test_map_iterate_kv(hid_t file_id)
+{
+    hid_t map_id = -1;
+    int *keys = NULL;
+    int *vals = NULL;
+    iterate_kv_ud_t iterate_ud;
+    hsize_t idx;
+    herr_t ret;
+    int i;
+
+    TESTING("map iteration with values")
+
+    if(NULL == (keys = (int *)malloc(MULTI_NUMB_KEYS * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (vals = (int *)malloc(MULTI_NUMB_KEYS * sizeof(int))))
+        TEST_ERROR
+
+    for(i = 0; i < MULTI_NUMB_KEYS; i++) {
+        keys[i] = i * 5 - MULTI_NUMB_KEYS;
+        vals[i] = 3 * keys[i] + 1;
+    } /* end for */
+
+    if((map_id = H5Mcreate(file_id, MAP_ITERATE_KV_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT,
+            H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5daos_map_put_multi(map_id, MULTI_NUMB_KEYS, H5T_NATIVE_INT, keys,
+            H5T_NATIVE_INT, vals, H5P_DEFAULT) < 0)
+        TEST_ERROR
+
+    /* Iterate over all keys, converting values to long long */
+    memset(&iterate_ud, 0, sizeof(iterate_ud));
+    idx = 0;
+    if((ret = H5daos_map_iterate_kv(map_id, &idx, H5T_NATIVE_INT, H5T_NATIVE_LLONG,
+            map_iterate_kv_cb, &iterate_ud, H5P_DEFAULT)) < 0) {
+        H5_FAILED(); AT();
+        printf("     failed to iterate over map with values\n");
+        goto error;
+    } /* end if */
+    if(ret != 0 || iterate_ud.nerrors) {
+        H5_FAILED(); AT();
+        printf("     incorrect iteration return value or values\n");
+        goto error;
+    } /* end if */
+    if(iterate_ud.ncalled != MULTI_NUMB_KEYS || idx != (hsize_t)MULTI_NUMB_KEYS) {
+        H5_FAILED(); AT();
+        printf("     incorrect number of keys iterated over: %d expected: %d\n", iterate_ud.ncalled, MULTI_NUMB_KEYS);
+        goto error;
+    } /* end if */
+
+    /* Stop iteration partway through */
+    memset(&iterate_ud, 0, sizeof(iterate_ud));
+    iterate_ud.stop_at = MULTI_NUMB_KEYS / 2;
+    if((ret = H5daos_map_iterate_kv(map_id, NULL, H5T_NATIVE_INT, H5T_NATIVE_LLONG,
+            map_iterate_kv_cb, &iterate_ud, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(ret != 1 || iterate_ud.nerrors || iterate_ud.ncalled != MULTI_NUMB_KEYS / 2) {
+        H5_FAILED(); AT();
+        printf("     incorrect short-circuit iteration: returned %d after %d keys\n", (int)ret, iterate_ud.ncalled);
+        goto error;
+    } /* end if */
+
+    if(H5Mclose(map_id) < 0)
+        TEST_ERROR
+
+    free(keys);
+    free(vals);
+
+    PASSED(); fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Mclose(map_id);
+    } H5E_END_TRY;
+    free(keys);
+    free(vals);
+
+    return 1;
+} /* end test_map_iterate_kv() */
+
+/*
+ * Iterate callback for test_ordered_keys()
+ */
+typedef struct {
+    int ncalled;
+    int nerrors;
+    uint64_t last_key;
+} iterate_ordered_ud_t;
+
+static herr_t
+map_iterate_ordered_cb(hid_t map_id, const void *_key, void *_iterate_ud)
+{
+    iterate_ordered_ud_t *iterate_ud = (iterate_ordered_ud_t *)_iterate_ud;
+    uint64_t key = *(const uint64_t *)_key;
+
+    /* Keys must be visited in ascending order */
+    if(iterate_ud->ncalled > 0 && key <= iterate_ud->last_key) {
+        printf("     key %llu visited after key %llu\n", (unsigned long long)key, (unsigned long long)iterate_ud->last_key);
+        iterate_ud->nerrors++;
+    } /* end if */
+
+    iterate_ud->last_key = key;
+    iterate_ud->ncalled++;
+
+    return 0;
+} /* end map_iterate_ordered_cb() */
+
+/*
+ * Tests a map with ordered unsigned 64 bit integer keys and key range
+ * iteration
+ */
+static int
+test_ordered_keys(hid_t file_id)
+{
+    hid_t mcpl_id = -1, mcpl_id2 = -1;
+    hid_t map_id = -1;
+    uint64_t *keys = NULL;
+    int *vals = NULL;
+    iterate_ordered_ud_t iterate_ud;
+    hbool_t ordered_keys;
+    uint64_t lo, hi;
+    int i;
+
+    TESTING("map with ordered keys")
+
+    if(NULL == (keys = (uint64_t *)malloc(ORDERED_NUMB_KEYS * sizeof(uint64_t))))
+        TEST_ERROR
+    if(NULL == (vals = (int *)malloc(ORDERED_NUMB_KEYS * sizeof(int))))
+        TEST_ERROR
+
+    /* Keys are multiples of 3 above 2^40, put in a scrambled order, so key
+     * order differs from both insertion and little endian byte order */
+    for(i = 0; i < ORDERED_NUMB_KEYS; i++) {
+        keys[i] = ((uint64_t)1 << 40) + 3 * (uint64_t)((i * 37) % ORDERED_NUMB_KEYS);
+        vals[i] = i;
+    } /* end for */
+
+    if((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0)
+        TEST_ERROR
+    if(H5daos_get_map_ordered_keys(mcpl_id, &ordered_keys) < 0)
+        TEST_ERROR
+    if(ordered_keys) {
+        H5_FAILED(); AT();
+        printf("     ordered keys enabled by default\n");
+        goto error;
+    } /* end if */
+    if(H5daos_set_map_ordered_keys(mcpl_id, TRUE) < 0)
+        TEST_ERROR
+
+    /* Ordered keys must be unsigned 64 bit integers */
+    H5E_BEGIN_TRY {
+        map_id = H5Mcreate(file_id, MAP_ORDERED_KEYS_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT,
+                H5P_DEFAULT, mcpl_id, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(map_id >= 0) {
+        H5_FAILED(); AT();
+        printf("     created map with ordered signed 32 bit integer keys\n");
+        goto error;
+    } /* end if */
+
+    if((map_id = H5Mcreate(file_id, MAP_ORDERED_KEYS_NAME, H5T_NATIVE_UINT64, H5T_NATIVE_INT,
+            H5P_DEFAULT, mcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5daos_map_put_multi(map_id, ORDERED_NUMB_KEYS, H5T_NATIVE_UINT64, keys,
+            H5T_NATIVE_INT, vals, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5Mclose(map_id) < 0)
+        TEST_ERROR
+
+    /* Reopen map and check that it still orders its keys */
+    if((map_id = H5Mopen(file_id, MAP_ORDERED_KEYS_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((mcpl_id2 = H5Mget_create_plist(map_id)) < 0)
+        TEST_ERROR
+    if(H5daos_get_map_ordered_keys(mcpl_id2, &ordered_keys) < 0)
+        TEST_ERROR
+    if(!ordered_keys) {
+        H5_FAILED(); AT();
+        printf("     ordered keys not set on reopened map's creation property list\n");
+        goto error;
+    } /* end if */
+
+    /* Spot check a value */
+    if(H5Mget(map_id, H5T_NATIVE_UINT64, &keys[5], H5T_NATIVE_INT, &i, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(i != 5) {
+        H5_FAILED(); AT();
+        printf("     incorrect value returned: %d expected: 5\n", i);
+        goto error;
+    } /* end if */
+
+    /* Iterate over all keys, which must be in order */
+    memset(&iterate_ud, 0, sizeof(iterate_ud));
+    if(H5Miterate(map_id, NULL, H5T_NATIVE_UINT64, map_iterate_ordered_cb, &iterate_ud, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(iterate_ud.nerrors || iterate_ud.ncalled != ORDERED_NUMB_KEYS) {
+        H5_FAILED(); AT();
+        printf("     incorrect iteration over ordered keys: %d keys visited\n", iterate_ud.ncalled);
+        goto error;
+    } /* end if */
+
+    /* Iterate over a key range whose bounds are not keys.  The keys in
+     * [lo, hi] are 2^40 + 3 * (10 ... 39). */
+    lo = ((uint64_t)1 << 40) + 29;
+    hi = ((uint64_t)1 << 40) + 118;
+    memset(&iterate_ud, 0, sizeof(iterate_ud));
+    if(H5daos_map_iterate_range(map_id, lo, hi, map_iterate_ordered_cb, &iterate_ud, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(iterate_ud.nerrors || iterate_ud.ncalled != 30
+            || iterate_ud.last_key != ((uint64_t)1 << 40) + 117) {
+        H5_FAILED(); AT();
+        printf("     incorrect key range iteration: %d keys visited, expected 30\n", iterate_ud.ncalled);
+        goto error;
+    } /* end if */
+
+    if(H5Pclose(mcpl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(mcpl_id2) < 0)
+        TEST_ERROR
+    if(H5Mclose(map_id) < 0)
+        TEST_ERROR
+
+    free(keys);
+    free(vals);
+
+    PASSED(); fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(mcpl_id);
+        H5Pclose(mcpl_id2);
+        H5Mclose(map_id);
+    } H5E_END_TRY;
+    free(keys);
+    free(vals);
+
+    return 1;
+} /* end test_ordered_keys() */
+
+/*
+ * Tests a map with a bloom filter
+ */
+static int
+test_bloom_filter(hid_t file_id)
+{
+    hid_t mcpl_id = -1, mcpl_id2 = -1;
+    hid_t map_id = -1;
+    int keys[MAP_BLOOM_NKEYS];
+    int vals[MAP_BLOOM_NKEYS];
+    int absent_key;
+    hsize_t expected_keys;
+    hbool_t exists;
+    double fpr, fpr2;
+    int i;
+
+    TESTING("map with bloom filter")
+
+    for(i = 0; i < MAP_BLOOM_NKEYS; i++) {
+        keys[i] = random_base + i;
+        vals[i] = rand();
+    } /* end for */
+
+    if((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0)
+        TEST_ERROR
+    if(H5daos_get_map_bloom_filter(mcpl_id, &expected_keys) < 0)
+        TEST_ERROR
+    if(expected_keys != 0) {
+        H5_FAILED(); AT();
+        printf("     bloom filter enabled by default\n");
+        goto error;
+    } /* end if */
+    if(H5daos_set_map_bloom_filter(mcpl_id, 2 * MAP_BLOOM_NKEYS) < 0)
+        TEST_ERROR
+
+    if((map_id = H5Mcreate(file_id, MAP_BLOOM_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT,
+            H5P_DEFAULT, mcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5daos_map_put_multi(map_id, MAP_BLOOM_NKEYS, H5T_NATIVE_INT, keys,
+            H5T_NATIVE_INT, vals, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5Mclose(map_id) < 0)
+        TEST_ERROR
+
+    /* Reopen the map so the filter is loaded from storage */
+    if((map_id = H5Mopen(file_id, MAP_BLOOM_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Keys that were put must always be found */
+    for(i = 0; i < MAP_BLOOM_NKEYS; i++) {
+        if(H5Mexists(map_id, H5T_NATIVE_INT, &keys[i], &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if(!exists) {
+            H5_FAILED(); AT();
+            printf("     key %d not found\n", keys[i]);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Keys that were not put must not be found, whether the filter or the map
+     * answers */
+    for(i = 0; i < MAP_BLOOM_NKEYS; i++) {
+        absent_key = random_base - 1 - i;
+        if(H5Mexists(map_id, H5T_NATIVE_INT, &absent_key, &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if(exists) {
+            H5_FAILED(); AT();
+            printf("     nonexistent key %d found\n", absent_key);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* The filter is sized for twice the number of keys, so its false positive
+     * rate should be well under 1% */
+    if(H5daos_map_get_bloom_filter_fpr(map_id, &fpr) < 0)
+        TEST_ERROR
+    if(fpr <= 0.0 || fpr >= 0.01) {
+        H5_FAILED(); AT();
+        printf("     unexpected false positive rate: %g\n", fpr);
+        goto error;
+    } /* end if */
+
+    /* Delete a key and rebuild the filter, which clears the deleted key's
+     * bits */
+    if(H5Mdelete(map_id, H5T_NATIVE_INT, &keys[0], H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5daos_map_rebuild_bloom_filter(map_id, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5Mexists(map_id, H5T_NATIVE_INT, &keys[0], &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(exists) {
+        H5_FAILED(); AT();
+        printf("     deleted key found\n");
+        goto error;
+    } /* end if */
+    if(H5Mexists(map_id, H5T_NATIVE_INT, &keys[1], &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(!exists) {
+        H5_FAILED(); AT();
+        printf("     key not found after rebuilding bloom filter\n");
+        goto error;
+    } /* end if */
+    if(H5daos_map_get_bloom_filter_fpr(map_id, &fpr2) < 0)
+        TEST_ERROR
+    if(fpr2 >= fpr) {
+        H5_FAILED(); AT();
+        printf("     false positive rate did not drop after rebuild: %g -> %g\n", fpr, fpr2);
+        goto error;
+    } /* end if */
+
+    /* Check the setting is reported on the map creation property list */
+    if((mcpl_id2 = H5Mget_create_plist(map_id)) < 0)
+        TEST_ERROR
+    if(H5daos_get_map_bloom_filter(mcpl_id2, &expected_keys) < 0)
+        TEST_ERROR
+    if(expected_keys == 0) {
+        H5_FAILED(); AT();
+        printf("     bloom filter not set on map creation property list after reopen\n");
+        goto error;
+    } /* end if */
+
+    if(H5Pclose(mcpl_id2) < 0)
+        TEST_ERROR
+    if(H5Mclose(map_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(mcpl_id) < 0)
+        TEST_ERROR
+
+    PASSED(); fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(mcpl_id2);
+        H5Mclose(map_id);
+        H5Pclose(mcpl_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_bloom_filter() */
+
+/*
+ * Tests a map with a bloom filter opened through two handles, where keys are
+ * put and deleted through one handle after the other has loaded the filter and
+ * the handles are refreshed to see each other's keys
+ */
+static int
+test_bloom_filter_two_handles(hid_t file_id)
+{
+    hid_t mcpl_id = -1;
+    hid_t map_id1 = -1, map_id2 = -1;
+    int keys[MAP_BLOOM_NKEYS];
+    int vals[MAP_BLOOM_NKEYS];
+    hbool_t exists;
+    int i;
+
+    TESTING("map with bloom filter through two handles")
+
+    for(i = 0; i < MAP_BLOOM_NKEYS; i++) {
+        keys[i] = random_base + i;
+        vals[i] = rand();
+    } /* end for */
+
+    if((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0)
+        TEST_ERROR
+    if(H5daos_set_map_bloom_filter(mcpl_id, 2 * MAP_BLOOM_NKEYS) < 0)
+        TEST_ERROR
+
+    /* Create the map with the first half of the keys and write them to the
+     * stored filter, then open it again so both handles have them */
+    if((map_id1 = H5Mcreate(file_id, MAP_BLOOM_HANDLES_NAME, H5T_NATIVE_INT, H5T_NATIVE_INT,
+            H5P_DEFAULT, mcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5daos_map_put_multi(map_id1, MAP_BLOOM_NKEYS / 2, H5T_NATIVE_INT, keys,
+            H5T_NATIVE_INT, vals, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5daos_map_refresh_bloom_filter(map_id1, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if((map_id2 = H5Mopen(file_id, MAP_BLOOM_HANDLES_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Put the second half of the keys through the second handle.  They must
+     * be found through the first once both handles are refreshed. */
+    for(i = MAP_BLOOM_NKEYS / 2; i < MAP_BLOOM_NKEYS; i++)
+        if(H5Mput(map_id2, H5T_NATIVE_INT, &keys[i], H5T_NATIVE_INT, &vals[i], H5P_DEFAULT) < 0)
+            TEST_ERROR
+    if(H5daos_map_refresh_bloom_filter(map_id2, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5daos_map_refresh_bloom_filter(map_id1, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    for(i = 0; i < MAP_BLOOM_NKEYS; i++) {
+        if(H5Mexists(map_id1, H5T_NATIVE_INT, &keys[i], &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if(!exists) {
+            H5_FAILED(); AT();
+            printf("     key %d put through other handle not found\n", keys[i]);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Delete a key through the first handle, rebuild the stored filter and
+     * check it through both handles.  Then put it back through the first
+     * handle. */
+    if(H5Mdelete(map_id1, H5T_NATIVE_INT, &keys[0], H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5daos_map_rebuild_bloom_filter(map_id1, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5daos_map_refresh_bloom_filter(map_id2, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5Mexists(map_id1, H5T_NATIVE_INT, &keys[0], &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(exists) {
+        H5_FAILED(); AT();
+        printf("     deleted key found\n");
+        goto error;
+    } /* end if */
+    if(H5Mexists(map_id2, H5T_NATIVE_INT, &keys[0], &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(exists) {
+        H5_FAILED(); AT();
+        printf("     key deleted through other handle found\n");
+        goto error;
+    } /* end if */
+    if(H5Mput(map_id1, H5T_NATIVE_INT, &keys[0], H5T_NATIVE_INT, &vals[0], H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5daos_map_refresh_bloom_filter(map_id1, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5daos_map_refresh_bloom_filter(map_id2, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(H5Mexists(map_id2, H5T_NATIVE_INT, &keys[0], &exists, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if(!exists) {
+        H5_FAILED(); AT();
+        printf("     key put back through other handle not found\n");
+        goto error;
+    } /* end if */
+
+    /* Every key must still be found through both handles after the rebuild */
+    for(i = 0; i < MAP_BLOOM_NKEYS; i++) {
+        if(H5Mexists(map_id1, H5T_NATIVE_INT, &keys[i], &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if(!exists) {
+            H5_FAILED(); AT();
+            printf("     key %d not found through first handle after rebuild\n", keys[i]);
+            goto error;
+        } /* end if */
+        if(H5Mexists(map_id2, H5T_NATIVE_INT, &keys[i], &exists, H5P_DEFAULT) < 0)
+            TEST_ERROR
+        if(!exists) {
+            H5_FAILED(); AT();
+            printf("     key %d not found through second handle after rebuild\n", keys[i]);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    if(H5Mclose(map_id2) < 0)
+        TEST_ERROR
+    if(H5Mclose(map_id1) < 0)
+        TEST_ERROR
+    if(H5Pclose(mcpl_id) < 0)
+        TEST_ERROR
+
+    PASSED(); fflush(stdout);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Mclose(map_id2);
+        H5Mclose(map_id1);
+        H5Pclose(mcpl_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_bloom_filter_two_handles() */
+
 /*
  * Tests opening a non-existent map object
  */
@@ -4011,6 +4769,12 @@ main( int argc, char** argv )
     nerrors += test_vl_tconv(file_id);
     nerrors += test_many_entries(file_id);
     nerrors += test_many_maps(file_id);
+    nerrors += test_multi_key(file_id);
+    nerrors += test_key_count(file_id);
+    nerrors += test_map_iterate_kv(file_id);
+    nerrors += test_ordered_keys(file_id);
+    nerrors += test_bloom_filter(file_id);
+    nerrors += test_bloom_filter_two_handles(file_id);
     nerrors += test_nonexistent_map(file_id);
 
     if(H5Pclose(fapl_id) < 0) {
@@ -42,6 +42,7 @@ static herr_t iterate_func1(hid_t map_id, const void *key, void *op_data);
 static herr_t iterate_func2(hid_t map_id, const void *key, void *op_data);
 static herr_t iterate_func3(hid_t map_id, const void *key, void *op_data);
 static herr_t iterate_func4(hid_t map_id, const void *key, void *op_data);
+static herr_t iterate_func5(hid_t map_id, const void *key, void *op_data);
 
 typedef struct delete_rank_0_test_info {
     size_t key_count;
@@ -1832,6 +1833,378 @@ error:
     return 1;
 }
 
+/*
+ * A test to create a map on all ranks, insert some keys on all ranks
+ * and then have all ranks iterate over the map together with
+ * H5daos_map_iterate_part(), making sure that every key is visited by
+ * exactly one rank.  The map uses a multi-group object class so that it
+ * can be split across ranks.
+ */
+#define MAP_TEST_ITERATE_PART_MAP_NAME   "iterate_part_map"
+#define MAP_TEST_ITERATE_PART_KEY_TYPE   H5T_NATIVE_INT
+#define MAP_TEST_ITERATE_PART_VAL_TYPE   H5T_NATIVE_INT
+#define MAP_TEST_ITERATE_PART_KEY_C_TYPE int
+#define MAP_TEST_ITERATE_PART_VAL_C_TYPE int
+#define MAP_TEST_ITERATE_PART_N_KEYS     100
+#define MAP_TEST_ITERATE_PART_OBJ_CLASS  "SX"
+static int
+test_iterate_part_all_ranks()
+{
+    MAP_TEST_ITERATE_PART_KEY_C_TYPE cur_key;
+    MAP_TEST_ITERATE_PART_VAL_C_TYPE cur_val;
+    size_t i, n_keys;
+    int   *visited = NULL;
+    hid_t  file_id = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
+    hid_t  mcpl_id = H5I_INVALID_HID;
+    hid_t  map_id = H5I_INVALID_HID;
+
+    TESTING_2("insert keys on all ranks - partitioned iteration over keys on all ranks")
+
+    n_keys = (size_t) mpi_size * MAP_TEST_ITERATE_PART_N_KEYS;
+    if (NULL == (visited = (int *) calloc(n_keys, sizeof(int)))) {
+        H5_FAILED();
+        HDputs("    failed to allocate buffer");
+        goto error;
+    }
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create FAPL");
+        goto error;
+    }
+
+    if (H5Pset_all_coll_metadata_ops(fapl_id, 1) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set collective metadata reads");
+        goto error;
+    }
+
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set MPI on FAPL");
+        goto error;
+    }
+
+    if ((file_id = H5Fopen(PARALLEL_FILENAME, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open file");
+        goto error;
+    }
+
+    if ((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create MCPL");
+        goto error;
+    }
+
+    if (H5daos_set_object_class(mcpl_id, MAP_TEST_ITERATE_PART_OBJ_CLASS) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set object class on MCPL");
+        goto error;
+    }
+
+    if ((map_id = H5Mcreate(file_id, MAP_TEST_ITERATE_PART_MAP_NAME, MAP_TEST_ITERATE_PART_KEY_TYPE,
+            MAP_TEST_ITERATE_PART_VAL_TYPE, H5P_DEFAULT, mcpl_id, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create map");
+        goto error;
+    }
+
+    /*
+     * Insert some keys on all ranks.
+     */
+    for (i = 0; i < MAP_TEST_ITERATE_PART_N_KEYS; i++) {
+        /* Keys range from 0 to ((mpi_size * MAP_TEST_ITERATE_PART_N_KEYS) - 1) */
+        cur_key = (MAP_TEST_ITERATE_PART_KEY_C_TYPE) ((size_t) (mpi_rank * MAP_TEST_ITERATE_PART_N_KEYS) + i);
+        cur_val = cur_key;
+
+        if (H5Mput(map_id, MAP_TEST_ITERATE_PART_KEY_TYPE, &cur_key,
+                MAP_TEST_ITERATE_PART_VAL_TYPE, &cur_val, H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            printf("    failed to set key-value pair %lld in map\n", (long long) i);
+            goto error;
+        }
+    }
+
+    /*
+     * Re-open the map to ensure the keys make it.
+     */
+    if (H5Mclose(map_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close map");
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file");
+        goto error;
+    }
+
+    if ((file_id = H5Fopen(PARALLEL_FILENAME, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open file");
+        goto error;
+    }
+
+    if ((map_id = H5Mopen(file_id, MAP_TEST_ITERATE_PART_MAP_NAME, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open map");
+        goto error;
+    }
+
+    /*
+     * Iterate over this rank's part of the map, then combine the visited
+     * keys from all ranks and make sure each key was visited exactly once.
+     */
+    if (H5daos_map_iterate_part(map_id, MAP_TEST_ITERATE_PART_KEY_TYPE, iterate_func5,
+            visited, TRUE, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        HDputs("    partitioned iteration over keys in map failed");
+        goto error;
+    }
+
+    if (MPI_SUCCESS != MPI_Allreduce(MPI_IN_PLACE, visited, (int) n_keys, MPI_INT, MPI_SUM, MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDputs("    MPI_Allreduce failed");
+        goto error;
+    }
+
+    for (i = 0; i < n_keys; i++)
+        if (visited[i] != 1) {
+            H5_FAILED();
+            printf("    key %lld was visited %d times, expected once\n", (long long) i, visited[i]);
+            goto error;
+        }
+
+    if (H5Mclose(map_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close map");
+        goto error;
+    }
+
+    if (H5Pclose(mcpl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close MCPL");
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close FAPL");
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file");
+        goto error;
+    }
+
+    free(visited);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Mclose(map_id);
+        H5Pclose(mcpl_id);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    free(visited);
+
+    return 1;
+}
+
+/*
+ * A test to create a map that keeps a key count on all ranks, have all
+ * ranks put keys at the same time (some keys are put by every rank and
+ * some keys are put more than once in one call) and then delete some of
+ * their keys, and make sure that H5Mget_count() returns the exact number
+ * of keys on all ranks.
+ */
+#define MAP_TEST_KEY_COUNT_MAP_NAME      "key_count_all_ranks_map"
+#define MAP_TEST_KEY_COUNT_KEY_TYPE      H5T_NATIVE_INT
+#define MAP_TEST_KEY_COUNT_VAL_TYPE      H5T_NATIVE_INT
+#define MAP_TEST_KEY_COUNT_KEY_C_TYPE    int
+#define MAP_TEST_KEY_COUNT_VAL_C_TYPE    int
+#define MAP_TEST_KEY_COUNT_N_SHARED_KEYS 10
+#define MAP_TEST_KEY_COUNT_N_KEYS        50
+static int
+test_key_count_all_ranks()
+{
+    MAP_TEST_KEY_COUNT_KEY_C_TYPE keys[MAP_TEST_KEY_COUNT_N_KEYS * 2];
+    MAP_TEST_KEY_COUNT_VAL_C_TYPE vals[MAP_TEST_KEY_COUNT_N_KEYS * 2];
+    MAP_TEST_KEY_COUNT_KEY_C_TYPE cur_key;
+    hsize_t key_count = 0;
+    hsize_t expected_count;
+    size_t i;
+    hid_t  file_id = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
+    hid_t  mcpl_id = H5I_INVALID_HID;
+    hid_t  map_id = H5I_INVALID_HID;
+
+    TESTING_2("concurrent puts and deletes on all ranks - key count on all ranks")
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create FAPL");
+        goto error;
+    }
+
+    if (H5Pset_all_coll_metadata_ops(fapl_id, 1) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set collective metadata reads");
+        goto error;
+    }
+
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set MPI on FAPL");
+        goto error;
+    }
+
+    if ((file_id = H5Fopen(PARALLEL_FILENAME, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open file");
+        goto error;
+    }
+
+    if ((mcpl_id = H5Pcreate(H5P_MAP_CREATE)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create MCPL");
+        goto error;
+    }
+
+    if (H5daos_set_map_key_count(mcpl_id, TRUE) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set key count on MCPL");
+        goto error;
+    }
+
+    if ((map_id = H5Mcreate(file_id, MAP_TEST_KEY_COUNT_MAP_NAME, MAP_TEST_KEY_COUNT_KEY_TYPE,
+            MAP_TEST_KEY_COUNT_VAL_TYPE, H5P_DEFAULT, mcpl_id, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create map");
+        goto error;
+    }
+
+    /*
+     * Put the shared keys on all ranks at the same time, one at a time.
+     * Shared keys range from 0 to (MAP_TEST_KEY_COUNT_N_SHARED_KEYS - 1).
+     */
+    for (i = 0; i < MAP_TEST_KEY_COUNT_N_SHARED_KEYS; i++) {
+        cur_key = (MAP_TEST_KEY_COUNT_KEY_C_TYPE) i;
+
+        if (H5Mput(map_id, MAP_TEST_KEY_COUNT_KEY_TYPE, &cur_key,
+                MAP_TEST_KEY_COUNT_VAL_TYPE, &mpi_rank, H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            printf("    failed to set shared key %lld in map\n", (long long) i);
+            goto error;
+        }
+    }
+
+    /*
+     * Put this rank's keys in one call, with every key repeated so the
+     * writes of the same key are in flight at the same time.  Each rank's
+     * keys start after the shared keys.
+     */
+    for (i = 0; i < MAP_TEST_KEY_COUNT_N_KEYS; i++) {
+        cur_key = (MAP_TEST_KEY_COUNT_KEY_C_TYPE) (MAP_TEST_KEY_COUNT_N_SHARED_KEYS
+                + (mpi_rank * MAP_TEST_KEY_COUNT_N_KEYS) + (int) i);
+        keys[2 * i] = cur_key;
+        keys[(2 * i) + 1] = cur_key;
+        vals[2 * i] = cur_key;
+        vals[(2 * i) + 1] = cur_key;
+    }
+
+    if (H5daos_map_put_multi(map_id, MAP_TEST_KEY_COUNT_N_KEYS * 2, MAP_TEST_KEY_COUNT_KEY_TYPE, keys,
+            MAP_TEST_KEY_COUNT_VAL_TYPE, vals, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        HDputs("    failed to put multiple key-value pairs in map");
+        goto error;
+    }
+
+    /*
+     * Delete every other key put by this rank, while the other ranks do the
+     * same.
+     */
+    for (i = 0; i < MAP_TEST_KEY_COUNT_N_KEYS; i += 2) {
+        cur_key = keys[2 * i];
+
+        if (H5Mdelete(map_id, MAP_TEST_KEY_COUNT_KEY_TYPE, &cur_key, H5P_DEFAULT) < 0) {
+            H5_FAILED();
+            printf("    failed to delete key %lld from map\n", (long long) cur_key);
+            goto error;
+        }
+    }
+
+    if (MPI_SUCCESS != MPI_Barrier(MPI_COMM_WORLD)) {
+        H5_FAILED();
+        HDputs("    MPI_Barrier failed");
+        goto error;
+    }
+
+    /*
+     * Check the key count on all ranks.
+     */
+    expected_count = (hsize_t) MAP_TEST_KEY_COUNT_N_SHARED_KEYS
+            + ((hsize_t) mpi_size * (MAP_TEST_KEY_COUNT_N_KEYS / 2));
+
+    if (H5Mget_count(map_id, &key_count, H5P_DEFAULT) < 0) {
+        H5_FAILED();
+        HDputs("    failed to retrieve the number of keys in map");
+        goto error;
+    }
+
+    if (key_count != expected_count) {
+        H5_FAILED();
+        printf("    number of keys in map (%lld) didn't match expected number (%lld)\n",
+                (long long) key_count, (long long) expected_count);
+        goto error;
+    }
+
+    if (H5Mclose(map_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close map");
+        goto error;
+    }
+
+    if (H5Pclose(mcpl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close MCPL");
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close FAPL");
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file");
+        goto error;
+    }
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Mclose(map_id);
+        H5Pclose(mcpl_id);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
 /*
  * A key iteration function for the test_insert_keys_one_rank_iterate_all_ranks
  * test which counts the number of keys and makes sure that each key
@@ -2002,6 +2375,42 @@ done:
     return ret_val;
 }
 
+/*
+ * A key iteration function for the test_iterate_part_all_ranks test
+ * which records each key visited by this rank and makes sure that each
+ * key's value matches the key.
+ */
+static herr_t
+iterate_func5(hid_t map_id, const void *key, void *op_data)
+{
+    MAP_TEST_ITERATE_PART_KEY_C_TYPE cur_key = *(const MAP_TEST_ITERATE_PART_KEY_C_TYPE *) key;
+    MAP_TEST_ITERATE_PART_VAL_C_TYPE retrieved_val;
+    int *visited = (int *) op_data;
+
+    if (cur_key < 0 || cur_key >= mpi_size * MAP_TEST_ITERATE_PART_N_KEYS) {
+        H5_FAILED();
+        printf("    unexpected key %lld visited\n", (long long) cur_key);
+        return H5_ITER_ERROR;
+    }
+
+    if (H5Mget(map_id, MAP_TEST_ITERATE_PART_KEY_TYPE, key,
+            MAP_TEST_ITERATE_PART_VAL_TYPE, &retrieved_val, H5P_DEFAULT)) {
+        H5_FAILED();
+        HDputs("    failed to retrieved key's value from map");
+        return H5_ITER_ERROR;
+    }
+
+    if (retrieved_val != cur_key) {
+        H5_FAILED();
+        printf("    key value was expected to be %lld, but was %lld\n", (long long) cur_key, (long long) retrieved_val);
+        return H5_ITER_ERROR;
+    }
+
+    visited[cur_key]++;
+
+    return H5_ITER_CONT;
+}
+
 int
 main(int argc, char **argv)
 {
@@ -2049,6 +2458,8 @@ main(int argc, char **argv)
     nerrors += test_delete_keys_all_ranks_iterate_all_ranks();
     nerrors += test_update_keys_rank_0_only_read_all_ranks();
     nerrors += test_update_keys_all_ranks_read_all_ranks();
+    nerrors += test_iterate_part_all_ranks();
+    nerrors += test_key_count_all_ranks();
 
     if (nerrors) goto error;
 
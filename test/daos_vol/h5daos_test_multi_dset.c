@@ -0,0 +1,255 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests multi-dataset reads and writes in the DAOS VOL connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_multi_dset.h5"
+
+#define NDSETS                  3
+#define NROWS                   20
+#define NCOLS                   12
+#define CHUNK_NROWS             4
+#define CHUNK_NCOLS             6
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_multi_dset(hid_t fapl_id);
+
+/*
+ * Test function.  Creates a chunked int dataset, a contiguous double
+ * dataset and a chunked int dataset, writes all of them with one call to
+ * H5daos_dataset_write_multi, then reads them back with one call to
+ * H5daos_dataset_read_multi, converting the double dataset to int.
+ * Finally, writes and reads back a hyperslab in the first and last
+ * datasets only, after reopening them so their opens are still in flight.
+ */
+int
+test_multi_dset(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t dset_id[NDSETS] = {-1, -1, -1};
+    hid_t sub_dset_id[2];
+    hid_t mem_type_id[NDSETS];
+    hid_t mem_space_id[NDSETS];
+    hid_t file_space_id[NDSETS];
+    hid_t dcpl_id = -1;
+    hid_t space_id = -1;
+    hsize_t dims[2] = {NROWS, NCOLS};
+    hsize_t chunk_dims[2] = {CHUNK_NROWS, CHUNK_NCOLS};
+    hsize_t start[2] = {3, 2};
+    hsize_t count[2] = {CHUNK_NROWS + 5, CHUNK_NCOLS + 1};
+    const char *dset_name[NDSETS] = {"dset0", "dset1", "dset2"};
+    int wbuf_int0[NROWS][NCOLS];
+    double wbuf_double[NROWS][NCOLS];
+    int wbuf_int2[NROWS][NCOLS];
+    int rbuf[NDSETS][NROWS][NCOLS];
+    const void *wbufs[NDSETS];
+    void *rbufs[NDSETS];
+    int i, j, k;
+
+    /* Initialize write buffers */
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++) {
+            wbuf_int0[i][j] = i * NCOLS + j;
+            wbuf_double[i][j] = (double)(2 * (i * NCOLS + j)) + 0.5;
+            wbuf_int2[i][j] = -(i * NCOLS + j);
+        } /* end for */
+
+    /* Create dataspace and DCPL */
+    if((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR
+
+    /* Create file and datasets */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id[0] = H5Dcreate2(file_id, dset_name[0], H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((dset_id[1] = H5Dcreate2(file_id, dset_name[1], H5T_NATIVE_DOUBLE, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((dset_id[2] = H5Dcreate2(file_id, dset_name[2], H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write all datasets in one call */
+    mem_type_id[0] = H5T_NATIVE_INT;
+    mem_type_id[1] = H5T_NATIVE_DOUBLE;
+    mem_type_id[2] = H5T_NATIVE_INT;
+    for(k = 0; k < NDSETS; k++) {
+        mem_space_id[k] = H5S_ALL;
+        file_space_id[k] = H5S_ALL;
+    } /* end for */
+    wbufs[0] = wbuf_int0;
+    wbufs[1] = wbuf_double;
+    wbufs[2] = wbuf_int2;
+    if(H5daos_dataset_write_multi(NDSETS, dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, wbufs) < 0)
+        TEST_ERROR
+
+    /* Read all datasets in one call, converting the double dataset to int */
+    mem_type_id[1] = H5T_NATIVE_INT;
+    for(k = 0; k < NDSETS; k++)
+        rbufs[k] = rbuf[k];
+    memset(rbuf, 0, sizeof(rbuf));
+    if(H5daos_dataset_read_multi(NDSETS, dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, rbufs) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++) {
+            int exp_val[NDSETS] = {wbuf_int0[i][j], (int)wbuf_double[i][j], wbuf_int2[i][j]};
+
+            for(k = 0; k < NDSETS; k++)
+                if(rbuf[k][i][j] != exp_val[k]) {
+                    H5_FAILED() AT()
+                    printf("    data read (%d) from dataset %d at [%d][%d] does not match expected (%d)\n", rbuf[k][i][j], k, i, j, exp_val[k]);
+                    goto error;
+                } /* end if */
+        } /* end for */
+
+    /* Close all datasets and reopen the first and last, so the I/O below
+     * may be issued before their opens complete */
+    for(k = 0; k < NDSETS; k++) {
+        if(H5Dclose(dset_id[k]) < 0)
+            TEST_ERROR
+        dset_id[k] = -1;
+    } /* end for */
+    if((dset_id[0] = H5Dopen2(file_id, dset_name[0], H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((dset_id[2] = H5Dopen2(file_id, dset_name[2], H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    sub_dset_id[0] = dset_id[0];
+    sub_dset_id[1] = dset_id[2];
+
+    /* Overwrite a hyperslab spanning several chunks in both datasets with
+     * swapped data */
+    if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    mem_type_id[1] = H5T_NATIVE_INT;
+    mem_space_id[0] = mem_space_id[1] = space_id;
+    file_space_id[0] = file_space_id[1] = space_id;
+    wbufs[0] = wbuf_int2;
+    wbufs[1] = wbuf_int0;
+    if(H5daos_dataset_write_multi(2, sub_dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, wbufs) < 0)
+        TEST_ERROR
+
+    /* Read both datasets back in full and verify */
+    if(H5Sselect_all(space_id) < 0)
+        TEST_ERROR
+    rbufs[0] = rbuf[0];
+    rbufs[1] = rbuf[2];
+    memset(rbuf, 0, sizeof(rbuf));
+    if(H5daos_dataset_read_multi(2, sub_dset_id, mem_type_id, mem_space_id, file_space_id, H5P_DEFAULT, rbufs) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++) {
+            hbool_t in_sel = (hsize_t)i >= start[0] && (hsize_t)i < start[0] + count[0]
+                    && (hsize_t)j >= start[1] && (hsize_t)j < start[1] + count[1];
+            int exp_val0 = in_sel ? wbuf_int2[i][j] : wbuf_int0[i][j];
+            int exp_val2 = in_sel ? wbuf_int0[i][j] : wbuf_int2[i][j];
+
+            if(rbuf[0][i][j] != exp_val0) {
+                H5_FAILED() AT()
+                printf("    data read (%d) from dataset 0 at [%d][%d] does not match expected (%d)\n", rbuf[0][i][j], i, j, exp_val0);
+                goto error;
+            } /* end if */
+            if(rbuf[2][i][j] != exp_val2) {
+                H5_FAILED() AT()
+                printf("    data read (%d) from dataset 2 at [%d][%d] does not match expected (%d)\n", rbuf[2][i][j], i, j, exp_val2);
+                goto error;
+            } /* end if */
+        } /* end for */
+
+    /* Close */
+    if(H5Dclose(dset_id[0]) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset_id[2]) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        for(k = 0; k < NDSETS; k++)
+            H5Dclose(dset_id[k]);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_multi_dset() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("multi-dataset read and write");
+    nerrors += test_multi_dset(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS multi-dataset I/O tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
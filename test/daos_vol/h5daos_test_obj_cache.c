@@ -0,0 +1,296 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests the object metadata cache in the DAOS VOL connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_obj_cache.h5"
+
+#define OBJ_CACHE_NCLOSED       2
+#define NDSETS                  4
+#define NOPENS                  4
+#define DIM0                    8
+#define DIM0_EXTENDED           16
+#define GRP_NAME                "steps"
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_obj_cache(hid_t fapl_id);
+static int check_dset(hid_t loc_id, const char *name, hsize_t expected_dim, int expected);
+
+/*
+ * Helper function.  Opens the one dimensional dataset name and checks that
+ * its size is expected_dim and its first element is expected.
+ */
+static int
+check_dset(hid_t loc_id, const char *name, hsize_t expected_dim, int expected)
+{
+    hid_t dset_id = -1;
+    hid_t space_id = -1;
+    hid_t type_id = -1;
+    hsize_t dim = 0;
+    int buf[DIM0_EXTENDED];
+
+    if((dset_id = H5Dopen2(loc_id, name, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((space_id = H5Dget_space(dset_id)) < 0)
+        TEST_ERROR
+    if(H5Sget_simple_extent_dims(space_id, &dim, NULL) < 0)
+        TEST_ERROR
+    if(dim != expected_dim) {
+        H5_FAILED() AT()
+        printf("    size of %s (%llu) does not match expected (%llu)\n", name, (unsigned long long)dim, (unsigned long long)expected_dim);
+        goto error;
+    } /* end if */
+    if((type_id = H5Dget_type(dset_id)) < 0)
+        TEST_ERROR
+    if(H5Tequal(type_id, H5T_NATIVE_INT) <= 0)
+        TEST_ERROR
+    if(H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR
+    if(buf[0] != expected) {
+        H5_FAILED() AT()
+        printf("    value read from %s (%d) does not match expected (%d)\n", name, buf[0], expected);
+        goto error;
+    } /* end if */
+    if(H5Tclose(type_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(type_id);
+        H5Sclose(space_id);
+        H5Dclose(dset_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end check_dset() */
+
+/*
+ * Test function.  Creates a group of datasets, then reopens the file and
+ * opens each dataset and the group repeatedly, both while another handle to
+ * the same object is open and after it has been closed, with more objects
+ * than the cache keeps closed.  Then extends a dataset and checks that the
+ * new extent is seen when it is reopened.
+ */
+int
+test_obj_cache(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t grp_id = -1;
+    hid_t grp2_id = -1;
+    hid_t dset_id = -1;
+    hid_t space_id = -1;
+    hid_t dcpl_id = -1;
+    hsize_t dims[1] = {DIM0};
+    hsize_t maxdims[1] = {H5S_UNLIMITED};
+    hsize_t chunk_dims[1] = {DIM0};
+    size_t nclosed = 0;
+    char name[32];
+    int buf[DIM0];
+    int i, j;
+
+    /* Set and check object cache settings */
+    if(H5daos_set_object_cache(fapl_id, OBJ_CACHE_NCLOSED) < 0)
+        TEST_ERROR
+    if(H5daos_get_object_cache(fapl_id, &nclosed) < 0)
+        TEST_ERROR
+    if(nclosed != OBJ_CACHE_NCLOSED) {
+        H5_FAILED() AT()
+        printf("    object cache size (%zu) does not match expected (%zu)\n", nclosed, (size_t)OBJ_CACHE_NCLOSED);
+        goto error;
+    } /* end if */
+
+    /* Create file, group and datasets */
+    if((space_id = H5Screate_simple(1, dims, maxdims)) < 0)
+        TEST_ERROR
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        TEST_ERROR
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((grp_id = H5Gcreate2(file_id, GRP_NAME, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for(i = 0; i < NDSETS; i++) {
+        snprintf(name, sizeof(name), "dset%d", i);
+        if((dset_id = H5Dcreate2(grp_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        for(j = 0; j < DIM0; j++)
+            buf[j] = i;
+        if(H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+            TEST_ERROR
+        if(H5Dclose(dset_id) < 0)
+            TEST_ERROR
+        dset_id = -1;
+    } /* end for */
+    if(H5Gclose(grp_id) < 0)
+        TEST_ERROR
+    grp_id = -1;
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    file_id = -1;
+
+    /* Reopen file and open each object repeatedly, while a handle to it is
+     * open and after it was closed.  There are more datasets than the cache
+     * keeps closed, so some are evicted each time around. */
+    if((file_id = H5Fopen(FILENAME, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR
+    for(i = 0; i < NOPENS; i++) {
+        if((grp_id = H5Gopen2(file_id, GRP_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if((grp2_id = H5Gopen2(file_id, GRP_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if(H5Gclose(grp2_id) < 0)
+            TEST_ERROR
+        grp2_id = -1;
+        for(j = 0; j < NDSETS; j++) {
+            snprintf(name, sizeof(name), "dset%d", j);
+            if((dset_id = H5Dopen2(grp_id, name, H5P_DEFAULT)) < 0)
+                TEST_ERROR
+            if(check_dset(grp_id, name, DIM0, j))
+                goto error;
+            if(H5Dclose(dset_id) < 0)
+                TEST_ERROR
+            dset_id = -1;
+            if(check_dset(grp_id, name, DIM0, j))
+                goto error;
+        } /* end for */
+        if(H5Gclose(grp_id) < 0)
+            TEST_ERROR
+        grp_id = -1;
+    } /* end for */
+
+    /* Extend a dataset while it is cached and check the new extent is seen,
+     * with the extending handle open and after it is closed */
+    if((grp_id = H5Gopen2(file_id, GRP_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(check_dset(grp_id, "dset0", DIM0, 0))
+        goto error;
+    if((dset_id = H5Dopen2(grp_id, "dset0", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    dims[0] = DIM0_EXTENDED;
+    if(H5Dset_extent(dset_id, dims) < 0)
+        TEST_ERROR
+    if(check_dset(grp_id, "dset0", DIM0_EXTENDED, 0))
+        goto error;
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = -1;
+    if(check_dset(grp_id, "dset0", DIM0_EXTENDED, 0))
+        goto error;
+
+    /* Close */
+    if(H5Gclose(grp_id) < 0)
+        TEST_ERROR
+    grp_id = -1;
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    file_id = -1;
+
+    /* Reopen file with the cache disabled and check the extent */
+    if(H5daos_set_object_cache(fapl_id, 0) < 0)
+        TEST_ERROR
+    if((file_id = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+    if(check_dset(file_id, GRP_NAME "/dset0", DIM0_EXTENDED, 0))
+        goto error;
+    if(check_dset(file_id, GRP_NAME "/dset1", DIM0, 1))
+        goto error;
+
+    /* Close */
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+        H5Gclose(grp2_id);
+        H5Gclose(grp_id);
+        H5Fclose(file_id);
+        H5Sclose(space_id);
+        H5Pclose(dcpl_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_obj_cache() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("object metadata cache");
+    nerrors += test_obj_cache(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS object metadata cache tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
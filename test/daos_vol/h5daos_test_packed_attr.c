@@ -0,0 +1,450 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests the packed attribute metadata layout in the DAOS VOL
+ *          connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_packed_attr.h5"
+
+#define SMALL_ATTR_NAME         "small"
+#define SMALL_ATTR_NEW_NAME     "small_renamed"
+#define SMALL_ATTR_NELMTS       8
+#define LARGE_ATTR_NAME         "large"
+#define LARGE_ATTR_NELMTS       1024
+#define UNPACKED_ATTR_NAME      "unpacked"
+#define UNPACKED_ATTR_NELMTS    8
+#define UNPACKED_ATTR_NEW_NAME  "unpacked_renamed"
+#define REOPEN_ATTR_NAME        "reopen"
+#define REOPEN_ATTR_NEW_NAME    "reopen_renamed"
+#define REOPEN_ATTR_NELMTS      8
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_packed_attr(hid_t fapl_id);
+static int create_attr(hid_t loc_id, const char *name, hsize_t nelmts, hid_t acpl_id, int base);
+static int check_attr(hid_t loc_id, const char *name, hsize_t nelmts, int base);
+static int check_nattrs(hid_t loc_id, hsize_t expected);
+static herr_t count_attrs_cb(hid_t loc_id, const char *name, const H5A_info_t *ainfo, void *op_data);
+
+/*
+ * Helper function.  Creates a one dimensional integer attribute and writes
+ * base + i to element i.
+ */
+static int
+create_attr(hid_t loc_id, const char *name, hsize_t nelmts, hid_t acpl_id, int base)
+{
+    hid_t attr_id = -1;
+    hid_t space_id = -1;
+    int *buf = NULL;
+    hsize_t i;
+
+    if(NULL == (buf = (int *)malloc(nelmts * sizeof(int))))
+        TEST_ERROR
+    for(i = 0; i < nelmts; i++)
+        buf[i] = base + (int)i;
+
+    if((space_id = H5Screate_simple(1, &nelmts, NULL)) < 0)
+        TEST_ERROR
+    if((attr_id = H5Acreate2(loc_id, name, H5T_NATIVE_INT, space_id, acpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Awrite(attr_id, H5T_NATIVE_INT, buf) < 0)
+        TEST_ERROR
+    if(H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    free(buf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(attr_id);
+        H5Sclose(space_id);
+    } H5E_END_TRY;
+    free(buf);
+
+    return 1;
+} /* end create_attr() */
+
+/*
+ * Helper function.  Opens the attribute and checks its dataspace and that
+ * element i is base + i.
+ */
+static int
+check_attr(hid_t loc_id, const char *name, hsize_t nelmts, int base)
+{
+    hid_t attr_id = -1;
+    hid_t space_id = -1;
+    int *buf = NULL;
+    hssize_t npoints;
+    hsize_t i;
+
+    if(NULL == (buf = (int *)malloc(nelmts * sizeof(int))))
+        TEST_ERROR
+    memset(buf, 0, nelmts * sizeof(int));
+
+    if((attr_id = H5Aopen(loc_id, name, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((space_id = H5Aget_space(attr_id)) < 0)
+        TEST_ERROR
+    if((npoints = H5Sget_simple_extent_npoints(space_id)) < 0)
+        TEST_ERROR
+    if((hsize_t)npoints != nelmts) {
+        H5_FAILED() AT()
+        printf("    number of elements in %s (%lld) does not match expected (%llu)\n", name, (long long)npoints, (unsigned long long)nelmts);
+        goto error;
+    } /* end if */
+    if(H5Aread(attr_id, H5T_NATIVE_INT, buf) < 0)
+        TEST_ERROR
+    for(i = 0; i < nelmts; i++)
+        if(buf[i] != base + (int)i) {
+            H5_FAILED() AT()
+            printf("    value read from %s[%llu] (%d) does not match expected (%d)\n", name, (unsigned long long)i, buf[i], base + (int)i);
+            goto error;
+        } /* end if */
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if(H5Aclose(attr_id) < 0)
+        TEST_ERROR
+
+    free(buf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(space_id);
+        H5Aclose(attr_id);
+    } H5E_END_TRY;
+    free(buf);
+
+    return 1;
+} /* end check_attr() */
+
+/*
+ * Attribute iteration callback.  Counts attributes.
+ */
+static herr_t
+count_attrs_cb(hid_t loc_id, const char *name, const H5A_info_t *ainfo, void *op_data)
+{
+    (void)loc_id;
+    (void)name;
+    (void)ainfo;
+
+    (*(hsize_t *)op_data)++;
+
+    return 0;
+} /* end count_attrs_cb() */
+
+/*
+ * Helper function.  Checks the number of attributes on loc_id by iteration.
+ */
+static int
+check_nattrs(hid_t loc_id, hsize_t expected)
+{
+    hsize_t nattrs = 0;
+
+    if(H5Aiterate2(loc_id, H5_INDEX_NAME, H5_ITER_INC, NULL, count_attrs_cb, &nattrs) < 0)
+        TEST_ERROR
+    if(nattrs != expected) {
+        H5_FAILED() AT()
+        printf("    number of attributes iterated over (%llu) does not match expected (%llu)\n", (unsigned long long)nattrs, (unsigned long long)expected);
+        goto error;
+    } /* end if */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_nattrs() */
+
+/*
+ * Test function.  Checks the packed attribute layout property, then creates
+ * small and large attributes in the packed layout and a small attribute in
+ * the original layout in the same file.  Checks existence, iteration,
+ * renaming in both layouts and deletion.  Then reopens the file, so the
+ * default layout is read from the file, and creates and renames another
+ * attribute, then reopens the file read only and checks the attribute
+ * values.
+ */
+int
+test_packed_attr(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t fcpl_id = -1;
+    hid_t acpl_id = -1;
+    hid_t dcpl_id = -1;
+    hid_t space_id = -1;
+    hid_t attr_id = -1;
+    hbool_t packed = FALSE;
+    htri_t exists;
+    herr_t status;
+
+    /* Set and check the packed attribute layout property */
+    if((fcpl_id = H5Pcreate(H5P_FILE_CREATE)) < 0)
+        TEST_ERROR
+    if((acpl_id = H5Pcreate(H5P_ATTRIBUTE_CREATE)) < 0)
+        TEST_ERROR
+    if(H5daos_get_packed_attr_layout(acpl_id, &packed) < 0)
+        TEST_ERROR
+    if(packed) {
+        H5_FAILED() AT()
+        printf("    packed attribute layout set by default\n");
+        goto error;
+    } /* end if */
+    if(H5daos_set_packed_attr_layout(fcpl_id, TRUE) < 0)
+        TEST_ERROR
+    if(H5daos_get_packed_attr_layout(fcpl_id, &packed) < 0)
+        TEST_ERROR
+    if(!packed) {
+        H5_FAILED() AT()
+        printf("    packed attribute layout not set on FCPL\n");
+        goto error;
+    } /* end if */
+    if(H5daos_set_packed_attr_layout(acpl_id, FALSE) < 0)
+        TEST_ERROR
+    if(H5daos_get_packed_attr_layout(acpl_id, &packed) < 0)
+        TEST_ERROR
+    if(packed) {
+        H5_FAILED() AT()
+        printf("    packed attribute layout not cleared on ACPL\n");
+        goto error;
+    } /* end if */
+
+    /* The property must be rejected on the default and on other property
+     * lists */
+    H5E_BEGIN_TRY {
+        status = H5daos_set_packed_attr_layout(H5P_DEFAULT, TRUE);
+    } H5E_END_TRY;
+    if(status >= 0) {
+        H5_FAILED() AT()
+        printf("    packed attribute layout set on H5P_DEFAULT\n");
+        goto error;
+    } /* end if */
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        status = H5daos_set_packed_attr_layout(dcpl_id, TRUE);
+    } H5E_END_TRY;
+    if(status >= 0) {
+        H5_FAILED() AT()
+        printf("    packed attribute layout set on DCPL\n");
+        goto error;
+    } /* end if */
+
+    /* Create file with the packed layout as default and create attributes.
+     * The small attribute's raw data is stored with its metadata, the large
+     * attribute's raw data is not, and the last attribute uses the original
+     * layout. */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl_id, fapl_id)) < 0)
+        TEST_ERROR
+    if(create_attr(file_id, SMALL_ATTR_NAME, SMALL_ATTR_NELMTS, H5P_DEFAULT, 1))
+        goto error;
+    if(create_attr(file_id, LARGE_ATTR_NAME, LARGE_ATTR_NELMTS, H5P_DEFAULT, 100))
+        goto error;
+    if(create_attr(file_id, UNPACKED_ATTR_NAME, UNPACKED_ATTR_NELMTS, acpl_id, 10000))
+        goto error;
+
+    /* Check attributes, alternating layouts */
+    if(check_attr(file_id, SMALL_ATTR_NAME, SMALL_ATTR_NELMTS, 1))
+        goto error;
+    if(check_attr(file_id, UNPACKED_ATTR_NAME, UNPACKED_ATTR_NELMTS, 10000))
+        goto error;
+    if(check_attr(file_id, LARGE_ATTR_NAME, LARGE_ATTR_NELMTS, 100))
+        goto error;
+    if(check_nattrs(file_id, 3))
+        goto error;
+
+    /* Check existence */
+    if((exists = H5Aexists(file_id, SMALL_ATTR_NAME)) < 0)
+        TEST_ERROR
+    if(!exists) {
+        H5_FAILED() AT()
+        printf("    packed attribute does not exist\n");
+        goto error;
+    } /* end if */
+    if((exists = H5Aexists(file_id, UNPACKED_ATTR_NAME)) < 0)
+        TEST_ERROR
+    if(!exists) {
+        H5_FAILED() AT()
+        printf("    unpacked attribute does not exist\n");
+        goto error;
+    } /* end if */
+    if((exists = H5Aexists(file_id, SMALL_ATTR_NEW_NAME)) < 0)
+        TEST_ERROR
+    if(exists) {
+        H5_FAILED() AT()
+        printf("    attribute exists before creation\n");
+        goto error;
+    } /* end if */
+
+    /* Creating an attribute with the name of an existing attribute in the
+     * other layout must fail */
+    if((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        attr_id = H5Acreate2(file_id, UNPACKED_ATTR_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(attr_id >= 0) {
+        H5_FAILED() AT()
+        printf("    duplicate attribute created\n");
+        goto error;
+    } /* end if */
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    space_id = -1;
+
+    /* Rename the small and unpacked attributes, which must keep their
+     * layouts, and delete the large attribute */
+    if(H5Arename(file_id, SMALL_ATTR_NAME, SMALL_ATTR_NEW_NAME) < 0)
+        TEST_ERROR
+    if(check_attr(file_id, SMALL_ATTR_NEW_NAME, SMALL_ATTR_NELMTS, 1))
+        goto error;
+    if(H5Arename(file_id, UNPACKED_ATTR_NAME, UNPACKED_ATTR_NEW_NAME) < 0)
+        TEST_ERROR
+    if(check_attr(file_id, UNPACKED_ATTR_NEW_NAME, UNPACKED_ATTR_NELMTS, 10000))
+        goto error;
+    if(H5Adelete(file_id, LARGE_ATTR_NAME) < 0)
+        TEST_ERROR
+    if((exists = H5Aexists(file_id, LARGE_ATTR_NAME)) < 0)
+        TEST_ERROR
+    if(exists) {
+        H5_FAILED() AT()
+        printf("    attribute exists after deletion\n");
+        goto error;
+    } /* end if */
+    if(check_nattrs(file_id, 2))
+        goto error;
+
+    /* Close */
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    file_id = -1;
+
+    /* Reopen file read write, so the default layout comes from the file, and
+     * create and rename an attribute with the default ACPL */
+    if((file_id = H5Fopen(FILENAME, H5F_ACC_RDWR, fapl_id)) < 0)
+        TEST_ERROR
+    if(check_attr(file_id, SMALL_ATTR_NEW_NAME, SMALL_ATTR_NELMTS, 1))
+        goto error;
+    if(create_attr(file_id, REOPEN_ATTR_NAME, REOPEN_ATTR_NELMTS, H5P_DEFAULT, 1000))
+        goto error;
+    if(check_attr(file_id, REOPEN_ATTR_NAME, REOPEN_ATTR_NELMTS, 1000))
+        goto error;
+    if(H5Arename(file_id, REOPEN_ATTR_NAME, REOPEN_ATTR_NEW_NAME) < 0)
+        TEST_ERROR
+    if(check_nattrs(file_id, 3))
+        goto error;
+
+    /* Close */
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    file_id = -1;
+
+    /* Reopen file read only and check the remaining attributes */
+    if((file_id = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+    if(check_attr(file_id, UNPACKED_ATTR_NEW_NAME, UNPACKED_ATTR_NELMTS, 10000))
+        goto error;
+    if(check_attr(file_id, SMALL_ATTR_NEW_NAME, SMALL_ATTR_NELMTS, 1))
+        goto error;
+    if(check_attr(file_id, REOPEN_ATTR_NEW_NAME, REOPEN_ATTR_NELMTS, 1000))
+        goto error;
+    if(check_nattrs(file_id, 3))
+        goto error;
+
+    /* Close */
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(acpl_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(fcpl_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(attr_id);
+        H5Sclose(space_id);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Pclose(acpl_id);
+        H5Pclose(fcpl_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_packed_attr() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("packed attribute layout");
+    nerrors += test_packed_attr(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS packed attribute layout tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
@@ -0,0 +1,259 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests the path cache used for group traversal in the DAOS VOL
+ *          connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_path_cache.h5"
+
+#define PATH_CACHE_NENTS        16
+#define PATH_CACHE_TTL          60.0
+#define DSET_PATH               "/run/step/fields/density"
+#define DSET_MOVED_PATH         "/run/step_moved/fields/density"
+#define NOPENS                  4
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_path_cache(hid_t fapl_id);
+static int check_dset(hid_t loc_id, const char *path, int expected);
+
+/*
+ * Helper function.  Opens the scalar dataset at path and checks that its
+ * value is expected.
+ */
+static int
+check_dset(hid_t loc_id, const char *path, int expected)
+{
+    hid_t dset_id = -1;
+    int val = -1;
+
+    if((dset_id = H5Dopen2(loc_id, path, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &val) < 0)
+        TEST_ERROR
+    if(val != expected) {
+        H5_FAILED() AT()
+        printf("    value read from %s (%d) does not match expected (%d)\n", path, val, expected);
+        goto error;
+    } /* end if */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end check_dset() */
+
+/*
+ * Test function.  Creates a dataset at the end of a deep path, opens it
+ * repeatedly by absolute and relative path, then checks that moving and
+ * deleting and recreating groups in the path invalidates the cache.
+ * Finally reopens the file read only with an entry lifetime.
+ */
+int
+test_path_cache(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t grp_id = -1;
+    hid_t dset_id = -1;
+    hid_t space_id = -1;
+    hid_t lcpl_id = -1;
+    size_t nents = 0;
+    double ttl = -1.0;
+    herr_t status;
+    int val;
+    int i;
+
+    /* Set and check path cache settings */
+    if(H5daos_set_path_cache(fapl_id, PATH_CACHE_NENTS, 0.0) < 0)
+        TEST_ERROR
+    if(H5daos_get_path_cache(fapl_id, &nents, &ttl) < 0)
+        TEST_ERROR
+    if(nents != PATH_CACHE_NENTS || ttl != 0.0) {
+        H5_FAILED() AT()
+        printf("    path cache settings (%zu, %f) do not match expected (%zu, %f)\n", nents, ttl, (size_t)PATH_CACHE_NENTS, 0.0);
+        goto error;
+    } /* end if */
+
+    /* Create file, groups and dataset */
+    if((lcpl_id = H5Pcreate(H5P_LINK_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_create_intermediate_group(lcpl_id, 1) < 0)
+        TEST_ERROR
+    if((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_PATH, H5T_NATIVE_INT, space_id, lcpl_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    val = 1;
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &val) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = -1;
+
+    /* Open the dataset repeatedly, by absolute path and relative to a group */
+    if((grp_id = H5Gopen2(file_id, "/run", H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for(i = 0; i < NOPENS; i++) {
+        if(check_dset(file_id, DSET_PATH, 1))
+            goto error;
+        if(check_dset(grp_id, "step/fields/density", 1))
+            goto error;
+    } /* end for */
+
+    /* Move a group in the path.  The old path must no longer resolve. */
+    if(H5Lmove(file_id, "/run/step", file_id, "/run/step_moved", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        dset_id = H5Dopen2(file_id, DSET_PATH, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(dset_id >= 0) {
+        H5_FAILED() AT()
+        printf("    dataset opened through moved group\n");
+        goto error;
+    } /* end if */
+    if(check_dset(file_id, DSET_MOVED_PATH, 1))
+        goto error;
+
+    /* Delete and recreate a group in the path with a new dataset.  The new
+     * dataset must be opened. */
+    if(H5Ldelete(file_id, "/run/step_moved/fields", H5P_DEFAULT) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_MOVED_PATH, H5T_NATIVE_INT, space_id, lcpl_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    val = 2;
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &val) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    dset_id = -1;
+    if(check_dset(file_id, DSET_MOVED_PATH, 2))
+        goto error;
+    if(check_dset(grp_id, "step_moved/fields/density", 2))
+        goto error;
+
+    /* Close */
+    if(H5Gclose(grp_id) < 0)
+        TEST_ERROR
+    grp_id = -1;
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    file_id = -1;
+
+    /* Reopen file read only with an entry lifetime and open the dataset
+     * repeatedly */
+    if(H5daos_set_path_cache(fapl_id, PATH_CACHE_NENTS, PATH_CACHE_TTL) < 0)
+        TEST_ERROR
+    if((file_id = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+    for(i = 0; i < NOPENS; i++)
+        if(check_dset(file_id, DSET_MOVED_PATH, 2))
+            goto error;
+
+    /* A negative lifetime must be rejected */
+    H5E_BEGIN_TRY {
+        status = H5daos_set_path_cache(fapl_id, PATH_CACHE_NENTS, -1.0);
+    } H5E_END_TRY;
+    if(status >= 0) {
+        H5_FAILED() AT()
+        printf("    negative path cache entry lifetime accepted\n");
+        goto error;
+    } /* end if */
+
+    /* Close */
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(lcpl_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+        H5Gclose(grp_id);
+        H5Fclose(file_id);
+        H5Sclose(space_id);
+        H5Pclose(lcpl_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_path_cache() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("path cache");
+    nerrors += test_path_cache(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS path cache tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
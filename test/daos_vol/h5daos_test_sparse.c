@@ -0,0 +1,209 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests reading sparsely written datasets (fill values in holes and
+ *          unwritten chunks) in the DAOS VOL connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_sparse.h5"
+
+#define DSET_NAME               "sparse_dset"
+#define NELEM                   1000
+#define CHUNK_NELEM             100
+#define WRITE_NELEM             500
+#define WRITE_STRIDE            3
+#define FILL_VALUE              -7
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_sparse(hid_t fapl_id, hbool_t set_fill);
+
+/*
+ * Test function.  Writes every WRITE_STRIDE'th element of the first
+ * WRITE_NELEM elements one at a time, so the written chunks contain many
+ * separate extents and the remaining chunks are never written, then checks
+ * the data read back (all of it and a hyperslab spanning written and
+ * unwritten chunks) with the default (zero) or a user-set fill value.
+ */
+int
+test_sparse(hid_t fapl_id, hbool_t set_fill)
+{
+    hid_t file_id = -1;
+    hid_t dset_id = -1;
+    hid_t dcpl_id = -1;
+    hid_t space_id = -1;
+    hid_t mem_space_id = -1;
+    hsize_t dims[1] = {NELEM};
+    hsize_t chunk_dims[1] = {CHUNK_NELEM};
+    hsize_t start[1];
+    hsize_t count[1] = {1};
+    int fill_value = set_fill ? FILL_VALUE : 0;
+    int exp_buf[NELEM];
+    int rbuf[NELEM];
+    int val;
+    int i;
+
+    /* Initialize expected data */
+    for(i = 0; i < NELEM; i++)
+        exp_buf[i] = (i < WRITE_NELEM && i % WRITE_STRIDE == 0) ? i : fill_value;
+
+    /* Create dataspaces */
+    if((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((mem_space_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR
+
+    /* Create DCPL */
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        TEST_ERROR
+    if(set_fill && H5Pset_fill_value(dcpl_id, H5T_NATIVE_INT, &fill_value) < 0)
+        TEST_ERROR
+
+    /* Create file and dataset */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Write one element at a time */
+    for(i = 0; i < WRITE_NELEM; i += WRITE_STRIDE) {
+        start[0] = (hsize_t)i;
+        if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR
+        val = i;
+        if(H5Dwrite(dset_id, H5T_NATIVE_INT, mem_space_id, space_id, H5P_DEFAULT, &val) < 0)
+            TEST_ERROR
+    } /* end for */
+    if(H5Sclose(mem_space_id) < 0)
+        TEST_ERROR
+    mem_space_id = -1;
+
+    /* Close and reopen dataset */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dopen2(file_id, DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Read all data and verify */
+    memset(rbuf, 0x55, sizeof(rbuf));
+    if(H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for(i = 0; i < NELEM; i++)
+        if(rbuf[i] != exp_buf[i]) {
+            H5_FAILED() AT()
+            printf("    data read (%d) at [%d] does not match expected (%d)\n", rbuf[i], i, exp_buf[i]);
+            goto error;
+        } /* end if */
+
+    /* Read a hyperslab spanning written and unwritten chunks into the same
+     * location in memory and verify */
+    start[0] = WRITE_NELEM - CHUNK_NELEM - 7;
+    count[0] = 2 * CHUNK_NELEM + 11;
+    if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    memset(rbuf, 0x55, sizeof(rbuf));
+    if(H5Dread(dset_id, H5T_NATIVE_INT, space_id, space_id, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    for(i = (int)start[0]; i < (int)(start[0] + count[0]); i++)
+        if(rbuf[i] != exp_buf[i]) {
+            H5_FAILED() AT()
+            printf("    data read (%d) at [%d] does not match expected (%d)\n", rbuf[i], i, exp_buf[i]);
+            goto error;
+        } /* end if */
+
+    /* Close */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+        H5Sclose(mem_space_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_sparse() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("sparse dataset read, zero fill");
+    nerrors += test_sparse(fapl_id, FALSE);
+
+    TESTING("sparse dataset read, fill value");
+    nerrors += test_sparse(fapl_id, TRUE);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS sparse dataset tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
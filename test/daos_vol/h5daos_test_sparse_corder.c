@@ -0,0 +1,451 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests sparse (hole tolerant) link and attribute creation order
+ *          indices in the DAOS VOL connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_sparse_corder.h5"
+
+#define GRP_NAME                "sparse"
+#define NENTRIES                20
+#define NAME_BUF_SIZE           16
+
+/*
+ * Names collected by an iteration
+ */
+typedef struct iter_names_t {
+    char names[NENTRIES][NAME_BUF_SIZE];
+    size_t n;
+} iter_names_t;
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_sparse_corder(hid_t fapl_id);
+static herr_t link_iter_cb(hid_t grp_id, const char *name, const H5L_info2_t *info, void *op_data);
+static herr_t attr_iter_cb(hid_t loc_id, const char *name, const H5A_info_t *info, void *op_data);
+static int check_iter(hid_t grp_id, hbool_t attrs, H5_iter_order_t order, hsize_t start,
+    char (*expected)[NAME_BUF_SIZE], hsize_t n);
+static int check_names(hid_t grp_id, hbool_t attrs, const hbool_t *exists);
+
+/*
+ * Iteration callbacks.  Append the name to the iter_names_t op_data.
+ */
+static herr_t
+link_iter_cb(hid_t grp_id, const char *name, const H5L_info2_t *info, void *op_data)
+{
+    iter_names_t *iter_names = (iter_names_t *)op_data;
+
+    (void)grp_id;
+    (void)info;
+
+    if(iter_names->n >= NENTRIES)
+        return -1;
+    snprintf(iter_names->names[iter_names->n++], NAME_BUF_SIZE, "%s", name);
+
+    return 0;
+} /* end link_iter_cb() */
+
+static herr_t
+attr_iter_cb(hid_t loc_id, const char *name, const H5A_info_t *info, void *op_data)
+{
+    iter_names_t *iter_names = (iter_names_t *)op_data;
+
+    (void)loc_id;
+    (void)info;
+
+    if(iter_names->n >= NENTRIES)
+        return -1;
+    snprintf(iter_names->names[iter_names->n++], NAME_BUF_SIZE, "%s", name);
+
+    return 0;
+} /* end attr_iter_cb() */
+
+/*
+ * Helper function.  Iterates over the links (or attributes) in grp_id's
+ * creation order index in the specified order, starting at index start,
+ * and checks that the names visited are expected[start] to expected[n - 1]
+ * (expected is in iteration order).
+ */
+static int
+check_iter(hid_t grp_id, hbool_t attrs, H5_iter_order_t order, hsize_t start,
+    char (*expected)[NAME_BUF_SIZE], hsize_t n)
+{
+    iter_names_t iter_names;
+    hsize_t idx = start;
+    hsize_t i;
+
+    iter_names.n = 0;
+    if(attrs) {
+        if(H5Aiterate2(grp_id, H5_INDEX_CRT_ORDER, order, &idx, attr_iter_cb, &iter_names) < 0)
+            TEST_ERROR
+    } /* end if */
+    else if(H5Literate2(grp_id, H5_INDEX_CRT_ORDER, order, &idx, link_iter_cb, &iter_names) < 0)
+        TEST_ERROR
+
+    if((hsize_t)iter_names.n != n - start) {
+        H5_FAILED() AT()
+        printf("    iteration from index %llu visited %llu entries, expected %llu\n", (unsigned long long)start,
+                (unsigned long long)iter_names.n, (unsigned long long)(n - start));
+        goto error;
+    } /* end if */
+    for(i = start; i < n; i++)
+        if(strcmp(iter_names.names[i - start], expected[i])) {
+            H5_FAILED() AT()
+            printf("    name at iteration index %llu (%s) does not match expected (%s)\n", (unsigned long long)i,
+                    iter_names.names[i - start], expected[i]);
+            goto error;
+        } /* end if */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_iter() */
+
+/*
+ * Helper function.  Checks that the names of the links (or attributes) in
+ * grp_id's creation order index, in both increasing and decreasing order,
+ * are those of the entries i for which exists[i] is TRUE, in order of i,
+ * and that the index ends there.  Checks the names both by index and by
+ * iterating over the index, from the start and from the middle.
+ */
+static int
+check_names(hid_t grp_id, hbool_t attrs, const hbool_t *exists)
+{
+    char expected[NENTRIES][NAME_BUF_SIZE];
+    char reversed[NENTRIES][NAME_BUF_SIZE];
+    char name[NAME_BUF_SIZE];
+    hsize_t n = 0;
+    hsize_t i;
+    ssize_t ret;
+    int j;
+
+    /* Build list of expected names */
+    for(j = 0; j < NENTRIES; j++)
+        if(exists[j])
+            snprintf(expected[n++], NAME_BUF_SIZE, "%c%02d", attrs ? 'a' : 'g', j);
+
+    for(i = 0; i < n; i++) {
+        /* Increasing order */
+        if(attrs)
+            ret = H5Aget_name_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, i, name, NAME_BUF_SIZE, H5P_DEFAULT);
+        else
+            ret = H5Lget_name_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, i, name, NAME_BUF_SIZE, H5P_DEFAULT);
+        if(ret < 0)
+            TEST_ERROR
+        if(strcmp(name, expected[i])) {
+            H5_FAILED() AT()
+            printf("    name at increasing index %llu (%s) does not match expected (%s)\n", (unsigned long long)i, name, expected[i]);
+            goto error;
+        } /* end if */
+
+        /* Decreasing order */
+        if(attrs)
+            ret = H5Aget_name_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_DEC, i, name, NAME_BUF_SIZE, H5P_DEFAULT);
+        else
+            ret = H5Lget_name_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_DEC, i, name, NAME_BUF_SIZE, H5P_DEFAULT);
+        if(ret < 0)
+            TEST_ERROR
+        if(strcmp(name, expected[n - i - 1])) {
+            H5_FAILED() AT()
+            printf("    name at decreasing index %llu (%s) does not match expected (%s)\n", (unsigned long long)i, name, expected[n - i - 1]);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    /* Iterate in both orders, from the start and from the middle */
+    for(i = 0; i < n; i++)
+        memcpy(reversed[i], expected[n - i - 1], NAME_BUF_SIZE);
+    if(check_iter(grp_id, attrs, H5_ITER_INC, 0, expected, n))
+        goto error;
+    if(check_iter(grp_id, attrs, H5_ITER_DEC, 0, reversed, n))
+        goto error;
+    if(check_iter(grp_id, attrs, H5_ITER_INC, n / 2, expected, n))
+        goto error;
+    if(check_iter(grp_id, attrs, H5_ITER_DEC, n / 2, reversed, n))
+        goto error;
+
+    /* The index must end after the last entry */
+    H5E_BEGIN_TRY {
+        if(attrs)
+            ret = H5Aget_name_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, n, name, NAME_BUF_SIZE, H5P_DEFAULT);
+        else
+            ret = H5Lget_name_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, n, name, NAME_BUF_SIZE, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0) {
+        H5_FAILED() AT()
+        printf("    name retrieved for out of range index %llu\n", (unsigned long long)n);
+        goto error;
+    } /* end if */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_names() */
+
+/*
+ * Test function.  Creates a group with sparse link and attribute creation
+ * order indices, creates links and attributes in it, deletes some of them
+ * by name and by index, and checks the indices in both orders.  Then adds
+ * more entries and checks the indices again after reopening the file.
+ */
+int
+test_sparse_corder(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t grp_id = -1;
+    hid_t sub_id = -1;
+    hid_t attr_id = -1;
+    hid_t space_id = -1;
+    hid_t gcpl_id = -1;
+    hbool_t sparse = FALSE;
+    hbool_t links[NENTRIES];
+    hbool_t attrs[NENTRIES];
+    char name[NAME_BUF_SIZE];
+    herr_t status;
+    int i;
+
+    /* Set up group creation property list */
+    if((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        TEST_ERROR
+    if(H5daos_get_sparse_crt_order_index(gcpl_id, &sparse) < 0)
+        TEST_ERROR
+    if(sparse) {
+        H5_FAILED() AT()
+        printf("    sparse creation order indices enabled by default\n");
+        goto error;
+    } /* end if */
+    if(H5Pset_link_creation_order(gcpl_id, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
+        TEST_ERROR
+    if(H5Pset_attr_creation_order(gcpl_id, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
+        TEST_ERROR
+    if(H5daos_set_sparse_crt_order_index(gcpl_id, TRUE) < 0)
+        TEST_ERROR
+    if(H5daos_get_sparse_crt_order_index(gcpl_id, &sparse) < 0)
+        TEST_ERROR
+    if(!sparse) {
+        H5_FAILED() AT()
+        printf("    sparse creation order index setting not retrieved\n");
+        goto error;
+    } /* end if */
+
+    /* The default property list must be rejected */
+    H5E_BEGIN_TRY {
+        status = H5daos_set_sparse_crt_order_index(H5P_DEFAULT, TRUE);
+    } H5E_END_TRY;
+    if(status >= 0) {
+        H5_FAILED() AT()
+        printf("    sparse creation order index set on default property list\n");
+        goto error;
+    } /* end if */
+
+    /* Create file and group */
+    if((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((grp_id = H5Gcreate2(file_id, GRP_NAME, H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+
+    /* Create the first half of the links and attributes */
+    for(i = 0; i < NENTRIES / 2; i++) {
+        snprintf(name, NAME_BUF_SIZE, "g%02d", i);
+        if((sub_id = H5Gcreate2(grp_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if(H5Gclose(sub_id) < 0)
+            TEST_ERROR
+        sub_id = -1;
+        links[i] = TRUE;
+
+        snprintf(name, NAME_BUF_SIZE, "a%02d", i);
+        if((attr_id = H5Acreate2(grp_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if(H5Aclose(attr_id) < 0)
+            TEST_ERROR
+        attr_id = -1;
+        attrs[i] = TRUE;
+    } /* end for */
+    for(i = NENTRIES / 2; i < NENTRIES; i++)
+        links[i] = attrs[i] = FALSE;
+    if(check_names(grp_id, FALSE, links))
+        goto error;
+    if(check_names(grp_id, TRUE, attrs))
+        goto error;
+
+    /* Delete by name from the middle of the indices */
+    if(H5Ldelete(grp_id, "g03", H5P_DEFAULT) < 0)
+        TEST_ERROR
+    links[3] = FALSE;
+    if(H5Ldelete(grp_id, "g06", H5P_DEFAULT) < 0)
+        TEST_ERROR
+    links[6] = FALSE;
+    if(H5Adelete(grp_id, "a04") < 0)
+        TEST_ERROR
+    attrs[4] = FALSE;
+    if(check_names(grp_id, FALSE, links))
+        goto error;
+    if(check_names(grp_id, TRUE, attrs))
+        goto error;
+
+    /* Delete by index, skipping over the holes: the fourth link in
+     * increasing order (g04), the last link (g09), the second attribute in
+     * decreasing order (a08) and the first attribute (a00) */
+    if(H5Ldelete_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, 3, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    links[4] = FALSE;
+    if(H5Ldelete_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_DEC, 0, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    links[9] = FALSE;
+    if(H5Adelete_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_DEC, 1, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    attrs[8] = FALSE;
+    if(H5Adelete_by_idx(grp_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, 0, H5P_DEFAULT) < 0)
+        TEST_ERROR
+    attrs[0] = FALSE;
+    if(check_names(grp_id, FALSE, links))
+        goto error;
+    if(check_names(grp_id, TRUE, attrs))
+        goto error;
+
+    /* Create the second half of the links and attributes.  They must follow
+     * the remaining entries in the indices. */
+    for(i = NENTRIES / 2; i < NENTRIES; i++) {
+        snprintf(name, NAME_BUF_SIZE, "g%02d", i);
+        if((sub_id = H5Gcreate2(grp_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if(H5Gclose(sub_id) < 0)
+            TEST_ERROR
+        sub_id = -1;
+        links[i] = TRUE;
+
+        snprintf(name, NAME_BUF_SIZE, "a%02d", i);
+        if((attr_id = H5Acreate2(grp_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if(H5Aclose(attr_id) < 0)
+            TEST_ERROR
+        attr_id = -1;
+        attrs[i] = TRUE;
+    } /* end for */
+    if(H5Ldelete(grp_id, "g15", H5P_DEFAULT) < 0)
+        TEST_ERROR
+    links[15] = FALSE;
+    if(H5Adelete(grp_id, "a12") < 0)
+        TEST_ERROR
+    attrs[12] = FALSE;
+    if(check_names(grp_id, FALSE, links))
+        goto error;
+    if(check_names(grp_id, TRUE, attrs))
+        goto error;
+
+    /* Close */
+    if(H5Gclose(grp_id) < 0)
+        TEST_ERROR
+    grp_id = -1;
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    file_id = -1;
+
+    /* Reopen file read only and check indices */
+    if((file_id = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl_id)) < 0)
+        TEST_ERROR
+    if((grp_id = H5Gopen2(file_id, GRP_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(check_names(grp_id, FALSE, links))
+        goto error;
+    if(check_names(grp_id, TRUE, attrs))
+        goto error;
+
+    /* Close */
+    if(H5Gclose(grp_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(gcpl_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(attr_id);
+        H5Gclose(sub_id);
+        H5Gclose(grp_id);
+        H5Fclose(file_id);
+        H5Sclose(space_id);
+        H5Pclose(gcpl_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_sparse_corder() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("sparse creation order indices");
+    nerrors += test_sparse_corder(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS sparse creation order index tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
@@ -0,0 +1,333 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests type converted dataset reads using the type conversion
+ *          thread pool and the type conversion buffer pool in the DAOS VOL
+ *          connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_tconv_pool.h5"
+
+#define DSET_DOUBLE_NAME        "double_dset"
+#define DSET_INT_NAME           "int_dset"
+#define NROWS                   40
+#define NCOLS                   30
+#define CHUNK_NROWS             8
+#define CHUNK_NCOLS             8
+#define NTHREADS                4
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_tconv_pool(hid_t fapl_id);
+int test_tconv_buf_pool(hid_t fapl_id);
+
+/*
+ * Test function.  Writes a double and an int dataset, then reads them back
+ * converted to float and long long (conversions done by the thread pool),
+ * and the double dataset converted to int (done by HDF5), reading all of
+ * each dataset (many chunks) and a hyperslab within a single chunk.
+ */
+int
+test_tconv_pool(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t dset_double_id = -1;
+    hid_t dset_int_id = -1;
+    hid_t dcpl_id = -1;
+    hid_t space_id = -1;
+    hsize_t dims[2] = {NROWS, NCOLS};
+    hsize_t chunk_dims[2] = {CHUNK_NROWS, CHUNK_NCOLS};
+    hsize_t start[2] = {1, 2};
+    hsize_t count[2] = {CHUNK_NROWS - 2, CHUNK_NCOLS - 3};
+    unsigned nthreads = 0;
+    double wbuf_double[NROWS][NCOLS];
+    int wbuf_int[NROWS][NCOLS];
+    float rbuf_float[NROWS][NCOLS];
+    long long rbuf_llong[NROWS][NCOLS];
+    int rbuf_int[NROWS][NCOLS];
+    int i, j;
+
+    /* Set and check number of type conversion threads */
+    if(H5daos_set_tconv_nthreads(fapl_id, NTHREADS) < 0)
+        TEST_ERROR
+    if(H5daos_get_tconv_nthreads(fapl_id, &nthreads) < 0)
+        TEST_ERROR
+    if(nthreads != NTHREADS) {
+        H5_FAILED() AT()
+        printf("    number of threads (%u) does not match expected (%u)\n", nthreads, (unsigned)NTHREADS);
+        goto error;
+    } /* end if */
+
+    /* Initialize write buffers */
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++) {
+            wbuf_double[i][j] = (double)(i * NCOLS + j) + 0.25;
+            wbuf_int[i][j] = (i * NCOLS + j) * ((j % 2) ? -1 : 1);
+        } /* end for */
+
+    /* Create dataspace and DCPL */
+    if((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR
+
+    /* Create file and datasets, and write data */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_double_id = H5Dcreate2(file_id, DSET_DOUBLE_NAME, H5T_NATIVE_DOUBLE, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if((dset_int_id = H5Dcreate2(file_id, DSET_INT_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_double_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf_double) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_int_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf_int) < 0)
+        TEST_ERROR
+
+    /* Read all data with conversion and verify */
+    memset(rbuf_float, 0, sizeof(rbuf_float));
+    if(H5Dread(dset_double_id, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf_float) < 0)
+        TEST_ERROR
+    memset(rbuf_llong, 0, sizeof(rbuf_llong));
+    if(H5Dread(dset_int_id, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf_llong) < 0)
+        TEST_ERROR
+    memset(rbuf_int, 0, sizeof(rbuf_int));
+    if(H5Dread(dset_double_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf_int) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++) {
+            if(rbuf_float[i][j] != (float)wbuf_double[i][j]) {
+                H5_FAILED() AT()
+                printf("    float data read (%f) at [%d][%d] does not match expected (%f)\n", (double)rbuf_float[i][j], i, j, wbuf_double[i][j]);
+                goto error;
+            } /* end if */
+            if(rbuf_llong[i][j] != (long long)wbuf_int[i][j]) {
+                H5_FAILED() AT()
+                printf("    long long data read (%lld) at [%d][%d] does not match expected (%d)\n", rbuf_llong[i][j], i, j, wbuf_int[i][j]);
+                goto error;
+            } /* end if */
+            if(rbuf_int[i][j] != (int)wbuf_double[i][j]) {
+                H5_FAILED() AT()
+                printf("    int data read (%d) at [%d][%d] does not match expected (%d)\n", rbuf_int[i][j], i, j, (int)wbuf_double[i][j]);
+                goto error;
+            } /* end if */
+        } /* end for */
+
+    /* Read a hyperslab within one chunk with conversion and verify */
+    if(H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR
+    memset(rbuf_float, 0, sizeof(rbuf_float));
+    if(H5Dread(dset_double_id, H5T_NATIVE_FLOAT, space_id, space_id, H5P_DEFAULT, rbuf_float) < 0)
+        TEST_ERROR
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++) {
+            float exp_val = ((hsize_t)i >= start[0] && (hsize_t)i < start[0] + count[0]
+                    && (hsize_t)j >= start[1] && (hsize_t)j < start[1] + count[1])
+                    ? (float)wbuf_double[i][j] : 0.0f;
+
+            if(rbuf_float[i][j] != exp_val) {
+                H5_FAILED() AT()
+                printf("    float data read (%f) at [%d][%d] does not match expected (%f)\n", (double)rbuf_float[i][j], i, j, (double)exp_val);
+                goto error;
+            } /* end if */
+        } /* end for */
+
+    /* Close */
+    if(H5Dclose(dset_double_id) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset_int_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_double_id);
+        H5Dclose(dset_int_id);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_tconv_pool() */
+
+/*
+ * Test function.  Reads an int dataset converted to long long twice and
+ * checks that the second read reuses the conversion buffers freed by the
+ * first.
+ */
+int
+test_tconv_buf_pool(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t dset_id = -1;
+    hid_t dcpl_id = -1;
+    hid_t space_id = -1;
+    hsize_t dims[2] = {NROWS, NCOLS};
+    hsize_t chunk_dims[2] = {CHUNK_NROWS, CHUNK_NCOLS};
+    uint64_t nhits = 0, nmisses = 0;
+    uint64_t nhits2 = 0, nmisses2 = 0;
+    int wbuf[NROWS][NCOLS];
+    long long rbuf[NROWS][NCOLS];
+    int i, j, k;
+
+    /* Initialize write buffer */
+    for(i = 0; i < NROWS; i++)
+        for(j = 0; j < NCOLS; j++)
+            wbuf[i][j] = i * NCOLS - j;
+
+    /* Create dataspace and DCPL */
+    if((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 2, chunk_dims) < 0)
+        TEST_ERROR
+
+    /* Create file and dataset, and write data */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_INT_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+
+    /* Read twice with conversion, checking the buffer pool counters after
+     * each read */
+    for(k = 0; k < 2; k++) {
+        memset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dset_id, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        for(i = 0; i < NROWS; i++)
+            for(j = 0; j < NCOLS; j++)
+                if(rbuf[i][j] != (long long)wbuf[i][j]) {
+                    H5_FAILED() AT()
+                    printf("    long long data read (%lld) at [%d][%d] does not match expected (%d)\n", rbuf[i][j], i, j, wbuf[i][j]);
+                    goto error;
+                } /* end if */
+
+        if(k == 0) {
+            if(H5daos_get_tconv_buf_pool_stats(&nhits, &nmisses, NULL) < 0)
+                TEST_ERROR
+        } /* end if */
+        else
+            if(H5daos_get_tconv_buf_pool_stats(&nhits2, &nmisses2, NULL) < 0)
+                TEST_ERROR
+    } /* end for */
+
+    /* The second read should have been served (at least partly) from
+     * buffers cached after the first */
+    if(nhits2 <= nhits) {
+        H5_FAILED() AT()
+        printf("    buffer pool hits did not increase (%llu before, %llu after)\n", (unsigned long long)nhits, (unsigned long long)nhits2);
+        goto error;
+    } /* end if */
+    if(nmisses2 < nmisses) {
+        H5_FAILED() AT()
+        printf("    buffer pool misses decreased (%llu before, %llu after)\n", (unsigned long long)nmisses, (unsigned long long)nmisses2);
+        goto error;
+    } /* end if */
+
+    /* Close */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    } H5E_END_TRY;
+
+    return 1;
+} /* end test_tconv_buf_pool() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("type conversion thread pool");
+    nerrors += test_tconv_pool(fapl_id);
+
+    TESTING("type conversion buffer pool");
+    nerrors += test_tconv_buf_pool(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS type conversion thread pool tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
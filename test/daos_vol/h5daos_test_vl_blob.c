@@ -0,0 +1,365 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of the HDF5 DAOS VOL connector. The full copyright      *
+ * notice, including terms governing use, modification, and redistribution,  *
+ * is contained in the COPYING file, which can be found at the root of the   *
+ * source code distribution tree.                                            *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: Tests writing and reading variable length data, which is stored
+ *          in blobs (or inline in blob IDs), in the DAOS VOL connector
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <hdf5.h>
+
+#include "daos_vol_public.h"
+#include "h5daos_test.h"
+
+/*
+ * Definitions
+ */
+#define TRUE                    1
+#define FALSE                   0
+
+#define FILENAME                "h5daos_test_vl_blob.h5"
+
+#define DSET_NAME               "vl_str_dset"
+#define SEQ_DSET_NAME           "vl_seq_dset"
+#define ATTR_NAME               "vl_str_attr"
+#define DSET_NELMTS             1000
+#define CHUNK_NELMTS            300
+#define ATTR_NELMTS             10
+#define STR_MAX_LEN             64
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int test_vl_blob(hid_t fapl_id);
+int test_vl_seq(hid_t fapl_id);
+
+/*
+ * Test function.  Writes a chunked dataset of variable length strings, with
+ * more strings per chunk than are written in one blob batch, and an
+ * attribute of variable length strings, then reads both back and verifies
+ * them, including after closing and reopening the file.
+ */
+int
+test_vl_blob(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t dset_id = -1;
+    hid_t attr_id = -1;
+    hid_t type_id = -1;
+    hid_t dset_space_id = -1;
+    hid_t attr_space_id = -1;
+    hid_t dcpl_id = -1;
+    hsize_t dset_dims[1] = {DSET_NELMTS};
+    hsize_t attr_dims[1] = {ATTR_NELMTS};
+    hsize_t chunk_dims[1] = {CHUNK_NELMTS};
+    char *str_buf = NULL;
+    char *wbuf[DSET_NELMTS];
+    char *rbuf[DSET_NELMTS];
+    hbool_t rbuf_valid = FALSE;
+    int i, k;
+
+    /* Initialize write buffer.  Lengths vary, and include empty strings. */
+    if(NULL == (str_buf = (char *)malloc(DSET_NELMTS * STR_MAX_LEN)))
+        TEST_ERROR
+    for(i = 0; i < DSET_NELMTS; i++) {
+        wbuf[i] = str_buf + i * STR_MAX_LEN;
+        if(i % 7 == 0)
+            wbuf[i][0] = '\0';
+        else
+            snprintf(wbuf[i], STR_MAX_LEN, "string %d %.*s", i, i % (STR_MAX_LEN - 20),
+                    "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz");
+    } /* end for */
+
+    /* Create type, dataspaces and DCPL */
+    if((type_id = H5Tcopy(H5T_C_S1)) < 0)
+        TEST_ERROR
+    if(H5Tset_size(type_id, H5T_VARIABLE) < 0)
+        TEST_ERROR
+    if((dset_space_id = H5Screate_simple(1, dset_dims, NULL)) < 0)
+        TEST_ERROR
+    if((attr_space_id = H5Screate_simple(1, attr_dims, NULL)) < 0)
+        TEST_ERROR
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        TEST_ERROR
+
+    /* Create file, dataset and attribute, and write data */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, DSET_NAME, type_id, dset_space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    if((attr_id = H5Acreate2(dset_id, ATTR_NAME, type_id, attr_space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Awrite(attr_id, type_id, wbuf) < 0)
+        TEST_ERROR
+
+    /* Read back and verify, then close and reopen the file and do it again */
+    for(k = 0; k < 2; k++) {
+        if(k == 1) {
+            if(H5Aclose(attr_id) < 0)
+                TEST_ERROR
+            attr_id = -1;
+            if(H5Dclose(dset_id) < 0)
+                TEST_ERROR
+            dset_id = -1;
+            if(H5Fclose(file_id) < 0)
+                TEST_ERROR
+            file_id = -1;
+            if((file_id = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl_id)) < 0)
+                TEST_ERROR
+            if((dset_id = H5Dopen2(file_id, DSET_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR
+            if((attr_id = H5Aopen(dset_id, ATTR_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR
+        } /* end if */
+
+        memset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dset_id, type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        rbuf_valid = TRUE;
+        for(i = 0; i < DSET_NELMTS; i++)
+            if(!rbuf[i] || strcmp(rbuf[i], wbuf[i])) {
+                H5_FAILED() AT()
+                printf("    dataset string read (%s) at [%d] does not match expected (%s)\n", rbuf[i] ? rbuf[i] : "NULL", i, wbuf[i]);
+                goto error;
+            } /* end if */
+        if(H5Dvlen_reclaim(type_id, dset_space_id, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        rbuf_valid = FALSE;
+
+        memset(rbuf, 0, sizeof(rbuf));
+        if(H5Aread(attr_id, type_id, rbuf) < 0)
+            TEST_ERROR
+        rbuf_valid = TRUE;
+        for(i = 0; i < ATTR_NELMTS; i++)
+            if(!rbuf[i] || strcmp(rbuf[i], wbuf[i])) {
+                H5_FAILED() AT()
+                printf("    attribute string read (%s) at [%d] does not match expected (%s)\n", rbuf[i] ? rbuf[i] : "NULL", i, wbuf[i]);
+                goto error;
+            } /* end if */
+        if(H5Dvlen_reclaim(type_id, attr_space_id, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR
+        rbuf_valid = FALSE;
+    } /* end for */
+
+    /* Close */
+    if(H5Aclose(attr_id) < 0)
+        TEST_ERROR
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(dset_space_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(attr_space_id) < 0)
+        TEST_ERROR
+    if(H5Tclose(type_id) < 0)
+        TEST_ERROR
+    free(str_buf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(rbuf_valid)
+            H5Dvlen_reclaim(type_id, dset_space_id, H5P_DEFAULT, rbuf);
+        H5Aclose(attr_id);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(dset_space_id);
+        H5Sclose(attr_space_id);
+        H5Tclose(type_id);
+    } H5E_END_TRY;
+    free(str_buf);
+
+    return 1;
+} /* end test_vl_blob() */
+
+/*
+ * Test function.  Writes a chunked dataset of variable length sequences of
+ * ints, including empty sequences, then reads it back converted to
+ * sequences of long longs and verifies it.
+ */
+int
+test_vl_seq(hid_t fapl_id)
+{
+    hid_t file_id = -1;
+    hid_t dset_id = -1;
+    hid_t file_type_id = -1;
+    hid_t mem_type_id = -1;
+    hid_t space_id = -1;
+    hid_t dcpl_id = -1;
+    hsize_t dims[1] = {DSET_NELMTS};
+    hsize_t chunk_dims[1] = {CHUNK_NELMTS};
+    int *int_buf = NULL;
+    hvl_t wbuf[DSET_NELMTS];
+    hvl_t rbuf[DSET_NELMTS];
+    hbool_t rbuf_valid = FALSE;
+    size_t nints = 0;
+    size_t i, j;
+
+    /* Initialize write buffer.  Sequence i has i % 13 elements. */
+    for(i = 0; i < DSET_NELMTS; i++)
+        nints += i % 13;
+    if(NULL == (int_buf = (int *)malloc(nints * sizeof(int))))
+        TEST_ERROR
+    nints = 0;
+    for(i = 0; i < DSET_NELMTS; i++) {
+        wbuf[i].len = i % 13;
+        wbuf[i].p = int_buf + nints;
+        for(j = 0; j < wbuf[i].len; j++)
+            int_buf[nints++] = (int)(i * 100 + j);
+    } /* end for */
+
+    /* Create types, dataspace and DCPL */
+    if((file_type_id = H5Tvlen_create(H5T_NATIVE_INT)) < 0)
+        TEST_ERROR
+    if((mem_type_id = H5Tvlen_create(H5T_NATIVE_LLONG)) < 0)
+        TEST_ERROR
+    if((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR
+    if((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR
+    if(H5Pset_chunk(dcpl_id, 1, chunk_dims) < 0)
+        TEST_ERROR
+
+    /* Create file and dataset, and write data */
+    if((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0)
+        TEST_ERROR
+    if((dset_id = H5Dcreate2(file_id, SEQ_DSET_NAME, file_type_id, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    if(H5Dwrite(dset_id, file_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+
+    /* Read back with conversion and verify */
+    memset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dset_id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    rbuf_valid = TRUE;
+    for(i = 0; i < DSET_NELMTS; i++) {
+        if(rbuf[i].len != wbuf[i].len) {
+            H5_FAILED() AT()
+            printf("    sequence length read (%zu) at [%zu] does not match expected (%zu)\n", rbuf[i].len, i, wbuf[i].len);
+            goto error;
+        } /* end if */
+        for(j = 0; j < rbuf[i].len; j++)
+            if(((long long *)rbuf[i].p)[j] != (long long)((int *)wbuf[i].p)[j]) {
+                H5_FAILED() AT()
+                printf("    sequence data read (%lld) at [%zu][%zu] does not match expected (%d)\n", ((long long *)rbuf[i].p)[j], i, j, ((int *)wbuf[i].p)[j]);
+                goto error;
+            } /* end if */
+    } /* end for */
+    if(H5Dvlen_reclaim(mem_type_id, space_id, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    rbuf_valid = FALSE;
+
+    /* Close */
+    if(H5Dclose(dset_id) < 0)
+        TEST_ERROR
+    if(H5Fclose(file_id) < 0)
+        TEST_ERROR
+    if(H5Pclose(dcpl_id) < 0)
+        TEST_ERROR
+    if(H5Sclose(space_id) < 0)
+        TEST_ERROR
+    if(H5Tclose(file_type_id) < 0)
+        TEST_ERROR
+    if(H5Tclose(mem_type_id) < 0)
+        TEST_ERROR
+    free(int_buf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(rbuf_valid)
+            H5Dvlen_reclaim(mem_type_id, space_id, H5P_DEFAULT, rbuf);
+        H5Dclose(dset_id);
+        H5Fclose(file_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+        H5Tclose(file_type_id);
+        H5Tclose(mem_type_id);
+    } H5E_END_TRY;
+    free(int_buf);
+
+    return 1;
+} /* end test_vl_seq() */
+
+/*
+ * main function
+ */
+int
+main( int argc, char** argv )
+{
+    hid_t   fapl_id = -1;
+    int     nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("variable length string dataset and attribute");
+    nerrors += test_vl_blob(fapl_id);
+
+    TESTING("variable length sequence dataset with conversion");
+    nerrors += test_vl_seq(fapl_id);
+
+    /* Repeat with short values stored inline */
+    if(H5daos_set_inline_vl(fapl_id, TRUE) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    TESTING("inline variable length string dataset and attribute");
+    nerrors += test_vl_blob(fapl_id);
+
+    TESTING("inline variable length sequence dataset with conversion");
+    nerrors += test_vl_seq(fapl_id);
+
+    if(H5Pclose(fapl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors) goto error;
+
+    if (MAINPROCESS) puts("All DAOS variable length blob tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS) printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */